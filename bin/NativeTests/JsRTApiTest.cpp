@@ -67,6 +67,7 @@ namespace JsRTApiTest
         WithSetup(JsRuntimeAttributeEnableIdleProcessing, handler);
         WithSetup(JsRuntimeAttributeDisableNativeCodeGeneration, handler);
         WithSetup(JsRuntimeAttributeDisableEval, handler);
+        WithSetup(JsRuntimeAttributeShareJitThreadPool, handler);
         WithSetup((JsRuntimeAttributes)(JsRuntimeAttributeDisableBackgroundWork | JsRuntimeAttributeAllowScriptInterrupt | JsRuntimeAttributeEnableIdleProcessing), handler);
     }
 
@@ -1932,4 +1933,1194 @@ namespace JsRTApiTest
         JsRTApiTest::WithSetup(JsRuntimeAttributeEnableExperimentalFeatures, ReentrantNoErrorParseModuleTest);
     }
 
+    void CHAKRA_CALLBACK GCPauseTargetBeforeCollectCallback(void *callbackState)
+    {
+        // Stretch the pause well past the GetTickCount granularity so that it is measured as a miss
+        (*static_cast<unsigned int *>(callbackState))++;
+        Sleep(50);
+    }
+
+    void GCPauseTargetTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        unsigned int missCount = (unsigned int)-1;
+        unsigned int previousMissCount = 0;
+        unsigned int collectCount = 0;
+        CHECK(JsSetRuntimeGCPauseTarget(JS_INVALID_RUNTIME_HANDLE, 5) == JsErrorInvalidArgument);
+        CHECK(JsGetRuntimeGCPauseTargetMissCount(JS_INVALID_RUNTIME_HANDLE, &missCount) == JsErrorInvalidArgument);
+        CHECK(JsGetRuntimeGCPauseTargetMissCount(runtime, nullptr) == JsErrorNullArgument);
+
+        REQUIRE(JsSetRuntimeBeforeCollectCallback(runtime, &collectCount, GCPauseTargetBeforeCollectCallback) == JsNoError);
+
+        // Without a pause target, no pause is counted as a miss
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        REQUIRE(JsGetRuntimeGCPauseTargetMissCount(runtime, &missCount) == JsNoError);
+        CHECK(collectCount > 0);
+        CHECK(missCount == 0);
+
+        // Every pause stretched by the callback overruns a 1ms target
+        REQUIRE(JsSetRuntimeGCPauseTarget(runtime, 1) == JsNoError);
+        collectCount = 0;
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        REQUIRE(JsGetRuntimeGCPauseTargetMissCount(runtime, &missCount) == JsNoError);
+        CHECK(collectCount > 0);
+        CHECK(missCount >= collectCount);
+
+        // A generous target is not missed
+        previousMissCount = missCount;
+        REQUIRE(JsSetRuntimeGCPauseTarget(runtime, 60000) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        REQUIRE(JsGetRuntimeGCPauseTargetMissCount(runtime, &missCount) == JsNoError);
+        CHECK(missCount == previousMissCount);
+
+        // Clearing the target stops counting
+        REQUIRE(JsSetRuntimeGCPauseTarget(runtime, 0) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        REQUIRE(JsGetRuntimeGCPauseTargetMissCount(runtime, &missCount) == JsNoError);
+        CHECK(missCount == previousMissCount);
+
+        REQUIRE(JsSetRuntimeBeforeCollectCallback(runtime, nullptr, nullptr) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_GCPauseTargetTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::GCPauseTargetTest);
+    }
+
+    struct HeapSnapshotCounts
+    {
+        size_t objectCount;
+        size_t edgeCount;
+        size_t totalSize;
+        bool validRecords;
+    };
+
+    void CHAKRA_CALLBACK HeapSnapshotCallback(const JsHeapSnapshotRecord *records, unsigned int recordCount, void *callbackState)
+    {
+        HeapSnapshotCounts * counts = (HeapSnapshotCounts *)callbackState;
+        for (unsigned int i = 0; i < recordCount; i++)
+        {
+            if (records[i].kind == JsHeapSnapshotRecordObject)
+            {
+                counts->objectCount++;
+                counts->totalSize += records[i].size;
+                counts->validRecords = counts->validRecords && records[i].address != nullptr && records[i].size != 0;
+            }
+            else
+            {
+                counts->edgeCount++;
+                counts->validRecords = counts->validRecords && records[i].kind == JsHeapSnapshotRecordEdge && records[i].target != nullptr;
+            }
+        }
+    }
+
+    void HeapSnapshotTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        HeapSnapshotCounts counts = {};
+        CHECK(JsStreamHeapSnapshot(runtime, nullptr, nullptr) == JsErrorNullArgument);
+        CHECK(JsStreamHeapSnapshot(JS_INVALID_RUNTIME_HANDLE, HeapSnapshotCallback, &counts) == JsErrorInvalidArgument);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var a = []; for (var i = 0; i < 1000; i++) { a.push({ x: i }); }"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        counts.validRecords = true;
+        REQUIRE(JsStreamHeapSnapshot(runtime, HeapSnapshotCallback, &counts) == JsNoError);
+        CHECK(counts.validRecords);
+        CHECK(counts.objectCount >= 1000);
+        CHECK(counts.edgeCount >= 1000);
+        CHECK(counts.totalSize > 0);
+    }
+
+    TEST_CASE("ApiTest_HeapSnapshotTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::HeapSnapshotTest);
+    }
+
+    void CHAKRA_CALLBACK AllocationSiteCallback(const JsAllocationSite *site, void *callbackState)
+    {
+        size_t * sampleCount = (size_t *)callbackState;
+        *sampleCount += site->sampleCount;
+    }
+
+    void AllocationSamplingTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        size_t sampleCount = 0;
+        CHECK(JsStartAllocationSampling(runtime, 0) == JsErrorInvalidArgument);
+        CHECK(JsGetAllocationSites(runtime, nullptr, nullptr) == JsErrorNullArgument);
+
+        // No sites are reported before sampling is started
+        REQUIRE(JsGetAllocationSites(runtime, AllocationSiteCallback, &sampleCount) == JsNoError);
+        CHECK(sampleCount == 0);
+
+        REQUIRE(JsStartAllocationSampling(runtime, 1024) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var a = []; for (var i = 0; i < 10000; i++) { a.push({ x: i, y: [i] }); }"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        REQUIRE(JsStopAllocationSampling(runtime) == JsNoError);
+        REQUIRE(JsGetAllocationSites(runtime, AllocationSiteCallback, &sampleCount) == JsNoError);
+        CHECK(sampleCount > 0);
+
+        // Stopping keeps the recorded sites, and no more samples are taken
+        size_t stoppedSampleCount = 0;
+        REQUIRE(JsRunScript(_u("var b = []; for (var i = 0; i < 10000; i++) { b.push({ x: i }); }"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsGetAllocationSites(runtime, AllocationSiteCallback, &stoppedSampleCount) == JsNoError);
+        CHECK(stoppedSampleCount == sampleCount);
+    }
+
+    TEST_CASE("ApiTest_AllocationSamplingTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::AllocationSamplingTest);
+    }
+
+    struct JitCompileCounts
+    {
+        volatile LONG compileCount;
+        volatile bool validStatistics;
+    };
+
+    void CHAKRA_CALLBACK JitCompileCallback(const JsJitCompileStatistics *statistics, void *callbackState)
+    {
+        // May run on a background JIT thread
+        JitCompileCounts * counts = (JitCompileCounts *)callbackState;
+        if (statistics->codeSize == 0)
+        {
+            counts->validStatistics = false;
+        }
+        InterlockedIncrement(&counts->compileCount);
+    }
+
+    void JitCompileCallbackTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JitCompileCounts counts = { 0, true };
+        REQUIRE(JsSetRuntimeJitCompileCallback(runtime, &counts, JitCompileCallback) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("function f(x) { return x + 1; } var s = 0; for (var i = 0; i < 100000; i++) { s = f(s); }"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        // A background JIT may still be working on f; keep it hot until something has been reported
+        bool jitEnabled = !(attributes & JsRuntimeAttributeDisableNativeCodeGeneration);
+        for (int i = 0; jitEnabled && counts.compileCount == 0 && i < 100; i++)
+        {
+            Sleep(10);
+            REQUIRE(JsRunScript(_u("for (var i = 0; i < 1000; i++) { s = f(s); }"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        }
+
+        // Once this returns no delivery is in flight, so the counts are stable and the state may go out of scope
+        REQUIRE(JsSetRuntimeJitCompileCallback(runtime, nullptr, nullptr) == JsNoError);
+        CHECK(counts.validStatistics);
+        if (jitEnabled)
+        {
+            CHECK(counts.compileCount > 0);
+        }
+        else
+        {
+            CHECK(counts.compileCount == 0);
+        }
+    }
+
+    TEST_CASE("ApiTest_JitCompileCallbackTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JitCompileCallbackTest);
+    }
+
+    void PromiseTaskQueueTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef callback = JS_INVALID_REFERENCE;
+        REQUIRE(JsSetPromiseContinuationCallback(PromiseContinuationCallback, &callback) == JsNoError);
+        REQUIRE(JsSetPromiseTaskQueueEnabled(true) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(
+            _u("var log = [];") \
+            _u("Promise.resolve(1).then(function (v) { log.push(v); return 2; }).then(function (v) { log.push(v); });") \
+            _u("Promise.resolve(3).then(function (v) { log.push(v); });"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        // The jobs were queued in the engine instead of being passed to the host
+        CHECK(callback == JS_INVALID_REFERENCE);
+
+        unsigned int taskCount = 0;
+        REQUIRE(JsRunPromiseTasks(&taskCount) == JsNoError);
+        CHECK(taskCount == 3);
+        REQUIRE(JsRunScript(_u("log.join()"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        JsValueRef expected = JS_INVALID_REFERENCE;
+        REQUIRE(JsPointerToString(_u("1,3,2"), wcslen(_u("1,3,2")), &expected) == JsNoError);
+        bool equals = false;
+        REQUIRE(JsStrictEquals(result, expected, &equals) == JsNoError);
+        CHECK(equals);
+
+        // Nothing is left to run
+        REQUIRE(JsRunPromiseTasks(&taskCount) == JsNoError);
+        CHECK(taskCount == 0);
+
+        // A throwing handler rejects its derived promise; the jobs queued after it still run, as does the rejection handler
+        REQUIRE(JsRunScript(
+            _u("Promise.resolve().then(function () { throw new Error('stop'); }).catch(function () { log.push(5); });") \
+            _u("Promise.resolve().then(function () { log.push(4); });"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsRunPromiseTasks(&taskCount) == JsNoError);
+        CHECK(taskCount == 3);
+        REQUIRE(JsRunScript(_u("log.join()"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsPointerToString(_u("1,3,2,4,5"), wcslen(_u("1,3,2,4,5")), &expected) == JsNoError);
+        REQUIRE(JsStrictEquals(result, expected, &equals) == JsNoError);
+        CHECK(equals);
+
+        // Disabling the queue hands new jobs to the host again
+        REQUIRE(JsSetPromiseTaskQueueEnabled(false) == JsNoError);
+        REQUIRE(JsRunScript(_u("Promise.resolve().then(function () { });"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        CHECK(callback != JS_INVALID_REFERENCE);
+    }
+
+    TEST_CASE("ApiTest_PromiseTaskQueueTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::PromiseTaskQueueTest);
+    }
+
+    void CALLBACK ArrayBufferContentsFinalizeCallback(void *data)
+    {
+        (*static_cast<int*>(data))++;
+    }
+
+    void ArrayBufferTransferTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef arrayBuffer = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var ab = new ArrayBuffer(16); var view = new Uint8Array(ab); view[3] = 42; ab"), JS_SOURCE_CONTEXT_NONE, _u(""), &arrayBuffer) == JsNoError);
+
+        BYTE *buffer = nullptr;
+        unsigned int bufferLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(arrayBuffer, &buffer, &bufferLength) == JsNoError);
+        BYTE *originalBuffer = buffer;
+
+        JsArrayBufferContents contents = nullptr;
+        REQUIRE(JsDetachArrayBuffer(arrayBuffer, &contents) == JsNoError);
+        CHECK(contents != nullptr);
+
+        // The source and its views are empty now, and can't be detached again
+        JsValueRef result = JS_INVALID_REFERENCE;
+        int length = -1;
+        REQUIRE(JsRunScript(_u("ab.byteLength + view.length"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &length) == JsNoError);
+        CHECK(length == 0);
+        JsArrayBufferContents again = nullptr;
+        CHECK(JsDetachArrayBuffer(arrayBuffer, &again) == JsErrorInvalidArgument);
+
+        // Attach the same memory in another runtime
+        JsRuntimeHandle second = JS_INVALID_RUNTIME_HANDLE;
+        JsContextRef secondContext = JS_INVALID_REFERENCE, current = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateRuntime(attributes, nullptr, &second) == JsNoError);
+        REQUIRE(JsCreateContext(second, &secondContext) == JsNoError);
+        REQUIRE(JsGetCurrentContext(&current) == JsNoError);
+        REQUIRE(JsSetCurrentContext(secondContext) == JsNoError);
+
+        JsValueRef attached = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateArrayBufferFromContents(contents, &attached) == JsNoError);
+        REQUIRE(JsGetArrayBufferStorage(attached, &buffer, &bufferLength) == JsNoError);
+        CHECK(buffer == originalBuffer);
+        CHECK(bufferLength == 16);
+        CHECK(buffer[3] == 42);
+
+        // External buffers keep their finalizer through the transfer
+        static BYTE externalData[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+        int finalizeCount = 0;
+        JsValueRef external = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateExternalArrayBuffer(externalData, sizeof(externalData), ArrayBufferContentsFinalizeCallback, &finalizeCount, &external) == JsNoError);
+        REQUIRE(JsDetachArrayBuffer(external, &contents) == JsNoError);
+        CHECK(finalizeCount == 0);
+        REQUIRE(JsReleaseArrayBufferContents(contents) == JsNoError);
+        CHECK(finalizeCount == 1);
+
+        // Only array buffers themselves can be detached
+        JsValueRef typedArray = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateTypedArray(JsArrayTypeInt8, JS_INVALID_REFERENCE, 0, 4, &typedArray) == JsNoError);
+        CHECK(JsDetachArrayBuffer(typedArray, &contents) == JsErrorInvalidArgument);
+
+        REQUIRE(JsSetCurrentContext(current) == JsNoError);
+        REQUIRE(JsDisposeRuntime(second) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_ArrayBufferTransferTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ArrayBufferTransferTest);
+    }
+
+    void BatchedPropertiesTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsPropertyIdRef propertyIds[3] = { JS_INVALID_REFERENCE, JS_INVALID_REFERENCE, JS_INVALID_REFERENCE };
+        REQUIRE(JsGetPropertyIdFromName(_u("x"), &propertyIds[0]) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("y"), &propertyIds[1]) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("z"), &propertyIds[2]) == JsNoError);
+
+        JsValueRef values[3] = { JS_INVALID_REFERENCE, JS_INVALID_REFERENCE, JS_INVALID_REFERENCE };
+        for (int i = 0; i < 3; i++)
+        {
+            REQUIRE(JsIntToNumber(i + 1, &values[i]) == JsNoError);
+        }
+
+        JsValueRef object = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateObjectWithProperties(propertyIds, values, 3, &object) == JsNoError);
+
+        JsValueRef results[3] = { JS_INVALID_REFERENCE, JS_INVALID_REFERENCE, JS_INVALID_REFERENCE };
+        REQUIRE(JsGetProperties(object, propertyIds, 3, results) == JsNoError);
+        for (int i = 0; i < 3; i++)
+        {
+            int value = 0;
+            REQUIRE(JsNumberToInt(results[i], &value) == JsNoError);
+            CHECK(value == i + 1);
+        }
+
+        // Overwrite the properties in reverse order
+        JsValueRef reversed[3] = { values[2], values[1], values[0] };
+        REQUIRE(JsSetProperties(object, propertyIds, reversed, 3, true) == JsNoError);
+        REQUIRE(JsGetProperties(object, propertyIds, 3, results) == JsNoError);
+        for (int i = 0; i < 3; i++)
+        {
+            int value = 0;
+            REQUIRE(JsNumberToInt(results[i], &value) == JsNoError);
+            CHECK(value == 3 - i);
+        }
+
+        // Nothing is set when one of the property IDs is invalid
+        JsPropertyIdRef badIds[2] = { propertyIds[0], JS_INVALID_REFERENCE };
+        CHECK(JsSetProperties(object, badIds, values, 2, true) == JsErrorInvalidArgument);
+        REQUIRE(JsGetProperties(object, propertyIds, 1, results) == JsNoError);
+        int x = 0;
+        REQUIRE(JsNumberToInt(results[0], &x) == JsNoError);
+        CHECK(x == 3);
+
+        // The arrays can be null when there are no properties
+        JsValueRef empty = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateObjectWithProperties(nullptr, nullptr, 0, &empty) == JsNoError);
+        JsValueType type = JsUndefined;
+        REQUIRE(JsGetValueType(empty, &type) == JsNoError);
+        CHECK(type == JsObject);
+        CHECK(JsGetProperties(empty, nullptr, 0, nullptr) == JsNoError);
+        CHECK(JsSetProperties(empty, nullptr, nullptr, 0, true) == JsNoError);
+        CHECK(JsGetProperties(empty, nullptr, 1, results) == JsErrorNullArgument);
+    }
+
+    TEST_CASE("ApiTest_BatchedPropertiesTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::BatchedPropertiesTest);
+    }
+
+    void ObjectTemplateTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsPropertyIdRef propertyIds[2] = { JS_INVALID_REFERENCE, JS_INVALID_REFERENCE };
+        REQUIRE(JsGetPropertyIdFromName(_u("first"), &propertyIds[0]) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("second"), &propertyIds[1]) == JsNoError);
+
+        JsObjectTemplate objectTemplate = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateObjectTemplate(propertyIds, 2, &objectTemplate) == JsNoError);
+        REQUIRE(JsAddRef(objectTemplate, nullptr) == JsNoError);
+
+        JsValueRef global = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        JsPropertyIdRef arrayId = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetPropertyIdFromName(_u("fromTemplate"), &arrayId) == JsNoError);
+        JsValueRef array = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateArray(0, &array) == JsNoError);
+        REQUIRE(JsSetProperty(global, arrayId, array, true) == JsNoError);
+
+        for (int i = 0; i < 10; i++)
+        {
+            JsValueRef values[2] = { JS_INVALID_REFERENCE, JS_INVALID_REFERENCE };
+            REQUIRE(JsIntToNumber(i, &values[0]) == JsNoError);
+            REQUIRE(JsIntToNumber(i * 2, &values[1]) == JsNoError);
+
+            JsValueRef object = JS_INVALID_REFERENCE, index = JS_INVALID_REFERENCE;
+            REQUIRE(JsCreateObjectFromTemplate(objectTemplate, values, 2, &object) == JsNoError);
+            REQUIRE(JsIntToNumber(i, &index) == JsNoError);
+            REQUIRE(JsSetIndexedProperty(array, index, object) == JsNoError);
+        }
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        bool matches = false;
+        REQUIRE(JsRunScript(
+            _u("fromTemplate.every(function (o, i) { return Object.keys(o).join() === 'first,second' && o.first === i && o.second === i * 2; })"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &matches) == JsNoError);
+        CHECK(matches);
+
+        // The number of values has to match the template
+        JsValueRef object = JS_INVALID_REFERENCE;
+        CHECK(JsCreateObjectFromTemplate(objectTemplate, &result, 1, &object) == JsErrorInvalidArgument);
+
+        // Other handles are not taken for a template
+        JsValueRef values[2] = { result, result };
+        JsValueRef plainObject = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateObject(&plainObject) == JsNoError);
+        CHECK(JsCreateObjectFromTemplate(plainObject, values, 2, &object) == JsErrorInvalidArgument);
+        CHECK(object == JS_INVALID_REFERENCE);
+        CHECK(JsCreateObjectFromTemplate(array, values, 2, &object) == JsErrorInvalidArgument);
+        CHECK(JsCreateObjectFromTemplate(propertyIds[0], values, 2, &object) == JsErrorInvalidArgument);
+
+        // Duplicate or missing property IDs are rejected
+        JsObjectTemplate badTemplate = JS_INVALID_REFERENCE;
+        JsPropertyIdRef duplicateIds[2] = { propertyIds[0], propertyIds[0] };
+        CHECK(JsCreateObjectTemplate(duplicateIds, 2, &badTemplate) == JsErrorInvalidArgument);
+        CHECK(JsCreateObjectTemplate(propertyIds, 0, &badTemplate) == JsErrorInvalidArgument);
+
+        REQUIRE(JsRelease(objectTemplate, nullptr) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_ObjectTemplateTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ObjectTemplateTest);
+    }
+
+    void ExternalStringTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        static const uint16_t content[] = { 'h', 'o', 's', 't', 0 };
+
+        JsValueRef string = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateExternalStringUtf16(content, 4, nullptr, nullptr, &string) == JsNoError);
+
+        JsValueType type = JsUndefined;
+        REQUIRE(JsGetValueType(string, &type) == JsNoError);
+        CHECK(type == JsString);
+
+        LPCWSTR stringPtr = nullptr;
+        size_t length = 0;
+        REQUIRE(JsStringToPointer(string, &stringPtr, &length) == JsNoError);
+        CHECK(length == 4);
+        CHECK((const void *)stringPtr == (const void *)content);
+
+        JsValueRef global = JS_INVALID_REFERENCE, result = JS_INVALID_REFERENCE;
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        bool matches = false;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("externalString"), &propertyId) == JsNoError);
+        REQUIRE(JsSetProperty(global, propertyId, string, true) == JsNoError);
+        REQUIRE(JsRunScript(_u("externalString + '!' === 'host!'"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &matches) == JsNoError);
+        CHECK(matches);
+
+        // The buffer has to be null terminated
+        CHECK(JsCreateExternalStringUtf16(content, 3, nullptr, nullptr, &string) == JsErrorInvalidArgument);
+
+        // Lengths no string can have are rejected before the terminator is read
+        CHECK(JsCreateExternalStringUtf16(content, 0x80000000, nullptr, nullptr, &string) == JsErrorInvalidArgument);
+        CHECK(JsCreateExternalStringUtf16(content, static_cast<size_t>(-1), nullptr, nullptr, &string) == JsErrorInvalidArgument);
+        CHECK(string == JS_INVALID_REFERENCE);
+    }
+
+    TEST_CASE("ApiTest_ExternalStringTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ExternalStringTest);
+    }
+
+    static bool externalSubStringFinalized = false;
+
+    static void CALLBACK ExternalSubStringFinalizeCallback(void *data)
+    {
+        // Poison the host buffer so any read through a dangling substring is caught
+        uint16_t *buffer = (uint16_t *)data;
+        for (size_t i = 0; buffer[i] != 0; i++)
+        {
+            buffer[i] = 'X';
+        }
+        externalSubStringFinalized = true;
+    }
+
+    void ExternalSubStringTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        static const uint16_t source[] = { 'e', 'x', 't', 'e', 'r', 'n', 'a', 'l', '-', 'h', 'o', 's', 't', '-', 'b', 'u', 'f', 'f', 'e', 'r', 0 };
+        // Outlives the runtime; refreshed because the previous run's finalizer poisoned it
+        static uint16_t content[_countof(source)];
+        memcpy(content, source, sizeof(source));
+        externalSubStringFinalized = false;
+
+        JsValueRef global = JS_INVALID_REFERENCE, result = JS_INVALID_REFERENCE;
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("externalString"), &propertyId) == JsNoError);
+
+        {
+            JsValueRef string = JS_INVALID_REFERENCE;
+            REQUIRE(JsCreateExternalStringUtf16(content, 20, ExternalSubStringFinalizeCallback, content, &string) == JsNoError);
+            REQUIRE(JsSetProperty(global, propertyId, string, true) == JsNoError);
+        }
+
+        // Only the substring is left pointing into the host buffer
+        REQUIRE(JsRunScript(_u("var sub = externalString.substring(9, 13); delete this.externalString;"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+
+        // The substring keeps the external string alive, so the host buffer was not released
+        CHECK(!externalSubStringFinalized);
+
+        bool matches = false;
+        REQUIRE(JsRunScript(_u("sub === 'host'"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &matches) == JsNoError);
+        CHECK(matches);
+
+        REQUIRE(JsRunScript(_u("sub = null;"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_ExternalSubStringTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ExternalSubStringTest);
+    }
+
+    void MemoryPressureTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        CHECK(JsNotifyMemoryPressure(JS_INVALID_RUNTIME_HANDLE, JsMemoryPressureLow) == JsErrorInvalidArgument);
+        CHECK(JsNotifyMemoryPressure(runtime, (JsMemoryPressureLevel)3) == JsErrorInvalidArgument);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var a = []; for (var i = 0; i < 10000; i++) { a.push({ x: i }); } a = null;"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        REQUIRE(JsNotifyMemoryPressure(runtime, JsMemoryPressureLow) == JsNoError);
+        REQUIRE(JsNotifyMemoryPressure(runtime, JsMemoryPressureModerate) == JsNoError);
+        REQUIRE(JsNotifyMemoryPressure(runtime, JsMemoryPressureCritical) == JsNoError);
+
+        // The runtime is still usable afterwards
+        REQUIRE(JsRunScript(_u("[1, 2, 3].length"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_MemoryPressureTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::MemoryPressureTest);
+    }
+
+    void IdleWithDeadlineTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        unsigned int nextIdleTick = 0;
+        if ((attributes & JsRuntimeAttributeEnableIdleProcessing) == 0)
+        {
+            CHECK(JsIdleWithDeadline(10, &nextIdleTick) == JsErrorIdleNotEnabled);
+            return;
+        }
+
+        CHECK(JsIdleWithDeadline(0, &nextIdleTick) == JsErrorInvalidArgument);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var a = []; for (var i = 0; i < 10000; i++) { a.push({ x: i }); } a = null;"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        REQUIRE(JsIdleWithDeadline(10, &nextIdleTick) == JsNoError);
+        REQUIRE(JsIdleWithDeadline(10, nullptr) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_IdleWithDeadlineTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::IdleWithDeadlineTest);
+    }
+
+    void CHAKRA_CALLBACK CollectedObjectsCallback(void * const *tokens, unsigned int count, void *callbackState)
+    {
+        size_t * collectedCount = (size_t *)callbackState;
+        for (unsigned int i = 0; i < count; i++)
+        {
+            if (tokens[i] == (void *)&CollectedObjectsCallback)
+            {
+                (*collectedCount)++;
+            }
+        }
+    }
+
+    void CollectedObjectsTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        size_t collectedCount = 0;
+        REQUIRE(JsSetRuntimeCollectedObjectsCallback(runtime, &collectedCount, CollectedObjectsCallback) == JsNoError);
+
+        JsValueRef number = JS_INVALID_REFERENCE;
+        REQUIRE(JsIntToNumber(1, &number) == JsNoError);
+        CHECK(JsSetObjectCollectToken(number, (void *)&CollectedObjectsCallback) == JsErrorInvalidArgument);
+
+        for (int i = 0; i < 100; i++)
+        {
+            JsValueRef object = JS_INVALID_REFERENCE;
+            REQUIRE(JsCreateObject(&object) == JsNoError);
+            REQUIRE(JsSetObjectCollectToken(object, (void *)&CollectedObjectsCallback) == JsNoError);
+        }
+
+        // An object whose token was removed is not reported
+        JsValueRef removed = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateObject(&removed) == JsNoError);
+        REQUIRE(JsSetObjectCollectToken(removed, &collectedCount) == JsNoError);
+        REQUIRE(JsSetObjectCollectToken(removed, nullptr) == JsNoError);
+        removed = JS_INVALID_REFERENCE;
+
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        CHECK(collectedCount > 0);
+        CHECK(collectedCount <= 100);
+
+        REQUIRE(JsSetRuntimeCollectedObjectsCallback(runtime, nullptr, nullptr) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_CollectedObjectsTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::CollectedObjectsTest);
+    }
+
+    void CHAKRA_CALLBACK ReplacedDataFinalizeCallback(void *callbackState)
+    {
+        (*(int *)callbackState)++;
+    }
+
+    void ReplaceTypedArrayExternalDataTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        BYTE first[16] = { 1 };
+        BYTE second[8] = { 2 };
+        int finalizeCount = 0;
+
+        JsValueRef arrayBuffer = JS_INVALID_REFERENCE;
+        JsValueRef typedArray = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateExternalArrayBuffer(first, sizeof(first), ReplacedDataFinalizeCallback, &finalizeCount, &arrayBuffer) == JsNoError);
+        REQUIRE(JsCreateTypedArray(JsArrayTypeUint16, arrayBuffer, 0, 8, &typedArray) == JsNoError);
+
+        // The length has to be a multiple of the element size
+        CHECK(JsReplaceTypedArrayExternalData(typedArray, second, 7, nullptr, nullptr) == JsErrorInvalidArgument);
+        CHECK(JsReplaceTypedArrayExternalData(arrayBuffer, second, sizeof(second), nullptr, nullptr) == JsErrorInvalidArgument);
+
+        REQUIRE(JsReplaceTypedArrayExternalData(typedArray, second, sizeof(second), nullptr, nullptr) == JsNoError);
+        CHECK(finalizeCount == 1);
+
+        BYTE *buffer = nullptr;
+        unsigned int bufferLength = 0;
+        REQUIRE(JsGetTypedArrayStorage(typedArray, &buffer, &bufferLength, nullptr, nullptr) == JsNoError);
+        CHECK(buffer == second);
+        CHECK(bufferLength == sizeof(second));
+        REQUIRE(JsGetArrayBufferStorage(arrayBuffer, &buffer, &bufferLength) == JsNoError);
+        CHECK(buffer == second);
+        CHECK(bufferLength == sizeof(second));
+
+        // A second view of the buffer can't be re-pointed
+        JsValueRef otherArray = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateTypedArray(JsArrayTypeUint8, arrayBuffer, 0, 8, &otherArray) == JsNoError);
+        CHECK(JsReplaceTypedArrayExternalData(typedArray, first, sizeof(first), nullptr, nullptr) == JsErrorInvalidArgument);
+
+        // Typed arrays over engine allocated buffers can't be re-pointed
+        JsValueRef ownedArray = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateTypedArray(JsArrayTypeUint8, JS_INVALID_REFERENCE, 0, 8, &ownedArray) == JsNoError);
+        CHECK(JsReplaceTypedArrayExternalData(ownedArray, first, sizeof(first), nullptr, nullptr) == JsErrorInvalidArgument);
+    }
+
+    TEST_CASE("ApiTest_ReplaceTypedArrayExternalDataTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ReplaceTypedArrayExternalDataTest);
+    }
+}
+
+namespace JsRTApiTest
+{
+    // Deserializes a typed array record with its byte offset and length replaced. The record starts
+    // after the version, the tag and the array type.
+    JsErrorCode DeserializePatchedTypedArray(const BYTE *bytes, unsigned int bytesLength, uint32_t byteOffset, uint32_t length)
+    {
+        BYTE patched[64];
+        REQUIRE(bytesLength <= sizeof(patched));
+        memcpy(patched, bytes, bytesLength);
+        memcpy(patched + 3, &byteOffset, sizeof(byteOffset));
+        memcpy(patched + 3 + sizeof(byteOffset), &length, sizeof(length));
+
+        JsSerializedValue fromBytes = nullptr;
+        REQUIRE(JsCreateSerializedValue(patched, bytesLength, &fromBytes) == JsNoError);
+        JsValueRef copy = JS_INVALID_REFERENCE;
+        JsErrorCode errorCode = JsDeserializeValue(fromBytes, &copy);
+        REQUIRE(JsReleaseSerializedValue(fromBytes) == JsNoError);
+        return errorCode;
+    }
+
+    void SerializeValueTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef value = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var buf = new ArrayBuffer(8); new Uint8Array(buf)[4] = 42;")
+            _u("var o = { a: 'text', n: 1.5, i: 7, d: new Date(5), list: [1, , 'x'], bytes: new Uint8Array(buf, 4, 2), buf: buf };")
+            _u("o.self = o; o"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+
+        JsValueRef transferred = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("buf"), JS_SOURCE_CONTEXT_NONE, _u(""), &transferred) == JsNoError);
+
+        JsSerializedValue serializedValue = nullptr;
+        REQUIRE(JsSerializeValue(value, &transferred, 1, &serializedValue) == JsNoError);
+
+        // The transferred buffer is detached in the source context
+        JsValueRef byteLength = JS_INVALID_REFERENCE;
+        int length = -1;
+        REQUIRE(JsRunScript(_u("buf.byteLength"), JS_SOURCE_CONTEXT_NONE, _u(""), &byteLength) == JsNoError);
+        REQUIRE(JsNumberToInt(byteLength, &length) == JsNoError);
+        CHECK(length == 0);
+
+        JsContextRef oldContext = JS_INVALID_REFERENCE, secondContext = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&oldContext) == JsNoError);
+        REQUIRE(JsCreateContext(runtime, &secondContext) == JsNoError);
+        REQUIRE(JsSetCurrentContext(secondContext) == JsNoError);
+
+        JsValueRef copy = JS_INVALID_REFERENCE;
+        REQUIRE(JsDeserializeValue(serializedValue, &copy) == JsNoError);
+
+        JsValueRef check = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("(function (copy) { return copy.a === 'text' && copy.n === 1.5 && copy.i === 7 &&")
+            _u("copy.d.getTime() === 5 && copy.list.length === 3 && !(1 in copy.list) && copy.list[2] === 'x' &&")
+            _u("copy.self === copy && copy.bytes.buffer === copy.buf && copy.bytes.length === 2 && copy.bytes[0] === 42 &&")
+            _u("copy.buf.byteLength === 8; })"), JS_SOURCE_CONTEXT_NONE, _u(""), &check) == JsNoError);
+
+        JsValueRef args[2] = { JS_INVALID_REFERENCE, copy };
+        REQUIRE(JsGetUndefinedValue(&args[0]) == JsNoError);
+        JsValueRef result = JS_INVALID_REFERENCE;
+        bool matches = false;
+        REQUIRE(JsCallFunction(check, args, 2, &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &matches) == JsNoError);
+        CHECK(matches);
+
+        // Transferred contents go to the first deserialization only
+        CHECK(JsDeserializeValue(serializedValue, &copy) == JsErrorInvalidArgument);
+        REQUIRE(JsReleaseSerializedValue(serializedValue) == JsNoError);
+
+        REQUIRE(JsSetCurrentContext(oldContext) == JsNoError);
+
+        // A value without transfers can be rebuilt from its bytes
+        JsValueRef text = JS_INVALID_REFERENCE;
+        REQUIRE(JsPointerToString(_u("text"), 4, &text) == JsNoError);
+        REQUIRE(JsSerializeValue(text, nullptr, 0, &serializedValue) == JsNoError);
+
+        const BYTE *bytes = nullptr;
+        unsigned int bytesLength = 0;
+        REQUIRE(JsGetSerializedValueBuffer(serializedValue, &bytes, &bytesLength) == JsNoError);
+
+        JsSerializedValue fromBytes = nullptr;
+        REQUIRE(JsCreateSerializedValue(bytes, bytesLength, &fromBytes) == JsNoError);
+        REQUIRE(JsDeserializeValue(fromBytes, &copy) == JsNoError);
+        bool equal = false;
+        REQUIRE(JsStrictEquals(text, copy, &equal) == JsNoError);
+        CHECK(equal);
+        REQUIRE(JsReleaseSerializedValue(fromBytes) == JsNoError);
+
+        // Truncated bytes are rejected
+        REQUIRE(JsCreateSerializedValue(bytes, bytesLength - 1, &fromBytes) == JsNoError);
+        CHECK(JsDeserializeValue(fromBytes, &copy) == JsErrorInvalidArgument);
+        REQUIRE(JsReleaseSerializedValue(fromBytes) == JsNoError);
+        REQUIRE(JsReleaseSerializedValue(serializedValue) == JsNoError);
+
+        // Typed arrays that don't fit in their buffer are rejected rather than thrown from the constructor
+        JsValueRef typedArray = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("new Uint16Array(new ArrayBuffer(8), 2, 2)"), JS_SOURCE_CONTEXT_NONE, _u(""), &typedArray) == JsNoError);
+        REQUIRE(JsSerializeValue(typedArray, nullptr, 0, &serializedValue) == JsNoError);
+        REQUIRE(JsGetSerializedValueBuffer(serializedValue, &bytes, &bytesLength) == JsNoError);
+
+        CHECK(DeserializePatchedTypedArray(bytes, bytesLength, 2, 2) == JsNoError);
+        CHECK(DeserializePatchedTypedArray(bytes, bytesLength, 2, 4) == JsErrorInvalidArgument);
+        CHECK(DeserializePatchedTypedArray(bytes, bytesLength, 2, 0x80000001) == JsErrorInvalidArgument);
+        CHECK(DeserializePatchedTypedArray(bytes, bytesLength, 0xFFFFFFFE, 1) == JsErrorInvalidArgument);
+        CHECK(DeserializePatchedTypedArray(bytes, bytesLength, 1, 2) == JsErrorInvalidArgument);
+
+        // Cut off in the middle of the typed array record
+        REQUIRE(JsCreateSerializedValue(bytes, 9, &fromBytes) == JsNoError);
+        CHECK(JsDeserializeValue(fromBytes, &copy) == JsErrorInvalidArgument);
+        REQUIRE(JsReleaseSerializedValue(fromBytes) == JsNoError);
+        REQUIRE(JsReleaseSerializedValue(serializedValue) == JsNoError);
+
+        // Indexed properties are defined on the copy, without running setters on the prototype chain
+        JsValueRef indexed = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("({ 0: 'a', list: ['x', 'y'] })"), JS_SOURCE_CONTEXT_NONE, _u(""), &indexed) == JsNoError);
+        REQUIRE(JsSerializeValue(indexed, nullptr, 0, &serializedValue) == JsNoError);
+
+        REQUIRE(JsSetCurrentContext(secondContext) == JsNoError);
+        REQUIRE(JsRunScript(_u("var setterCalls = 0;")
+            _u("Object.defineProperty(Object.prototype, '0', { set: function (v) { setterCalls++; }, configurable: true });")
+            _u("Object.defineProperty(Array.prototype, '1', { set: function (v) { setterCalls++; }, configurable: true });"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsDeserializeValue(serializedValue, &copy) == JsNoError);
+        REQUIRE(JsRunScript(_u("(function (copy) { return setterCalls === 0 && copy.hasOwnProperty('0') && copy[0] === 'a' &&")
+            _u("copy.list.hasOwnProperty('1') && copy.list[1] === 'y' && copy.list.length === 2; })"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &check) == JsNoError);
+        args[1] = copy;
+        matches = false;
+        REQUIRE(JsCallFunction(check, args, 2, &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &matches) == JsNoError);
+        CHECK(matches);
+        REQUIRE(JsSetCurrentContext(oldContext) == JsNoError);
+        REQUIRE(JsReleaseSerializedValue(serializedValue) == JsNoError);
+        serializedValue = nullptr;
+
+        // Functions can't be serialized
+        JsValueRef function = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("(function () {})"), JS_SOURCE_CONTEXT_NONE, _u(""), &function) == JsNoError);
+        CHECK(JsSerializeValue(function, nullptr, 0, &serializedValue) == JsErrorInvalidArgument);
+        CHECK(serializedValue == nullptr);
+    }
+
+    TEST_CASE("ApiTest_SerializeValueTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::SerializeValueTest);
+    }
+}
+
+namespace JsRTApiTest
+{
+    JsValueRef CALLBACK CheckCpuTimeLimitCallback(JsValueRef function, bool isConstructCall, JsValueRef *args, unsigned short argumentCount, void *callbackState)
+    {
+        bool exceeded = false;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        JsCheckRuntimeScriptCpuTimeLimit(static_cast<JsRuntimeHandle>(callbackState), &exceeded);
+        JsBoolToBoolean(exceeded, &result);
+        return result;
+    }
+
+    void CpuTimeAccountingTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsContextRef context = JS_INVALID_REFERENCE;
+        INT64 scriptTime = -1;
+        INT64 gcTime = -1;
+        REQUIRE(JsGetCurrentContext(&context) == JsNoError);
+        REQUIRE(JsGetContextCpuTime(context, &scriptTime) == JsNoError);
+        CHECK(scriptTime == 0);
+
+        // The limit depends on accounting
+        if (attributes & JsRuntimeAttributeAllowScriptInterrupt)
+        {
+            CHECK(JsSetRuntimeScriptCpuTimeLimit(runtime, 1000) == JsErrorInvalidArgument);
+        }
+        CHECK(JsSetRuntimeScriptCpuTimeLimit(runtime, 0) == JsNoError);
+
+        REQUIRE(JsSetRuntimeCpuTimeAccounting(runtime, true) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var a = []; for (var i = 0; i < 1000000; i++) { a.push({ i: i }); } a.length"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+
+        REQUIRE(JsGetContextCpuTime(context, &scriptTime) == JsNoError);
+        CHECK(scriptTime > 0);
+        REQUIRE(JsGetRuntimeGcCpuTime(runtime, &gcTime) == JsNoError);
+        CHECK(gcTime >= 0);
+
+        if (!(attributes & JsRuntimeAttributeAllowScriptInterrupt))
+        {
+            CHECK(JsSetRuntimeScriptCpuTimeLimit(runtime, 1) == JsErrorCannotDisableExecution);
+            CHECK(JsCheckRuntimeScriptCpuTimeLimit(runtime, nullptr) == JsErrorCannotDisableExecution);
+            return;
+        }
+
+        // The script runs its own watchdog, which stops it once it has used more than the limit
+        JsValueRef checkLimit = JS_INVALID_REFERENCE;
+        JsValueRef global = JS_INVALID_REFERENCE;
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateFunction(CheckCpuTimeLimitCallback, runtime, &checkLimit) == JsNoError);
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("checkLimit"), &propertyId) == JsNoError);
+        REQUIRE(JsSetProperty(global, propertyId, checkLimit, true) == JsNoError);
+
+        REQUIRE(JsSetRuntimeScriptCpuTimeLimit(runtime, 1000) == JsNoError);
+        CHECK(JsRunScript(_u("while (true) { checkLimit(); }"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsErrorScriptTerminated);
+
+        bool isDisabled = false;
+        REQUIRE(JsIsRuntimeExecutionDisabled(runtime, &isDisabled) == JsNoError);
+        CHECK(isDisabled);
+        REQUIRE(JsEnableRuntimeExecution(runtime) == JsNoError);
+
+        // Outside of script there is nothing to stop
+        bool exceeded = true;
+        REQUIRE(JsCheckRuntimeScriptCpuTimeLimit(runtime, &exceeded) == JsNoError);
+        CHECK(!exceeded);
+
+        // A limit too large to convert to clock units saturates instead of wrapping around to a small one
+        REQUIRE(JsSetRuntimeScriptCpuTimeLimit(runtime, 0x7FFFFFFFFFFFFFFF) == JsNoError);
+        REQUIRE(JsRunScript(_u("for (var i = 0; i < 1000; i++) { checkLimit(); }"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsIsRuntimeExecutionDisabled(runtime, &isDisabled) == JsNoError);
+        CHECK(!isDisabled);
+
+        // Turning accounting off removes the limit
+        REQUIRE(JsSetRuntimeScriptCpuTimeLimit(runtime, 1) == JsNoError);
+        REQUIRE(JsSetRuntimeCpuTimeAccounting(runtime, false) == JsNoError);
+        REQUIRE(JsRunScript(_u("for (var i = 0; i < 100000; i++) { checkLimit(); }"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsIsRuntimeExecutionDisabled(runtime, &isDisabled) == JsNoError);
+        CHECK(!isDisabled);
+        CHECK(JsSetRuntimeScriptCpuTimeLimit(runtime, 1) == JsErrorInvalidArgument);
+    }
+
+    TEST_CASE("ApiTest_CpuTimeAccountingTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::CpuTimeAccountingTest);
+    }
+
+    struct BatchedFetchData
+    {
+        BatchedFetchData()
+        : callCount(0), specifierCount(0)
+        {
+        }
+        int callCount;
+        unsigned int specifierCount;
+    };
+    BatchedFetchData batchedFetchData;
+
+    static JsErrorCode CALLBACK Batched_FIMC(_In_ JsModuleRecord referencingModule, _In_ unsigned int specifierCount, _In_reads_(specifierCount) const JsValueRef* specifiers, _Out_writes_(specifierCount) JsModuleRecord* dependentModuleRecords)
+    {
+        batchedFetchData.callCount++;
+        batchedFetchData.specifierCount = specifierCount;
+        for (unsigned int i = 0; i < specifierCount; i++)
+        {
+            LPCWSTR specifierStr;
+            size_t length;
+            REQUIRE(JsStringToPointer(specifiers[i], &specifierStr, &length) == JsNoError);
+            REQUIRE((!wcscmp(specifierStr, _u("a.js")) || !wcscmp(specifierStr, _u("b.js"))));
+            REQUIRE(JsInitializeModuleRecord(referencingModule, specifiers[i], &dependentModuleRecords[i]) == JsNoError);
+        }
+        return JsNoError;
+    }
+
+    void ModuleBatchedFetchTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsModuleRecord requestModule = JS_INVALID_REFERENCE;
+        JsValueRef specifier;
+
+        REQUIRE(JsPointerToString(_u(""), 1, &specifier) == JsNoError);
+        REQUIRE(JsInitializeModuleRecord(nullptr, specifier, &requestModule) == JsNoError);
+        REQUIRE(JsSetModuleHostInfo(requestModule, JsModuleHostInfo_FetchImportedModulesCallback, Batched_FIMC) == JsNoError);
+
+        void* callback = nullptr;
+        REQUIRE(JsGetModuleHostInfo(requestModule, JsModuleHostInfo_FetchImportedModulesCallback, &callback) == JsNoError);
+        CHECK(callback == Batched_FIMC);
+
+        JsValueRef errorObject = JS_INVALID_REFERENCE;
+        const char* fileContent = "import {x} from 'a.js'; import {y} from 'b.js'; export {z} from 'a.js';";
+        JsErrorCode errorCode = JsParseModuleSource(requestModule, 0, (LPBYTE)fileContent,
+            (unsigned int)strlen(fileContent), JsParseModuleSourceFlags_DataIsUTF8, &errorObject);
+
+        CHECK(errorCode == JsNoError);
+        CHECK(errorObject == JS_INVALID_REFERENCE);
+        CHECK(batchedFetchData.callCount == 1);
+        CHECK(batchedFetchData.specifierCount == 2);
+    }
+
+    TEST_CASE("ApiTest_ModuleBatchedFetchTest", "[ApiTest]")
+    {
+        JsRTApiTest::WithSetup(JsRuntimeAttributeEnableExperimentalFeatures, ModuleBatchedFetchTest);
+    }
+}
+
+namespace JsRTApiTest
+{
+    void RuntimeSamplingTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        unsigned int profileSize = 0;
+        CHECK(JsStartRuntimeSampling(runtime, 0, 100) == JsErrorInvalidArgument);
+        CHECK(JsStartRuntimeSampling(runtime, 1, 0) == JsErrorInvalidArgument);
+        CHECK(JsGetRuntimeSamplingProfile(runtime, nullptr, 0, nullptr) == JsErrorNullArgument);
+
+        REQUIRE(JsStartRuntimeSampling(runtime, 1, 100) == JsNoError);
+
+        // JSON.parse probes the stack on entry, so the loop reaches a sampling point on every iteration even
+        // once it is jitted
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("function f(n) { return n + JSON.parse('1'); } var n = 0; var start = Date.now(); while (Date.now() - start < 200) { n = f(n); } n"),
+            JS_SOURCE_CONTEXT_NONE, _u("sampling.js"), &result) == JsNoError);
+
+        REQUIRE(JsStopRuntimeSampling(runtime) == JsNoError);
+
+        REQUIRE(JsGetRuntimeSamplingProfile(runtime, nullptr, 0, &profileSize) == JsNoError);
+        REQUIRE(profileSize > 0);
+
+        BYTE tooSmall[1];
+        unsigned int tooSmallSize = 0;
+        CHECK(JsGetRuntimeSamplingProfile(runtime, tooSmall, sizeof(tooSmall), &tooSmallSize) == JsErrorInvalidArgument);
+        CHECK(tooSmallSize == profileSize);
+
+        BYTE *profile = new BYTE[profileSize];
+        unsigned int written = 0;
+        REQUIRE(JsGetRuntimeSamplingProfile(runtime, profile, profileSize, &written) == JsNoError);
+        CHECK(written == profileSize);
+
+        // The first field is a length delimited sample_type
+        CHECK(profile[0] == 0x0A);
+
+        // Functions only get into the string table when a sample hits them
+        const char fileName[] = "sampling.js";
+        size_t fileNameLength = strlen(fileName);
+        bool sampled = false;
+        for (unsigned int i = 0; !sampled && i + fileNameLength <= profileSize; i++)
+        {
+            sampled = memcmp(profile + i, fileName, fileNameLength) == 0;
+        }
+        CHECK(sampled);
+        delete[] profile;
+    }
+
+    TEST_CASE("ApiTest_RuntimeSamplingTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::RuntimeSamplingTest);
+    }
+}
+
+namespace JsRTApiTest
+{
+    struct ContextCounters
+    {
+        INT64 getLookups;
+        INT64 setLookups;
+        int inlineCacheCounterCount;
+    };
+
+    void CALLBACK ContextCounterCallback(JsContextCounterCategory category, const char *name, INT64 value, void *callbackState)
+    {
+        ContextCounters *counters = static_cast<ContextCounters *>(callbackState);
+        if (category == JsContextCounterInlineCache)
+        {
+            counters->inlineCacheCounterCount++;
+            if (strcmp(name, "GetLookups") == 0)
+            {
+                counters->getLookups = value;
+            }
+            else if (strcmp(name, "SetLookups") == 0)
+            {
+                counters->setLookups = value;
+            }
+        }
+    }
+
+    void RuntimeCountersTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsContextRef context = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&context) == JsNoError);
+        CHECK(JsGetContextCounters(context, nullptr, nullptr) == JsErrorNullArgument);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var o = { x: 0 }; for (var i = 0; i < 100; i++) { o.x = o.x + i; } o.x"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        ContextCounters counters = { 0, 0, 0 };
+        REQUIRE(JsGetContextCounters(context, ContextCounterCallback, &counters) == JsNoError);
+        CHECK(counters.inlineCacheCounterCount == 4);
+        CHECK(counters.getLookups > 0);
+        CHECK(counters.setLookups > 0);
+
+        JsGcPhaseTimes phaseTimes;
+        CHECK(JsGetRuntimeGcPhaseTimes(runtime, nullptr) == JsErrorNullArgument);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        REQUIRE(JsGetRuntimeGcPhaseTimes(runtime, &phaseTimes) == JsNoError);
+        CHECK(phaseTimes.collectionCount > 0);
+        CHECK(phaseTimes.markTime >= 0);
+        CHECK(phaseTimes.sweepTime >= 0);
+    }
+
+    TEST_CASE("ApiTest_RuntimeCountersTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::RuntimeCountersTest);
+    }
+}
+
+namespace JsRTApiTest
+{
+    struct PerfHintCounts
+    {
+        volatile LONG count;
+        bool sawWithBlock;
+        unsigned int line;
+    };
+
+    void CHAKRA_CALLBACK PerfHintCallback(const JsPerfHint *perfHint, void *callbackState)
+    {
+        PerfHintCounts *hints = (PerfHintCounts *)callbackState;
+        // Hints found by the background JIT are reported on its thread
+        InterlockedIncrement(&hints->count);
+        if (strcmp(perfHint->name, "HasWithBlock") == 0)
+        {
+            hints->sawWithBlock = true;
+            hints->line = perfHint->line;
+        }
+    }
+
+    void PerfHintCallbackTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        PerfHintCounts hints = { 0, false, 0 };
+        REQUIRE(JsSetRuntimePerfHintCallback(runtime, &hints, PerfHintCallback, 100) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("function f(o) {\n  with (o) { return x; }\n}\nf({ x: 1 });"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        CHECK(hints.sawWithBlock);
+        CHECK(hints.line <= 1);
+
+        // Clearing the callback waits for reports in flight, and nothing more is reported after it
+        REQUIRE(JsSetRuntimePerfHintCallback(runtime, nullptr, nullptr, 0) == JsNoError);
+        LONG count = hints.count;
+        REQUIRE(JsRunScript(_u("function g(o) { with (o) { return x; } } g({ x: 1 });"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        CHECK(hints.count == count);
+    }
+
+    TEST_CASE("ApiTest_PerfHintCallbackTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::PerfHintCallbackTest);
+    }
+}
+
+namespace JsRTApiTest
+{
+    struct FunctionMemoryTotals
+    {
+        int functionCount;
+        size_t byteCodeSize;
+        bool sawFunctionOnSecondLine;
+    };
+
+    void CHAKRA_CALLBACK FunctionMemoryUsageCallback(const JsFunctionMemoryUsage *usage, void *callbackState)
+    {
+        FunctionMemoryTotals *totals = (FunctionMemoryTotals *)callbackState;
+        totals->functionCount++;
+        totals->byteCodeSize += usage->byteCodeSize;
+        if (usage->line == 1 && usage->byteCodeSize > 0)
+        {
+            totals->sawFunctionOnSecondLine = true;
+        }
+    }
+
+    void FunctionMemoryUsageTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var total = 0;\nfunction add(x) { total += x; return total; }\nadd(1); add(2);"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        JsContextRef context = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&context) == JsNoError);
+
+        FunctionMemoryTotals totals = { 0, 0, false };
+        REQUIRE(JsGetContextFunctionMemoryUsage(context, FunctionMemoryUsageCallback, &totals) == JsNoError);
+        CHECK(totals.functionCount >= 2);
+        CHECK(totals.byteCodeSize > 0);
+        CHECK(totals.sawFunctionOnSecondLine);
+
+        CHECK(JsGetContextFunctionMemoryUsage(context, nullptr, nullptr) == JsErrorNullArgument);
+
+        REQUIRE(JsSetRuntimeCodeAgingPolicy(runtime, 2) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        REQUIRE(JsRunScript(_u("add(3);"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsSetRuntimeCodeAgingPolicy(runtime, 0) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_FunctionMemoryUsageTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::FunctionMemoryUsageTest);
+    }
+}
+
+namespace JsRTApiTest
+{
+    void RedeferralPolicyTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        REQUIRE(JsSetRuntimeRedeferralPolicy(runtime, 1) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("function square(x) { return x * x; }\nsquare(2);"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        // Whether or not square is redeferred by these collections, calling it again has to give the same result
+        for (int i = 0; i < 4; i++)
+        {
+            REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        }
+
+        REQUIRE(JsRunScript(_u("square(3)"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        int value = 0;
+        REQUIRE(JsNumberToInt(result, &value) == JsNoError);
+        CHECK(value == 9);
+
+        REQUIRE(JsSetRuntimeRedeferralPolicy(runtime, 0) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_RedeferralPolicyTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::RedeferralPolicyTest);
+    }
 }
@@ -202,6 +202,73 @@ namespace MemoryPolicyTests
         NegativeTest(JsRuntimeAttributeDisableBackgroundWork);
     }
 
+    static bool CALLBACK TrackAllocationCallback(LPVOID context, JsMemoryEventType allocationEvent, size_t allocationSize)
+    {
+        REQUIRE(context != nullptr);
+        MemoryPolicyTest* memoryPolicyTest = static_cast<MemoryPolicyTest*>(context);
+        if (allocationEvent == JsMemoryAllocate)
+        {
+            memoryPolicyTest->totalAllocationSize += allocationSize;
+        }
+        else
+        {
+            memoryPolicyTest->totalAllocationSize -= allocationSize;
+        }
+        return true;
+    }
+
+    void PageSegmentPoolTest(JsRuntimeAttributes attributes)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        bool matches = false;
+
+        // The first runtime builds a large heap and drops it. Its empty page segments go to the
+        // process wide pool once they exceed its free page budget, and the rest when it is disposed.
+        MemoryPolicyTest donorPolicy;
+        JsRuntimeHandle donor = JS_INVALID_RUNTIME_HANDLE;
+        REQUIRE(JsCreateRuntime(attributes, nullptr, &donor) == JsNoError);
+        REQUIRE(JsSetRuntimeMemoryAllocationCallback(donor, &donorPolicy, TrackAllocationCallback) == JsNoError);
+
+        JsContextRef context = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateContext(donor, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+        REQUIRE(JsRunScript(_u("var list = []; for (var i = 0; i < 200000; i++) { list.push({ index: i, name: 'item' + i }); } list = null;"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), nullptr) == JsNoError);
+        REQUIRE(JsSetCurrentContext(JS_INVALID_REFERENCE) == JsNoError);
+        REQUIRE(JsCollectGarbage(donor) == JsNoError);
+        CHECK(donorPolicy.totalAllocationSize > 0);
+        REQUIRE(JsDisposeRuntime(donor) == JsNoError);
+
+        // Pooled segments no longer count against the runtime that gave them up
+        CHECK(donorPolicy.totalAllocationSize == 0);
+
+        // The second runtime takes the pooled segments for its own heap. They must behave like
+        // freshly reserved ones: new objects start out clean and the memory is charged to it.
+        MemoryPolicyTest adopterPolicy;
+        JsRuntimeHandle adopter = JS_INVALID_RUNTIME_HANDLE;
+        REQUIRE(JsCreateRuntime(attributes, nullptr, &adopter) == JsNoError);
+        REQUIRE(JsSetRuntimeMemoryAllocationCallback(adopter, &adopterPolicy, TrackAllocationCallback) == JsNoError);
+
+        REQUIRE(JsCreateContext(adopter, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+        REQUIRE(JsRunScript(_u("var list = []; for (var i = 0; i < 200000; i++) { list.push({ index: i, name: 'item' + i, holes: new Array(4) }); }")
+            _u("list.every(function (o, i) { return o.index === i && o.name === 'item' + i && o.holes.length === 4 && !(0 in o.holes) && o.extra === undefined; })"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &matches) == JsNoError);
+        CHECK(matches);
+        CHECK(adopterPolicy.totalAllocationSize > 0);
+
+        REQUIRE(JsSetCurrentContext(JS_INVALID_REFERENCE) == JsNoError);
+        REQUIRE(JsDisposeRuntime(adopter) == JsNoError);
+        CHECK(adopterPolicy.totalAllocationSize == 0);
+    }
+
+    TEST_CASE("MemoryPolicyTest_PageSegmentPool", "[MemoryPolicyTest]")
+    {
+        PageSegmentPoolTest(JsRuntimeAttributeNone);
+        PageSegmentPoolTest(JsRuntimeAttributeDisableBackgroundWork);
+    }
+
     void ContextLeak()
     {
         MemoryPolicyTest memoryPolicyTest;
@@ -0,0 +1,331 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "stdafx.h"
+#include "catch.hpp"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#pragma warning(disable:6387) // suppressing preFAST which raises warning for passing null to the JsRT APIs
+#pragma warning(disable:6262) // CATCH is using stack variables to report errors, suppressing the preFAST warning.
+
+//
+// Microbenchmarks of hot engine paths, reached through the JsRT API. They are hidden from the default run;
+// use "nativetests.exe [MicroBenchmark]" to run them. Each one prints a "### MICROBENCHMARK" line with the
+// median time of one operation, in the same spirit as the "### TIME" lines of test/benchmarks. The microbench
+// suite of test/benchmarks/runbenchmarks.py runs them and compares them against a saved baseline, failing on
+// regressions.
+//
+namespace MicroBenchmarks
+{
+    static const int BatchCount = 15;
+    static const double MinBatchMilliseconds = 20;
+
+    // Runs the operation in batches, growing the batch until it takes long enough to time, and reports the
+    // median time of one operation across the batches.
+    template <class Operation>
+    void Measure(const char *name, Operation operation)
+    {
+        typedef std::chrono::steady_clock Clock;
+
+        // Warm up, which also lets the JIT compile any script the operation calls
+        unsigned int batchSize = 1;
+        for (;;)
+        {
+            Clock::time_point start = Clock::now();
+            for (unsigned int i = 0; i < batchSize; i++)
+            {
+                operation();
+            }
+            double elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            if (elapsed >= MinBatchMilliseconds || batchSize >= (1u << 24))
+            {
+                break;
+            }
+            batchSize *= 2;
+        }
+
+        std::vector<double> nanosecondsPerOperation;
+        for (int batch = 0; batch < BatchCount; batch++)
+        {
+            Clock::time_point start = Clock::now();
+            for (unsigned int i = 0; i < batchSize; i++)
+            {
+                operation();
+            }
+            nanosecondsPerOperation.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count() / batchSize);
+        }
+
+        std::sort(nanosecondsPerOperation.begin(), nanosecondsPerOperation.end());
+        printf("### MICROBENCHMARK %s: %.1f ns/op (min %.1f, max %.1f)\n", name,
+            nanosecondsPerOperation[BatchCount / 2], nanosecondsPerOperation.front(), nanosecondsPerOperation.back());
+        fflush(stdout);
+    }
+
+    // Runs the handler in a fresh runtime with a current context
+    template <class Handler>
+    void WithRuntime(Handler handler)
+    {
+        JsRuntimeHandle runtime = JS_INVALID_RUNTIME_HANDLE;
+        JsContextRef context = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateRuntime(JsRuntimeAttributeNone, nullptr, &runtime) == JsNoError);
+        REQUIRE(JsCreateContext(runtime, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+
+        handler(runtime);
+
+        REQUIRE(JsSetCurrentContext(JS_INVALID_REFERENCE) == JsNoError);
+        REQUIRE(JsDisposeRuntime(runtime) == JsNoError);
+    }
+
+    JsValueRef RunScript(const char16 *script)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        return result;
+    }
+
+    JsValueRef GetGlobalFunction(const char16 *name)
+    {
+        JsValueRef global = JS_INVALID_REFERENCE;
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        JsValueRef function = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(name, &propertyId) == JsNoError);
+        REQUIRE(JsGetProperty(global, propertyId, &function) == JsNoError);
+        return function;
+    }
+
+    // Calls a global script function with no arguments, and checks that it succeeded. The check only goes
+    // through CATCH on failure, to keep its bookkeeping out of the timing.
+    void CallGlobalFunction(JsValueRef function, JsValueRef undefined)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        JsErrorCode errorCode = JsCallFunction(function, &undefined, 1, &result);
+        if (errorCode != JsNoError)
+        {
+            REQUIRE(errorCode == JsNoError);
+        }
+    }
+
+    TEST_CASE("MicroBenchmark_RecyclerAllocation", "[.][MicroBenchmark]")
+    {
+        WithRuntime([](JsRuntimeHandle runtime)
+        {
+            // Short lived objects, which mostly die in the partial collections
+            Measure("RecyclerAllocation.Object", []()
+            {
+                JsValueRef object = JS_INVALID_REFERENCE;
+                JsCreateObject(&object);
+            });
+
+            Measure("RecyclerAllocation.ArrayBuffer4K", []()
+            {
+                JsValueRef buffer = JS_INVALID_REFERENCE;
+                JsCreateArrayBuffer(4096, &buffer);
+            });
+        });
+    }
+
+    TEST_CASE("MicroBenchmark_RecyclerCollection", "[.][MicroBenchmark]")
+    {
+        WithRuntime([](JsRuntimeHandle runtime)
+        {
+            // A GCStress-like live graph: binary trees with cross links, arrays and strings hanging off them
+            RunScript(_u("function makeTree(depth) {\n")
+                _u("  if (depth == 0) { return { s: 'leaf' + depth }; }\n")
+                _u("  var node = { left: makeTree(depth - 1), right: makeTree(depth - 1), values: [depth, depth * 2, {}] };\n")
+                _u("  node.left.sibling = node.right;\n")
+                _u("  return node;\n")
+                _u("}\n")
+                _u("var forest = [];\n")
+                _u("for (var i = 0; i < 16; i++) { forest.push(makeTree(12)); }\n")
+                _u("function churn() { for (var i = 0; i < 1000; i++) { forest[i & 15].garbage = makeTree(3); } }\n"));
+
+            Measure("RecyclerCollection.LiveGraph", [runtime]()
+            {
+                JsCollectGarbage(runtime);
+            });
+
+            JsValueRef undefined = JS_INVALID_REFERENCE;
+            REQUIRE(JsGetUndefinedValue(&undefined) == JsNoError);
+            JsValueRef churn = GetGlobalFunction(_u("churn"));
+            Measure("RecyclerCollection.Churn1000Trees", [churn, undefined]()
+            {
+                CallGlobalFunction(churn, undefined);
+            });
+        });
+    }
+
+    TEST_CASE("MicroBenchmark_PropertyRecordLookup", "[.][MicroBenchmark]")
+    {
+        WithRuntime([](JsRuntimeHandle runtime)
+        {
+            // Names that are already in the property map, as a host looking up its bindings would use
+            static const int NameCount = 1024;
+            std::vector<std::basic_string<char16>> names;
+            for (int i = 0; i < NameCount; i++)
+            {
+                char16 name[32];
+                swprintf_s(name, _countof(name), _u("property%d"), i);
+                names.push_back(name);
+
+                JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+                REQUIRE(JsGetPropertyIdFromName(name, &propertyId) == JsNoError);
+            }
+
+            int index = 0;
+            Measure("PropertyRecordLookup.Existing", [&names, &index]()
+            {
+                JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+                JsGetPropertyIdFromName(names[index].c_str(), &propertyId);
+                index = (index + 1) & (NameCount - 1);
+            });
+
+            JsValueRef object = RunScript(_u("({ a: 1, b: 2, c: 3, d: 4, e: 5 })"));
+            JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+            REQUIRE(JsGetPropertyIdFromName(_u("d"), &propertyId) == JsNoError);
+            Measure("PropertyRecordLookup.GetProperty", [object, propertyId]()
+            {
+                JsValueRef value = JS_INVALID_REFERENCE;
+                JsGetProperty(object, propertyId, &value);
+            });
+        });
+    }
+
+    TEST_CASE("MicroBenchmark_CallFunction", "[.][MicroBenchmark]")
+    {
+        WithRuntime([](JsRuntimeHandle runtime)
+        {
+            RunScript(_u("function identity(x) { return x; }"));
+            JsValueRef identity = GetGlobalFunction(_u("identity"));
+            JsValueRef args[2] = { JS_INVALID_REFERENCE, JS_INVALID_REFERENCE };
+            REQUIRE(JsGetUndefinedValue(&args[0]) == JsNoError);
+            REQUIRE(JsIntToNumber(42, &args[1]) == JsNoError);
+
+            Measure("CallFunction.RoundTrip", [identity, &args]()
+            {
+                JsValueRef result = JS_INVALID_REFERENCE;
+                JsCallFunction(identity, args, 2, &result);
+            });
+        });
+    }
+
+    TEST_CASE("MicroBenchmark_Json", "[.][MicroBenchmark]")
+    {
+        WithRuntime([](JsRuntimeHandle runtime)
+        {
+            // The same record shape at three sizes; the text and the value are built once, outside the timing
+            RunScript(_u("function makeRecords(count) {\n")
+                _u("  var records = [];\n")
+                _u("  for (var i = 0; i < count; i++) {\n")
+                _u("    records.push({ id: i, name: 'record ' + i, price: i * 1.25, tags: ['a', 'b', 'c'], nested: { ok: true, n: null } });\n")
+                _u("  }\n")
+                _u("  return records;\n")
+                _u("}\n")
+                _u("var small = makeRecords(1), medium = makeRecords(100), large = makeRecords(10000);\n")
+                _u("var smallText = JSON.stringify(small), mediumText = JSON.stringify(medium), largeText = JSON.stringify(large);\n")
+                _u("function parseSmall() { return JSON.parse(smallText); }\n")
+                _u("function parseMedium() { return JSON.parse(mediumText); }\n")
+                _u("function parseLarge() { return JSON.parse(largeText); }\n")
+                _u("function stringifySmall() { return JSON.stringify(small); }\n")
+                _u("function stringifyMedium() { return JSON.stringify(medium); }\n")
+                _u("function stringifyLarge() { return JSON.stringify(large); }\n"));
+
+            JsValueRef undefined = JS_INVALID_REFERENCE;
+            REQUIRE(JsGetUndefinedValue(&undefined) == JsNoError);
+
+            static const struct { const char *name; const char16 *function; } benchmarks[] =
+            {
+                { "Json.ParseSmall", _u("parseSmall") },
+                { "Json.ParseMedium", _u("parseMedium") },
+                { "Json.ParseLarge", _u("parseLarge") },
+                { "Json.StringifySmall", _u("stringifySmall") },
+                { "Json.StringifyMedium", _u("stringifyMedium") },
+                { "Json.StringifyLarge", _u("stringifyLarge") },
+            };
+            for (int i = 0; i < _countof(benchmarks); i++)
+            {
+                JsValueRef function = GetGlobalFunction(benchmarks[i].function);
+                Measure(benchmarks[i].name, [function, undefined]()
+                {
+                    CallGlobalFunction(function, undefined);
+                });
+            }
+        });
+    }
+
+    TEST_CASE("MicroBenchmark_StringConcat", "[.][MicroBenchmark]")
+    {
+        WithRuntime([](JsRuntimeHandle runtime)
+        {
+            // Appending builds a concat string; the charAt forces it to be flattened
+            RunScript(_u("function appendChars() { var s = ''; for (var i = 0; i < 1000; i++) { s += 'x'; } return s.charAt(500); }\n")
+                _u("function joinParts() { var s = ''; for (var i = 0; i < 100; i++) { s = s + 'part' + i + ','; } return s.length; }\n"));
+
+            JsValueRef undefined = JS_INVALID_REFERENCE;
+            REQUIRE(JsGetUndefinedValue(&undefined) == JsNoError);
+
+            JsValueRef appendChars = GetGlobalFunction(_u("appendChars"));
+            Measure("StringConcat.Append1000Chars", [appendChars, undefined]()
+            {
+                CallGlobalFunction(appendChars, undefined);
+            });
+
+            JsValueRef joinParts = GetGlobalFunction(_u("joinParts"));
+            Measure("StringConcat.Join100Parts", [joinParts, undefined]()
+            {
+                CallGlobalFunction(joinParts, undefined);
+            });
+        });
+    }
+
+    TEST_CASE("MicroBenchmark_MapOperations", "[.][MicroBenchmark]")
+    {
+        WithRuntime([](JsRuntimeHandle runtime)
+        {
+            // Object and number keys, so that both pointer and value hashing are covered; half of the gets miss
+            RunScript(_u("var keys = []; for (var i = 0; i < 1000; i++) { keys.push(i % 2 ? {} : i * 1.5); }\n")
+                _u("var map = new Map(); for (var i = 0; i < 1000; i += 2) { map.set(keys[i], i); }\n")
+                _u("function getKeys() { var n = 0; for (var i = 0; i < 1000; i++) { if (map.get(keys[i]) !== undefined) { n++; } } return n; }\n")
+                _u("function setAndDelete() { var m = new Map(); for (var i = 0; i < 1000; i++) { m.set(keys[i], i); } for (var i = 0; i < 1000; i++) { m.delete(keys[i]); } return m.size; }\n"));
+
+            JsValueRef undefined = JS_INVALID_REFERENCE;
+            REQUIRE(JsGetUndefinedValue(&undefined) == JsNoError);
+
+            JsValueRef getKeys = GetGlobalFunction(_u("getKeys"));
+            Measure("MapOperations.Get1000", [getKeys, undefined]()
+            {
+                CallGlobalFunction(getKeys, undefined);
+            });
+
+            JsValueRef setAndDelete = GetGlobalFunction(_u("setAndDelete"));
+            Measure("MapOperations.SetAndDelete1000", [setAndDelete, undefined]()
+            {
+                CallGlobalFunction(setAndDelete, undefined);
+            });
+        });
+    }
+
+    TEST_CASE("MicroBenchmark_ContextCreation", "[.][MicroBenchmark]")
+    {
+        JsRuntimeHandle runtime = JS_INVALID_RUNTIME_HANDLE;
+        REQUIRE(JsCreateRuntime(JsRuntimeAttributeNone, nullptr, &runtime) == JsNoError);
+
+        // Includes the first entry into the context, which initializes its library
+        Measure("ContextCreation.CreateAndEnter", [runtime]()
+        {
+            JsContextRef context = JS_INVALID_REFERENCE;
+            JsValueRef global = JS_INVALID_REFERENCE;
+            JsCreateContext(runtime, &context);
+            JsSetCurrentContext(context);
+            JsGetGlobalObject(&global);
+            JsSetCurrentContext(JS_INVALID_REFERENCE);
+        });
+
+        REQUIRE(JsDisposeRuntime(runtime) == JsNoError);
+    }
+}
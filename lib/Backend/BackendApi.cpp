@@ -199,3 +199,8 @@ void DeleteNativeCodeData(NativeCodeData * data)
 {
     delete data;
 }
+
+size_t GetNativeCodeDataSize(NativeCodeData * data)
+{
+    return data->totalSize;
+}
@@ -2233,6 +2233,7 @@ void BailOutRecord::ScheduleFunctionCodeGen(Js::ScriptFunction * function, Js::S
         function->GetFunctionBody()->GetDisplayName(), ::GetBailOutKindName(bailOutKind), bailOutRecord->bailOutCount, callsCount,
         RejitReasonNames[rejitReason], reThunk ? trueString : falseString);
 
+    executeFunction->GetScriptContext()->CountBailOut(bailOutKind);
 #ifdef REJIT_STATS
     if(PHASE_STATS(Js::ReJITPhase, executeFunction))
     {
@@ -2255,6 +2256,7 @@ void BailOutRecord::ScheduleFunctionCodeGen(Js::ScriptFunction * function, Js::S
     }
     else if (rejitReason != RejitReason::None)
     {
+        executeFunction->GetScriptContext()->CountRejit(rejitReason);
 #ifdef REJIT_STATS
         if(PHASE_STATS(Js::ReJITPhase, executeFunction))
         {
@@ -2570,6 +2572,7 @@ void BailOutRecord::ScheduleLoopBodyCodeGen(Js::ScriptFunction * function, Js::S
         function->GetFunctionBody()->GetDisplayName(), executeFunction->GetLoopNumber(loopHeader),
         ::GetBailOutKindName(bailOutKind), RejitReasonNames[rejitReason]);
 
+    executeFunction->GetScriptContext()->CountBailOut(bailOutKind);
 #ifdef REJIT_STATS
     if(PHASE_STATS(Js::ReJITPhase, executeFunction))
     {
@@ -2579,6 +2582,7 @@ void BailOutRecord::ScheduleLoopBodyCodeGen(Js::ScriptFunction * function, Js::S
 
     if (rejitReason != RejitReason::None)
     {
+        executeFunction->GetScriptContext()->CountRejit(rejitReason);
 #ifdef REJIT_STATS
         if(PHASE_STATS(Js::ReJITPhase, executeFunction))
         {
@@ -402,6 +402,11 @@ EmitBufferManager<TAlloc, TPreReservedAlloc, SyncObject>::CommitBuffer(TEmitBuff
     Assert(destBuffer != nullptr);
     Assert(allocation != nullptr);
 
+    if (CONFIG_FLAG_RELEASE(BatchJitCodeProtection))
+    {
+        return CommitBufferWithSingleProtect(allocation, destBuffer, bytes, sourceBuffer, alignPad);
+    }
+
     BYTE *currentDestBuffer = destBuffer + allocation->GetBytesUsed();
     BYTE *bufferToFlush = currentDestBuffer;
     Assert(allocation->BytesFree() >= bytes + alignPad);
@@ -477,6 +482,75 @@ EmitBufferManager<TAlloc, TPreReservedAlloc, SyncObject>::CommitBuffer(TEmitBuff
     return FinalizeAllocation(allocation, destBuffer);
 }
 
+//----------------------------------------------------------------------------
+// EmitBufferManager::CommitBufferWithSingleProtect
+//      Same as CommitBuffer, but the whole allocation is made writable once,
+//      filled (alignment, code and the debug break padding at the end) and made
+//      executable again. This trades the one writable page at a time guarantee
+//      for two protection changes per allocation.
+//----------------------------------------------------------------------------
+template <typename TAlloc, typename TPreReservedAlloc, class SyncObject>
+bool
+EmitBufferManager<TAlloc, TPreReservedAlloc, SyncObject>::CommitBufferWithSingleProtect(TEmitBufferAllocation* allocation, __out_bcount(bytes) BYTE* destBuffer, __in size_t bytes, __in_bcount(bytes) const BYTE* sourceBuffer, __in DWORD alignPad)
+{
+    Assert(this->criticalSection.IsLocked());
+
+    BYTE *currentDestBuffer = destBuffer + allocation->GetBytesUsed();
+    BYTE *bufferToFlush = currentDestBuffer;
+    Assert(allocation->BytesFree() >= bytes + alignPad);
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    if (CheckCommitFaultInjection())
+    {
+        return false;
+    }
+#endif
+
+    const bool isJITServer = JITManager::GetJITManager()->IsJITServer();
+    if (!isJITServer && !this->allocationHeap.ProtectAllocationWithExecuteReadWrite(allocation->allocation))
+    {
+        return false;
+    }
+
+    if (alignPad != 0)
+    {
+        CustomHeap::FillDebugBreak(currentDestBuffer, alignPad);
+        currentDestBuffer += alignPad;
+        allocation->bytesUsed += alignPad;
+    }
+
+    if (bytes != 0)
+    {
+        memcpy_s(currentDestBuffer, allocation->BytesFree(), sourceBuffer, bytes);
+        currentDestBuffer += bytes;
+        allocation->bytesUsed += bytes;
+    }
+
+    // Fill the rest while the allocation is still writable, instead of finalizing through another CommitBuffer.
+    DWORD bytesFree = allocation->BytesFree();
+    if (bytesFree > 0)
+    {
+        BYTE* buffer = nullptr;
+        this->GetBuffer(allocation, bytesFree, &buffer);
+        CustomHeap::FillDebugBreak(currentDestBuffer, bytesFree);
+        currentDestBuffer += bytesFree;
+        allocation->bytesUsed += bytesFree;
+    }
+
+    if (!isJITServer && !this->allocationHeap.ProtectAllocationWithExecuteReadOnly(allocation->allocation))
+    {
+        return false;
+    }
+
+    FlushInstructionCache(this->processHandle, bufferToFlush, currentDestBuffer - bufferToFlush);
+#if DBG_DUMP
+    this->totalBytesAlignment += alignPad + bytesFree;
+    this->totalBytesCode += bytes;
+#endif
+
+    return true;
+}
+
 template <typename TAlloc, typename TPreReservedAlloc, class SyncObject>
 void
 EmitBufferManager<TAlloc, TPreReservedAlloc, SyncObject>::CompletePreviousAllocation(TEmitBufferAllocation* allocation)
@@ -67,6 +67,7 @@ public:
 
 private:
     void FreeAllocations(bool release);
+    bool CommitBufferWithSingleProtect(TEmitBufferAllocation* allocation, __out_bcount(bytes) BYTE* destBuffer, __in size_t bytes, __in_bcount(bytes) const BYTE* sourceBuffer, __in DWORD alignPad);
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     bool CheckCommitFaultInjection();
@@ -1961,6 +1961,12 @@ bool Func::DoRecordNativeMap() const
 #endif
 
 #ifdef PERF_HINT
+bool IsPerfHintEnabled(Func* func)
+{
+    // The host callback lives in the runtime's thread context, which an out of process JIT can't reach
+    return PHASE_TRACE1(Js::PerfHintPhase) || (!func->IsOOPJIT() && IsPerfHintEnabled(func->GetScriptContext()));
+}
+
 void WritePerfHint(PerfHints hint, Func* func, uint byteCodeOffset /*= Js::Constants::NoByteCodeOffset*/)
 {
     if (!func->IsOOPJIT())
@@ -1017,6 +1017,11 @@ class AutoCodeGenPhase
 public:
     AutoCodeGenPhase(Func * func, Js::Phase phase) : func(func), phase(phase), dump(false), isPhaseComplete(false)
     {
+        startTime.QuadPart = 0;
+        if (JITOutput::IsTimedPhase(phase))
+        {
+            QueryPerformanceCounter(&startTime);
+        }
         func->BeginPhase(phase);
     }
     ~AutoCodeGenPhase()
@@ -1024,6 +1029,10 @@ public:
         if(this->isPhaseComplete)
         {
             func->EndPhase(phase, dump);
+            if (startTime.QuadPart != 0)
+            {
+                func->GetJITOutput()->RecordPhaseTime(phase, startTime);
+            }
         }
         else
         {
@@ -1041,6 +1050,7 @@ public:
 private:
     Func * func;
     Js::Phase phase;
+    LARGE_INTEGER startTime;
     bool dump;
     bool isPhaseComplete;
 };
@@ -1049,5 +1059,6 @@ private:
 #define END_CODEGEN_PHASE_NO_DUMP(func, phase) __autoCodeGen.EndPhase(func, phase, false, true); }
 
 #ifdef PERF_HINT
+bool IsPerfHintEnabled(Func* func);
 void WritePerfHint(PerfHints hint, Func* func, uint byteCodeOffset = Js::Constants::NoByteCodeOffset);
 #endif
@@ -4231,7 +4231,7 @@ GlobOpt::OptArguments(IR::Instr *instr)
                     if (IsArgumentsOpnd(src1))
                     {
 #ifdef PERF_HINT
-                        if (PHASE_TRACE1(Js::PerfHintPhase))
+                        if (IsPerfHintEnabled(instr->m_func))
                         {
                             WritePerfHint(PerfHints::HeapArgumentsCreated, instr->m_func, instr->GetByteCodeOffset());
                         }
@@ -4249,7 +4249,7 @@ GlobOpt::OptArguments(IR::Instr *instr)
                     if (IsArgumentsOpnd(src2))
                     {
 #ifdef PERF_HINT
-                        if (PHASE_TRACE1(Js::PerfHintPhase))
+                        if (IsPerfHintEnabled(instr->m_func))
                         {
                             WritePerfHint(PerfHints::HeapArgumentsCreated, instr->m_func, instr->GetByteCodeOffset());
                         }
@@ -4268,7 +4268,7 @@ GlobOpt::OptArguments(IR::Instr *instr)
                     if (IsArgumentsOpnd(dst))
                     {
 #ifdef PERF_HINT
-                        if (PHASE_TRACE1(Js::PerfHintPhase))
+                        if (IsPerfHintEnabled(instr->m_func))
                         {
                             WritePerfHint(PerfHints::HeapArgumentsModification, instr->m_func, instr->GetByteCodeOffset());
                         }
@@ -4282,7 +4282,7 @@ GlobOpt::OptArguments(IR::Instr *instr)
                     if (this->currentBlock->loop && IsArgumentsOpnd(dst))
                     {
 #ifdef PERF_HINT
-                        if (PHASE_TRACE1(Js::PerfHintPhase))
+                        if (IsPerfHintEnabled(instr->m_func))
                         {
                             WritePerfHint(PerfHints::HeapArgumentsModification, instr->m_func, instr->GetByteCodeOffset());
                         }
@@ -1384,6 +1384,7 @@ BailOutInstrTemplate<InstrType>::New(Js::OpCode opcode, BailOutKind kind, BailOu
     // in case we bail out to the interpreter, so that we can reuse the jitted
     // loop bodies
     func->GetJITOutput()->SetHasBailoutInstr(true);
+    func->GetJITOutput()->IncrementBailOutCount();
 
     return bailOutInstr;
 }
@@ -6998,7 +6998,7 @@ IRBuilder::BuildBr(Js::OpCode newOpcode, uint32 offset)
         return;
     }
 #ifdef PERF_HINT
-    else if (PHASE_TRACE1(Js::PerfHintPhase) && (newOpcode == Js::OpCode::TryCatch || newOpcode == Js::OpCode::TryFinally) )
+    else if (IsPerfHintEnabled(this->m_func) && (newOpcode == Js::OpCode::TryCatch || newOpcode == Js::OpCode::TryFinally) )
     {
         WritePerfHint(PerfHints::HasTryBlock, this->m_func, offset);
     }
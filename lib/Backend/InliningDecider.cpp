@@ -143,7 +143,11 @@ uint InliningDecider::InlinePolymorphicCallSite(Js::FunctionBody *const inliner,
 
     uint inlineeCount = 0;
     uint actualInlineeCount  = 0;
+    uint inlineeByteCodeCount = 0;
 
+    // The callees come ordered by how often they were called, so the hottest ones get inlined first.
+    // The ones that don't fit in the count or bytecode budget are reached through the generic call
+    // of the polymorphic dispatch. Forced inlining ignores both limits.
     for (inlineeCount = 0; inlineeCount < functionBodyArrayLength; inlineeCount++)
     {
         if (!functionBodyArray[inlineeCount])
@@ -151,10 +155,23 @@ uint InliningDecider::InlinePolymorphicCallSite(Js::FunctionBody *const inliner,
             AssertMsg(inlineeCount >= 2, "There are at least two polymorphic call site");
             break;
         }
-        if (Inline(inliner, functionBodyArray[inlineeCount]->GetFunctionInfo(), isConstructorCall, true /*isPolymorphicCall*/, 0, profiledCallSiteId, recursiveInlineDepth, false))
+        Js::FunctionBody *const inlinee = functionBodyArray[inlineeCount];
+        if (!PHASE_FORCE(Js::InlinePhase, this->topFunc) &&
+            !PHASE_FORCE(Js::InlinePhase, inliner) &&
+            !PHASE_FORCE(Js::InlinePhase, inlinee) &&
+            (actualInlineeCount >= (uint)max(threshold.polymorphicInlineeCountMax, 0) ||
+             inlineeByteCodeCount + inlinee->GetByteCodeCount() > (uint)max(threshold.polymorphicInlineBudget, 0)))
+        {
+            PHASE_PRINT_TESTTRACE(Js::PolymorphicInlineLimitsPhase, this->topFunc,
+                _u("INLINING (Polymorphic): Skip Inline: Over the polymorphic inlinee count or budget\tInlinee: %s\tCaller: %s\tInlined: %d\n"),
+                inlinee->GetDisplayName(), inliner->GetDisplayName(), actualInlineeCount);
+            continue;
+        }
+        if (Inline(inliner, inlinee->GetFunctionInfo(), isConstructorCall, true /*isPolymorphicCall*/, 0, profiledCallSiteId, recursiveInlineDepth, false))
         {
             canInlineArray[inlineeCount] = true;
             actualInlineeCount++;
+            inlineeByteCodeCount += inlinee->GetByteCodeCount();
         }
     }
     if (inlineeCount != actualInlineeCount)
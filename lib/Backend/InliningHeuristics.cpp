@@ -27,6 +27,9 @@ void InliningThreshold::SetAggressiveHeuristics()
     leafInlineThreshold = limit;
     loopInlineThreshold = limit;
     polymorphicInlineThreshold = limit;
+    // Aggressive inlining is only bounded by inlineCountMax, so inline every polymorphic callee that fits
+    polymorphicInlineeCountMax = INT_MAX;
+    polymorphicInlineBudget = INT_MAX;
     maxNumberOfInlineesWithLoop = CONFIG_FLAG(MaxNumberOfInlineesWithLoop);
 
     inlineCountMax = CONFIG_FLAG(AggressiveInlineCountMax);
@@ -60,6 +63,8 @@ void InliningThreshold::SetHeuristics()
     leafInlineThreshold = CONFIG_FLAG(LeafInlineThreshold);
     loopInlineThreshold = CONFIG_FLAG(LoopInlineThreshold);
     polymorphicInlineThreshold = CONFIG_FLAG(PolymorphicInlineThreshold);
+    polymorphicInlineeCountMax = CONFIG_FLAG(PolymorphicInlineeCountMax);
+    polymorphicInlineBudget = CONFIG_FLAG(PolymorphicInlineBudget);
     maxNumberOfInlineesWithLoop = CONFIG_FLAG(MaxNumberOfInlineesWithLoop);
     constantArgumentInlineThreshold = CONFIG_FLAG(ConstantArgumentInlineThreshold);
     inlineCountMax = !forLoopBody ? CONFIG_FLAG(InlineCountMax) : CONFIG_FLAG(InlineCountMaxInLoopBodies);
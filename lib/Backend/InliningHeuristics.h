@@ -16,6 +16,8 @@ struct InliningThreshold
     int leafInlineThreshold;
     int loopInlineThreshold;
     int polymorphicInlineThreshold;
+    int polymorphicInlineeCountMax;
+    int polymorphicInlineBudget;
     int inlineCountMax;
     int maxNumberOfInlineesWithLoop;
     int constantArgumentInlineThreshold;
@@ -36,6 +36,12 @@ JITOutput::SetHasBailoutInstr(bool val)
     m_outputData->hasBailoutInstr = val;
 }
 
+void
+JITOutput::IncrementBailOutCount()
+{
+    m_outputData->bailOutCount++;
+}
+
 void
 JITOutput::SetArgUsedForBranch(uint8 param)
 {
@@ -239,6 +245,54 @@ JITOutput::FinalizeNativeCode()
     }
 }
 
+/* static */
+bool
+JITOutput::IsTimedPhase(Js::Phase phase)
+{
+    switch (phase)
+    {
+    case Js::IRBuilderPhase:
+    case Js::GlobOptPhase:
+    case Js::LowererPhase:
+    case Js::RegAllocPhase:
+    case Js::EncoderPhase:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void
+JITOutput::RecordPhaseTime(Js::Phase phase, LARGE_INTEGER startTime)
+{
+    LARGE_INTEGER endTime;
+    LARGE_INTEGER freq;
+    QueryPerformanceCounter(&endTime);
+    QueryPerformanceFrequency(&freq);
+
+    const unsigned int elapsed = (unsigned int)((endTime.QuadPart - startTime.QuadPart) * 1000000 / freq.QuadPart);
+    switch (phase)
+    {
+    case Js::IRBuilderPhase:
+        m_outputData->irBuilderTime += elapsed;
+        break;
+    case Js::GlobOptPhase:
+        m_outputData->globOptTime += elapsed;
+        break;
+    case Js::LowererPhase:
+        m_outputData->lowererTime += elapsed;
+        break;
+    case Js::RegAllocPhase:
+        m_outputData->regAllocTime += elapsed;
+        break;
+    case Js::EncoderPhase:
+        m_outputData->encoderTime += elapsed;
+        break;
+    default:
+        Assert(UNREACHED);
+    }
+}
+
 JITOutputIDL *
 JITOutput::GetOutputData()
 {
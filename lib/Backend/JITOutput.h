@@ -15,6 +15,7 @@ public:
     void SetVarSlotsOffset(int32 offset);
     void SetVarChangedOffset(int32 offset);
     void SetHasBailoutInstr(bool val);
+    void IncrementBailOutCount();
     void SetArgUsedForBranch(uint8 param);
     void SetFrameHeight(uint val);
     void RecordThrowMap(Js::ThrowMapEntry * throwMap, uint mapCount);
@@ -44,6 +45,9 @@ public:
 
     void FinalizeNativeCode();
 
+    static bool IsTimedPhase(Js::Phase phase);
+    void RecordPhaseTime(Js::Phase phase, LARGE_INTEGER startTime);
+
     JITOutputIDL * GetOutputData();
 private:
     template <typename TEmitBufferAllocation, typename TCodeGenAllocators>
@@ -2928,11 +2928,19 @@ LinearScan::Spill(Lifetime *newLifetime, IR::RegOpnd *regOpnd, bool dontSpillCur
         }
     }
 
+    // Inside loops, many candidates often end up with the same spill cost (typically the dense numeric
+    // loops of asm.js/wasm code). Break ties by spilling the lifetime that stays live the longest, as it
+    // would otherwise hold on to the register past the other candidates' last uses.
+    const bool breakTiesByEnd = this->curLoop && !PHASE_OFF(Js::LoopSpillTieBreakPhase, this->func);
+    uint candidateEnd = 0;
+
     SList<Lifetime *>::EditingIterator candidate;
     FOREACH_SLIST_ENTRY_EDITING(Lifetime *, lifetime, this->activeLiveranges, iter)
     {
         uint spillCost = this->GetSpillCost(lifetime);
-        if (spillCost < minSpillCost                        &&
+        bool isCheaper = spillCost < minSpillCost ||
+            (breakTiesByEnd && candidate.IsValid() && spillCost == minSpillCost && lifetime->end > candidateEnd);
+        if (isCheaper                                       &&
             this->instrUseRegs.Test(lifetime->reg) == false &&
             (lifetime->isFloat || lifetime->isSimd128()) == isFloatReg  &&
             !lifetime->cantSpill                            &&
@@ -2940,6 +2948,7 @@ LinearScan::Spill(Lifetime *newLifetime, IR::RegOpnd *regOpnd, bool dontSpillCur
             this->linearScanMD.FitRegIntSizeConstraints(lifetime->reg, intUsageBV))
         {
             minSpillCost = spillCost;
+            candidateEnd = lifetime->end;
             candidate = iter;
         }
     } NEXT_SLIST_ENTRY_EDITING;
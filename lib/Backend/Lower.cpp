@@ -854,7 +854,7 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
             }
 
 #ifdef PERF_HINT
-            if (PHASE_TRACE1(Js::PerfHintPhase))
+            if (IsPerfHintEnabled(this->m_func))
             {
                 WritePerfHint(PerfHints::CallsEval, this->m_func, instr->GetByteCodeOffset());
             }
@@ -6222,6 +6222,16 @@ IR::Instr* Lowerer::GenerateCompleteLdFld(IR::Instr* instr, bool emitFastPath, I
     bool isHelper = false;
     IR::RegOpnd* typeOpnd = nullptr;
 
+    emitFastPath = emitFastPath || DoSimpleJitFieldFastPath(instr, instr->GetSrc1()->AsSymOpnd());
+
+    IR::LabelInstr* labelProfileCacheHit = nullptr;
+    IR::LabelInstr* labelProfileDone = nullptr;
+    if (emitFastPath && instr->IsJitProfilingInstr())
+    {
+        Assert(!isRoot);
+        GenerateProfileLdFldCacheHit(instr, &labelProfileCacheHit, &labelProfileDone);
+    }
+
     if (isRoot)
     {
         // Don't do the fast path here if emitFastPath is false, even if we can.
@@ -6249,6 +6259,11 @@ IR::Instr* Lowerer::GenerateCompleteLdFld(IR::Instr* instr, bool emitFastPath, I
                 labelHelper->isOpHelper = isHelper;
                 instr->InsertBefore(labelHelper);
             }
+            if (labelProfileCacheHit != nullptr)
+            {
+                // The profiling helper records the access itself, so only fast path hits go on to profile the hit
+                InsertBranch(Js::OpCode::Br, labelProfileDone, labelProfileCacheHit);
+            }
             prevInstr = LowerLdFld(instr, monoHelperAfterFastPath, polyHelperAfterFastPath, true, labelBailOut, isHelper);
         }
     }
@@ -7058,6 +7073,86 @@ Lowerer::LowerStFld(
     return instrPrev;
 }
 
+// SimpleJit doesn't do fast paths, but the inline cache check with a direct slot access for field loads and stores
+// doesn't depend on GlobOpt and is much cheaper than the helper call. Profiling instrs still need every access profiled
+// for FullJit. A plain load with a monomorphic cache can only hit the local cache, which a cheap call can profile
+// after the fast path (see GenerateProfileLdFldCacheHit). Other profiling instrs keep going through their helpers.
+bool Lowerer::DoSimpleJitFieldFastPath(IR::Instr *const instr, IR::SymOpnd *const symOpnd) const
+{
+#ifdef INLINE_CACHE_STATS
+    if (PHASE_STATS1(Js::PolymorphicInlineCachePhase))
+    {
+        // Always use the slow path, so we can track property accesses
+        return false;
+    }
+#endif
+
+    if (!m_func->IsSimpleJit() ||
+        !symOpnd->IsPropertySymOpnd() ||
+        PHASE_OFF(Js::FastPathPhase, m_func) ||
+        PHASE_OFF(Js::SimpleJitFieldFastPathPhase, m_func))
+    {
+        return false;
+    }
+
+    IR::PropertySymOpnd *const propertySymOpnd = symOpnd->AsPropertySymOpnd();
+    if (instr->IsJitProfilingInstr() &&
+        (instr->m_opcode != Js::OpCode::LdFld ||
+            propertySymOpnd->m_runtimePolymorphicInlineCache ||
+            propertySymOpnd->m_sym->AsPropertySym()->m_propertyId == Js::PropertyIds::arguments))
+    {
+        return false;
+    }
+
+    PHASE_PRINT_TESTTRACE(
+        Js::SimpleJitFieldFastPathPhase,
+        m_func,
+        _u("SimpleJit field fast path: %s, func: %s, profiled: %s\n"),
+        Js::OpCodeUtil::GetOpCodeName(instr->m_opcode),
+        m_func->GetJITFunctionBody()->GetDisplayName(),
+        instr->IsJitProfilingInstr() ? _u("true") : _u("false"));
+
+    return true;
+}
+
+// Fast path hits for a profiling LdFld skip the profiling helper, so they continue to a call that profiles the hit:
+//
+//     dst = LdFld                    ; lowered to the fast path and then the profiling helper
+//     JMP $done                      ; inserted by the caller before the helper call is lowered
+// $cacheHit:
+//     CALL ProfiledLdFldCacheHit(dst, inlineCacheIndex, framePointer)
+// $done:
+void Lowerer::GenerateProfileLdFldCacheHit(IR::Instr *const instrLdFld, IR::LabelInstr **const labelCacheHitOut, IR::LabelInstr **const labelDoneOut)
+{
+    Assert(instrLdFld->IsJitProfilingInstr());
+    Assert(instrLdFld->m_opcode == Js::OpCode::LdFld);
+
+    IR::LabelInstr *const labelCacheHit = IR::LabelInstr::New(Js::OpCode::Label, m_func);
+    IR::LabelInstr *const labelDone = IR::LabelInstr::New(Js::OpCode::Label, m_func);
+    instrLdFld->InsertAfter(labelCacheHit);
+    labelCacheHit->InsertAfter(labelDone);
+
+    /*
+        void ProfilingHelpers::ProfiledLdFldCacheHit_Jit(
+            const Var value,
+            const InlineCacheIndex inlineCacheIndex,
+            void *const framePointer)
+    */
+
+    IR::Instr *const callInstr = IR::Instr::New(Js::OpCode::Call, m_func);
+    labelDone->InsertBefore(callInstr);
+    m_lowererMD.LoadHelperArgument(callInstr, IR::Opnd::CreateFramePointerOpnd(m_func));
+    m_lowererMD.LoadHelperArgument(
+        callInstr,
+        IR::Opnd::CreateInlineCacheIndexOpnd(instrLdFld->GetSrc1()->AsPropertySymOpnd()->m_inlineCacheIndex, m_func));
+    m_lowererMD.LoadHelperArgument(callInstr, instrLdFld->GetDst()->Copy(m_func));
+    callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::HelperProfiledLdFldCacheHit, m_func));
+    m_lowererMD.LowerCall(callInstr, 0);
+
+    *labelCacheHitOut = labelCacheHit;
+    *labelDoneOut = labelDone;
+}
+
 IR::Instr* Lowerer::GenerateCompleteStFld(IR::Instr* instr, bool emitFastPath, IR::JnHelperMethod monoHelperAfterFastPath, IR::JnHelperMethod polyHelperAfterFastPath,
     IR::JnHelperMethod monoHelperWithoutFastPath, IR::JnHelperMethod polyHelperWithoutFastPath, bool withPutFlags, Js::PropertyOperationFlags flags)
 {
@@ -7073,6 +7168,8 @@ IR::Instr* Lowerer::GenerateCompleteStFld(IR::Instr* instr, bool emitFastPath, I
     IR::LabelInstr* labelHelper = nullptr;
     bool isHelper = false;
     IR::RegOpnd* typeOpnd = nullptr;
+
+    emitFastPath = emitFastPath || DoSimpleJitFieldFastPath(instr, instr->GetDst()->AsSymOpnd());
     if(emitFastPath && GenerateFastStFldForCustomProperty(instr, &labelHelper))
     {
         if(labelHelper)
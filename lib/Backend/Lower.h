@@ -126,6 +126,8 @@ private:
     IR::Instr *     LowerScopedDelFld(IR::Instr *instr, IR::JnHelperMethod helperMethod, bool withInlineCache, bool strictMode);
     IR::Instr *     LowerNewScFunc(IR::Instr *instr);
     IR::Instr *     LowerNewScGenFunc(IR::Instr *instr);
+    bool            DoSimpleJitFieldFastPath(IR::Instr *const instr, IR::SymOpnd *const symOpnd) const;
+    void            GenerateProfileLdFldCacheHit(IR::Instr *const instrLdFld, IR::LabelInstr **const labelCacheHitOut, IR::LabelInstr **const labelDoneOut);
     IR::Instr*      GenerateCompleteStFld(IR::Instr* instr, bool emitFastPath, IR::JnHelperMethod monoHelperAfterFastPath, IR::JnHelperMethod polyHelperAfterFastPath,
                         IR::JnHelperMethod monoHelperWithoutFastPath, IR::JnHelperMethod polyHelperWithoutFastPath, bool withPutFlags, Js::PropertyOperationFlags flags);
     bool            GenerateStFldWithCachedType(IR::Instr * instrStFld, bool* continueAsHelperOut, IR::LabelInstr** labelHelperOut, IR::RegOpnd** typeOpndOut);
@@ -5,7 +5,7 @@
 #include "Backend.h"
 
 NativeCodeData::NativeCodeData(DataChunk * chunkList) 
-    : chunkList(chunkList)
+    : chunkList(chunkList), totalSize(0)
 {
 #ifdef PERF_COUNTERS
     this->size = 0;
@@ -266,7 +266,6 @@ NativeCodeData::Allocator::Alloc(DECLSPEC_GUARD_OVERFLOW size_t requestSize)
             this->lastChunkList->next = newChunk;
             this->lastChunkList = newChunk;
         }
-        this->totalSize += (unsigned int)requestSize;
         data = newChunk->data;
     }
     else
@@ -276,6 +275,7 @@ NativeCodeData::Allocator::Alloc(DECLSPEC_GUARD_OVERFLOW size_t requestSize)
         this->noFixupChunkList = newChunk;
         data = newChunk->data;
     }
+    this->totalSize += (unsigned int)requestSize;
 
 
 #ifdef PERF_COUNTERS
@@ -316,6 +316,7 @@ NativeCodeData::Allocator::Finalize()
     if (this->chunkList != nullptr)
     {
         data = HeapNew(NativeCodeData, this->chunkList);
+        data->totalSize = this->totalSize;
         this->chunkList = nullptr;
 #ifdef PERF_COUNTERS
         data->size = this->size;
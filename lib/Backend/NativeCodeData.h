@@ -66,6 +66,7 @@ public:
         DataChunk * chunkList;
         DataChunkNoFixup * noFixupChunkList;
     };
+    unsigned int totalSize;
 
 #ifdef PERF_COUNTERS
     size_t size;
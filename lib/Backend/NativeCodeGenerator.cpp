@@ -796,7 +796,7 @@ volatile UINT_PTR NativeCodeGenerator::CodegenFailureSeed = 0;
 #endif
 
 void
-NativeCodeGenerator::CodeGen(PageAllocator * pageAllocator, CodeGenWorkItem* workItem, const bool foreground)
+NativeCodeGenerator::CodeGen(PageAllocator * pageAllocator, CodeGenWorkItem* workItem, const bool foreground, JitArenaAllocator * threadJitArena)
 {
     if(foreground)
     {
@@ -910,7 +910,23 @@ NativeCodeGenerator::CodeGen(PageAllocator * pageAllocator, CodeGenWorkItem* wor
     {
         InProcCodeGenAllocators *const allocators =
             foreground ? EnsureForegroundAllocators(pageAllocator) : GetBackgroundAllocator(pageAllocator); // okay to do outside lock since the respective function is called only from one thread
-        NoRecoverMemoryJitArenaAllocator jitArena(_u("JITArena"), pageAllocator, Js::Throw::OutOfMemory);
+        // Background threads keep one arena across jobs so its pages are not returned to and taken back from the page
+        // allocator for every function. It is reset when the job is done, even if code gen throws.
+        NoRecoverMemoryJitArenaAllocator localJitArena(_u("JITArena"), pageAllocator, Js::Throw::OutOfMemory);
+        Assert(threadJitArena == nullptr || threadJitArena->GetPageAllocator() == pageAllocator);
+        JitArenaAllocator& jitArena = threadJitArena != nullptr ? *threadJitArena : localJitArena;
+        struct AutoResetJitArena
+        {
+            AutoResetJitArena(JitArenaAllocator * arena) : arena(arena) {}
+            ~AutoResetJitArena()
+            {
+                if (arena != nullptr)
+                {
+                    arena->ResetRetainLargestBlock();
+                }
+            }
+            JitArenaAllocator * arena;
+        } autoResetJitArena(threadJitArena);
 #if DBG
         jitArena.SetNeedsDelayFreeList();
 #endif
@@ -1151,6 +1167,25 @@ NativeCodeGenerator::CodeGen(PageAllocator * pageAllocator, CodeGenWorkItem* wor
 
     NativeCodeGenerator::LogCodeGenDone(workItem, &start_time);
 
+    ThreadContext::BackgroundCallback<ThreadContext::JitCompileCallbackFunction> * jitCompileCallback = scriptContext->GetThreadContext()->GetJitCompileCallback();
+    if (jitCompileCallback->IsSet())
+    {
+        ThreadContext::JitCompileStatistics statistics;
+        statistics.functionBody = body;
+        statistics.isLoopBody = workItem->Type() == JsLoopBodyWorkItemType;
+        statistics.irBuilderTime = jitWriteData.irBuilderTime;
+        statistics.globOptTime = jitWriteData.globOptTime;
+        statistics.lowererTime = jitWriteData.lowererTime;
+        statistics.regAllocTime = jitWriteData.regAllocTime;
+        statistics.encoderTime = jitWriteData.encoderTime;
+        statistics.codeSize = jitWriteData.codeSize;
+        statistics.bailOutCount = jitWriteData.bailOutCount;
+        jitCompileCallback->Invoke([&](ThreadContext::JitCompileCallbackFunction callback, void * context)
+        {
+            callback(context, statistics);
+        });
+    }
+
 #ifdef BGJIT_STATS
     // Must be interlocked because the following data may be modified from the background and foreground threads concurrently
     Js::ScriptContext *scriptContext = workItem->GetScriptContext();
@@ -1755,6 +1790,7 @@ NativeCodeGenerator::Process(JsUtil::Job *const job, JsUtil::ParallelThreadData
 {
     const bool foreground = !threadData;
     PageAllocator *pageAllocator;
+    JitArenaAllocator *threadJitArena = nullptr;
     if (foreground)
     {
         pageAllocator = scriptContext->GetThreadContext()->GetPageAllocator();
@@ -1762,6 +1798,7 @@ NativeCodeGenerator::Process(JsUtil::Job *const job, JsUtil::ParallelThreadData
     else
     {
         pageAllocator = threadData->GetPageAllocator();
+        threadJitArena = threadData->jitArena;
     }
 
     CodeGenWorkItem *const codeGenWork = static_cast<CodeGenWorkItem *>(job);
@@ -1785,7 +1822,7 @@ NativeCodeGenerator::Process(JsUtil::Job *const job, JsUtil::ParallelThreadData
         // Unless we're in a ForceNative configuration, ignore this workitem if it exceeds JIT limits
         if (fn->ForceJITLoopBody() || !WorkItemExceedsJITLimits(codeGenWork))
         {
-            CodeGen(pageAllocator, codeGenWork, foreground);
+            CodeGen(pageAllocator, codeGenWork, foreground, threadJitArena);
             return true;
         }
         Js::EntryPointInfo * entryPoint = loopBodyCodeGenWorkItem->GetEntryPoint();
@@ -1797,7 +1834,7 @@ NativeCodeGenerator::Process(JsUtil::Job *const job, JsUtil::ParallelThreadData
         // Unless we're in a ForceNative configuration, ignore this workitem if it exceeds JIT limits
         if (IS_PREJIT_ON() || Js::Configuration::Global.flags.ForceNative || !WorkItemExceedsJITLimits(codeGenWork))
         {
-            CodeGen(pageAllocator, codeGenWork, foreground);
+            CodeGen(pageAllocator, codeGenWork, foreground, threadJitArena);
             return true;
         }
 #if ENABLE_DEBUG_CONFIG_OPTIONS
@@ -3360,6 +3397,8 @@ void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem,
             workItemRemoved->OnRemoveFromJitQueue(this);
         }
     }
+    // Order the job among other queued jobs by how hot the function or loop body was before it was queued
+    codeGenWorkItem->SetWeight(codeGenWorkItem->GetInterpretedCount());
     Processor()->AddJob(codeGenWorkItem, prioritize);   // This one can throw (really unlikely though), OOM specifically.
     if(jitMode == ExecutionMode::FullJit)
     {
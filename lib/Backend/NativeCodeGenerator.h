@@ -125,7 +125,7 @@ public:
 
 private:
 
-    void CodeGen(PageAllocator * pageAllocator, CodeGenWorkItem* workItem, const bool foreground);
+    void CodeGen(PageAllocator * pageAllocator, CodeGenWorkItem* workItem, const bool foreground, JitArenaAllocator * threadJitArena = nullptr);
 
     InProcCodeGenAllocators *CreateAllocators(PageAllocator *const pageAllocator)
     {
@@ -148,23 +148,19 @@ SimpleLayout::Layout()
                         else
                         {
                             IR::Instr *lastOpHelperInstr = labelInstr->GetPrevRealInstr();
-                            if (lastOpHelperInstr->IsBranchInstr())
+                            if (lastOpHelperInstr->IsBranchInstr() || !PHASE_OFF(Js::ColdHelperLayoutPhase, this->func))
                             {
-                                IR::BranchInstr *lastOpHelperBranchInstr = lastOpHelperInstr->AsBranchInstr();
-
                                 //      jmp $target         <== prevInstr           //this is unconditional jump
                                 // $helper:                 <== lastOpHelperLabel
                                 //      ...
-                                //      jmp $labeln         <== lastOpHelperInstr   //Conditional/Unconditional jump
+                                //      jmp $labeln         <== lastOpHelperInstr   //Conditional/Unconditional jump, or any other instr
                                 // $label:                  <== labelInstr
 
+                                // The helper block is only reachable through branches, so it is cold code that doesn't
+                                // need to sit in the middle of the fast path. MoveHelperBlock adds the jmp back to $label
+                                // if the last instruction of the block can fall through.
+
                                 lastInstr = this->MoveHelperBlock(lastOpHelperLabel, lastOpHelperStatementIndex, lastOpHelperFunc, labelInstr, lastInstr);
-                                //Compensation code if its not unconditional jump
-                                if (!lastOpHelperBranchInstr->IsUnconditional())
-                                {
-                                    IR::BranchInstr *branchInstr = IR::BranchInstr::New(LowererMD::MDUncondBranchOpcode, labelInstr, this->func);
-                                    lastOpHelperBranchInstr->InsertAfter(branchInstr);
-                                }
                             }
 
                         }
@@ -99,6 +99,7 @@ void SetProfilerFromNativeCodeGen(NativeCodeGenerator * toNativeCodeGen, NativeC
 #endif
 
 void DeleteNativeCodeData(NativeCodeData * data);
+size_t GetNativeCodeDataSize(NativeCodeData * data);
 #else
 inline BOOL IsIntermediateCodeGenThunk(Js::JavascriptMethod codeAddress) { return false; }
 inline BOOL IsAsmJsCodeGenThunk(Js::JavascriptMethod codeAddress) { return false; }
@@ -4,6 +4,10 @@
 //-------------------------------------------------------------------------------------------------------
 #include "Utf8Codex.h"
 
+#if defined(_M_IX86) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
 #ifndef _WIN32
 #undef _Analysis_assume_
 #define _Analysis_assume_(expr)
@@ -40,6 +44,49 @@ namespace utf8
         return (reinterpret_cast<size_t>(pb) & mAlignmentMask) == 0 && (reinterpret_cast<size_t>(pch) & mAlignmentMask) == 0;
     }
 
+#if defined(_M_IX86) || defined(_M_X64)
+    // Widen ASCII 16 bytes at a time. Stops at the first block containing a byte with the high bit set,
+    // or when fewer than 16 bytes are left; the caller handles the rest.
+    inline void DecodeAsciiBlocks(LPCUTF8& pb, LPCUTF8 pbEnd, char16*& pch)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        while (pbEnd - pb >= 16)
+        {
+            const __m128i bytes = _mm_loadu_si128((const __m128i *)pb);
+            if (_mm_movemask_epi8(bytes) != 0)
+            {
+                return;
+            }
+            _mm_storeu_si128((__m128i *)pch, _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128((__m128i *)(pch + 8), _mm_unpackhi_epi8(bytes, zero));
+            pb += 16;
+            pch += 16;
+        }
+    }
+
+    // Narrow ASCII 16 characters at a time. Stops at the first block containing a character above 0x7F,
+    // or when fewer than 16 characters are left; the caller handles the rest.
+    inline void EncodeAsciiBlocks(LPUTF8& pb, const char16*& pch, charcount_t& cch)
+    {
+        const __m128i nonAscii = _mm_set1_epi16((short)0xFF80);
+        const __m128i zero = _mm_setzero_si128();
+        while (cch >= 16)
+        {
+            const __m128i low = _mm_loadu_si128((const __m128i *)pch);
+            const __m128i high = _mm_loadu_si128((const __m128i *)(pch + 8));
+            const __m128i test = _mm_and_si128(_mm_or_si128(low, high), nonAscii);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(test, zero)) != 0xFFFF)
+            {
+                return;
+            }
+            _mm_storeu_si128((__m128i *)pb, _mm_packus_epi16(low, high));
+            pb += 16;
+            pch += 16;
+            cch -= 16;
+        }
+    }
+#endif
+
     inline size_t EncodedBytes(char16 prefix)
     {
          CodexAssert(0 == (prefix & 0xFF00)); // prefix must really be a byte. We use char16 for as a convenience for the API.
@@ -384,6 +431,14 @@ LFourByte:
         if (!ShouldFastPath(ptr, buffer)) goto LSlowPath;
 
 LFastPath:
+#if defined(_M_IX86) || defined(_M_X64)
+        {
+            // Every ASCII byte is one character, so the first cch bytes are all readable.
+            LPCUTF8 start = ptr;
+            DecodeAsciiBlocks(ptr, ptr + cch, buffer);
+            cch -= ptr - start;
+        }
+#endif
         while (cch >= 4)
         {
             uint32 bytes = *(uint32 *)ptr;
@@ -419,6 +474,9 @@ LSlowPath:
         if (!ShouldFastPath(p, dest)) goto LSlowPath;
 
 LFastPath:
+#if defined(_M_IX86) || defined(_M_X64)
+        DecodeAsciiBlocks(p, pbEnd, dest);
+#endif
         while (p + 3 < pbEnd)
         {
             unsigned bytes = *(unsigned *)p;
@@ -482,6 +540,9 @@ LSlowPath:
         if (!ShouldFastPath(dest, source)) goto LSlowPath;
 
 LFastPath:
+#if defined(_M_IX86) || defined(_M_X64)
+        EncodeAsciiBlocks(dest, source, cch);
+#endif
         while (cch >= 4)
         {
             uint32 first = ((const uint32 *)source)[0];
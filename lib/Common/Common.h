@@ -106,6 +106,7 @@ template<> struct IntMath<int64> { using Type = Int64Math; };
 #include "DataStructures/WeakReferenceDictionary.h"
 #include "DataStructures/LeafValueDictionary.h"
 #include "DataStructures/Dictionary.h"
+#include "DataStructures/OpenAddressingDictionary.h"
 #include "DataStructures/List.h"
 #include "DataStructures/Stack.h"
 #include "DataStructures/Queue.h"
@@ -115,6 +116,7 @@ template<> struct IntMath<int64> { using Type = Int64Math; };
 #include "DataStructures/InternalStringNoCaseComparer.h"
 #include "DataStructures/SparseArray.h"
 #include "DataStructures/GrowingArray.h"
+#include "DataStructures/ConcurrentReadArray.h"
 #include "DataStructures/EvalMapString.h"
 #include "DataStructures/RegexKey.h"
 #include "DataStructures/LineOffsetCache.h"
@@ -33,14 +33,14 @@ namespace JsUtil
     // Job
     // -------------------------------------------------------------------------------------------------------------------------
 
-    Job::Job(const bool isCritical) : manager(0), isCritical(isCritical)
+    Job::Job(const bool isCritical) : manager(0), queueKey(0), weight(0), isCritical(isCritical)
 #if ENABLE_DEBUG_CONFIG_OPTIONS
         , failureReason(FailureReason::NotFailed)
 #endif
     {
     }
 
-    Job::Job(JobManager *const manager, const bool isCritical) : manager(manager), isCritical(isCritical)
+    Job::Job(JobManager *const manager, const bool isCritical) : manager(manager), queueKey(0), weight(0), isCritical(isCritical)
 #if ENABLE_DEBUG_CONFIG_OPTIONS
         , failureReason(FailureReason::NotFailed)
 #endif
@@ -58,6 +58,16 @@ namespace JsUtil
         return isCritical;
     }
 
+    uint Job::GetWeight() const
+    {
+        return weight;
+    }
+
+    void Job::SetWeight(const uint weight)
+    {
+        this->weight = weight;
+    }
+
     // -------------------------------------------------------------------------------------------------------------------------
     // JobManager
     // -------------------------------------------------------------------------------------------------------------------------
@@ -205,8 +215,16 @@ namespace JsUtil
     // JobProcessor
     // -------------------------------------------------------------------------------------------------------------------------
 
-    JobProcessor::JobProcessor(const bool processesInBackground) : processesInBackground(processesInBackground), isClosed(false)
+    JobProcessor::JobProcessor(const bool processesInBackground) : processesInBackground(processesInBackground), isClosed(false), numJobsAdded(0)
+    {
+    }
+
+    void JobProcessor::MoveJobToBeginning(Job *const job)
     {
+        // This function is called from inside the lock
+
+        job->queueKey = Job::PrioritizedQueueKey;
+        jobs.MoveToBeginning(job);
     }
 
     bool JobProcessor::ProcessesInBackground() const
@@ -277,6 +295,7 @@ namespace JsUtil
         {
             if (job->Manager() == manager)
             {
+                job->queueKey = Job::PrioritizedQueueKey;
                 if (!lastJob)
                     lastJob = job;
             }
@@ -310,9 +329,31 @@ namespace JsUtil
         ++job->Manager()->numJobsAddedToProcessor;
 
         if (prioritize)
+        {
+            job->queueKey = Job::PrioritizedQueueKey;
             jobs.LinkToBeginning(job);
+            return;
+        }
+
+        // Keep the queue ordered by weight, heaviest first. To keep a stream of heavy jobs from starving lighter ones, a queued
+        // job gains JobQueueAgingWeight for each job added after it. All queued jobs age at the same rate, so ordering by
+        // (weight - aging * time added) gives the same order without having to update queued jobs. Jobs of equal weight keep
+        // their FIFO order, and most jobs are inserted near the end, so search from there.
+        job->queueKey = static_cast<int64>(job->weight) - static_cast<int64>(numJobsAdded++ * (uint64)CONFIG_FLAG(JobQueueAgingWeight));
+        Job *previousJob = jobs.Tail();
+        while (previousJob && previousJob->queueKey < job->queueKey)
+        {
+            previousJob = previousJob->Previous();
+        }
+
+        if (previousJob)
+        {
+            jobs.LinkAfter(job, previousJob);
+        }
         else
-            jobs.LinkToEnd(job);
+        {
+            jobs.LinkToBeginning(job);
+        }
     }
 
     bool JobProcessor::RemoveJob(Job *const job)
@@ -482,7 +523,7 @@ namespace JsUtil
     // BackgroundJobProcessor
     // -------------------------------------------------------------------------------------------------------------------------
 
-    void BackgroundJobProcessor::InitializeThreadCount()
+    void BackgroundJobProcessor::InitializeThreadCount(bool isProcessWide)
     {
         if (CONFIG_FLAG(ForceMaxJitThreadCount))
         {
@@ -493,6 +534,13 @@ namespace JsUtil
             // In a low-memory scenario, don't spin up multiple threads, regardless of how many cores we have.
             this->maxThreadCount = 1;
         }
+        else if (isProcessWide)
+        {
+            // A process-wide processor serves the runtimes on every thread, so MaxJitThreadCount (which is meant for a
+            // single runtime) would leave the queue backed up when many runtimes are hot. Leave one core for the GC.
+            int processorCount = AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
+            this->maxThreadCount = max(1, max(processorCount - 1, CONFIG_FLAG(MaxJitThreadCount)));
+        }
         else
         {
             int processorCount = AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
@@ -502,11 +550,11 @@ namespace JsUtil
         }
     }
 
-    void BackgroundJobProcessor::InitializeParallelThreadData(AllocationPolicyManager* policyManager, bool disableParallelThreads)
+    void BackgroundJobProcessor::InitializeParallelThreadData(AllocationPolicyManager* policyManager, bool disableParallelThreads, bool isProcessWide)
     {
         if (!disableParallelThreads)
         {
-            InitializeThreadCount();
+            InitializeThreadCount(isProcessWide);
         }
         else
         {
@@ -605,7 +653,7 @@ namespace JsUtil
         return;
     }
 
-    BackgroundJobProcessor::BackgroundJobProcessor(AllocationPolicyManager* policyManager, JsUtil::ThreadService *threadService, bool disableParallelThreads)
+    BackgroundJobProcessor::BackgroundJobProcessor(AllocationPolicyManager* policyManager, JsUtil::ThreadService *threadService, bool disableParallelThreads, bool isProcessWide)
         : JobProcessor(true),
         jobReady(true),
         wakeAllBackgroundThreads(false),
@@ -618,7 +666,7 @@ namespace JsUtil
         if (!threadService->HasCallback())
         {
             // We don't have a thread service, so create a dedicated thread to handle background jobs.
-            InitializeParallelThreadData(policyManager, disableParallelThreads);
+            InitializeParallelThreadData(policyManager, disableParallelThreads, isProcessWide);
         }
         else
         {
@@ -680,6 +728,10 @@ namespace JsUtil
             if (threadData->CanDecommit())
             {
                 // If its 1sec time out decommit and wait for INFINITE
+                if (threadData->jitArena != nullptr)
+                {
+                    threadData->jitArena->Clear();
+                }
                 threadData->backgroundPageAllocator.DecommitNow();
                 this->ForEachManager([&](JobManager *manager){
                     manager->OnDecommit(threadData);
@@ -1022,6 +1074,8 @@ namespace JsUtil
 
         ArenaAllocator threadArena(_u("ThreadArena"), threadData->GetPageAllocator(), Js::Throw::OutOfMemory);
         threadData->threadArena = &threadArena;
+        NoRecoverMemoryJitArenaAllocator jitArena(_u("JITArena"), threadData->GetPageAllocator(), Js::Throw::OutOfMemory);
+        threadData->jitArena = &jitArena;
 
         {
             // Make sure we take decommit action before the threadArena is torn down, in case the
@@ -34,10 +34,16 @@ namespace JsUtil
     {
         friend SingleJobManager;
         friend WaitableSingleJobManager;
+        friend JobProcessor;
 
     private:
         JobManager *manager;
 
+        // Position of the job in the job processor's queue relative to other jobs (see JobProcessor::AddJob)
+        int64 queueKey;
+        uint weight;
+        static const int64 PrioritizedQueueKey = INT64_MAX;
+
         // Jobs may be aborted if the job processor is closed while there are still queued jobs, or if a job manager is removed
         // while it still has jobs queued to the job processor. Critical jobs are not aborted and rather processed during the
         // JobProcessor::Close call. Aborted jobs are not processed and instead the job manager is notified with
@@ -65,6 +71,11 @@ namespace JsUtil
     public:
         JobManager *Manager() const;
         bool IsCritical() const;
+
+        // Among jobs that are not prioritized, jobs with a greater weight are processed first. Must be set before the job is
+        // added to the job processor.
+        uint GetWeight() const;
+        void SetWeight(const uint weight);
     };
 
     // -------------------------------------------------------------------------------------------------------------------------
@@ -295,10 +306,13 @@ namespace JsUtil
         DoublyLinkedList<Job> jobs;
     private:
         bool isClosed;
+        uint64 numJobsAdded;    // used to age queued jobs
 
     protected:
         JobProcessor(const bool processesInBackground);
 
+        void MoveJobToBeginning(Job *const job);
+
     public:
         // Ideally, a job manager should not need to depend on this, but there may be cases where it's needed (such as if
         // processing jobs needs to support the -profile switch)
@@ -418,6 +432,7 @@ namespace JsUtil
         Event threadStartedOrClosing; //This is only used for shutdown scenario to indicate background thread is shutting down or starting
         PageAllocator backgroundPageAllocator;
         ArenaAllocator *threadArena;
+        JitArenaAllocator *jitArena;    // Reused across the code gen jobs on this thread, keeps its largest page block
         BackgroundJobProcessor *processor;
         Parser *parser;
         CompileScriptException *pse;
@@ -433,6 +448,7 @@ namespace JsUtil
                                      PageAllocator::DefaultLowMaxFreePageCount :
                                      PageAllocator::DefaultMaxFreePageCount)),
             threadArena(nullptr),
+            jitArena(nullptr),
             processor(nullptr),
             parser(nullptr),
             pse(nullptr)
@@ -462,7 +478,7 @@ namespace JsUtil
 #endif
 
     public:
-        BackgroundJobProcessor(AllocationPolicyManager* policyManager, ThreadService *threadService, bool disableParallelThreads);
+        BackgroundJobProcessor(AllocationPolicyManager* policyManager, ThreadService *threadService, bool disableParallelThreads, bool isProcessWide = false);
         ~BackgroundJobProcessor();
 
 
@@ -478,8 +494,8 @@ namespace JsUtil
         Job* GetCurrentJobOfManager(JobManager *const manager);
         ParallelThreadData * GetThreadDataFromCurrentJob(Job* job);
 
-        void InitializeThreadCount();
-        void InitializeParallelThreadData(AllocationPolicyManager* policyManager, bool disableParallelThreads);
+        void InitializeThreadCount(bool isProcessWide);
+        void InitializeParallelThreadData(AllocationPolicyManager* policyManager, bool disableParallelThreads, bool isProcessWide);
         void InitializeParallelThreadDataForThreadServiceCallBack(AllocationPolicyManager* policyManager);
 
     public:
@@ -363,7 +363,7 @@ namespace JsUtil
             bool forcedInThread = (threadService->HasCallback() && this->parallelThreadData[0]->isWaitingForJobs);
             if (!forcedInThread && !manager->ShouldProcessInForeground(false, numJobs))
             {
-                jobs.MoveToBeginning(job);
+                MoveJobToBeginning(job);
                 manager->PrioritizedButNotYetProcessed(job);
                 return false;
             }
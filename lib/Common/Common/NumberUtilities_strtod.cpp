@@ -892,6 +892,367 @@ LFail:
 /***************************************************************************
 String to Double.
 ***************************************************************************/
+/***************************************************************************
+Eisel-Lemire decimal to double conversion (Lemire, "Number Parsing at a
+Gigabyte per Second", 2021).
+
+Computes the correctly rounded double nearest to luMan * 10^lwExp from a
+128-bit truncated approximation of 10^lwExp. Fails, so the caller can fall
+back to the BIGNUM path, when the approximation is too close to a rounding
+boundary to decide, at exact halfway points, and for results that would be
+subnormal or overflow.
+***************************************************************************/
+static const int32 klwPow10FastMin = -128;
+static const int32 klwPow10FastMax = 128;
+
+// 10^k for k in [klwPow10FastMin, klwPow10FastMax], normalized to 128 bits and truncated.
+static const uint64 g_rgluPow10Fast[][2] =
+{
+    { 0xDDD0467C64BCE4A0ull, 0xAC7CB3F6D05DDBDEull }, // 1e-128
+    { 0x8AA22C0DBEF60EE4ull, 0x6BCDF07A423AA96Bull }, // 1e-127
+    { 0xAD4AB7112EB3929Dull, 0x86C16C98D2C953C6ull }, // 1e-126
+    { 0xD89D64D57A607744ull, 0xE871C7BF077BA8B7ull }, // 1e-125
+    { 0x87625F056C7C4A8Bull, 0x11471CD764AD4972ull }, // 1e-124
+    { 0xA93AF6C6C79B5D2Dull, 0xD598E40D3DD89BCFull }, // 1e-123
+    { 0xD389B47879823479ull, 0x4AFF1D108D4EC2C3ull }, // 1e-122
+    { 0x843610CB4BF160CBull, 0xCEDF722A585139BAull }, // 1e-121
+    { 0xA54394FE1EEDB8FEull, 0xC2974EB4EE658828ull }, // 1e-120
+    { 0xCE947A3DA6A9273Eull, 0x733D226229FEEA32ull }, // 1e-119
+    { 0x811CCC668829B887ull, 0x0806357D5A3F525Full }, // 1e-118
+    { 0xA163FF802A3426A8ull, 0xCA07C2DCB0CF26F7ull }, // 1e-117
+    { 0xC9BCFF6034C13052ull, 0xFC89B393DD02F0B5ull }, // 1e-116
+    { 0xFC2C3F3841F17C67ull, 0xBBAC2078D443ACE2ull }, // 1e-115
+    { 0x9D9BA7832936EDC0ull, 0xD54B944B84AA4C0Dull }, // 1e-114
+    { 0xC5029163F384A931ull, 0x0A9E795E65D4DF11ull }, // 1e-113
+    { 0xF64335BCF065D37Dull, 0x4D4617B5FF4A16D5ull }, // 1e-112
+    { 0x99EA0196163FA42Eull, 0x504BCED1BF8E4E45ull }, // 1e-111
+    { 0xC06481FB9BCF8D39ull, 0xE45EC2862F71E1D6ull }, // 1e-110
+    { 0xF07DA27A82C37088ull, 0x5D767327BB4E5A4Cull }, // 1e-109
+    { 0x964E858C91BA2655ull, 0x3A6A07F8D510F86Full }, // 1e-108
+    { 0xBBE226EFB628AFEAull, 0x890489F70A55368Bull }, // 1e-107
+    { 0xEADAB0ABA3B2DBE5ull, 0x2B45AC74CCEA842Eull }, // 1e-106
+    { 0x92C8AE6B464FC96Full, 0x3B0B8BC90012929Dull }, // 1e-105
+    { 0xB77ADA0617E3BBCBull, 0x09CE6EBB40173744ull }, // 1e-104
+    { 0xE55990879DDCAABDull, 0xCC420A6A101D0515ull }, // 1e-103
+    { 0x8F57FA54C2A9EAB6ull, 0x9FA946824A12232Dull }, // 1e-102
+    { 0xB32DF8E9F3546564ull, 0x47939822DC96ABF9ull }, // 1e-101
+    { 0xDFF9772470297EBDull, 0x59787E2B93BC56F7ull }, // 1e-100
+    { 0x8BFBEA76C619EF36ull, 0x57EB4EDB3C55B65Aull }, // 1e-99
+    { 0xAEFAE51477A06B03ull, 0xEDE622920B6B23F1ull }, // 1e-98
+    { 0xDAB99E59958885C4ull, 0xE95FAB368E45ECEDull }, // 1e-97
+    { 0x88B402F7FD75539Bull, 0x11DBCB0218EBB414ull }, // 1e-96
+    { 0xAAE103B5FCD2A881ull, 0xD652BDC29F26A119ull }, // 1e-95
+    { 0xD59944A37C0752A2ull, 0x4BE76D3346F0495Full }, // 1e-94
+    { 0x857FCAE62D8493A5ull, 0x6F70A4400C562DDBull }, // 1e-93
+    { 0xA6DFBD9FB8E5B88Eull, 0xCB4CCD500F6BB952ull }, // 1e-92
+    { 0xD097AD07A71F26B2ull, 0x7E2000A41346A7A7ull }, // 1e-91
+    { 0x825ECC24C873782Full, 0x8ED400668C0C28C8ull }, // 1e-90
+    { 0xA2F67F2DFA90563Bull, 0x728900802F0F32FAull }, // 1e-89
+    { 0xCBB41EF979346BCAull, 0x4F2B40A03AD2FFB9ull }, // 1e-88
+    { 0xFEA126B7D78186BCull, 0xE2F610C84987BFA8ull }, // 1e-87
+    { 0x9F24B832E6B0F436ull, 0x0DD9CA7D2DF4D7C9ull }, // 1e-86
+    { 0xC6EDE63FA05D3143ull, 0x91503D1C79720DBBull }, // 1e-85
+    { 0xF8A95FCF88747D94ull, 0x75A44C6397CE912Aull }, // 1e-84
+    { 0x9B69DBE1B548CE7Cull, 0xC986AFBE3EE11ABAull }, // 1e-83
+    { 0xC24452DA229B021Bull, 0xFBE85BADCE996168ull }, // 1e-82
+    { 0xF2D56790AB41C2A2ull, 0xFAE27299423FB9C3ull }, // 1e-81
+    { 0x97C560BA6B0919A5ull, 0xDCCD879FC967D41Aull }, // 1e-80
+    { 0xBDB6B8E905CB600Full, 0x5400E987BBC1C920ull }, // 1e-79
+    { 0xED246723473E3813ull, 0x290123E9AAB23B68ull }, // 1e-78
+    { 0x9436C0760C86E30Bull, 0xF9A0B6720AAF6521ull }, // 1e-77
+    { 0xB94470938FA89BCEull, 0xF808E40E8D5B3E69ull }, // 1e-76
+    { 0xE7958CB87392C2C2ull, 0xB60B1D1230B20E04ull }, // 1e-75
+    { 0x90BD77F3483BB9B9ull, 0xB1C6F22B5E6F48C2ull }, // 1e-74
+    { 0xB4ECD5F01A4AA828ull, 0x1E38AEB6360B1AF3ull }, // 1e-73
+    { 0xE2280B6C20DD5232ull, 0x25C6DA63C38DE1B0ull }, // 1e-72
+    { 0x8D590723948A535Full, 0x579C487E5A38AD0Eull }, // 1e-71
+    { 0xB0AF48EC79ACE837ull, 0x2D835A9DF0C6D851ull }, // 1e-70
+    { 0xDCDB1B2798182244ull, 0xF8E431456CF88E65ull }, // 1e-69
+    { 0x8A08F0F8BF0F156Bull, 0x1B8E9ECB641B58FFull }, // 1e-68
+    { 0xAC8B2D36EED2DAC5ull, 0xE272467E3D222F3Full }, // 1e-67
+    { 0xD7ADF884AA879177ull, 0x5B0ED81DCC6ABB0Full }, // 1e-66
+    { 0x86CCBB52EA94BAEAull, 0x98E947129FC2B4E9ull }, // 1e-65
+    { 0xA87FEA27A539E9A5ull, 0x3F2398D747B36224ull }, // 1e-64
+    { 0xD29FE4B18E88640Eull, 0x8EEC7F0D19A03AADull }, // 1e-63
+    { 0x83A3EEEEF9153E89ull, 0x1953CF68300424ACull }, // 1e-62
+    { 0xA48CEAAAB75A8E2Bull, 0x5FA8C3423C052DD7ull }, // 1e-61
+    { 0xCDB02555653131B6ull, 0x3792F412CB06794Dull }, // 1e-60
+    { 0x808E17555F3EBF11ull, 0xE2BBD88BBEE40BD0ull }, // 1e-59
+    { 0xA0B19D2AB70E6ED6ull, 0x5B6ACEAEAE9D0EC4ull }, // 1e-58
+    { 0xC8DE047564D20A8Bull, 0xF245825A5A445275ull }, // 1e-57
+    { 0xFB158592BE068D2Eull, 0xEED6E2F0F0D56712ull }, // 1e-56
+    { 0x9CED737BB6C4183Dull, 0x55464DD69685606Bull }, // 1e-55
+    { 0xC428D05AA4751E4Cull, 0xAA97E14C3C26B886ull }, // 1e-54
+    { 0xF53304714D9265DFull, 0xD53DD99F4B3066A8ull }, // 1e-53
+    { 0x993FE2C6D07B7FABull, 0xE546A8038EFE4029ull }, // 1e-52
+    { 0xBF8FDB78849A5F96ull, 0xDE98520472BDD033ull }, // 1e-51
+    { 0xEF73D256A5C0F77Cull, 0x963E66858F6D4440ull }, // 1e-50
+    { 0x95A8637627989AADull, 0xDDE7001379A44AA8ull }, // 1e-49
+    { 0xBB127C53B17EC159ull, 0x5560C018580D5D52ull }, // 1e-48
+    { 0xE9D71B689DDE71AFull, 0xAAB8F01E6E10B4A6ull }, // 1e-47
+    { 0x9226712162AB070Dull, 0xCAB3961304CA70E8ull }, // 1e-46
+    { 0xB6B00D69BB55C8D1ull, 0x3D607B97C5FD0D22ull }, // 1e-45
+    { 0xE45C10C42A2B3B05ull, 0x8CB89A7DB77C506Aull }, // 1e-44
+    { 0x8EB98A7A9A5B04E3ull, 0x77F3608E92ADB242ull }, // 1e-43
+    { 0xB267ED1940F1C61Cull, 0x55F038B237591ED3ull }, // 1e-42
+    { 0xDF01E85F912E37A3ull, 0x6B6C46DEC52F6688ull }, // 1e-41
+    { 0x8B61313BBABCE2C6ull, 0x2323AC4B3B3DA015ull }, // 1e-40
+    { 0xAE397D8AA96C1B77ull, 0xABEC975E0A0D081Aull }, // 1e-39
+    { 0xD9C7DCED53C72255ull, 0x96E7BD358C904A21ull }, // 1e-38
+    { 0x881CEA14545C7575ull, 0x7E50D64177DA2E54ull }, // 1e-37
+    { 0xAA242499697392D2ull, 0xDDE50BD1D5D0B9E9ull }, // 1e-36
+    { 0xD4AD2DBFC3D07787ull, 0x955E4EC64B44E864ull }, // 1e-35
+    { 0x84EC3C97DA624AB4ull, 0xBD5AF13BEF0B113Eull }, // 1e-34
+    { 0xA6274BBDD0FADD61ull, 0xECB1AD8AEACDD58Eull }, // 1e-33
+    { 0xCFB11EAD453994BAull, 0x67DE18EDA5814AF2ull }, // 1e-32
+    { 0x81CEB32C4B43FCF4ull, 0x80EACF948770CED7ull }, // 1e-31
+    { 0xA2425FF75E14FC31ull, 0xA1258379A94D028Dull }, // 1e-30
+    { 0xCAD2F7F5359A3B3Eull, 0x096EE45813A04330ull }, // 1e-29
+    { 0xFD87B5F28300CA0Dull, 0x8BCA9D6E188853FCull }, // 1e-28
+    { 0x9E74D1B791E07E48ull, 0x775EA264CF55347Dull }, // 1e-27
+    { 0xC612062576589DDAull, 0x95364AFE032A819Dull }, // 1e-26
+    { 0xF79687AED3EEC551ull, 0x3A83DDBD83F52204ull }, // 1e-25
+    { 0x9ABE14CD44753B52ull, 0xC4926A9672793542ull }, // 1e-24
+    { 0xC16D9A0095928A27ull, 0x75B7053C0F178293ull }, // 1e-23
+    { 0xF1C90080BAF72CB1ull, 0x5324C68B12DD6338ull }, // 1e-22
+    { 0x971DA05074DA7BEEull, 0xD3F6FC16EBCA5E03ull }, // 1e-21
+    { 0xBCE5086492111AEAull, 0x88F4BB1CA6BCF584ull }, // 1e-20
+    { 0xEC1E4A7DB69561A5ull, 0x2B31E9E3D06C32E5ull }, // 1e-19
+    { 0x9392EE8E921D5D07ull, 0x3AFF322E62439FCFull }, // 1e-18
+    { 0xB877AA3236A4B449ull, 0x09BEFEB9FAD487C2ull }, // 1e-17
+    { 0xE69594BEC44DE15Bull, 0x4C2EBE687989A9B3ull }, // 1e-16
+    { 0x901D7CF73AB0ACD9ull, 0x0F9D37014BF60A10ull }, // 1e-15
+    { 0xB424DC35095CD80Full, 0x538484C19EF38C94ull }, // 1e-14
+    { 0xE12E13424BB40E13ull, 0x2865A5F206B06FB9ull }, // 1e-13
+    { 0x8CBCCC096F5088CBull, 0xF93F87B7442E45D3ull }, // 1e-12
+    { 0xAFEBFF0BCB24AAFEull, 0xF78F69A51539D748ull }, // 1e-11
+    { 0xDBE6FECEBDEDD5BEull, 0xB573440E5A884D1Bull }, // 1e-10
+    { 0x89705F4136B4A597ull, 0x31680A88F8953030ull }, // 1e-9
+    { 0xABCC77118461CEFCull, 0xFDC20D2B36BA7C3Dull }, // 1e-8
+    { 0xD6BF94D5E57A42BCull, 0x3D32907604691B4Cull }, // 1e-7
+    { 0x8637BD05AF6C69B5ull, 0xA63F9A49C2C1B10Full }, // 1e-6
+    { 0xA7C5AC471B478423ull, 0x0FCF80DC33721D53ull }, // 1e-5
+    { 0xD1B71758E219652Bull, 0xD3C36113404EA4A8ull }, // 1e-4
+    { 0x83126E978D4FDF3Bull, 0x645A1CAC083126E9ull }, // 1e-3
+    { 0xA3D70A3D70A3D70Aull, 0x3D70A3D70A3D70A3ull }, // 1e-2
+    { 0xCCCCCCCCCCCCCCCCull, 0xCCCCCCCCCCCCCCCCull }, // 1e-1
+    { 0x8000000000000000ull, 0x0000000000000000ull }, // 1e0
+    { 0xA000000000000000ull, 0x0000000000000000ull }, // 1e1
+    { 0xC800000000000000ull, 0x0000000000000000ull }, // 1e2
+    { 0xFA00000000000000ull, 0x0000000000000000ull }, // 1e3
+    { 0x9C40000000000000ull, 0x0000000000000000ull }, // 1e4
+    { 0xC350000000000000ull, 0x0000000000000000ull }, // 1e5
+    { 0xF424000000000000ull, 0x0000000000000000ull }, // 1e6
+    { 0x9896800000000000ull, 0x0000000000000000ull }, // 1e7
+    { 0xBEBC200000000000ull, 0x0000000000000000ull }, // 1e8
+    { 0xEE6B280000000000ull, 0x0000000000000000ull }, // 1e9
+    { 0x9502F90000000000ull, 0x0000000000000000ull }, // 1e10
+    { 0xBA43B74000000000ull, 0x0000000000000000ull }, // 1e11
+    { 0xE8D4A51000000000ull, 0x0000000000000000ull }, // 1e12
+    { 0x9184E72A00000000ull, 0x0000000000000000ull }, // 1e13
+    { 0xB5E620F480000000ull, 0x0000000000000000ull }, // 1e14
+    { 0xE35FA931A0000000ull, 0x0000000000000000ull }, // 1e15
+    { 0x8E1BC9BF04000000ull, 0x0000000000000000ull }, // 1e16
+    { 0xB1A2BC2EC5000000ull, 0x0000000000000000ull }, // 1e17
+    { 0xDE0B6B3A76400000ull, 0x0000000000000000ull }, // 1e18
+    { 0x8AC7230489E80000ull, 0x0000000000000000ull }, // 1e19
+    { 0xAD78EBC5AC620000ull, 0x0000000000000000ull }, // 1e20
+    { 0xD8D726B7177A8000ull, 0x0000000000000000ull }, // 1e21
+    { 0x878678326EAC9000ull, 0x0000000000000000ull }, // 1e22
+    { 0xA968163F0A57B400ull, 0x0000000000000000ull }, // 1e23
+    { 0xD3C21BCECCEDA100ull, 0x0000000000000000ull }, // 1e24
+    { 0x84595161401484A0ull, 0x0000000000000000ull }, // 1e25
+    { 0xA56FA5B99019A5C8ull, 0x0000000000000000ull }, // 1e26
+    { 0xCECB8F27F4200F3Aull, 0x0000000000000000ull }, // 1e27
+    { 0x813F3978F8940984ull, 0x4000000000000000ull }, // 1e28
+    { 0xA18F07D736B90BE5ull, 0x5000000000000000ull }, // 1e29
+    { 0xC9F2C9CD04674EDEull, 0xA400000000000000ull }, // 1e30
+    { 0xFC6F7C4045812296ull, 0x4D00000000000000ull }, // 1e31
+    { 0x9DC5ADA82B70B59Dull, 0xF020000000000000ull }, // 1e32
+    { 0xC5371912364CE305ull, 0x6C28000000000000ull }, // 1e33
+    { 0xF684DF56C3E01BC6ull, 0xC732000000000000ull }, // 1e34
+    { 0x9A130B963A6C115Cull, 0x3C7F400000000000ull }, // 1e35
+    { 0xC097CE7BC90715B3ull, 0x4B9F100000000000ull }, // 1e36
+    { 0xF0BDC21ABB48DB20ull, 0x1E86D40000000000ull }, // 1e37
+    { 0x96769950B50D88F4ull, 0x1314448000000000ull }, // 1e38
+    { 0xBC143FA4E250EB31ull, 0x17D955A000000000ull }, // 1e39
+    { 0xEB194F8E1AE525FDull, 0x5DCFAB0800000000ull }, // 1e40
+    { 0x92EFD1B8D0CF37BEull, 0x5AA1CAE500000000ull }, // 1e41
+    { 0xB7ABC627050305ADull, 0xF14A3D9E40000000ull }, // 1e42
+    { 0xE596B7B0C643C719ull, 0x6D9CCD05D0000000ull }, // 1e43
+    { 0x8F7E32CE7BEA5C6Full, 0xE4820023A2000000ull }, // 1e44
+    { 0xB35DBF821AE4F38Bull, 0xDDA2802C8A800000ull }, // 1e45
+    { 0xE0352F62A19E306Eull, 0xD50B2037AD200000ull }, // 1e46
+    { 0x8C213D9DA502DE45ull, 0x4526F422CC340000ull }, // 1e47
+    { 0xAF298D050E4395D6ull, 0x9670B12B7F410000ull }, // 1e48
+    { 0xDAF3F04651D47B4Cull, 0x3C0CDD765F114000ull }, // 1e49
+    { 0x88D8762BF324CD0Full, 0xA5880A69FB6AC800ull }, // 1e50
+    { 0xAB0E93B6EFEE0053ull, 0x8EEA0D047A457A00ull }, // 1e51
+    { 0xD5D238A4ABE98068ull, 0x72A4904598D6D880ull }, // 1e52
+    { 0x85A36366EB71F041ull, 0x47A6DA2B7F864750ull }, // 1e53
+    { 0xA70C3C40A64E6C51ull, 0x999090B65F67D924ull }, // 1e54
+    { 0xD0CF4B50CFE20765ull, 0xFFF4B4E3F741CF6Dull }, // 1e55
+    { 0x82818F1281ED449Full, 0xBFF8F10E7A8921A4ull }, // 1e56
+    { 0xA321F2D7226895C7ull, 0xAFF72D52192B6A0Dull }, // 1e57
+    { 0xCBEA6F8CEB02BB39ull, 0x9BF4F8A69F764490ull }, // 1e58
+    { 0xFEE50B7025C36A08ull, 0x02F236D04753D5B4ull }, // 1e59
+    { 0x9F4F2726179A2245ull, 0x01D762422C946590ull }, // 1e60
+    { 0xC722F0EF9D80AAD6ull, 0x424D3AD2B7B97EF5ull }, // 1e61
+    { 0xF8EBAD2B84E0D58Bull, 0xD2E0898765A7DEB2ull }, // 1e62
+    { 0x9B934C3B330C8577ull, 0x63CC55F49F88EB2Full }, // 1e63
+    { 0xC2781F49FFCFA6D5ull, 0x3CBF6B71C76B25FBull }, // 1e64
+    { 0xF316271C7FC3908Aull, 0x8BEF464E3945EF7Aull }, // 1e65
+    { 0x97EDD871CFDA3A56ull, 0x97758BF0E3CBB5ACull }, // 1e66
+    { 0xBDE94E8E43D0C8ECull, 0x3D52EEED1CBEA317ull }, // 1e67
+    { 0xED63A231D4C4FB27ull, 0x4CA7AAA863EE4BDDull }, // 1e68
+    { 0x945E455F24FB1CF8ull, 0x8FE8CAA93E74EF6Aull }, // 1e69
+    { 0xB975D6B6EE39E436ull, 0xB3E2FD538E122B44ull }, // 1e70
+    { 0xE7D34C64A9C85D44ull, 0x60DBBCA87196B616ull }, // 1e71
+    { 0x90E40FBEEA1D3A4Aull, 0xBC8955E946FE31CDull }, // 1e72
+    { 0xB51D13AEA4A488DDull, 0x6BABAB6398BDBE41ull }, // 1e73
+    { 0xE264589A4DCDAB14ull, 0xC696963C7EED2DD1ull }, // 1e74
+    { 0x8D7EB76070A08AECull, 0xFC1E1DE5CF543CA2ull }, // 1e75
+    { 0xB0DE65388CC8ADA8ull, 0x3B25A55F43294BCBull }, // 1e76
+    { 0xDD15FE86AFFAD912ull, 0x49EF0EB713F39EBEull }, // 1e77
+    { 0x8A2DBF142DFCC7ABull, 0x6E3569326C784337ull }, // 1e78
+    { 0xACB92ED9397BF996ull, 0x49C2C37F07965404ull }, // 1e79
+    { 0xD7E77A8F87DAF7FBull, 0xDC33745EC97BE906ull }, // 1e80
+    { 0x86F0AC99B4E8DAFDull, 0x69A028BB3DED71A3ull }, // 1e81
+    { 0xA8ACD7C0222311BCull, 0xC40832EA0D68CE0Cull }, // 1e82
+    { 0xD2D80DB02AABD62Bull, 0xF50A3FA490C30190ull }, // 1e83
+    { 0x83C7088E1AAB65DBull, 0x792667C6DA79E0FAull }, // 1e84
+    { 0xA4B8CAB1A1563F52ull, 0x577001B891185938ull }, // 1e85
+    { 0xCDE6FD5E09ABCF26ull, 0xED4C0226B55E6F86ull }, // 1e86
+    { 0x80B05E5AC60B6178ull, 0x544F8158315B05B4ull }, // 1e87
+    { 0xA0DC75F1778E39D6ull, 0x696361AE3DB1C721ull }, // 1e88
+    { 0xC913936DD571C84Cull, 0x03BC3A19CD1E38E9ull }, // 1e89
+    { 0xFB5878494ACE3A5Full, 0x04AB48A04065C723ull }, // 1e90
+    { 0x9D174B2DCEC0E47Bull, 0x62EB0D64283F9C76ull }, // 1e91
+    { 0xC45D1DF942711D9Aull, 0x3BA5D0BD324F8394ull }, // 1e92
+    { 0xF5746577930D6500ull, 0xCA8F44EC7EE36479ull }, // 1e93
+    { 0x9968BF6ABBE85F20ull, 0x7E998B13CF4E1ECBull }, // 1e94
+    { 0xBFC2EF456AE276E8ull, 0x9E3FEDD8C321A67Eull }, // 1e95
+    { 0xEFB3AB16C59B14A2ull, 0xC5CFE94EF3EA101Eull }, // 1e96
+    { 0x95D04AEE3B80ECE5ull, 0xBBA1F1D158724A12ull }, // 1e97
+    { 0xBB445DA9CA61281Full, 0x2A8A6E45AE8EDC97ull }, // 1e98
+    { 0xEA1575143CF97226ull, 0xF52D09D71A3293BDull }, // 1e99
+    { 0x924D692CA61BE758ull, 0x593C2626705F9C56ull }, // 1e100
+    { 0xB6E0C377CFA2E12Eull, 0x6F8B2FB00C77836Cull }, // 1e101
+    { 0xE498F455C38B997Aull, 0x0B6DFB9C0F956447ull }, // 1e102
+    { 0x8EDF98B59A373FECull, 0x4724BD4189BD5EACull }, // 1e103
+    { 0xB2977EE300C50FE7ull, 0x58EDEC91EC2CB657ull }, // 1e104
+    { 0xDF3D5E9BC0F653E1ull, 0x2F2967B66737E3EDull }, // 1e105
+    { 0x8B865B215899F46Cull, 0xBD79E0D20082EE74ull }, // 1e106
+    { 0xAE67F1E9AEC07187ull, 0xECD8590680A3AA11ull }, // 1e107
+    { 0xDA01EE641A708DE9ull, 0xE80E6F4820CC9495ull }, // 1e108
+    { 0x884134FE908658B2ull, 0x3109058D147FDCDDull }, // 1e109
+    { 0xAA51823E34A7EEDEull, 0xBD4B46F0599FD415ull }, // 1e110
+    { 0xD4E5E2CDC1D1EA96ull, 0x6C9E18AC7007C91Aull }, // 1e111
+    { 0x850FADC09923329Eull, 0x03E2CF6BC604DDB0ull }, // 1e112
+    { 0xA6539930BF6BFF45ull, 0x84DB8346B786151Cull }, // 1e113
+    { 0xCFE87F7CEF46FF16ull, 0xE612641865679A63ull }, // 1e114
+    { 0x81F14FAE158C5F6Eull, 0x4FCB7E8F3F60C07Eull }, // 1e115
+    { 0xA26DA3999AEF7749ull, 0xE3BE5E330F38F09Dull }, // 1e116
+    { 0xCB090C8001AB551Cull, 0x5CADF5BFD3072CC5ull }, // 1e117
+    { 0xFDCB4FA002162A63ull, 0x73D9732FC7C8F7F6ull }, // 1e118
+    { 0x9E9F11C4014DDA7Eull, 0x2867E7FDDCDD9AFAull }, // 1e119
+    { 0xC646D63501A1511Dull, 0xB281E1FD541501B8ull }, // 1e120
+    { 0xF7D88BC24209A565ull, 0x1F225A7CA91A4226ull }, // 1e121
+    { 0x9AE757596946075Full, 0x3375788DE9B06958ull }, // 1e122
+    { 0xC1A12D2FC3978937ull, 0x0052D6B1641C83AEull }, // 1e123
+    { 0xF209787BB47D6B84ull, 0xC0678C5DBD23A49Aull }, // 1e124
+    { 0x9745EB4D50CE6332ull, 0xF840B7BA963646E0ull }, // 1e125
+    { 0xBD176620A501FBFFull, 0xB650E5A93BC3D898ull }, // 1e126
+    { 0xEC5D3FA8CE427AFFull, 0xA3E51F138AB4CEBEull }, // 1e127
+    { 0x93BA47C980E98CDFull, 0xC66F336C36B10137ull }, // 1e128
+};
+
+static inline uint64 MulHiLo64(uint64 x, uint64 y, uint64 *pluLo)
+{
+    const uint64 kluMask32 = 0xFFFFFFFF;
+    uint64 a = x >> 32;
+    uint64 b = x & kluMask32;
+    uint64 c = y >> 32;
+    uint64 d = y & kluMask32;
+    uint64 ac = a * c;
+    uint64 bc = b * c;
+    uint64 ad = a * d;
+    uint64 bd = b * d;
+    uint64 mid = (bd >> 32) + (ad & kluMask32) + (bc & kluMask32);
+
+    *pluLo = (mid << 32) | (bd & kluMask32);
+    return ac + (ad >> 32) + (bc >> 32) + (mid >> 32);
+}
+
+static BOOL FDblFromDecimalFast(uint64 luMan, int32 lwExp, double *pdbl)
+{
+    Assert(luMan != 0);
+    Assert(klwPow10FastMin <= lwExp && lwExp <= klwPow10FastMax);
+
+    int cbitLeadingZeros = 0;
+    while (0 == (luMan & 0x8000000000000000ull))
+    {
+        luMan <<= 1;
+        cbitLeadingZeros++;
+    }
+
+    // floor(lwExp * log2(10)) + 64 + exponent bias, adjusted for the normalization shift.
+    int32 lwExp2 = ((217706 * lwExp) >> 16) + 64 + 1023 - cbitLeadingZeros;
+
+    const uint64 *pluPow = g_rgluPow10Fast[lwExp - klwPow10FastMin];
+    uint64 luLo;
+    uint64 luHi = MulHiLo64(luMan, pluPow[0], &luLo);
+
+    // Only the top 54 bits of luHi matter. If the bits below them are all ones, the truncated low
+    // word of the power could still carry into them; widen the product to find out.
+    if (0x1FF == (luHi & 0x1FF) && luLo + luMan < luMan)
+    {
+        uint64 luLoLo;
+        uint64 luLoHi = MulHiLo64(luMan, pluPow[1], &luLoLo);
+        uint64 luMergedHi = luHi;
+        uint64 luMergedLo = luLo + luLoHi;
+        if (luMergedLo < luLo)
+        {
+            luMergedHi++;
+        }
+        if (0x1FF == (luMergedHi & 0x1FF) && 0 == luMergedLo + 1 && luLoLo + luMan < luMan)
+        {
+            return FALSE;
+        }
+        luHi = luMergedHi;
+        luLo = luMergedLo;
+    }
+
+    // Keep 54 bits, one more than the mantissa, for rounding.
+    uint64 luMsb = luHi >> 63;
+    uint64 luMant = luHi >> (luMsb + 9);
+    lwExp2 -= (int32)(1 ^ luMsb);
+
+    // An exact halfway case; round-half-even needs the exact value.
+    if (0 == luLo && 0 == (luHi & 0x1FF) && 1 == (luMant & 3))
+    {
+        return FALSE;
+    }
+
+    luMant += luMant & 1;
+    luMant >>= 1;
+    if (luMant >> 53)
+    {
+        luMant >>= 1;
+        lwExp2++;
+    }
+
+    if (lwExp2 <= 0 || lwExp2 >= 0x7FF)
+    {
+        return FALSE;
+    }
+
+    uint64 luBits = ((uint64)lwExp2 << 52) | (luMant & 0x000FFFFFFFFFFFFFull);
+    Js::NumberUtilities::LuHiDbl(*pdbl) = (uint32)(luBits >> 32);
+    Js::NumberUtilities::LuLoDbl(*pdbl) = (uint32)luBits;
+    return TRUE;
+}
+
 template <typename EncodedChar>
 double Js::NumberUtilities::StrToDbl( const EncodedChar *psz, const EncodedChar **ppchLim, bool& likelyInt )
 {
@@ -1173,6 +1534,32 @@ LEnd:
 #endif //!DBG
     }
 
+    // Up to 19 digits fit in a uint64, which is all Eisel-Lemire needs.
+    if (cchDig <= 19 && lwExp >= klwPow10FastMin && lwExp <= klwPow10FastMax)
+    {
+        uint64 luMan = 0;
+        for (pch = pchMinDig; pch < pchLimDig; pch++)
+        {
+            if (*pch != '.')
+            {
+                Assert(Js::NumberUtilities::IsDigit(*pch));
+                luMan = luMan * 10 + (*pch - '0');
+            }
+        }
+
+        double dblFast;
+        if (FDblFromDecimalFast(luMan, lwExp, &dblFast))
+        {
+#if DBG
+            canUseLowPrec = true;
+            dblLowPrec = dblFast;
+#else //!DBG
+            dbl = dblFast;
+            goto LDone;
+#endif //!DBG
+        }
+    }
+
     lwExp += cchDig;
     if (lwExp >= klwMaxExp10)
     {
@@ -1560,6 +1947,318 @@ LFail:
 }
 
 
+/***************************************************************************
+Grisu3 shortest digit generation (Loitsch, "Printing Floating-Point Numbers
+Quickly and Accurately with Integers", PLDI 2010).
+
+Works on 64-bit "do-it-yourself" floats scaled by a cached power of ten.
+Produces the shortest digit string that round-trips and is closest to the
+double, or fails (about 0.5% of inputs) when 64 bits of precision cannot
+guarantee that, in which case the caller falls back to the BIGNUM paths.
+***************************************************************************/
+struct DIYFP
+{
+    uint64 m_f;
+    int m_e;
+};
+
+struct CACHEDPOWER
+{
+    uint64 m_f;
+    int16 m_e;
+    int16 m_wExp10;
+};
+
+// 10^k rounded to 64 bits for k = -348, -340, ..., 340.
+static const CACHEDPOWER g_rgCachedPowers[] =
+{
+    { 0xFA8FD5A0081C0288ull, -1220, -348 },
+    { 0xBAAEE17FA23EBF76ull, -1193, -340 },
+    { 0x8B16FB203055AC76ull, -1166, -332 },
+    { 0xCF42894A5DCE35EAull, -1140, -324 },
+    { 0x9A6BB0AA55653B2Dull, -1113, -316 },
+    { 0xE61ACF033D1A45DFull, -1087, -308 },
+    { 0xAB70FE17C79AC6CAull, -1060, -300 },
+    { 0xFF77B1FCBEBCDC4Full, -1034, -292 },
+    { 0xBE5691EF416BD60Cull, -1007, -284 },
+    { 0x8DD01FAD907FFC3Cull,  -980, -276 },
+    { 0xD3515C2831559A83ull,  -954, -268 },
+    { 0x9D71AC8FADA6C9B5ull,  -927, -260 },
+    { 0xEA9C227723EE8BCBull,  -901, -252 },
+    { 0xAECC49914078536Dull,  -874, -244 },
+    { 0x823C12795DB6CE57ull,  -847, -236 },
+    { 0xC21094364DFB5637ull,  -821, -228 },
+    { 0x9096EA6F3848984Full,  -794, -220 },
+    { 0xD77485CB25823AC7ull,  -768, -212 },
+    { 0xA086CFCD97BF97F4ull,  -741, -204 },
+    { 0xEF340A98172AACE5ull,  -715, -196 },
+    { 0xB23867FB2A35B28Eull,  -688, -188 },
+    { 0x84C8D4DFD2C63F3Bull,  -661, -180 },
+    { 0xC5DD44271AD3CDBAull,  -635, -172 },
+    { 0x936B9FCEBB25C996ull,  -608, -164 },
+    { 0xDBAC6C247D62A584ull,  -582, -156 },
+    { 0xA3AB66580D5FDAF6ull,  -555, -148 },
+    { 0xF3E2F893DEC3F126ull,  -529, -140 },
+    { 0xB5B5ADA8AAFF80B8ull,  -502, -132 },
+    { 0x87625F056C7C4A8Bull,  -475, -124 },
+    { 0xC9BCFF6034C13053ull,  -449, -116 },
+    { 0x964E858C91BA2655ull,  -422, -108 },
+    { 0xDFF9772470297EBDull,  -396, -100 },
+    { 0xA6DFBD9FB8E5B88Full,  -369,  -92 },
+    { 0xF8A95FCF88747D94ull,  -343,  -84 },
+    { 0xB94470938FA89BCFull,  -316,  -76 },
+    { 0x8A08F0F8BF0F156Bull,  -289,  -68 },
+    { 0xCDB02555653131B6ull,  -263,  -60 },
+    { 0x993FE2C6D07B7FACull,  -236,  -52 },
+    { 0xE45C10C42A2B3B06ull,  -210,  -44 },
+    { 0xAA242499697392D3ull,  -183,  -36 },
+    { 0xFD87B5F28300CA0Eull,  -157,  -28 },
+    { 0xBCE5086492111AEBull,  -130,  -20 },
+    { 0x8CBCCC096F5088CCull,  -103,  -12 },
+    { 0xD1B71758E219652Cull,   -77,   -4 },
+    { 0x9C40000000000000ull,   -50,    4 },
+    { 0xE8D4A51000000000ull,   -24,   12 },
+    { 0xAD78EBC5AC620000ull,     3,   20 },
+    { 0x813F3978F8940984ull,    30,   28 },
+    { 0xC097CE7BC90715B3ull,    56,   36 },
+    { 0x8F7E32CE7BEA5C70ull,    83,   44 },
+    { 0xD5D238A4ABE98068ull,   109,   52 },
+    { 0x9F4F2726179A2245ull,   136,   60 },
+    { 0xED63A231D4C4FB27ull,   162,   68 },
+    { 0xB0DE65388CC8ADA8ull,   189,   76 },
+    { 0x83C7088E1AAB65DBull,   216,   84 },
+    { 0xC45D1DF942711D9Aull,   242,   92 },
+    { 0x924D692CA61BE758ull,   269,  100 },
+    { 0xDA01EE641A708DEAull,   295,  108 },
+    { 0xA26DA3999AEF774Aull,   322,  116 },
+    { 0xF209787BB47D6B85ull,   348,  124 },
+    { 0xB454E4A179DD1877ull,   375,  132 },
+    { 0x865B86925B9BC5C2ull,   402,  140 },
+    { 0xC83553C5C8965D3Dull,   428,  148 },
+    { 0x952AB45CFA97A0B3ull,   455,  156 },
+    { 0xDE469FBD99A05FE3ull,   481,  164 },
+    { 0xA59BC234DB398C25ull,   508,  172 },
+    { 0xF6C69A72A3989F5Cull,   534,  180 },
+    { 0xB7DCBF5354E9BECEull,   561,  188 },
+    { 0x88FCF317F22241E2ull,   588,  196 },
+    { 0xCC20CE9BD35C78A5ull,   614,  204 },
+    { 0x98165AF37B2153DFull,   641,  212 },
+    { 0xE2A0B5DC971F303Aull,   667,  220 },
+    { 0xA8D9D1535CE3B396ull,   694,  228 },
+    { 0xFB9B7CD9A4A7443Cull,   720,  236 },
+    { 0xBB764C4CA7A44410ull,   747,  244 },
+    { 0x8BAB8EEFB6409C1Aull,   774,  252 },
+    { 0xD01FEF10A657842Cull,   800,  260 },
+    { 0x9B10A4E5E9913129ull,   827,  268 },
+    { 0xE7109BFBA19C0C9Dull,   853,  276 },
+    { 0xAC2820D9623BF429ull,   880,  284 },
+    { 0x80444B5E7AA7CF85ull,   907,  292 },
+    { 0xBF21E44003ACDD2Dull,   933,  300 },
+    { 0x8E679C2F5E44FF8Full,   960,  308 },
+    { 0xD433179D9C8CB841ull,   986,  316 },
+    { 0x9E19DB92B4E31BA9ull,  1013,  324 },
+    { 0xEB96BF6EBADF77D9ull,  1039,  332 },
+    { 0xAF87023B9BF0EE6Bull,  1066,  340 },
+};
+
+static const int kwCachedPowersMinExp10 = -348;
+static const int kwCachedPowersExp10Step = 8;
+
+// Range of binary exponents for the scaled value; keeps the integral part in 32 bits.
+static const int kwGrisuMinExp2 = -60;
+static const int kwGrisuMaxExp2 = -32;
+
+static const uint32 g_rgluSmallTens[] =
+{
+    0, 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+static inline DIYFP DiyFpMul(const DIYFP &x, const DIYFP &y)
+{
+    // 64x64 -> upper 64 bits of the product, rounded.
+    const uint64 kluMask32 = 0xFFFFFFFF;
+    uint64 a = x.m_f >> 32;
+    uint64 b = x.m_f & kluMask32;
+    uint64 c = y.m_f >> 32;
+    uint64 d = y.m_f & kluMask32;
+    uint64 ac = a * c;
+    uint64 bc = b * c;
+    uint64 ad = a * d;
+    uint64 bd = b * d;
+    uint64 tmp = (bd >> 32) + (ad & kluMask32) + (bc & kluMask32) + (1U << 31);
+
+    DIYFP res;
+    res.m_f = ac + (ad >> 32) + (bc >> 32) + (tmp >> 32);
+    res.m_e = x.m_e + y.m_e + 64;
+    return res;
+}
+
+static inline DIYFP DiyFpNormalize(DIYFP v)
+{
+    Assert(v.m_f != 0);
+    while (0 == (v.m_f & 0xFFC0000000000000ull))
+    {
+        v.m_f <<= 10;
+        v.m_e -= 10;
+    }
+    while (0 == (v.m_f & 0x8000000000000000ull))
+    {
+        v.m_f <<= 1;
+        v.m_e--;
+    }
+    return v;
+}
+
+// Try to round the last digit of prgb[0, cb) towards w. See RoundWeed in the paper; all distances
+// are in units of 2^-e of the scaled values, and luUnit is the accumulated error bound.
+static BOOL FGrisuRoundWeed(byte *prgb, int cb, uint64 luDistTooHighW, uint64 luUnsafeInterval,
+    uint64 luRest, uint64 luTenKappa, uint64 luUnit)
+{
+    uint64 luSmallDist = luDistTooHighW - luUnit;
+    uint64 luBigDist = luDistTooHighW + luUnit;
+
+    while (luRest < luSmallDist &&
+        luUnsafeInterval - luRest >= luTenKappa &&
+        (luRest + luTenKappa < luSmallDist ||
+        luSmallDist - luRest >= luRest + luTenKappa - luSmallDist))
+    {
+        prgb[cb - 1]--;
+        luRest += luTenKappa;
+    }
+
+    // If the digits could still move closer to the far end of w's error range, we can't tell
+    // which candidate is closest.
+    if (luRest < luBigDist &&
+        luUnsafeInterval - luRest >= luTenKappa &&
+        (luRest + luTenKappa < luBigDist ||
+        luBigDist - luRest > luRest + luTenKappa - luBigDist))
+    {
+        return FALSE;
+    }
+
+    return (2 * luUnit <= luRest) && (luRest <= luUnsafeInterval - 4 * luUnit);
+}
+
+_Success_(return)
+static BOOL FDblToRgbGrisu(double dbl, _Out_writes_to_(kcbMaxRgb, (*ppbLim - prgb)) byte *prgb,
+                           int *pwExp10, byte **ppbLim)
+{
+    // Caller should take care of 0, negative and non-finite values.
+    Assert(Js::NumberUtilities::IsFinite(dbl));
+    Assert(0 < dbl);
+
+    uint64 luBits = ((uint64)Js::NumberUtilities::LuHiDbl(dbl) << 32) | Js::NumberUtilities::LuLoDbl(dbl);
+    uint64 luMant = luBits & 0x000FFFFFFFFFFFFFull;
+    int wExp2 = (int)(luBits >> 52);
+
+    DIYFP v;
+    if (wExp2 > 0)
+    {
+        v.m_f = luMant | 0x0010000000000000ull;
+        v.m_e = wExp2 - 1075;
+    }
+    else
+    {
+        v.m_f = luMant;
+        v.m_e = -1074;
+    }
+
+    // Boundaries halfway to the neighbouring doubles. The lower one is closer for powers of two.
+    DIYFP numPlus;
+    numPlus.m_f = (v.m_f << 1) + 1;
+    numPlus.m_e = v.m_e - 1;
+    numPlus = DiyFpNormalize(numPlus);
+
+    DIYFP numMinus;
+    if (0 == luMant && wExp2 > 1)
+    {
+        numMinus.m_f = (v.m_f << 2) - 1;
+        numMinus.m_e = v.m_e - 2;
+    }
+    else
+    {
+        numMinus.m_f = (v.m_f << 1) - 1;
+        numMinus.m_e = v.m_e - 1;
+    }
+    numMinus.m_f <<= numMinus.m_e - numPlus.m_e;
+    numMinus.m_e = numPlus.m_e;
+
+    DIYFP w = DiyFpNormalize(v);
+    Assert(w.m_e == numPlus.m_e);
+
+    // Pick the cached power of ten that brings w's exponent into [kwGrisuMinExp2, kwGrisuMaxExp2].
+    int k = (int)ceil((kwGrisuMinExp2 - (w.m_e + 64) + 63) * 0.30102999566398114);
+    int iPower = (-kwCachedPowersMinExp10 + k - 1) / kwCachedPowersExp10Step + 1;
+    Assert(iPower >= 0 && iPower < (int)_countof(g_rgCachedPowers));
+    const CACHEDPOWER &power = g_rgCachedPowers[iPower];
+    DIYFP tenMk;
+    tenMk.m_f = power.m_f;
+    tenMk.m_e = power.m_e;
+    Assert(kwGrisuMinExp2 <= w.m_e + tenMk.m_e + 64 && w.m_e + tenMk.m_e + 64 <= kwGrisuMaxExp2);
+
+    DIYFP numW = DiyFpMul(w, tenMk);
+    DIYFP numLow = DiyFpMul(numMinus, tenMk);
+    DIYFP numHigh = DiyFpMul(numPlus, tenMk);
+
+    // Each scaled value is off by less than one unit; widen the interval to be safe, then generate
+    // digits of numTooHigh until what remains fits inside the unsafe interval.
+    uint64 luUnit = 1;
+    uint64 luTooLow = numLow.m_f - luUnit;
+    uint64 luTooHigh = numHigh.m_f + luUnit;
+    uint64 luUnsafeInterval = luTooHigh - luTooLow;
+    int wShift = -numW.m_e;
+    uint64 luOne = (uint64)1 << wShift;
+    uint32 luIntegrals = (uint32)(luTooHigh >> wShift);
+    uint64 luFractionals = luTooHigh & (luOne - 1);
+
+    int kappa = ((64 - wShift + 1) * 1233 >> 12) + 1;
+    if (luIntegrals < g_rgluSmallTens[kappa])
+        kappa--;
+    uint32 luDivisor = g_rgluSmallTens[kappa];
+
+    int ib = 0;
+    while (kappa > 0)
+    {
+        Assert(ib < kcbMaxRgb);
+        prgb[ib++] = (byte)(luIntegrals / luDivisor);
+        luIntegrals %= luDivisor;
+        kappa--;
+        uint64 luRest = ((uint64)luIntegrals << wShift) + luFractionals;
+        if (luRest < luUnsafeInterval)
+        {
+            if (!FGrisuRoundWeed(prgb, ib, luTooHigh - numW.m_f, luUnsafeInterval, luRest, (uint64)luDivisor << wShift, luUnit))
+                return FALSE;
+            goto LDone;
+        }
+        luDivisor /= 10;
+    }
+
+    for (;;)
+    {
+        luFractionals *= 10;
+        luUnit *= 10;
+        luUnsafeInterval *= 10;
+        Assert(ib < kcbMaxRgb);
+        prgb[ib++] = (byte)(luFractionals >> wShift);
+        luFractionals &= luOne - 1;
+        kappa--;
+        if (luFractionals < luUnsafeInterval)
+        {
+            if (!FGrisuRoundWeed(prgb, ib, (luTooHigh - numW.m_f) * luUnit, luUnsafeInterval, luFractionals, luOne, luUnit))
+                return FALSE;
+            break;
+        }
+    }
+
+LDone:
+    // prgb holds the digits of an integer d with dbl ~= d * 10^(kappa - mk); the callers want
+    // dbl ~= 0.d * 10^*pwExp10.
+    *pwExp10 = ib + kappa - power.m_wExp10;
+    *ppbLim = &prgb[ib];
+    return TRUE;
+}
+
+
 /***************************************************************************
 Get mantissa bytes (BCD).
 ***************************************************************************/
@@ -2449,7 +3148,8 @@ BOOL Js::NumberUtilities::FNonZeroFiniteDblToStr(double dbl, __out_ecount(cchDst
         AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
 #endif //DBG
 
-    if (!FDblToRgbFast(dbl, rgb, &wExp10, &pbLim) &&
+    if (!FDblToRgbGrisu(dbl, rgb, &wExp10, &pbLim) &&
+        !FDblToRgbFast(dbl, rgb, &wExp10, &pbLim) &&
         !FDblToRgbPrecise(dbl, rgb, &wExp10, &pbLim))
     {
         AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
@@ -298,7 +298,6 @@
 
 #define BGJIT_STATS
 #define REJIT_STATS
-#define PERF_HINT
 #define POLY_INLINE_CACHE_SIZE_STATS
 
 #define JS_PROFILE_DATA_INTERFACE 1
@@ -324,6 +323,19 @@
 #define VTUNE_PROFILING
 #endif
 
+// Linux perf map and jitdump output for generated code
+#if defined(__linux__)
+#define PERF_MAP_PROFILING
+#endif
+
+// Recycler events as USDT probes, where ETW isn't available
+#if !defined(ENABLE_JS_ETW) && defined(__linux__) && defined(HAS_SYS_SDT_H)
+#define ENABLE_GC_USDT
+#endif
+
+// Perf hints are traced under -trace:PerfHint, and can be reported to the host in release builds
+#define PERF_HINT
+
 
 #ifdef NTBUILD
 #define PERF_COUNTERS
@@ -370,20 +382,10 @@
 #endif
 
 #define TTD_COMPRESSED_OUTPUT 0
-#define TTD_LOG_READER TextFormatReader
-#define TTD_LOG_WRITER TextFormatWriter
-
-//For now always use the (lower performance) text format for snapshots for easier debugging etc.
-#define TTD_SNAP_READER TextFormatReader
-#define TTD_SNAP_WRITER TextFormatWriter
-
-//#if ENABLE_TTD_INTERNAL_DIAGNOSTICS
-//#define TTD_SNAP_READER TextFormatReader
-//#define TTD_SNAP_WRITER TextFormatWriter
-//#else
-//#define TTD_SNAP_READER BinaryFormatReader
-//#define TTD_SNAP_WRITER BinaryFormatWriter
-//#endif
+
+//The log and snapshots are written in the verbose text format when diagnostics are enabled (for easier debugging etc.) unless -TTDBinaryFormat is given
+//Otherwise they use the compact binary format so recording can stay on in production builds
+//Each stream starts with a marker for its format, so they are read back with the matching reader either way
 
 #if ENABLE_TTD_INTERNAL_DIAGNOSTICS
 #define ENABLE_SNAPSHOT_COMPARE 1
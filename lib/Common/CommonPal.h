@@ -674,7 +674,9 @@ namespace PlatformAgnostic
     }
 };
 
+#include "PlatformAgnostic/AddressWaiter.h"
 #include "PlatformAgnostic/DateTime.h"
 #include "PlatformAgnostic/Numbers.h"
+#include "PlatformAgnostic/PerfMap.h"
 #include "PlatformAgnostic/SystemInfo.h"
 #include "PlatformAgnostic/Thread.h"
@@ -17,6 +17,7 @@ PHASE(All)
         PHASE(SkipNestedDeferred)
         PHASE(CacheScopeInfoNames)
         PHASE(ScanAhead)
+        PHASE(FastCommentScan)
         PHASE(ParallelParse)
         PHASE(EarlyReferenceErrors)
     PHASE(ByteCode)
@@ -75,6 +76,7 @@ PHASE(All)
             PHASE(InlineCallTarget)
             PHASE(PartialPolymorphicInline)
             PHASE(PolymorphicInline)
+                PHASE(PolymorphicInlineLimits)
             PHASE(PolymorphicInlineFixedMethods)
             PHASE(InlineOutsideLoops)
             PHASE(InlineFunctionsWithLoops)
@@ -150,6 +152,8 @@ PHASE(All)
                     PHASE(NativeArrayConversion)
                     PHASE(CopyOnAccessArray)
                     PHASE(NativeArrayLeafSegment)
+                    PHASE(NativeArraySort)
+                    PHASE(DenseArgsCopy)
                 PHASE(TypedArrayTypeSpec)
                 PHASE(LdLenIntSpec)
                 PHASE(FixDataProps)
@@ -186,6 +190,7 @@ PHASE(All)
                     PHASE(MarkTempNumberOnTempObject)
         PHASE(Lowerer)
             PHASE(FastPath)
+                PHASE(SimpleJitFieldFastPath)
                 PHASE(LoopFastPath)
                 PHASE(MathFastPath)
                 PHASE(Atom)
@@ -219,10 +224,12 @@ PHASE(All)
                 PHASE(StackPack)
                 PHASE(SecondChance)
                 PHASE(RegionUseCount)
+                PHASE(LoopSpillTieBreak)
                 PHASE(RegHoistLoads)
                 PHASE(ClearRegLoopExit)
         PHASE(Peeps)
         PHASE(Layout)
+            PHASE(ColdHelperLayout)
         PHASE(EHBailoutPatchUp)
         PHASE(FinalLower)
         PHASE(PrologEpilog)
@@ -254,6 +261,7 @@ PHASE(All)
         PHASE(Recycler)
             PHASE(ThreadCollect)
             PHASE(ExplicitFree)
+            PHASE(BumpAllocateFreeTail)
             PHASE(ExpirableCollect)
             PHASE(GarbageCollect)
             PHASE(ConcurrentCollect)
@@ -264,6 +272,7 @@ PHASE(All)
                 PHASE(BackgroundFinishMark)
             PHASE(ConcurrentPartialCollect)
             PHASE(ParallelMark)
+                PHASE(ParallelMarkWorkStealing)
             PHASE(PartialCollect)
                 PHASE(ResetMarks)
                 PHASE(ResetWriteWatch)
@@ -282,6 +291,8 @@ PHASE(All)
                     PHASE(SweepLarge)
                     PHASE(SweepPartialReuse)
                 PHASE(ConcurrentSweep)
+                    PHASE(ParallelSweep)
+                PHASE(LazySweep)
                 PHASE(Finalize)
                 PHASE(Dispose)
                 PHASE(FinishPartial)
@@ -289,6 +300,7 @@ PHASE(All)
         PHASE(BailOut)
         PHASE(RegexQc)
         PHASE(RegexOptBT)
+        PHASE(RegexSimdSync)
         PHASE(InlineCache)
         PHASE(PolymorphicInlineCache)
         PHASE(MissingPropertyCache)
@@ -342,8 +354,13 @@ PHASE(All)
         PHASE(ConsoleScope)
         PHASE(ScriptProfiler)
         PHASE(JSON)
+            PHASE(FastJSONStringScan)
+        PHASE(SimdStringSearch)
+        PHASE(SimdStringCase)
         PHASE(RegexResultNotUsed)
         PHASE(Error)
+        PHASE(AsyncAwaitFastPath)
+        PHASE(TypedArrayBulkOps)
         PHASE(PropertyRecord)
         PHASE(TypePathDynamicSize)
         PHASE(ConditionalCompilation)
@@ -424,6 +441,8 @@ PHASE(All)
 #define DEFAULT_CONFIG_LeafInlineThreshold  (60)            //Inlinee threshold for function which is leaf (irrespective of it has loops or not)
 #define DEFAULT_CONFIG_LoopInlineThreshold  (25)            //Inlinee threshold for function with loops
 #define DEFAULT_CONFIG_PolymorphicInlineThreshold  (35)     //Polymorphic inline threshold
+#define DEFAULT_CONFIG_PolymorphicInlineeCountMax  (4)      //Max number of callees inlined at a polymorphic call site, hottest first
+#define DEFAULT_CONFIG_PolymorphicInlineBudget  (140)       //Max sum of bytecodes of inlinees inlined at a single polymorphic call site
 #define DEFAULT_CONFIG_InlineCountMax       (1200)          //Max sum of bytecodes of inlinees inlined into a function (excluding built-ins)
 #define DEFAULT_CONFIG_InlineCountMaxInLoopBodies (500)     // Max sum of bytecodes of inlinees that can be inlined into a jitted loop body (excluding built-ins)
 #define DEFAULT_CONFIG_AggressiveInlineCountMax       (8000)          //Max sum of bytecodes of inlinees inlined into a function (excluding built-ins) when inlined aggressively
@@ -436,6 +455,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_InlineInLoopBodyScaleDownFactor    (4)
 
 #define DEFAULT_CONFIG_CloneInlinedPolymorphicCaches (true)
+#define DEFAULT_CONFIG_BatchJitCodeProtection (false)
 #define DEFAULT_CONFIG_HighPrecisionDate    (false)
 #define DEFAULT_CONFIG_ForceOldDateAPI      (false)
 #define DEFAULT_CONFIG_Loop                 (1)
@@ -593,6 +613,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_MaxJITFunctionBytecodeSize (120000)
 
 #define DEFAULT_CONFIG_JitQueueThreshold      (6)
+#define DEFAULT_CONFIG_JobQueueAgingWeight    (32)
 
 #define DEFAULT_CONFIG_FullJitRequeueThreshold (25)     // Minimum number of times a function needs to be executed before it is re-added to the jit queue
 
@@ -701,6 +722,12 @@ PHASE(All)
 
 #define DEFAULT_CONFIG_MemProtectHeap (false)
 
+#define DEFAULT_CONFIG_RecyclerParallelism (4)  // main thread + up to 3 parallel mark threads
+#define DEFAULT_CONFIG_RecyclerSparseBlockOccupancyPercent (0)  // 0 disables moving sparse blocks to the end of the allocable list
+#define DEFAULT_CONFIG_PageSegmentPoolMaxSegmentCount (16)
+#define DEFAULT_CONFIG_PageSegmentPoolMaxCommittedKB (4096)
+#define DEFAULT_CONFIG_RecyclerLazySweep (false)
+
 #define DEFAULT_CONFIG_InduceCodeGenFailure (30) // When -InduceCodeGenFailure is passed in, 30% of JIT allocations will fail
 
 #define DEFAULT_CONFIG_SkipSplitWhenResultIgnored (false)
@@ -868,6 +895,7 @@ FLAGNR(Boolean, CreateFunctionProxy   , "Create function proxies instead of full
 FLAGNR(Boolean, HybridFgJit           , "When background JIT is enabled, enable jitting in the foreground based on heuristics. This flag is only effective when OptimizeForManyInstances is disabled (UI threads).", DEFAULT_CONFIG_HybridFgJit)
 FLAGNR(Number,  HybridFgJitBgQueueLengthThreshold, "The background job queue length must exceed this threshold to consider jitting in the foreground", DEFAULT_CONFIG_HybridFgJitBgQueueLengthThreshold)
 FLAGNR(Boolean, BytecodeHist          , "Provide a histogram of the bytecodes run by the script. (NoNative required).", false)
+FLAGR (Boolean, BatchJitCodeProtection, "Make a JIT code allocation writable once for the whole commit instead of one page at a time", DEFAULT_CONFIG_BatchJitCodeProtection)
 FLAGNR(Boolean, CurrentSourceInfo     , "Enable IASD get current script source info", DEFAULT_CONFIG_CurrentSourceInfo)
 FLAGNR(Boolean, CFGLog                , "Log CFG checks", false)
 FLAGNR(Boolean, CheckAlignment        , "Insert checks in the native code to verify 8-byte alignment of stack", false)
@@ -914,6 +942,7 @@ FLAGNR(Boolean, DumpObjectGraphOnEnum, "Dump object graph on recycler heap enume
 #ifdef DYNAMIC_PROFILE_STORAGE
 FLAGNRA(String, DynamicProfileCache   , Dpc, "File to cache dynamic profile information", nullptr)
 FLAGNR(String,  DynamicProfileCacheDir, "Directory to cache dynamic profile information", nullptr)
+FLAGNR(Boolean, DynamicProfileCacheBySourceHash, "Key cached dynamic profile information by a hash of the script source instead of its url", false)
 FLAGNRA(String, DynamicProfileInput   , Dpi, "Read only file containing dynamic profile information", nullptr)
 #endif
 #ifdef EDIT_AND_CONTINUE
@@ -1129,6 +1158,7 @@ FLAGNR(Number,  InlineThresholdAdjustCountInSmallFunction       , "Adjustment in
 FLAGNR(String,  Interpret             , "List of functions to interpret", nullptr)
 FLAGNR(Phases,  Instrument            , "Instrument the generated code from the given phase", )
 FLAGNR(Number,  JitQueueThreshold     , "Max number of work items/script context in the jit queue", DEFAULT_CONFIG_JitQueueThreshold)
+FLAGNR(Number,  JobQueueAgingWeight   , "Weight a queued background job gains for each job queued after it, so that heavier jobs don't starve it", DEFAULT_CONFIG_JobQueueAgingWeight)
 #ifdef LEAK_REPORT
 FLAGNR(String,  LeakReport            , "File name for the leak report", nullptr)
 #endif
@@ -1148,6 +1178,8 @@ FLAGNR(Number,  MaxNumberOfInlineesWithLoop, "Number of times to allow inlinees
 FLAGNR(Phases,  Memspect,              "Enables memspect tracking to perform memory investigations.", )
 #endif
 FLAGNR(Number,  PolymorphicInlineThreshold     , "Maximum size in bytecodes of a polymorphic inline candidate", DEFAULT_CONFIG_PolymorphicInlineThreshold)
+FLAGNR(Number,  PolymorphicInlineeCountMax     , "Maximum number of callees inlined at a polymorphic call site, the rest go through a generic call", DEFAULT_CONFIG_PolymorphicInlineeCountMax)
+FLAGNR(Number,  PolymorphicInlineBudget        , "Maximum sum of bytecodes of the callees inlined at a single polymorphic call site", DEFAULT_CONFIG_PolymorphicInlineBudget)
 FLAGNR(Boolean, PrimeRecycler         , "Prime the recycler first", DEFAULT_CONFIG_PrimeRecycler)
 FLAGNR(Boolean, PrivateHeap           , "Use HeapAlloc with a private heap", DEFAULT_CONFIG_PrivateHeap)
 #if defined(CHECK_MEMORY_LEAK) || defined(LEAK_REPORT)
@@ -1417,6 +1449,13 @@ FLAGNR(Boolean, DisableDebugObject, "Disable test only Debug object properties",
 FLAGNR(Boolean, DumpHeap, "enable Debug.dumpHeap even when DisableDebugObject is set", DEFAULT_CONFIG_DumpHeap)
 FLAGNR(String, autoProxy, "enable creating proxy for each object creation", _u("__msTestHandler"))
 FLAGNR(Number,  PerfHintLevel, "Specifies the perf-hint level (1,2) 1 == critical, 2 == only noisy", DEFAULT_CONFIG_PerfHintLevel)
+#ifdef PERF_MAP_PROFILING
+FLAGR (Boolean, PerfMap, "Write /tmp/perf-<pid>.map entries for JIT and interpreter thunk code so Linux perf can symbolize it", false)
+FLAGR (Boolean, PerfJitDump, "With -PerfMap, also write jit-<pid>.dump (jitdump format, with code bytes) for perf inject --jit", false)
+#endif
+#if ENABLE_TTD
+FLAGNR(Boolean, TTDBinaryFormat, "Write time travel logs and snapshots in the binary format used by release builds", false)
+#endif
 #ifdef INTERNAL_MEM_PROTECT_HEAP_ALLOC
 FLAGNR(Boolean, MemProtectHeap, "Use the mem protect heap as the default heap", DEFAULT_CONFIG_MemProtectHeap)
 #endif
@@ -1441,6 +1480,11 @@ FLAGNR(NumberSet, RejitTraceFilter, "Filter the rejit trace messages to specific
 FLAGNR(Number,  MaxBackgroundFinishMarkCount, "Maximum number of background finish mark", 1)
 FLAGNR(Number,  BackgroundFinishMarkWaitTime, "Millisecond to wait for background finish mark", 15)
 FLAGNR(Number,  MinBackgroundRepeatMarkRescanBytes, "Minimum number of bytes rescan to trigger background finish mark",  -1)
+FLAGR (Number,  RecyclerParallelism, "Maximum number of threads, including the main thread, used for parallel mark (1 to 4, larger values are capped at 4)", DEFAULT_CONFIG_RecyclerParallelism)
+FLAGR (Number,  RecyclerSparseBlockOccupancyPercent, "Swept small blocks with fewer live objects than this percentage are allocated from last so they can drain and be released (0 or less disables it, values above 100 are treated as 100)", DEFAULT_CONFIG_RecyclerSparseBlockOccupancyPercent)
+FLAGR (Number,  PageSegmentPoolMaxSegmentCount, "Maximum number of empty recycler page segments kept in the process wide pool shared between runtimes (0 to disable)", DEFAULT_CONFIG_PageSegmentPoolMaxSegmentCount)
+FLAGR (Number,  PageSegmentPoolMaxCommittedKB, "Maximum amount of memory, in KB, that the pooled recycler page segments keep committed; older pooled segments are decommitted", DEFAULT_CONFIG_PageSegmentPoolMaxCommittedKB)
+FLAGR (Boolean, RecyclerLazySweep, "Defer sweeping the objects of in-thread swept normal small blocks until allocation needs the block", DEFAULT_CONFIG_RecyclerLazySweep)
 
 #if defined(_M_IX86) || defined(_M_X64)
 FLAGNR(Boolean, ZeroMemoryWithNonTemporalStore, "Zero free memory with non-temporal stores to avoid evicting other content from processor cache", DEFAULT_CONFIG_ZeroMemoryWithNonTemporalStore)
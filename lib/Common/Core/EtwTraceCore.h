@@ -83,6 +83,22 @@ public:
     static bool s_registered;
 };
 
+#elif defined(ENABLE_GC_USDT)
+//
+// Without ETW, the recycler events are USDT probes of the "chakra" provider, named after the ETW events
+// and with the same arguments, e.g. "bpftrace -e 'usdt:./libChakraCore.so:chakra:GC_SWEEP_STOP { ... }'".
+// A probe is a nop until a tracer attaches to it.
+//
+#include <sys/sdt.h>
+
+#define GCUSDT_ARGS(...) __VA_ARGS__
+#define GCETW(e, args) STAP_PROBEV(chakra, e, GCUSDT_ARGS args)
+#define GCUSDT(e, args) STAP_PROBEV(chakra, e, GCUSDT_ARGS args)
+#define JS_ETW(s)
+#define IS_JS_ETW(s) (false)
+#define GCETW_INTERNAL(e, args)
+#define JS_ETW_INTERNAL(s)
+#define EDGE_ETW_INTERNAL(s)
 #else
 #define GCETW(e, ...)
 #define JS_ETW(s)
@@ -91,3 +107,8 @@ public:
 #define JS_ETW_INTERNAL(s)
 #define EDGE_ETW_INTERNAL(s)
 #endif
+
+#ifndef GCUSDT
+// Events that only exist as USDT probes
+#define GCUSDT(e, args)
+#endif
@@ -0,0 +1,145 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+// Contains a sparse array of pointers with one writer and lock free readers on other threads.
+// Items are stored in fixed size chunks that never move once allocated. The directory of chunks is
+// replaced when it grows, and the replaced directories are only freed with the array, so that a reader
+// that loaded one before the replacement can still go through it.
+
+#pragma once
+
+namespace JsUtil
+{
+    template <class TValue>
+    class ConcurrentReadArray
+    {
+        CompileAssert(sizeof(TValue) == sizeof(void *));
+
+    public:
+        ConcurrentReadArray() : directory(nullptr) {}
+
+        ~ConcurrentReadArray()
+        {
+            Clear();
+        }
+
+        // Can be called on any thread, concurrently with SetItem. Returns nullptr for an index that was never set.
+        TValue Item(uint index) const
+        {
+            const Directory * currentDirectory = this->directory;
+            if (currentDirectory == nullptr)
+            {
+                return nullptr;
+            }
+
+            uint chunkIndex = index >> ChunkShift;
+            if (chunkIndex >= currentDirectory->chunkCount)
+            {
+                return nullptr;
+            }
+
+            TValue volatile * chunk = currentDirectory->chunks[chunkIndex];
+            if (chunk == nullptr)
+            {
+                return nullptr;
+            }
+
+            return chunk[index & ChunkMask];
+        }
+
+        // Must only be called by the owning thread.
+        void SetItem(uint index, TValue value)
+        {
+            TValue volatile * chunk = EnsureChunk(index >> ChunkShift);
+            chunk[index & ChunkMask] = value;
+        }
+
+        // Must only be called by the owning thread, while no other thread is reading.
+        void Clear()
+        {
+            Directory * currentDirectory = this->directory;
+            this->directory = nullptr;
+
+            if (currentDirectory != nullptr)
+            {
+                for (uint i = 0; i < currentDirectory->chunkCount; i++)
+                {
+                    if (currentDirectory->chunks[i] != nullptr)
+                    {
+                        HeapDeleteArray(ChunkSize, (TValue *)currentDirectory->chunks[i]);
+                    }
+                }
+            }
+
+            while (currentDirectory != nullptr)
+            {
+                Directory * retired = currentDirectory->retired;
+                HeapDeleteArray(currentDirectory->chunkCount, (TValue **)currentDirectory->chunks);
+                HeapDelete(currentDirectory);
+                currentDirectory = retired;
+            }
+        }
+
+    private:
+        static const uint ChunkShift = 10;
+        static const uint ChunkSize = 1 << ChunkShift;
+        static const uint ChunkMask = ChunkSize - 1;
+        static const uint InitialChunkCount = 4;
+
+        struct Directory
+        {
+            uint chunkCount;
+            TValue volatile * volatile * chunks;
+            Directory * retired;
+        };
+
+        TValue volatile * EnsureChunk(uint chunkIndex)
+        {
+            Directory * currentDirectory = this->directory;
+            if (currentDirectory == nullptr || chunkIndex >= currentDirectory->chunkCount)
+            {
+                uint chunkCount = currentDirectory == nullptr ? InitialChunkCount : currentDirectory->chunkCount * 2;
+                chunkCount = max(chunkCount, chunkIndex + 1);
+
+                TValue ** chunks = HeapNewArrayZ(TValue *, chunkCount);
+                Directory * newDirectory = HeapNewNoThrowStruct(Directory);
+                if (newDirectory == nullptr)
+                {
+                    HeapDeleteArray(chunkCount, chunks);
+                    Js::Throw::OutOfMemory();
+                }
+                newDirectory->chunkCount = chunkCount;
+                newDirectory->chunks = (TValue volatile * volatile *)chunks;
+                newDirectory->retired = currentDirectory;
+                if (currentDirectory != nullptr)
+                {
+                    for (uint i = 0; i < currentDirectory->chunkCount; i++)
+                    {
+                        newDirectory->chunks[i] = currentDirectory->chunks[i];
+                    }
+                }
+
+                // Readers must not see the new directory before its contents
+                MemoryBarrier();
+                this->directory = newDirectory;
+                currentDirectory = newDirectory;
+            }
+
+            TValue volatile * chunk = currentDirectory->chunks[chunkIndex];
+            if (chunk == nullptr)
+            {
+                chunk = HeapNewArrayZ(TValue, ChunkSize);
+
+                // Readers must not see the new chunk before it is zeroed
+                MemoryBarrier();
+                currentDirectory->chunks[chunkIndex] = chunk;
+            }
+            return chunk;
+        }
+
+        Directory * volatile directory;
+
+        PREVENT_COPY(ConcurrentReadArray);
+    };
+}
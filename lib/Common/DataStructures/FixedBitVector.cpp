@@ -4,6 +4,49 @@
 //-------------------------------------------------------------------------------------------------------
 #include "CommonDataStructuresPch.h"
 
+#if defined(_M_IX86) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+enum class UnitBlockOp { Or, And, Minus };
+
+// Applies a bitwise operation to the units of two bit vectors of the same length, 16 bytes at a time
+// where SSE2 is available. The operation is a template parameter so the branches fold away.
+template <UnitBlockOp op>
+static void
+ForEachUnitBlock(BVUnit * dst, const BVUnit * src, BVIndex wordCount)
+{
+    BVIndex i = 0;
+#if defined(_M_IX86) || defined(_M_X64)
+    const BVIndex unitsPerBlock = sizeof(__m128i) / sizeof(BVUnit);
+    for (; i + unitsPerBlock <= wordCount; i += unitsPerBlock)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i *)&dst[i]);
+        __m128i b = _mm_loadu_si128((const __m128i *)&src[i]);
+        __m128i result =
+            op == UnitBlockOp::Or ? _mm_or_si128(a, b) :
+            op == UnitBlockOp::And ? _mm_and_si128(a, b) :
+            _mm_andnot_si128(b, a);
+        _mm_storeu_si128((__m128i *)&dst[i], result);
+    }
+#endif
+    for (; i < wordCount; i++)
+    {
+        switch (op)
+        {
+        case UnitBlockOp::Or:
+            dst[i].Or(src[i]);
+            break;
+        case UnitBlockOp::And:
+            dst[i].And(src[i]);
+            break;
+        case UnitBlockOp::Minus:
+            dst[i].Minus(src[i]);
+            break;
+        }
+    }
+}
+
 BVFixed::BVFixed(BVFixed * initBv) :
    len(initBv->Length())
 {
@@ -182,7 +225,8 @@ void
 BVFixed::Or(const BVFixed*bv)
 {
     AssertBV(bv);
-    this->for_each(bv, &BVUnit::Or);
+    AssertMsg(this->len == bv->len, "Fatal: The 2 bitvectors should have had the same length.");
+    ForEachUnitBlock<UnitBlockOp::Or>(&this->data[0], &bv->data[0], this->WordCount());
 }
 
 //
@@ -226,14 +270,16 @@ void
 BVFixed::And(const BVFixed*bv)
 {
     AssertBV(bv);
-    this->for_each(bv, &BVUnit::And);
+    AssertMsg(this->len == bv->len, "Fatal: The 2 bitvectors should have had the same length.");
+    ForEachUnitBlock<UnitBlockOp::And>(&this->data[0], &bv->data[0], this->WordCount());
 }
 
 void
 BVFixed::Minus(const BVFixed*bv)
 {
     AssertBV(bv);
-    this->for_each(bv, &BVUnit::Minus);
+    AssertMsg(this->len == bv->len, "Fatal: The 2 bitvectors should have had the same length.");
+    ForEachUnitBlock<UnitBlockOp::Minus>(&this->data[0], &bv->data[0], this->WordCount());
 }
 
 void
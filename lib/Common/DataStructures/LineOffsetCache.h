@@ -166,6 +166,22 @@ namespace JsUtil
 
             while (currentSourcePosition < sourceEndCharacter)
             {
+                // Fast path for runs of plain ASCII that are not line terminators: each byte is exactly one
+                // character, so the offsets can be advanced without going through the UTF8 decoder.
+                utf8char_t currentByte = *currentSourcePosition;
+                if (currentByte < 0x80 && currentByte != '\r' && currentByte != '\n')
+                {
+                    ++currentSourcePosition;
+                    ++currentCharacterOffset;
+                    ++currentByteOffset;
+
+                    if (currentCharacterOffset >= maxCharacterOffset)
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+
                 LPCUTF8 previousCharacter = currentSourcePosition;
 
                 // Decode from UTF8 to wide char.  Note that Decode will advance the current character by 1 at least.
@@ -0,0 +1,497 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if defined(_M_IX86) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+// An open addressing alternative to BaseDictionary, for sites where lookups dominate.
+//
+// LAYOUT
+// The entries are kept in a single array, with no buckets and no next links. Each entry has a control byte,
+// which is either Empty, Deleted, or the low 7 bits of the hash of its key. A lookup loads the control bytes
+// of a group of 16 consecutive entries at once, compares all of them against the 7 hash bits (with SSE2
+// where available), and only compares keys for the entries that match. The probe sequence moves from group
+// to group with a growing stride, and ends at the first group that has an Empty entry.
+//
+// The first GroupSize control bytes are mirrored after the last one, so that a group can start at any
+// entry and be loaded with one unaligned read.
+//
+// INTERFACE
+// The template parameters and methods follow BaseDictionary, so a typedef can switch between the two. The
+// size is always a power of 2. Unlike BaseDictionary, entries have no stable index, there is no resize lock
+// and no entry cleanup policy; sites that need those stay on BaseDictionary.
+//
+namespace JsUtil
+{
+    template <
+        class TKey,
+        class TValue,
+        class TAllocator,
+        class SizePolicy = PowerOf2SizePolicy,
+        template <typename ValueOrKey> class Comparer = DefaultComparer
+    >
+    class OpenAddressingDictionary
+    {
+    public:
+        typedef TKey KeyType;
+        typedef TValue ValueType;
+        typedef typename AllocatorInfo<TAllocator, TValue>::AllocatorType AllocatorType;
+
+    private:
+        typedef typename AllocatorInfo<TAllocator, TValue>::AllocatorFunc EntryAllocatorFuncType;
+        typedef TypeAllocatorFunc<AllocatorType, byte> ControlAllocatorFuncType;
+
+        struct Entry
+        {
+            TKey key;
+            TValue value;
+        };
+
+        static const uint GroupSize = 16;
+        static const byte EmptyControl = 0x80;
+        static const byte DeletedControl = 0xFE;
+
+        byte * controls;
+        Entry * entries;
+        AllocatorType * alloc;
+        uint capacity;
+        uint count;
+        uint deletedCount;
+
+    public:
+        OpenAddressingDictionary(AllocatorType * allocator, int capacity = 0)
+            : controls(nullptr),
+            entries(nullptr),
+            alloc(allocator),
+            capacity(0),
+            count(0),
+            deletedCount(0)
+        {
+            Assert(allocator);
+
+            // If initial capacity is negative or 0, lazy initialization on the first insert operation is performed.
+            if (capacity > 0)
+            {
+                Initialize(GetCapacityFor((uint)capacity));
+            }
+        }
+
+        ~OpenAddressingDictionary()
+        {
+            Reset();
+        }
+
+        AllocatorType * GetAllocator() const
+        {
+            return alloc;
+        }
+
+        int Capacity() const
+        {
+            return (int)capacity;
+        }
+
+        int Count() const
+        {
+            return (int)count;
+        }
+
+        TValue Item(const TKey& key) const
+        {
+            int i = FindEntry(key);
+            Assert(i >= 0);
+            return entries[i].value;
+        }
+
+        int Add(const TKey& key, const TValue& value)
+        {
+            Assert(FindEntry(key) < 0);
+            return InsertNew(key, value);
+        }
+
+        int AddNew(const TKey& key, const TValue& value)
+        {
+            int i = FindEntry(key);
+            if (i >= 0)
+            {
+                return i;
+            }
+            return InsertNew(key, value);
+        }
+
+        int Item(const TKey& key, const TValue& value)
+        {
+            int i = FindEntry(key);
+            if (i >= 0)
+            {
+                entries[i].value = value;
+                return i;
+            }
+            return InsertNew(key, value);
+        }
+
+        bool ContainsKey(const TKey& key) const
+        {
+            return FindEntry(key) >= 0;
+        }
+
+        bool TryGetValue(const TKey& key, TValue * value) const
+        {
+            int i = FindEntry(key);
+            if (i >= 0)
+            {
+                *value = entries[i].value;
+                return true;
+            }
+            return false;
+        }
+
+        bool TryGetReference(const TKey& key, TValue ** value)
+        {
+            int i = FindEntry(key);
+            if (i >= 0)
+            {
+                *value = &entries[i].value;
+                return true;
+            }
+            return false;
+        }
+
+        TValue Lookup(const TKey& key, const TValue& defaultValue) const
+        {
+            int i = FindEntry(key);
+            return i >= 0 ? entries[i].value : defaultValue;
+        }
+
+        bool Remove(const TKey& key)
+        {
+            int i = FindEntry(key);
+            if (i < 0)
+            {
+                return false;
+            }
+            RemoveAt((uint)i);
+            return true;
+        }
+
+        bool TryGetValueAndRemove(const TKey& key, TValue * value)
+        {
+            int i = FindEntry(key);
+            if (i < 0)
+            {
+                return false;
+            }
+            *value = entries[i].value;
+            RemoveAt((uint)i);
+            return true;
+        }
+
+        void Clear()
+        {
+            if (count + deletedCount > 0)
+            {
+                memset(controls, EmptyControl, capacity + GroupSize);
+                memset(entries, 0, sizeof(Entry) * capacity);
+                count = 0;
+                deletedCount = 0;
+            }
+        }
+
+        void Reset()
+        {
+            if (capacity != 0)
+            {
+                DeleteControls(controls, capacity);
+                DeleteEntries(entries, capacity);
+                controls = nullptr;
+                entries = nullptr;
+                capacity = 0;
+                count = 0;
+                deletedCount = 0;
+            }
+        }
+
+        template<class Fn>
+        void Map(Fn fn) const
+        {
+            for (uint i = 0; i < capacity; i++)
+            {
+                if (IsFull(controls[i]))
+                {
+                    fn(entries[i].key, entries[i].value);
+                }
+            }
+        }
+
+        template<class Fn>
+        bool MapUntil(Fn fn) const
+        {
+            for (uint i = 0; i < capacity; i++)
+            {
+                if (IsFull(controls[i]) && fn(entries[i].key, entries[i].value))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+        static bool IsFull(byte control)
+        {
+            return (control & 0x80) == 0;
+        }
+
+        // The comparers' hash codes are often addresses or small integers, with little entropy in the bits
+        // the table uses; mix them so that the group index and the 7 control bits are both well distributed.
+        static hash_t GetHashCode(const TKey& key)
+        {
+            hash_t hash = (hash_t)Comparer<TKey>::GetHashCode(key);
+            hash ^= hash >> 16;
+            hash *= 0x7feb352d;
+            hash ^= hash >> 15;
+            hash *= 0x846ca68b;
+            hash ^= hash >> 16;
+            return hash;
+        }
+
+        static byte GetControlHash(hash_t hash)
+        {
+            return (byte)(hash & 0x7F);
+        }
+
+        static uint GetCapacityFor(uint entryCount)
+        {
+            // Keep at most 7/8 of the entries in use
+            uint capacity = GroupSize;
+            while (capacity - capacity / 8 < entryCount)
+            {
+                capacity = UInt32Math::Mul(capacity, 2);
+            }
+            return capacity;
+        }
+
+        // Returns a mask with bit i set if the control byte i of the group starting at the given entry is the
+        // given value.
+        uint MatchGroup(uint start, byte value) const
+        {
+#if defined(_M_IX86) || defined(_M_X64)
+            const __m128i group = _mm_loadu_si128((const __m128i *)(controls + start));
+            return (uint)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)value)));
+#else
+            uint mask = 0;
+            for (uint i = 0; i < GroupSize; i++)
+            {
+                if (controls[start + i] == value)
+                {
+                    mask |= 1 << i;
+                }
+            }
+            return mask;
+#endif
+        }
+
+        // Returns a mask with bit i set if the control byte i of the group starting at the given entry is Empty or
+        // Deleted; both have the high bit set.
+        uint MatchGroupNotFull(uint start) const
+        {
+#if defined(_M_IX86) || defined(_M_X64)
+            const __m128i group = _mm_loadu_si128((const __m128i *)(controls + start));
+            return (uint)_mm_movemask_epi8(group);
+#else
+            uint mask = 0;
+            for (uint i = 0; i < GroupSize; i++)
+            {
+                if (!IsFull(controls[start + i]))
+                {
+                    mask |= 1 << i;
+                }
+            }
+            return mask;
+#endif
+        }
+
+        static uint LowestBit(uint mask)
+        {
+            Assert(mask != 0);
+            DWORD index;
+            _BitScanForward(&index, mask);
+            return index;
+        }
+
+        int FindEntry(const TKey& key) const
+        {
+            if (capacity == 0)
+            {
+                return -1;
+            }
+
+            hash_t hash = GetHashCode(key);
+            byte controlHash = GetControlHash(hash);
+            uint indexMask = capacity - 1;
+            uint start = (hash >> 7) & indexMask;
+
+            // The stride grows by a group each step, which visits every group when the group count is a power of 2
+            for (uint stride = GroupSize; ; stride += GroupSize)
+            {
+                for (uint match = MatchGroup(start, controlHash); match != 0; match &= match - 1)
+                {
+                    uint i = (start + LowestBit(match)) & indexMask;
+                    if (Comparer<TKey>::Equals(entries[i].key, key))
+                    {
+                        return (int)i;
+                    }
+                }
+
+                if (MatchGroup(start, EmptyControl) != 0)
+                {
+                    return -1;
+                }
+
+                start = (start + stride) & indexMask;
+            }
+        }
+
+        uint FindInsertSlot(hash_t hash) const
+        {
+            uint indexMask = capacity - 1;
+            uint start = (hash >> 7) & indexMask;
+            for (uint stride = GroupSize; ; stride += GroupSize)
+            {
+                uint match = MatchGroupNotFull(start);
+                if (match != 0)
+                {
+                    return (start + LowestBit(match)) & indexMask;
+                }
+                start = (start + stride) & indexMask;
+            }
+        }
+
+        void SetControl(uint i, byte control)
+        {
+            controls[i] = control;
+            if (i < GroupSize)
+            {
+                controls[capacity + i] = control;
+            }
+        }
+
+        int InsertNew(const TKey& key, const TValue& value)
+        {
+            if (capacity == 0)
+            {
+                Initialize(GroupSize);
+            }
+            else if (count + deletedCount >= capacity - capacity / 8)
+            {
+                // Rehash in place of the deleted entries if they make up much of the load, grow otherwise
+                Resize(count < (capacity - capacity / 8) / 2 ? capacity : UInt32Math::Mul(capacity, 2));
+            }
+
+            hash_t hash = GetHashCode(key);
+            uint i = FindInsertSlot(hash);
+            if (controls[i] == DeletedControl)
+            {
+                deletedCount--;
+            }
+            SetControl(i, GetControlHash(hash));
+            entries[i].key = key;
+            entries[i].value = value;
+            count++;
+            return (int)i;
+        }
+
+        void RemoveAt(uint i)
+        {
+            Assert(IsFull(controls[i]));
+            SetControl(i, DeletedControl);
+            memset(&entries[i], 0, sizeof(Entry));
+            count--;
+            deletedCount++;
+        }
+
+        void Initialize(uint newCapacity)
+        {
+            Assert(Math::IsPow2((int32)newCapacity) && newCapacity >= GroupSize);
+            byte * newControls = AllocateControls(newCapacity);
+            Entry * newEntries;
+            try
+            {
+                newEntries = AllocateEntries(newCapacity);
+            }
+            catch (...)
+            {
+                DeleteControls(newControls, newCapacity);
+                throw;
+            }
+
+            controls = newControls;
+            entries = newEntries;
+            capacity = newCapacity;
+            count = 0;
+            deletedCount = 0;
+        }
+
+        void Resize(uint newCapacity)
+        {
+            byte * oldControls = controls;
+            Entry * oldEntries = entries;
+            uint oldCapacity = capacity;
+
+            // When the allocator is the Recycler, allocating may collect, but nothing here is weakly referenced
+            Initialize(newCapacity);
+            for (uint i = 0; i < oldCapacity; i++)
+            {
+                if (IsFull(oldControls[i]))
+                {
+                    hash_t hash = GetHashCode(oldEntries[i].key);
+                    uint j = FindInsertSlot(hash);
+                    SetControl(j, GetControlHash(hash));
+                    entries[j] = oldEntries[i];
+                    count++;
+                }
+            }
+
+            DeleteControls(oldControls, oldCapacity);
+            DeleteEntries(oldEntries, oldCapacity);
+        }
+
+        byte * AllocateControls(DECLSPEC_GUARD_OVERFLOW uint capacity)
+        {
+            uint controlCount = UInt32Math::Add(capacity, GroupSize);
+            byte * newControls =
+                AllocateArray<AllocatorType, byte, false>(
+                    TRACK_ALLOC_INFO(alloc, byte, AllocatorType, 0, controlCount),
+                    ControlAllocatorFuncType::GetAllocFunc(),
+                    controlCount);
+            memset(newControls, EmptyControl, controlCount);
+            return newControls;
+        }
+
+        Entry * AllocateEntries(DECLSPEC_GUARD_OVERFLOW uint capacity)
+        {
+            // As in BaseDictionary, the choice of leaf/non-leaf allocation is made on the basis of TValue
+            return
+                AllocateArray<AllocatorType, Entry, false>(
+                    TRACK_ALLOC_INFO(alloc, Entry, AllocatorType, 0, capacity),
+                    EntryAllocatorFuncType::GetAllocZeroFunc(),
+                    capacity);
+        }
+
+        void DeleteControls(__in_ecount(capacity + GroupSize) byte * const controls, const uint capacity)
+        {
+            AllocatorFree(alloc, ControlAllocatorFuncType::GetFreeFunc(), controls, (capacity + GroupSize) * sizeof(byte));
+        }
+
+        void DeleteEntries(__in_ecount(capacity) Entry * const entries, const uint capacity)
+        {
+            AllocatorFree(alloc, EntryAllocatorFuncType::GetFreeFunc(), entries, capacity * sizeof(Entry));
+        }
+
+        PREVENT_COPY(OpenAddressingDictionary);
+    };
+}
@@ -26,6 +26,14 @@ public:
 
     uint Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks);
 
+    // Work stealing support for parallel mark.
+    // The owner of a stack can donate entries to a shared stack, and an idle owner can steal them back a chunk's worth at a time.
+    // Entries are copied rather than chunks moved, so each stack only ever allocates from and frees to its own page pool, and
+    // pages (in particular reserved ones) never change pools. Callers must synchronize access to the shared stack.
+    bool HasDonatableChunks() const { return this->currentChunk != nullptr && this->currentChunk->nextChunk != nullptr; }
+    uint DonateEntries(PageStack<T> * sharedStack, uint chunkCount);
+    bool StealEntries(PageStack<T> * sharedStack);
+
     void Abort();
     void Release();
 
@@ -49,6 +57,7 @@ public:
 private:
     Chunk * CreateChunk();
     void FreeChunk(Chunk * chunk);
+    uint MoveEntries(PageStack<T> * targetStack, size_t maxCount);
 
 private:
     T * nextEntry;
@@ -353,6 +362,49 @@ uint PageStack<T>::Split(uint targetCount, __in_ecount(targetCount) PageStack<T>
 }
 
 
+template <typename T>
+uint PageStack<T>::MoveEntries(PageStack<T> * targetStack, size_t maxCount)
+{
+    // Pop entries off this stack and push them on [targetStack], stopping early if [targetStack] can't get a page.
+    Assert(targetStack != this);
+
+    uint movedCount = 0;
+    T item;
+    while (movedCount < maxCount && !this->IsEmpty())
+    {
+        this->Pop(&item);
+        if (!targetStack->Push(item))
+        {
+            // Any chunk the pop freed went back to our own pool, so pushing the entry back can't fail.
+            AssertVerify(this->Push(item));
+            break;
+        }
+        movedCount++;
+    }
+
+    return movedCount;
+}
+
+
+template <typename T>
+uint PageStack<T>::DonateEntries(PageStack<T> * sharedStack, uint chunkCount)
+{
+    // Give up to [chunkCount] chunks' worth of entries to [sharedStack].
+    Assert(HasDonatableChunks());
+    return MoveEntries(sharedStack, (size_t)chunkCount * EntriesPerChunk);
+}
+
+
+template <typename T>
+bool PageStack<T>::StealEntries(PageStack<T> * sharedStack)
+{
+    // Take up to one chunk's worth of entries from [sharedStack].
+    // A parallel mark stack keeps its last chunk when it runs dry, so this fills that chunk without allocating.
+    Assert(IsEmpty());
+    return sharedStack->MoveEntries(this, EntriesPerChunk) != 0;
+}
+
+
 template <typename T>
 void PageStack<T>::Abort()
 {
@@ -114,6 +114,10 @@ private:
 
     static BVIndex CountBit(UnitWord32 bits)
     {
+#if defined(__POPCNT__)
+        // Targets built with -msse4.2 have popcnt, use it directly instead of the adder tree
+        return BVIndex(__builtin_popcount(bits));
+#else
         const uint _5_32 =     0x55555555;
         const uint _3_32 =     0x33333333;
         const uint _F1_32 =    0x0f0f0f0f;
@@ -129,10 +133,14 @@ private:
         bits += bits >> 8;
         bits += bits >> 16;
         return BVIndex(bits & 0xff);
+#endif
     }
 
     static BVIndex CountBit(UnitWord64 bits)
     {
+#if defined(__POPCNT__)
+        return BVIndex(__builtin_popcountll(bits));
+#else
 #if DBG
         unsigned countBits = CountBit((UnitWord32)bits) + CountBit((UnitWord32)(bits >> 32));
 #endif
@@ -158,6 +166,7 @@ private:
         AssertMsg(countBits == (bits & 0xff), "Wrong count?");
 
         return (BVIndex)(bits & 0xff);
+#endif
     }
 
     static unsigned int NumLeadingZeroes(UnitWord32 bits)
@@ -395,6 +395,57 @@ FullReset()
     }
 }
 
+template <class TFreeListPolicy, size_t ObjectAlignmentBitShiftArg, bool RequireObjectAlignment, size_t MaxObjectSize>
+void
+ArenaAllocatorBase<TFreeListPolicy, ObjectAlignmentBitShiftArg, RequireObjectAlignment, MaxObjectSize>::
+ResetRetainLargestBlock()
+{
+    if (this->blockState <= 1)
+    {
+        // Zero or one big block, nothing to choose from
+        Reset();
+        return;
+    }
+
+    ASSERT_THREAD();
+    Assert(!lockBlockList);
+
+#ifdef PROFILE_MEM
+    LogReset();
+#endif
+
+    BigBlock * largestBlock = nullptr;
+    BigBlock ** largestBlockLink = nullptr;
+    for (BigBlock ** link = &this->bigBlocks; *link != nullptr; link = &(*link)->nextBigBlock)
+    {
+        if (largestBlock == nullptr || (*link)->nbytes > largestBlock->nbytes)
+        {
+            largestBlock = *link;
+            largestBlockLink = link;
+        }
+    }
+    for (BigBlock ** link = &this->fullBlocks; *link != nullptr; link = &(*link)->nextBigBlock)
+    {
+        if (largestBlock == nullptr || (*link)->nbytes > largestBlock->nbytes)
+        {
+            largestBlock = *link;
+            largestBlockLink = link;
+        }
+    }
+
+    if (largestBlock != nullptr)
+    {
+        *largestBlockLink = largestBlock->nextBigBlock;
+    }
+    Clear();
+    if (largestBlock != nullptr)
+    {
+        this->blockState = 1;
+        largestBlock->currentByte = 0;
+        SetCacheBlock(largestBlock);
+    }
+}
+
 template <class TFreeListPolicy, size_t ObjectAlignmentBitShiftArg, bool RequireObjectAlignment, size_t MaxObjectSize>
 void
 ArenaAllocatorBase<TFreeListPolicy, ObjectAlignmentBitShiftArg, RequireObjectAlignment, MaxObjectSize>::
@@ -191,6 +191,10 @@ public:
         FullReset();
     }
 
+    // Like Reset, but keeps the largest page block rather than the current one. An arena that is reused for a
+    // series of similar tasks then starts each one with enough pages for the biggest task seen so far.
+    void ResetRetainLargestBlock();
+
     void Move(ArenaAllocatorBase *srcAllocator);
 
     void Clear()
@@ -542,6 +546,12 @@ public:
         bvFreeList = nullptr;
         ArenaAllocator::Clear();
     }
+
+    void ResetRetainLargestBlock()
+    {
+        bvFreeList = nullptr;
+        ArenaAllocator::ResetRetainLargestBlock();
+    }
 };
 
 // This allocator by default on OOM does not attempt to recover memory from Recycler, just throws OOM.
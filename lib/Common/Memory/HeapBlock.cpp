@@ -887,6 +887,81 @@ SmallHeapBlockT<TBlockAttributes>::ClearAllAllocBytes()
 #endif
 }
 
+template <class TBlockAttributes>
+char *
+SmallHeapBlockT<TBlockAttributes>::TryTakeFreeTailForBumpAllocation(Recycler * recycler)
+{
+    // Short lived objects are usually the most recently allocated ones, so after a sweep it is common for
+    // every free object in a block to sit in one run at the end of the block. Handing that run to the allocator
+    // as a bump allocation range is cheaper than walking the free list, and lets native code allocate from the
+    // block inline instead of calling the allocation helper.
+    Assert(this->isInAllocator);
+    Assert(this->freeObjectList != nullptr);
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    if (CUSTOM_PHASE_OFF1(recycler->GetRecyclerFlagsTable(), Js::BumpAllocateFreeTailPhase))
+    {
+        return nullptr;
+    }
+#endif
+
+#ifdef RECYCLER_MEMORY_VERIFY
+    if (recycler->VerifyEnabled())
+    {
+        return nullptr;
+    }
+#endif
+
+    // The free bit vector is only accurate if nothing was allocated from the block since it was swept.
+    // Finalizable blocks track pending dispose objects separately from the free list, leave those alone.
+    if (!this->IsFreeBitsValid() || this->freeCount == 0 || this->IsAnyFinalizableBlock())
+    {
+        return nullptr;
+    }
+
+    Assert(this->freeCount == this->GetFreeBitVector()->Count());
+
+    // Since there are exactly freeCount free objects, they are all in the tail iff the last freeCount objects are free.
+    // Walk backward so that a block with a live object near the end is rejected quickly.
+    SmallHeapBlockBitVector * freeBits = this->GetFreeBitVector();
+    const uint objectBitDelta = this->GetObjectBitDelta();
+    const uint firstFreeIndex = this->objectCount - this->freeCount;
+    for (uint objectIndex = this->objectCount; objectIndex > firstFreeIndex; objectIndex--)
+    {
+        if (!freeBits->Test((objectIndex - 1) * objectBitDelta))
+        {
+            return nullptr;
+        }
+    }
+
+    // Free objects in normal blocks are zeroed except for the free list link (see FillFreeMemory).
+    // Bump allocated memory is expected to be entirely zero, so clear the link.
+    const bool needZeroNext = !this->IsLeafBlock()
+#ifdef RECYCLER_WRITE_BARRIER_ALLOC_THREAD_PAGE
+        && !this->IsWithBarrier()
+#endif
+        ;
+
+    char * bumpAllocAddress = this->address + firstFreeIndex * this->objectSize;
+    char * objectAddress = bumpAllocAddress;
+    for (uint objectIndex = firstFreeIndex; objectIndex < this->objectCount; objectIndex++)
+    {
+        if (needZeroNext)
+        {
+            ((FreeObject *)objectAddress)->ZeroNext();
+        }
+#if DBG || defined(RECYCLER_STATS)
+        this->GetDebugFreeBitVector()->Clear(objectIndex * objectBitDelta);
+#endif
+        objectAddress += this->objectSize;
+    }
+
+    // Leave lastFreeObjectHead alone; the free bit vector is now stale, just as if we had allocated everything
+    // off the free list, and will be rebuilt from the (empty) free list before it is used again.
+    this->freeObjectList = nullptr;
+    return bumpAllocAddress;
+}
+
 #if ENABLE_PARTIAL_GC
 template <class TBlockAttributes>
 bool
@@ -1165,7 +1240,6 @@ SmallHeapBlockT<TBlockAttributes>::SweepObjects(Recycler * recycler)
     {
         Assert(IsValidBitIndex(bitIndex));
 
-        RECYCLER_STATS_ADD(recycler, objectSweepScanCount, !isForceSweeping);
         if (!marked->Test(bitIndex))
         {
             if (!this->GetFreeBitVector()->Test(bitIndex))
@@ -1200,6 +1274,9 @@ SmallHeapBlockT<TBlockAttributes>::SweepObjects(Recycler * recycler)
     }
 
     Assert(sweepCount == expectedSweepCount);
+
+    // Blocks may be swept on several threads at once during a parallel sweep
+    RECYCLER_STATS_INTERLOCKED_ADD(recycler, objectSweepScanCount, isForceSweeping ? 0 : localObjectCount);
 #if ENABLE_CONCURRENT_GC
     this->isPendingConcurrentSweep = false;
 #endif
@@ -1570,11 +1647,17 @@ SmallHeapBlockT<TBlockAttributes>::MarkImplicitRoots()
 
 template <class TBlockAttributes>
 void
-SmallHeapBlockT<TBlockAttributes>::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+SmallHeapBlockT<TBlockAttributes>::EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context)
 {
-    ForEachAllocatedObject(infoBits, [=](uint index, void * objectAddress)
+    // Leaf blocks don't store the leaf bit per object, report it so callers don't need to know the block type
+    ObjectInfoBits const impliedBits = this->IsLeafBlock() ? LeafBit : NoBit;
+    ForEachAllocatedObject([=](uint index, void * objectAddress)
     {
-        CallBackFunction(objectAddress, this->objectSize);
+        ObjectInfoBits attributes = (ObjectInfoBits)(this->ObjectInfo(index) | impliedBits);
+        if ((attributes & infoBits) == infoBits)
+        {
+            callback(objectAddress, this->objectSize, attributes, context);
+        }
     });
 }
 
@@ -140,6 +140,10 @@ enum ObjectInfoBits : unsigned short
     EnumClassMask               = EnumClass_1_Bit,
 };
 
+// Callback for heap object enumeration. Attributes are the object's stored ObjectInfoBits,
+// plus LeafBit for objects in leaf blocks.
+typedef void (*EnumerateObjectsCallback)(void * address, size_t size, ObjectInfoBits attributes, void * context);
+
 
 enum ResetMarkFlags
 {
@@ -559,6 +563,10 @@ public:
 
     uint GetAndClearLastFreeCount();
     void ClearAllAllocBytes();      // Reset all unaccounted alloc bytes and the new alloc count
+
+    // If all the free objects are in one run at the end of the block, take them off the free list
+    // and return the start of the run so it can be bump allocated. Returns nullptr otherwise.
+    char * TryTakeFreeTailForBumpAllocation(Recycler * recycler);
 #if ENABLE_PARTIAL_GC
     uint GetAndClearUnaccountedAllocBytes();
     void AdjustPartialUncollectedAllocBytes(RecyclerSweep& recyclerSweep, uint const expectSweepCount);
@@ -581,7 +589,7 @@ public:
 
     void Reset();
 
-    void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context);
 
     bool IsImplicitRoot(uint objectIndex)
     {
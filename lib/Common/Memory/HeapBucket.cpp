@@ -41,6 +41,9 @@ HeapBucketT<TBlockType>::HeapBucketT() :
     emptyBlockList(nullptr),
     fullBlockList(nullptr),
     heapBlockList(nullptr),
+#if ENABLE_CONCURRENT_GC
+    lazySweepHeapBlockList(nullptr),
+#endif
     explicitFreeList(nullptr),
     lastExplicitFreeListAllocator(nullptr)
 {
@@ -59,6 +62,9 @@ HeapBucketT<TBlockType>::~HeapBucketT()
 {
     DeleteHeapBlockList(this->heapBlockList);
     DeleteHeapBlockList(this->fullBlockList);
+#if ENABLE_CONCURRENT_GC
+    DeleteHeapBlockList(this->lazySweepHeapBlockList);
+#endif
 
     Assert(this->heapBlockCount + this->newHeapBlockCount == 0);
     RECYCLER_SLOW_CHECK(Assert(this->emptyHeapBlockCount == HeapBlockList::Count(this->emptyBlockList)));
@@ -298,6 +304,7 @@ HeapBucketT<TBlockType>::GetNonEmptyHeapBlockCount(bool checkCount) const
     size_t currentHeapBlockCount = HeapBlockList::Count(fullBlockList);
     currentHeapBlockCount += HeapBlockList::Count(heapBlockList);
 #if ENABLE_CONCURRENT_GC
+    currentHeapBlockCount += HeapBlockList::Count(lazySweepHeapBlockList);
     // Recycler can be null if we have OOM in the ctor
     if (this->GetRecycler() && this->GetRecycler()->recyclerSweep != nullptr)
     {
@@ -343,6 +350,12 @@ HeapBucketT<TBlockType>::TryAlloc(Recycler * recycler, TBlockAllocatorType * all
         this->lastExplicitFreeListAllocator = allocator;
         this->explicitFreeList = nullptr;
     }
+#if ENABLE_CONCURRENT_GC
+    else if ((heapBlock = this->LazySweepNextHeapBlock(recycler)) != nullptr)
+    {
+        allocator->Set(heapBlock);
+    }
+#endif
     else
     {
         return nullptr;
@@ -751,7 +764,16 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
 
 #if ENABLE_PARTIAL_GC
     // CONCURRENT-TODO: Add a mode where we can do in thread sweep, and concurrent partial sweep?
-    bool const queuePendingSweep = this->DoQueuePendingSweep(recycler);
+    bool const queuePendingSweep = this->DoQueuePendingSweep(recycler)
+#if ENABLE_CONCURRENT_GC
+        // For parallel sweep, queue as well in order to hand the object sweep over to the parallel threads,
+        // and for lazy sweep in order to leave the object sweep to allocation. Like partial GC, this only
+        // covers plain normal buckets; leaf, finalizable and write barrier blocks are still swept here.
+        || (IsNormalBucket && (recyclerSweep.IsParallelSweep() || recyclerSweep.IsLazySweep()))
+#endif
+        ;
+#elif ENABLE_CONCURRENT_GC
+    bool const queuePendingSweep = IsNormalBucket && (recyclerSweep.IsParallelSweep() || recyclerSweep.IsLazySweep());
 #else
     bool const queuePendingSweep = false;
 #endif
@@ -954,9 +976,107 @@ HeapBucketT<TBlockType>::StartAllocationAfterSweep()
 {
     Assert(this->IsAllocationStopped());
     DebugOnly(this->isAllocationStopped = false);
+    this->MoveSparseHeapBlocksToTail();
     this->nextAllocableBlockHead = this->heapBlockList;
 }
 
+#if ENABLE_CONCURRENT_GC
+template <typename TBlockType>
+void
+HeapBucketT<TBlockType>::SetLazySweepHeapBlockList(TBlockType * list)
+{
+    Assert(IsNormalBucket);
+    Assert(this->lazySweepHeapBlockList == nullptr);
+    this->lazySweepHeapBlockList = list;
+}
+
+template <typename TBlockType>
+TBlockType *
+HeapBucketT<TBlockType>::LazySweepNextHeapBlock(Recycler * recycler)
+{
+    // The allocator has used up all the swept blocks, sweep the next block left by the lazy sweep.
+    // The block goes back on the heapBlockList the same way blocks we have allocated from sit there.
+    Assert(this->nextAllocableBlockHead == nullptr);
+    TBlockType * heapBlock = this->lazySweepHeapBlockList;
+    if (heapBlock != nullptr)
+    {
+        this->lazySweepHeapBlockList = heapBlock->GetNextBlock();
+        heapBlock->template SweepObjects<SweepMode_Concurrent>(recycler);
+        Assert(heapBlock->HasFreeObject());
+        heapBlock->SetNextBlock(this->heapBlockList);
+        this->heapBlockList = heapBlock;
+    }
+    return heapBlock;
+}
+
+template <typename TBlockType>
+void
+HeapBucketT<TBlockType>::FinishLazySweep(Recycler * recycler)
+{
+    TBlockType * list = this->lazySweepHeapBlockList;
+    if (list == nullptr)
+    {
+        return;
+    }
+
+    this->lazySweepHeapBlockList = nullptr;
+    HeapBlockList::ForEach(list, [recycler](TBlockType * heapBlock)
+    {
+        heapBlock->template SweepObjects<SweepMode_Concurrent>(recycler);
+    });
+    this->AppendAllocableHeapBlockList(list);
+}
+#endif
+
+template <typename TBlockType>
+void
+HeapBucketT<TBlockType>::MoveSparseHeapBlocksToTail()
+{
+    // Objects can't be moved by this collector, so a block that only holds a few live objects can't be
+    // evacuated. Instead, allocate from the densest blocks first and leave the sparse ones at the end of
+    // the allocable list, so their remaining objects have a chance to die and the block be released.
+    const int configuredPercent = CONFIG_FLAG(RecyclerSparseBlockOccupancyPercent);
+    if (configuredPercent <= 0)
+    {
+        return;
+    }
+
+    // Above 100% every block would count as sparse; cap it there so the products below can't overflow either
+    const uint occupancyPercent = (uint)min(configuredPercent, 100);
+
+    TBlockType * denseHead = nullptr;
+    TBlockType * denseTail = nullptr;
+    TBlockType * sparseHead = nullptr;
+    TBlockType * sparseTail = nullptr;
+
+    HeapBlockList::ForEachEditing(this->heapBlockList, [&](TBlockType * heapBlock)
+    {
+        bool isSparse = (heapBlock->GetMarkedCount() * 100 < heapBlock->GetObjectCount() * occupancyPercent);
+        TBlockType ** head = isSparse ? &sparseHead : &denseHead;
+        TBlockType ** tail = isSparse ? &sparseTail : &denseTail;
+
+        heapBlock->SetNextBlock(nullptr);
+        if (*tail == nullptr)
+        {
+            *head = heapBlock;
+        }
+        else
+        {
+            (*tail)->SetNextBlock(heapBlock);
+        }
+        *tail = heapBlock;
+    });
+
+    if (denseTail == nullptr)
+    {
+        this->heapBlockList = sparseHead;
+        return;
+    }
+
+    denseTail->SetNextBlock(sparseHead);
+    this->heapBlockList = denseHead;
+}
+
 
 #if DBG
 template <typename TBlockType>
@@ -1055,11 +1175,11 @@ HeapBucketT<TBlockType>::AppendAllocableHeapBlockList(TBlockType * list)
 
 template <typename TBlockType>
 void
-HeapBucketT<TBlockType>::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+HeapBucketT<TBlockType>::EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context)
 {
     UpdateAllocators();
-    HeapBucket::EnumerateObjects(fullBlockList, infoBits, CallBackFunction);
-    HeapBucket::EnumerateObjects(heapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(fullBlockList, infoBits, callback, context);
+    HeapBucket::EnumerateObjects(heapBlockList, infoBits, callback, context);
 }
 
 #ifdef RECYCLER_SLOW_CHECK_ENABLED
@@ -1084,6 +1204,10 @@ HeapBucketT<TBlockType>::Check(bool checkCount)
     size_t smallHeapBlockCount = HeapInfo::Check(true, false, this->fullBlockList);
     smallHeapBlockCount += HeapInfo::Check(true, false, this->heapBlockList, this->nextAllocableBlockHead);
     smallHeapBlockCount += HeapInfo::Check(false, false, this->nextAllocableBlockHead);
+#if ENABLE_CONCURRENT_GC
+    // Blocks pending lazy sweep don't have their free objects yet, so just count them
+    smallHeapBlockCount += HeapBlockList::Count(this->lazySweepHeapBlockList);
+#endif
     Assert(!checkCount || this->heapBlockCount == smallHeapBlockCount);
     return smallHeapBlockCount;
 }
@@ -1114,6 +1238,9 @@ HeapBucketT<TBlockType>::AggregateBucketStats(HeapBucketStats& stats)
     HeapBlockList::ForEach(emptyBlockList, blockStatsAggregator);
     HeapBlockList::ForEach(fullBlockList, blockStatsAggregator);
     HeapBlockList::ForEach(heapBlockList, blockStatsAggregator);
+#if ENABLE_CONCURRENT_GC
+    HeapBlockList::ForEach(lazySweepHeapBlockList, blockStatsAggregator);
+#endif
 }
 #endif
 
@@ -1303,15 +1430,15 @@ HeapBucketGroup<TBlockAttributes>::TransferDisposedObjects()
 
 template <class TBlockAttributes>
 void
-HeapBucketGroup<TBlockAttributes>::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+HeapBucketGroup<TBlockAttributes>::EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context)
 {
-    heapBucket.EnumerateObjects(infoBits, CallBackFunction);
-    leafHeapBucket.EnumerateObjects(infoBits, CallBackFunction);
+    heapBucket.EnumerateObjects(infoBits, callback, context);
+    leafHeapBucket.EnumerateObjects(infoBits, callback, context);
 #ifdef RECYCLER_WRITE_BARRIER
-    smallNormalWithBarrierHeapBucket.EnumerateObjects(infoBits, CallBackFunction);
-    smallFinalizableWithBarrierHeapBucket.EnumerateObjects(infoBits, CallBackFunction);
+    smallNormalWithBarrierHeapBucket.EnumerateObjects(infoBits, callback, context);
+    smallFinalizableWithBarrierHeapBucket.EnumerateObjects(infoBits, callback, context);
 #endif
-    finalizableHeapBucket.EnumerateObjects(infoBits, CallBackFunction);
+    finalizableHeapBucket.EnumerateObjects(infoBits, callback, context);
 }
 
 template <class TBlockAttributes>
@@ -1415,6 +1542,29 @@ HeapBucketGroup<TBlockAttributes>::SweepPendingObjects(RecyclerSweep& recyclerSw
     finalizableHeapBucket.SweepPendingObjects(recyclerSweep);
 }
 
+template <class TBlockAttributes>
+void
+HeapBucketGroup<TBlockAttributes>::ParallelSweepPendingObjects(RecyclerSweep& recyclerSweep)
+{
+    Assert(recyclerSweep.GetPendingSweepBlockList(&leafHeapBucket) == nullptr);
+
+    heapBucket.ParallelSweepPendingObjects(recyclerSweep);
+#ifdef RECYCLER_WRITE_BARRIER
+    smallNormalWithBarrierHeapBucket.ParallelSweepPendingObjects(recyclerSweep);
+    smallFinalizableWithBarrierHeapBucket.ParallelSweepPendingObjects(recyclerSweep);
+#endif
+
+    finalizableHeapBucket.ParallelSweepPendingObjects(recyclerSweep);
+}
+
+template <class TBlockAttributes>
+void
+HeapBucketGroup<TBlockAttributes>::FinishLazySweep(Recycler * recycler)
+{
+    // Only the normal bucket queues blocks for lazy sweep
+    heapBucket.FinishLazySweep(recycler);
+}
+
 template <class TBlockAttributes>
 void
 HeapBucketGroup<TBlockAttributes>::TransferPendingEmptyHeapBlocks(RecyclerSweep& recyclerSweep)
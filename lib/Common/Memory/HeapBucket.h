@@ -67,9 +67,10 @@ public:
 
     uint GetBucketIndex() const;
     uint GetMediumBucketIndex() const;
+    uint GetSizeCat() const { return sizeCat; }
 
     template <typename TBlockType>
-    static void EnumerateObjects(TBlockType * heapBlockList, ObjectInfoBits infoBits, void(*CallBackFunction)(void * address, size_t size));
+    static void EnumerateObjects(TBlockType * heapBlockList, ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context);
 
 protected:
     HeapInfo * heapInfo;
@@ -193,6 +194,12 @@ protected:
 
     void StopAllocationBeforeSweep();
     void StartAllocationAfterSweep();
+    void MoveSparseHeapBlocksToTail();
+#if ENABLE_CONCURRENT_GC
+    void SetLazySweepHeapBlockList(TBlockType * list);
+    void FinishLazySweep(Recycler * recycler);
+    TBlockType * LazySweepNextHeapBlock(Recycler * recycler);
+#endif
 #if DBG
     bool IsAllocationStopped() const;
 #endif
@@ -203,7 +210,7 @@ protected:
 #endif
 
     // Partial/Concurrent GC
-    void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context);
 
 #if DBG
     bool AllocatorsAreEmpty() const;
@@ -233,6 +240,9 @@ protected:
 
     TBlockType * fullBlockList;      // list of blocks that are fully allocated
     TBlockType * heapBlockList;      // list of blocks that has free objects
+#if ENABLE_CONCURRENT_GC
+    TBlockType * lazySweepHeapBlockList;    // list of blocks that still need their objects swept, swept when allocation needs them
+#endif
 
     FreeObject* explicitFreeList; // List of objects that have been explicitly freed
     TBlockAllocatorType * lastExplicitFreeListAllocator;
@@ -257,11 +267,11 @@ protected:
 
 template <typename TBlockType>
 void
-HeapBucket::EnumerateObjects(TBlockType * heapBlockList, ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+HeapBucket::EnumerateObjects(TBlockType * heapBlockList, ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context)
 {
     HeapBlockList::ForEach(heapBlockList, [=](TBlockType * heapBlock)
     {
-        heapBlock->EnumerateObjects(infoBits, CallBackFunction);
+        heapBlock->EnumerateObjects(infoBits, callback, context);
     });
 }
 
@@ -281,13 +291,19 @@ HeapBucketT<TBlockType>::SweepBucket(RecyclerSweep& recyclerSweep, Fn sweepFn)
 #endif
     {
 #if ENABLE_CONCURRENT_GC
-        // We should only queue up pending sweep if we are doing partial collect
-        Assert(recyclerSweep.GetPendingSweepBlockList(this) == nullptr);
+        // We should only queue up pending sweep if we are doing partial collect or parallel sweep
+        if (recyclerSweep.GetPendingSweepBlockList(this) != nullptr)
+        {
+            // SweepPendingObjects will start allocation once the pending blocks have been swept
+            Assert(recyclerSweep.IsParallelSweep() || recyclerSweep.IsLazySweep());
+        }
+        else
 #endif
-
-        // Every thing is swept immediately in non partial collect, so we can allocate
-        // from the heap block list now
-        StartAllocationAfterSweep();
+        {
+            // Every thing is swept immediately in non partial collect, so we can allocate
+            // from the heap block list now
+            StartAllocationAfterSweep();
+        }
     }
 
     RECYCLER_SLOW_CHECK(this->VerifyHeapBlockCount(recyclerSweep.IsBackground()));
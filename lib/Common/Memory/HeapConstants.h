@@ -30,7 +30,10 @@ public:
     static const uint BucketCount = (MaxSmallObjectSize >> ObjectAllocationShift);
 
 #ifdef BUCKETIZE_MEDIUM_ALLOCATIONS
-    static const uint MediumObjectGranularity = 256;
+    // 128 byte medium size classes bound the internal fragmentation of the smallest medium objects to
+    // about 14% (769 -> 896 bytes), where 256 byte classes wasted up to 25% (769 -> 1024 bytes).
+    // Changing this requires regenerating the static valid pointers maps in ValidPointersMap/.
+    static const uint MediumObjectGranularity = 128;
     static const uint MediumBucketCount = (MaxMediumObjectSize - MaxSmallObjectSize) / MediumObjectGranularity;
 #endif
 };
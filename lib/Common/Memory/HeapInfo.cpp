@@ -382,6 +382,9 @@ HeapInfo::HeapInfo() :
     , captureFreeCallStack(false)
 #endif
 {
+#if defined(DUMP_FRAGMENTATION_STATS) && defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+    memset(mediumAllocRequestCount, 0, sizeof(mediumAllocRequestCount));
+#endif
 }
 
 HeapInfo::~HeapInfo()
@@ -1044,7 +1047,7 @@ void DumpBucket(uint bucketIndex, typename SmallHeapBlockType<TBucketType, TBloc
 
     bucket.AggregateBucketStats(stats);
 
-    Output::Print(_u("%d,%d,"), bucketIndex, (bucketIndex + 1) << HeapConstants::ObjectAllocationShift);
+    Output::Print(_u("%d,%d,"), bucketIndex, bucket.GetSizeCat());
     Output::Print(_u("%d,%d,%d,%d,%d,%d,%d\n"), stats.totalBlockCount, stats.finalizeBlockCount, stats.emptyBlockCount, stats.objectCount, stats.finalizeCount, stats.objectByteCount, stats.totalByteCount);
 }
 
@@ -1069,6 +1072,29 @@ HeapInfo::DumpFragmentationStats()
         DumpBucket<FinalizeBit, MediumAllocationBlockAttributes>(i, mediumHeapBuckets[i].GetBucket<FinalizeBit>());
         DumpBucket<LeafBit, MediumAllocationBlockAttributes>(i, mediumHeapBuckets[i].GetBucket<LeafBit>());
     }
+
+    // Requested medium sizes, and the bytes lost by rounding them up to their bucket's size
+    Output::Print(_u("[FRAG %d] Medium Allocation Requests\n"), ::GetTickCount());
+    Output::Print(_u("Request Size,SizeCat,Request Count,Wasted Bytes\n"));
+    size_t totalRequestBytes = 0;
+    size_t totalWastedBytes = 0;
+    for (uint i = 0; i < MediumAllocRequestSizeCount; i++)
+    {
+        if (mediumAllocRequestCount[i] == 0)
+        {
+            continue;
+        }
+
+        // Report each 16 byte range by its largest size, and assume every request in it was that size
+        size_t requestSize = HeapConstants::MaxSmallObjectSize + ((i + 1) * HeapConstants::ObjectGranularity);
+        size_t sizeCat = GetMediumObjectAlignedSizeNoCheck(requestSize);
+        size_t wastedBytes = (sizeCat - requestSize) * mediumAllocRequestCount[i];
+        totalRequestBytes += requestSize * mediumAllocRequestCount[i];
+        totalWastedBytes += wastedBytes;
+        Output::Print(_u("%d,%d,%d,%d\n"), requestSize, sizeCat, mediumAllocRequestCount[i], wastedBytes);
+    }
+    Output::Print(_u("Total,,%d,%d (%.1f%%)\n"), totalRequestBytes, totalWastedBytes,
+        totalRequestBytes == 0 ? 0.0 : (100.0 * totalWastedBytes) / (totalRequestBytes + totalWastedBytes));
 #endif
 }
 #endif
@@ -1168,6 +1194,52 @@ HeapInfo::SweepPendingObjects(RecyclerSweep& recyclerSweep)
 
     largeObjectBucket.SweepPendingObjects(recyclerSweep);
 }
+
+void
+HeapInfo::ParallelSweepPendingObjects(RecyclerSweep& recyclerSweep)
+{
+    // Called on each thread taking part in a parallel sweep. Every bucket group is claimed by exactly one thread,
+    // which sweeps the objects of the blocks on its pending sweep lists. The lists themselves are left alone and
+    // are merged back by SweepPendingObjects on the background thread once all threads are done.
+    if (!recyclerSweep.HasPendingSweepSmallHeapBlocks())
+    {
+        return;
+    }
+
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+    const uint bucketCount = HeapConstants::BucketCount + HeapConstants::MediumBucketCount;
+#else
+    const uint bucketCount = HeapConstants::BucketCount;
+#endif
+
+    for (uint i = recyclerSweep.GetNextParallelSweepBucket(); i < bucketCount; i = recyclerSweep.GetNextParallelSweepBucket())
+    {
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+        if (i >= HeapConstants::BucketCount)
+        {
+            mediumHeapBuckets[i - HeapConstants::BucketCount].ParallelSweepPendingObjects(recyclerSweep);
+            continue;
+        }
+#endif
+        heapBuckets[i].ParallelSweepPendingObjects(recyclerSweep);
+    }
+}
+
+void
+HeapInfo::FinishLazySweep()
+{
+    for (uint i = 0; i < HeapConstants::BucketCount; i++)
+    {
+        heapBuckets[i].FinishLazySweep(recycler);
+    }
+
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+    for (uint i = 0; i < HeapConstants::MediumBucketCount; i++)
+    {
+        mediumHeapBuckets[i].FinishLazySweep(recycler);
+    }
+#endif
+}
 #endif
 
 #if ENABLE_CONCURRENT_GC
@@ -1312,40 +1384,40 @@ HeapInfo::TransferDisposedObjects()
     largeObjectBucket.TransferDisposedObjects();
 }
 void
-HeapInfo::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+HeapInfo::EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context)
 {
     for (uint i = 0; i < HeapConstants::BucketCount; i++)
     {
-        heapBuckets[i].EnumerateObjects(infoBits, CallBackFunction);
+        heapBuckets[i].EnumerateObjects(infoBits, callback, context);
     }
 
 #ifdef BUCKETIZE_MEDIUM_ALLOCATIONS
     for (uint i = 0; i < HeapConstants::MediumBucketCount; i++)
     {
-        mediumHeapBuckets[i].EnumerateObjects(infoBits, CallBackFunction);
+        mediumHeapBuckets[i].EnumerateObjects(infoBits, callback, context);
     }
 #endif
 
-    largeObjectBucket.EnumerateObjects(infoBits, CallBackFunction);
+    largeObjectBucket.EnumerateObjects(infoBits, callback, context);
 
 #if ENABLE_CONCURRENT_GC
-    HeapBucket::EnumerateObjects(newLeafHeapBlockList, infoBits, CallBackFunction);
-    HeapBucket::EnumerateObjects(newNormalHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(newLeafHeapBlockList, infoBits, callback, context);
+    HeapBucket::EnumerateObjects(newNormalHeapBlockList, infoBits, callback, context);
 #ifdef RECYCLER_WRITE_BARRIER
-    HeapBucket::EnumerateObjects(newNormalWithBarrierHeapBlockList, infoBits, CallBackFunction);
-    HeapBucket::EnumerateObjects(newFinalizableWithBarrierHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(newNormalWithBarrierHeapBlockList, infoBits, callback, context);
+    HeapBucket::EnumerateObjects(newFinalizableWithBarrierHeapBlockList, infoBits, callback, context);
 #endif
 
-    HeapBucket::EnumerateObjects(newFinalizableHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(newFinalizableHeapBlockList, infoBits, callback, context);
 
-    HeapBucket::EnumerateObjects(newMediumLeafHeapBlockList, infoBits, CallBackFunction);
-    HeapBucket::EnumerateObjects(newMediumNormalHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(newMediumLeafHeapBlockList, infoBits, callback, context);
+    HeapBucket::EnumerateObjects(newMediumNormalHeapBlockList, infoBits, callback, context);
 #ifdef RECYCLER_WRITE_BARRIER
-    HeapBucket::EnumerateObjects(newMediumNormalWithBarrierHeapBlockList, infoBits, CallBackFunction);
-    HeapBucket::EnumerateObjects(newMediumFinalizableWithBarrierHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(newMediumNormalWithBarrierHeapBlockList, infoBits, callback, context);
+    HeapBucket::EnumerateObjects(newMediumFinalizableWithBarrierHeapBlockList, infoBits, callback, context);
 #endif
 
-    HeapBucket::EnumerateObjects(newMediumFinalizableHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(newMediumFinalizableHeapBlockList, infoBits, callback, context);
 #endif
 }
 
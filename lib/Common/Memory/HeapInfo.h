@@ -31,7 +31,7 @@ public:
 #endif
 
     void ResetMarks(ResetMarkFlags flags);
-    void EnumerateObjects(ObjectInfoBits infoBits, void(*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context);
 #ifdef RECYCLER_PAGE_HEAP
     bool IsPageHeapEnabled() const{ return isPageHeapEnabled; }
     static size_t RoundObjectSize(size_t objectSize)
@@ -48,6 +48,13 @@ public:
 
 #ifdef DUMP_FRAGMENTATION_STATS
     void DumpFragmentationStats();
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+    void RecordMediumAllocRequest(size_t size)
+    {
+        Assert(IsMediumObject(size));
+        mediumAllocRequestCount[(size - HeapConstants::MaxSmallObjectSize - 1) / HeapConstants::ObjectGranularity]++;
+    }
+#endif
 #endif
 
     template <ObjectInfoBits attributes, bool nothrow>
@@ -72,6 +79,10 @@ public:
     size_t Rescan(RescanFlags flags);
 #if ENABLE_PARTIAL_GC || ENABLE_CONCURRENT_GC
     void SweepPendingObjects(RecyclerSweep& recyclerSweep);
+#endif
+#if ENABLE_CONCURRENT_GC
+    void ParallelSweepPendingObjects(RecyclerSweep& recyclerSweep);
+    void FinishLazySweep();
 #endif
     void Sweep(RecyclerSweep& recyclerSweep, bool concurrent);
 
@@ -373,6 +384,11 @@ public:
     static typename SmallHeapBlockT<TBlockAttributes>::BlockInfo const * GetBlockInfo(uint objectSize);
 
 private:
+#if defined(DUMP_FRAGMENTATION_STATS) && defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+    // Number of medium allocations requested for each 16 byte size range, to measure how well the medium buckets fit
+    static const uint MediumAllocRequestSizeCount = (HeapConstants::MaxMediumObjectSize - HeapConstants::MaxSmallObjectSize) / HeapConstants::ObjectGranularity;
+    size_t mediumAllocRequestCount[MediumAllocRequestSizeCount];
+#endif
     size_t uncollectedAllocBytes;
     size_t lastUncollectedAllocBytes;
     size_t uncollectedExternalBytes;
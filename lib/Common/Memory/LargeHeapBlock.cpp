@@ -1793,7 +1793,7 @@ LargeHeapBlock::FinishPartialCollect(Recycler * recycler)
 #endif
 
 void
-LargeHeapBlock::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+LargeHeapBlock::EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context)
 {
     for (uint i = 0; i < allocCount; i++)
     {
@@ -1802,9 +1802,10 @@ LargeHeapBlock::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunctio
         {
             continue;
         }
-        if ((header->GetAttributes(this->heapInfo->recycler->Cookie) & infoBits) != 0)
+        ObjectInfoBits attributes = (ObjectInfoBits)header->GetAttributes(this->heapInfo->recycler->Cookie);
+        if ((attributes & infoBits) == infoBits)
         {
-            CallBackFunction(header->GetAddress(), header->objectSize);
+            callback(header->GetAddress(), header->objectSize, attributes, context);
         }
     }
 }
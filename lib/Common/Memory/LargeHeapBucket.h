@@ -62,7 +62,7 @@ public:
     void DisposeObjects();
     void TransferDisposedObjects();
 
-    void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context);
 
     void Verify();
     void VerifyMark();
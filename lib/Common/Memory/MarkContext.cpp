@@ -81,6 +81,20 @@ uint MarkContext::Split(uint targetCount, __in_ecount(targetCount) MarkContext *
     return this->markStack.Split(targetCount, targetStacks);
 }
 
+#if ENABLE_CONCURRENT_GC
+uint MarkContext::DonateMarkObjects(MarkContext * sharedContext, uint chunkCount)
+{
+    Assert(sharedContext != this);
+    return this->markStack.DonateEntries(&sharedContext->markStack, chunkCount);
+}
+
+bool MarkContext::StealMarkObjects(MarkContext * sharedContext)
+{
+    Assert(sharedContext != this);
+    return this->markStack.StealEntries(&sharedContext->markStack);
+}
+#endif
+
 
 void MarkContext::ProcessTracked()
 {
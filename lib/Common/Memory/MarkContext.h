@@ -49,6 +49,14 @@ public:
 
     uint Split(uint targetCount, __in_ecount(targetCount) MarkContext ** targetContexts);
 
+#if ENABLE_CONCURRENT_GC
+    // Work stealing between parallel mark contexts; see Recycler::StealParallelMarkWork
+    template <bool parallel>
+    void DonateMarkObjectsIfRequested();
+    uint DonateMarkObjects(MarkContext * sharedContext, uint chunkCount);
+    bool StealMarkObjects(MarkContext * sharedContext);
+#endif
+
     void Abort();
     void Release();
 
@@ -159,6 +159,20 @@ void MarkContext::MarkTrackedObject(FinalizableObject * trackedObject)
     END_NO_EXCEPTION
 }
 
+#if ENABLE_CONCURRENT_GC
+template <bool parallel>
+inline
+void MarkContext::DonateMarkObjectsIfRequested()
+{
+    // Only parallel marking has other workers to hand work to.
+    // Keep the check cheap: a read of the idle worker count, which is normally zero.
+    if (parallel && recycler->parallelMarkIdleCount != 0 && markStack.HasDonatableChunks())
+    {
+        recycler->DonateParallelMarkWork(this);
+    }
+}
+#endif
+
 template <bool parallel, bool interior>
 inline
 void MarkContext::ProcessMark()
@@ -189,6 +203,11 @@ void MarkContext::ProcessMark()
             ScanObject<parallel, interior>(current.obj, current.byteCount);
 
             current = next;
+
+#if ENABLE_CONCURRENT_GC
+            // Hand surplus work to idle parallel mark workers, if any are waiting for it.
+            DonateMarkObjectsIfRequested<parallel>();
+#endif
         }
 
         // The stack is empty, but we still have a previously retrieved entry; process it now.
@@ -205,6 +224,10 @@ void MarkContext::ProcessMark()
     while (markStack.Pop(&current))
     {
         ScanObject<parallel, interior>(current.obj, current.byteCount);
+
+#if ENABLE_CONCURRENT_GC
+        DonateMarkObjectsIfRequested<parallel>();
+#endif
     }
 #endif
 
@@ -669,6 +669,12 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::~PageAllocatorBase()
     Assert(!this->HasMultiThreadAccess());
 #endif
 
+    // Give the empty segments to other thread contexts instead of releasing them to the OS
+    while (!emptySegments.Empty() && PageSegmentPool::Donate(this, &emptySegments))
+    {
+        this->freePageCount -= maxAllocPageCount;
+    }
+
     SubUsedBytes(usedBytes);
 
     SubCommittedBytes(committedBytes);
@@ -1358,15 +1364,22 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::SnailAllocPages(uint p
 
     Assert(pages == nullptr);
     Assert(maxAllocPageCount >= pageCount);
-    if (maxAllocPageCount != pageCount && (maxFreePageCount < maxAllocPageCount - pageCount + freePageCount))
+
+    // Prefer a segment that the shared pool has already decommitted over reserving a new one.
+    // Only the pages handed out here are recommitted.
+    TPageSegment * decommitSegment = PageSegmentPool::AdoptDecommitSegment(this, &this->decommitSegments);
+    if (decommitSegment == nullptr && maxAllocPageCount != pageCount && (maxFreePageCount < maxAllocPageCount - pageCount + freePageCount))
     {
         // If we exceed the number of max free page count, allocate from a new fully decommit block
-        TPageSegment * decommitSegment = AllocPageSegment(this->decommitSegments, this, false, false);
+        decommitSegment = AllocPageSegment(this->decommitSegments, this, false, false);
         if (decommitSegment == nullptr)
         {
             return nullptr;
         }
+    }
 
+    if (decommitSegment != nullptr)
+    {
         pages = decommitSegment->template DoAllocDecommitPages<notPageAligned>(pageCount);
         if (pages != nullptr)
         {
@@ -1387,9 +1400,14 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::SnailAllocPages(uint p
     // decommitted pages, or from the empty segment list, so we'll
     // try allocating a segment. In a page allocator with a pre-reserved segment,
     // we're not allowed to allocate additional segments so return here.
-    // Otherwise, add a new segment and allocate from it
+    // Otherwise, add a new segment and allocate from it, preferring a committed empty segment
+    // given up by another thread context over reserving and committing a new one.
 
-    newSegment = AddPageSegment(emptySegments);
+    newSegment = PageSegmentPool::AdoptEmptySegment(this, &emptySegments);
+    if (newSegment == nullptr)
+    {
+        newSegment = AddPageSegment(emptySegments);
+    }
     if (newSegment == nullptr)
     {
         return nullptr;
@@ -1541,8 +1559,11 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::ReleasePages(__in void
         if (!ZeroPages() && !emptySegments.Empty())
         {
             Assert(emptySegments.Head().GetDecommitPageCount() == 0);
-            LogFreeSegment(&emptySegments.Head());
-            emptySegments.RemoveHead(&NoThrowNoMemProtectHeapAllocator::Instance);
+            if (!PageSegmentPool::Donate(this, &emptySegments))
+            {
+                LogFreeSegment(&emptySegments.Head());
+                emptySegments.RemoveHead(&NoThrowNoMemProtectHeapAllocator::Instance);
+            }
             this->freePageCount -= maxAllocPageCount;
 
 #if DBG
@@ -1995,8 +2016,11 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::DecommitNow(bool all)
         if (pageToDecommit >= maxAllocPageCount)
         {
             Assert(emptySegments.Head().GetDecommitPageCount() == 0);
-            LogFreeSegment(&emptySegments.Head());
-            emptySegments.RemoveHead(&NoThrowNoMemProtectHeapAllocator::Instance);
+            if (!PageSegmentPool::Donate(this, &emptySegments))
+            {
+                LogFreeSegment(&emptySegments.Head());
+                emptySegments.RemoveHead(&NoThrowNoMemProtectHeapAllocator::Instance);
+            }
 
             pageToDecommit -= maxAllocPageCount;
 #if DBG_DUMP
@@ -2851,6 +2875,188 @@ uint PageSegmentBase<T>::GetMaxPageCount()
     return MaxPageCount;
 }
 
+//=============================================================================================================
+// PageSegmentPool
+//=============================================================================================================
+
+CriticalSection PageSegmentPool::cs;
+PageAllocator * PageSegmentPool::holder = nullptr;
+
+bool
+PageSegmentPool::IsCompatible(PageAllocator * pageAllocator)
+{
+    Assert(cs.IsLocked());
+    Assert(holder != nullptr);
+
+    // Segments can only move between page allocators that would have created an identical segment
+    return pageAllocator->type == holder->type
+        && pageAllocator->maxAllocPageCount == holder->maxAllocPageCount
+        && pageAllocator->allocFlags == holder->allocFlags
+        && pageAllocator->zeroPages == holder->zeroPages
+        && pageAllocator->secondaryAllocPageCount == 0;
+}
+
+bool
+PageSegmentPool::Donate(PageAllocator * pageAllocator, DListBase<PageSegment> * segmentList)
+{
+    Assert(!segmentList->Empty());
+
+    const uint maxSegmentCount = (uint)CONFIG_FLAG(PageSegmentPoolMaxSegmentCount);
+    if (maxSegmentCount == 0 || pageAllocator->type != PageAllocatorType_Recycler
+#if defined(RECYCLER_NO_PAGE_REUSE) || defined(ARENA_MEMORY_VERIFY)
+        || pageAllocator->disablePageReuse
+#endif
+        )
+    {
+        return false;
+    }
+
+    AutoCriticalSection autoCS(&cs);
+    if (pageAllocator == holder)
+    {
+        // The holder is being released
+        return false;
+    }
+
+    if (holder == nullptr)
+    {
+        // The first donor decides the configuration of the segments kept in the pool
+        holder = HeapNewNoThrow(PageAllocator, nullptr, Js::Configuration::Global.flags, pageAllocator->type,
+            0, pageAllocator->zeroPages,
+#if ENABLE_BACKGROUND_PAGE_FREEING
+            nullptr,
+#endif
+            pageAllocator->maxAllocPageCount);
+        if (holder == nullptr)
+        {
+            return false;
+        }
+        holder->allocFlags = pageAllocator->allocFlags;
+    }
+
+    if (!IsCompatible(pageAllocator))
+    {
+        return false;
+    }
+
+    if ((uint)(holder->emptySegments.Count() + holder->decommitSegments.Count()) >= maxSegmentCount)
+    {
+        // A committed segment is worth more to the adopter than an old reservation
+        if (holder->decommitSegments.Empty())
+        {
+            return false;
+        }
+        PageSegment * oldestSegment = &holder->decommitSegments.Tail();
+        holder->LogFreeDecommittedSegment(oldestSegment);
+        holder->decommitSegments.RemoveElement(&NoThrowNoMemProtectHeapAllocator::Instance, oldestSegment);
+    }
+
+    PageSegment * segment = &segmentList->Head();
+    Assert(segment->IsEmpty());
+    Assert(segment->GetDecommitPageCount() == 0);
+
+    pageAllocator->LogFreeSegment(segment);
+    pageAllocator->ReportFree(segment->GetPageCount() * AutoSystemInfo::PageSize);
+
+    segment->SetAllocator(holder);
+    segmentList->MoveHeadTo(&holder->emptySegments);
+    holder->LogAllocSegment(segment);
+
+    Trim();
+    return true;
+}
+
+void
+PageSegmentPool::Trim()
+{
+    Assert(cs.IsLocked());
+
+    // Keep the most recently donated segments committed. Older ones only keep their reservation,
+    // so the pool never holds on to more than -PageSegmentPoolMaxCommittedKB of memory.
+    const size_t maxCommittedBytes = (size_t)(uint)CONFIG_FLAG(PageSegmentPoolMaxCommittedKB) * 1024;
+    const size_t segmentBytes = holder->maxAllocPageCount * AutoSystemInfo::PageSize;
+    while (!holder->emptySegments.Empty() && holder->emptySegments.Count() * segmentBytes > maxCommittedBytes)
+    {
+        PageSegment * segment = &holder->emptySegments.Tail();
+        size_t decommitPageCount = segment->DecommitFreePages(holder->maxAllocPageCount);
+        holder->LogDecommitPages(decommitPageCount);
+        holder->emptySegments.MoveElementTo(segment, &holder->decommitSegments);
+    }
+}
+
+bool
+PageSegmentPool::CanAdopt(PageAllocator * pageAllocator, PageSegment * segment)
+{
+    Assert(cs.IsLocked());
+    return IsCompatible(pageAllocator) && pageAllocator->RequestAlloc(segment->GetPageCount() * AutoSystemInfo::PageSize);
+}
+
+PageSegment *
+PageSegmentPool::AdoptEmptySegment(PageAllocator * pageAllocator, DListBase<PageSegment> * segmentList)
+{
+    if (pageAllocator->type != PageAllocatorType_Recycler)
+    {
+        return nullptr;
+    }
+
+    AutoCriticalSection autoCS(&cs);
+    if (holder == nullptr || holder->emptySegments.Empty() || !CanAdopt(pageAllocator, &holder->emptySegments.Head()))
+    {
+        return nullptr;
+    }
+
+    // The segment is still committed, so it is taken over just like one of the adopter's own
+    // empty segments without committing or zeroing any page again
+    PageSegment * segment = &holder->emptySegments.Head();
+    Assert(segment->IsEmpty());
+    holder->LogFreeSegment(segment);
+    segment->SetAllocator(pageAllocator);
+    holder->emptySegments.MoveHeadTo(segmentList);
+
+    pageAllocator->LogAllocSegment(segment);
+    pageAllocator->AddFreePageCount(pageAllocator->maxAllocPageCount);
+    return segment;
+}
+
+PageSegment *
+PageSegmentPool::AdoptDecommitSegment(PageAllocator * pageAllocator, DListBase<PageSegment> * segmentList)
+{
+    if (pageAllocator->type != PageAllocatorType_Recycler)
+    {
+        return nullptr;
+    }
+
+    AutoCriticalSection autoCS(&cs);
+    if (holder == nullptr || holder->decommitSegments.Empty() || !CanAdopt(pageAllocator, &holder->decommitSegments.Head()))
+    {
+        return nullptr;
+    }
+
+    PageSegment * segment = &holder->decommitSegments.Head();
+    Assert(segment->GetDecommitPageCount() == pageAllocator->maxAllocPageCount);
+
+    size_t decommitPageCount = segment->GetDecommitPageCount();
+    holder->LogFreePartiallyDecommittedPageSegment(segment);
+    segment->SetAllocator(pageAllocator);
+    holder->decommitSegments.MoveHeadTo(segmentList);
+
+    pageAllocator->LogAllocSegment(segment);
+    pageAllocator->LogDecommitPages(decommitPageCount);
+    return segment;
+}
+
+void
+PageSegmentPool::ReleaseAll()
+{
+    AutoCriticalSection autoCS(&cs);
+    if (holder != nullptr)
+    {
+        // Keep the holder set while it is deleted so it doesn't try to donate its own segments
+        HeapDelete(holder);
+        holder = nullptr;
+    }
+}
+
 namespace Memory
 {
     //Instantiate all the Templates in this class below.
@@ -126,8 +126,13 @@ public:
     SegmentBaseCommon(PageAllocatorBaseCommon* allocator);
     virtual ~SegmentBaseCommon() {}
     bool IsInPreReservedHeapPageAllocator() const;
+
+    // Used by PageSegmentPool to hand an empty segment over to another page allocator
+    void SetAllocator(PageAllocatorBaseCommon* allocator) { this->allocator = allocator; }
 };
 
+class PageSegmentPool;
+
 /*
  * A segment is a collection of pages. A page corresponds to the concept of an
  * OS memory page. Segments allocate memory using the OS VirtualAlloc call.
@@ -491,6 +496,8 @@ class PageAllocatorBase: public PageAllocatorBaseCommon
     // Allowing recycler to report external memory allocation.
     friend class Recycler;
 public:
+    typedef TPageSegment PageSegmentType;
+
     static uint const DefaultMaxFreePageCount = 0x400;       // 4 MB
     static uint const DefaultLowMaxFreePageCount = 0x100;    // 1 MB for low-memory process
 
@@ -752,6 +759,7 @@ protected:
     friend TSegment;
     friend TPageSegment;
     friend class IdleDecommit;
+    friend class PageSegmentPool;
 
 protected:
     virtual bool CreateSecondaryAllocator(TSegment* segment, bool committed, SecondaryAllocator** allocator)
@@ -909,4 +917,42 @@ private:
 
 };
 
+/*
+ * Process wide cache of empty page segments shared between page allocators of different
+ * thread contexts. Instead of releasing an empty segment to the OS when it has more free
+ * pages than it wants to keep, a page allocator donates the segment to the pool, and another
+ * page allocator with the same configuration adopts it instead of reserving and committing
+ * a new one. Donated segments stay committed, so the adopter doesn't pay for the commit or
+ * for zeroing the pages. Once the pool holds more than -PageSegmentPoolMaxCommittedKB, its
+ * oldest segments are decommitted and only their reservation is kept, up to
+ * -PageSegmentPoolMaxSegmentCount segments in all. Each page allocator's own free page list
+ * remains its thread local cache; the pool only sees whole segments.
+ */
+class PageSegmentPool
+{
+public:
+    template <typename TPageAllocator>
+    static bool Donate(TPageAllocator * pageAllocator, DListBase<typename TPageAllocator::PageSegmentType> * segmentList) { return false; }
+    static bool Donate(PageAllocator * pageAllocator, DListBase<PageSegment> * segmentList);
+
+    template <typename TPageAllocator>
+    static typename TPageAllocator::PageSegmentType * AdoptEmptySegment(TPageAllocator * pageAllocator, DListBase<typename TPageAllocator::PageSegmentType> * segmentList) { return nullptr; }
+    static PageSegment * AdoptEmptySegment(PageAllocator * pageAllocator, DListBase<PageSegment> * segmentList);
+
+    template <typename TPageAllocator>
+    static typename TPageAllocator::PageSegmentType * AdoptDecommitSegment(TPageAllocator * pageAllocator, DListBase<typename TPageAllocator::PageSegmentType> * segmentList) { return nullptr; }
+    static PageSegment * AdoptDecommitSegment(PageAllocator * pageAllocator, DListBase<PageSegment> * segmentList);
+
+    static void ReleaseAll();
+
+private:
+    static bool IsCompatible(PageAllocator * pageAllocator);
+    static bool CanAdopt(PageAllocator * pageAllocator, PageSegment * segment);
+    static void Trim();
+
+    static CriticalSection cs;
+
+    // Holds the pooled segments while they don't belong to any thread context
+    static PageAllocator * holder;
+};
 }
@@ -139,6 +139,14 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     parallelMarkContext1(this, &this->parallelMarkPagePool1),
     parallelMarkContext2(this, &this->parallelMarkPagePool2),
     parallelMarkContext3(this, &this->parallelMarkPagePool3),
+#if ENABLE_CONCURRENT_GC
+    parallelMarkSharedPagePool(configFlagsTable),
+    parallelMarkSharedContext(this, &this->parallelMarkSharedPagePool),
+    parallelMarkWorkEvent(nullptr),
+    parallelMarkIdleCount(0),
+    parallelMarkBusyCount(0),
+    enableParallelMarkWorkStealing(false),
+#endif
 #if ENABLE_PARTIAL_GC
     clientTrackedObjectAllocator(_u("CTO-List"), GetPageAllocator(), Js::Throw::OutOfMemory),
 #endif
@@ -163,6 +171,7 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     enableConcurrentMark(false),  // Default to non-concurrent
     enableParallelMark(false),
     enableConcurrentSweep(false),
+    enableParallelSweep(false),
     concurrentThread(NULL),
     concurrentWorkReadyEvent(NULL),
     concurrentWorkDoneEvent(NULL),
@@ -219,6 +228,18 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     inCacheCleanupCollection(false),
     hasPendingDeleteGuestArena(false),
     needOOMRescan(false),
+    pauseTargetTime(0),
+    pauseTargetMissCount(0),
+    phaseCollectionCount(0),
+    phaseMarkTicks(0),
+    phaseSweepTicks(0),
+    phaseBackgroundMarkTicks(0),
+    phaseBackgroundSweepTicks(0),
+    allocationSampleInterval(0),
+    allocationSampleBytesLeft(0),
+    allocationSampleCallback(nullptr),
+    allocationSampleCallbackState(nullptr),
+    inAllocationSample(false),
 #if ENABLE_CONCURRENT_GC && ENABLE_PARTIAL_GC
     hasBackgroundFinishPartial(false),
 #endif
@@ -255,6 +276,10 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #endif
     , objectBeforeCollectCallbackMap(nullptr)
     , objectBeforeCollectCallbackState(ObjectBeforeCollectCallback_None)
+    , objectCollectTokenMap(nullptr)
+    , collectedObjectTokens(nullptr)
+    , collectedObjectTokenCount(0)
+    , collectedObjectTokenCapacity(0)
 {
 #ifdef RECYCLER_MARK_TRACK
     this->markMap = NoCheckHeapNew(MarkMap, &NoCheckHeapAllocator::Instance, 163, &markMapCriticalSection);
@@ -262,6 +287,9 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     parallelMarkContext1.SetMarkMap(markMap);
     parallelMarkContext2.SetMarkMap(markMap);
     parallelMarkContext3.SetMarkMap(markMap);
+#if ENABLE_CONCURRENT_GC
+    parallelMarkSharedContext.SetMarkMap(markMap);
+#endif
 #endif
 
 #ifdef RECYCLER_MEMORY_VERIFY
@@ -467,6 +495,7 @@ Recycler::~Recycler()
 #endif
 
     ClearObjectBeforeCollectCallbacks();
+    ClearObjectCollectTokens();
 
 #ifdef RECYCLER_DUMP_OBJECT_GRAPH
     if (GetRecyclerFlagsTable().DumpObjectGraphOnExit)
@@ -517,6 +546,9 @@ Recycler::~Recycler()
     parallelMarkContext1.Release();
     parallelMarkContext2.Release();
     parallelMarkContext3.Release();
+#if ENABLE_CONCURRENT_GC
+    parallelMarkSharedContext.Release();
+#endif
 
     // Clean up the weak reference map so that
     // objects being finalized can safely refer to weak references
@@ -831,7 +863,8 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 #if ENABLE_CONCURRENT_GC
     // Default to non-concurrent
     uint numProcs = (uint)AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
-    this->maxParallelism = (numProcs > 4) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? 4 : numProcs;
+    uint parallelismLimit = (uint)max(1, min((int)Recycler::MaxParallelism, GetRecyclerFlagsTable().RecyclerParallelism));
+    this->maxParallelism = (numProcs > parallelismLimit) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? parallelismLimit : numProcs;
 
     if (forceInThread)
     {
@@ -1869,6 +1902,11 @@ Recycler::ResetMarks(ResetMarkFlags flags)
     this->scanPinnedObjectMap = true;
     this->hasScannedInitialImplicitRoots = false;
 
+#if ENABLE_CONCURRENT_GC
+    // Blocks still pending lazy sweep need the marks from the last collection
+    this->FinishLazySweep();
+#endif
+
     heapBlockMap.ResetMarks();
 
     autoHeap.ResetMarks(flags);
@@ -2037,14 +2075,24 @@ Recycler::ProcessParallelMark(bool background, MarkContext * markContext)
 
     RECYCLER_PROFILE_EXEC_THREAD_BEGIN(background, this, Js::MarkPhase);
 
-    if (this->enableScanInteriorPointers)
-    {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
-    }
-    else
+#if ENABLE_CONCURRENT_GC
+    // Process our own mark stack, then keep stealing work from the other parallel workers until everyone is done.
+    this->StartParallelMarkWork();
+    do
+#endif
     {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        if (this->enableScanInteriorPointers)
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
+        }
+        else
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        }
     }
+#if ENABLE_CONCURRENT_GC
+    while (this->StealParallelMarkWork(markContext));
+#endif
 
     RECYCLER_PROFILE_EXEC_THREAD_END(background, this, Js::MarkPhase);
 
@@ -2058,13 +2106,96 @@ Recycler::ProcessParallelMark(bool background, MarkContext * markContext)
     }
 }
 
+#if ENABLE_CONCURRENT_GC
+void
+Recycler::StartParallelMarkWork()
+{
+    if (!this->enableParallelMarkWorkStealing)
+    {
+        return;
+    }
+
+    AutoCriticalSection autoCs(&this->parallelMarkWorkCriticalSection);
+    this->parallelMarkBusyCount++;
+}
+
+bool
+Recycler::StealParallelMarkWork(MarkContext * markContext)
+{
+    // Called by a parallel mark worker whose mark stack just ran dry.
+    // Wait for another worker to donate some of its work, and return true if we got some.
+    // Return false once no worker is busy and there is no donated work left, at which point marking is done.
+    // Workers that haven't started yet are not counted as busy; they will process their own mark stacks when they start.
+    if (!this->enableParallelMarkWorkStealing)
+    {
+        return false;
+    }
+
+    Assert(!markContext->HasPendingMarkObjects());
+
+    {
+        AutoCriticalSection autoCs(&this->parallelMarkWorkCriticalSection);
+        Assert(this->parallelMarkBusyCount > 0);
+        this->parallelMarkBusyCount--;
+        this->parallelMarkIdleCount++;
+    }
+
+    while (true)
+    {
+        {
+            AutoCriticalSection autoCs(&this->parallelMarkWorkCriticalSection);
+            if (markContext->StealMarkObjects(&this->parallelMarkSharedContext))
+            {
+                this->parallelMarkIdleCount--;
+                this->parallelMarkBusyCount++;
+                return true;
+            }
+
+            if (this->parallelMarkBusyCount == 0)
+            {
+                // Marking is done; wake up the other idle workers so they see it too
+                Assert(!this->parallelMarkSharedContext.HasPendingMarkObjects());
+                this->parallelMarkIdleCount--;
+                SetEvent(this->parallelMarkWorkEvent);
+                return false;
+            }
+
+            // The event is only set and reset under the lock, so a donation made after this can't be missed
+            ResetEvent(this->parallelMarkWorkEvent);
+        }
+
+        DWORD ret = WaitForSingleObject(this->parallelMarkWorkEvent, INFINITE);
+        Assert(ret == WAIT_OBJECT_0);
+    }
+}
+
+void
+Recycler::DonateParallelMarkWork(MarkContext * markContext)
+{
+    AutoCriticalSection autoCs(&this->parallelMarkWorkCriticalSection);
+
+    // Don't pile up more work than the idle workers can pick up
+    if (this->parallelMarkIdleCount != 0 && !this->parallelMarkSharedContext.HasPendingMarkObjects())
+    {
+        if (markContext->DonateMarkObjects(&this->parallelMarkSharedContext, this->parallelMarkIdleCount) != 0)
+        {
+            SetEvent(this->parallelMarkWorkEvent);
+        }
+    }
+}
+#endif
+
 void
 Recycler::Mark()
 {
+    const uint64 markStart = GetPhaseTimestamp();
+
     // Marking in thread, we can just pre-mark them
     ResetMarks(this->enableScanImplicitRoots ? ResetMarkFlags_InThreadImplicitRoots : ResetMarkFlags_InThread);
     collectionState = CollectionStateFindRoots;
     RootMark(CollectionStateMark);
+
+    this->phaseMarkTicks += GetPhaseTimestamp() - markStart;
 }
 
 #if ENABLE_CONCURRENT_GC
@@ -2140,6 +2271,11 @@ Recycler::ResetMarkCollectionState()
     // Note parallelMarkContext1 is not used in background parallel (see DoBackgroundParallelMark)
     parallelMarkContext2.Cleanup();
     parallelMarkContext3.Cleanup();
+#if ENABLE_CONCURRENT_GC
+    parallelMarkSharedContext.Cleanup();
+    this->parallelMarkIdleCount = 0;
+    this->parallelMarkBusyCount = 0;
+#endif
 
     this->ClearNeedOOMRescan();
     DebugOnly(this->isProcessingRescan = false);
@@ -2218,7 +2354,7 @@ Recycler::RescanMark(DWORD waitTime)
         // Only do background finish mark if we have a time limit or it is forced
         (CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::BackgroundFinishMarkPhase) || waitTime != INFINITE) &&
         // Don't do background finish mark if we failed to finish mark too many times
-        (this->backgroundFinishMarkCount < RecyclerHeuristic::MaxBackgroundFinishMarkCount(this->GetRecyclerFlagsTable())))
+        (this->backgroundFinishMarkCount < RecyclerHeuristic::MaxBackgroundFinishMarkCount(this->pauseTargetTime != 0, this->GetRecyclerFlagsTable())))
     {
         this->PrepareBackgroundFindRoots();
         if (StartConcurrent(CollectionStateConcurrentFinishMark))
@@ -2258,6 +2394,7 @@ Recycler::RescanMark(DWORD waitTime)
 size_t
 Recycler::FinishMark(DWORD waitTime)
 {
+    const uint64 markStart = GetPhaseTimestamp();
     size_t scannedRootBytes = RescanMark(waitTime);
     Assert(waitTime != INFINITE || scannedRootBytes != Recycler::InvalidScanRootBytes);
     if (scannedRootBytes != Recycler::InvalidScanRootBytes)
@@ -2289,6 +2426,7 @@ Recycler::FinishMark(DWORD waitTime)
         // Continue to mark from root one more time
         scannedRootBytes += RootMark(CollectionStateRescanMark);
     }
+    this->phaseMarkTicks += GetPhaseTimestamp() - markStart;
     return scannedRootBytes;
 }
 
@@ -2297,11 +2435,12 @@ void
 Recycler::DoParallelMark()
 {
     Assert(this->enableParallelMark);
-    Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+    Assert(this->maxParallelism > 1 && this->maxParallelism <= Recycler::MaxParallelism);
 
     // Split the mark stack into [this->maxParallelism] equal pieces.
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
     MarkContext * splitContexts[3] = { &parallelMarkContext1, &parallelMarkContext2, &parallelMarkContext3 };
+    CompileAssert(_countof(splitContexts) == Recycler::MaxParallelism - 1);
     uint actualSplitCount = markContext.Split(this->maxParallelism - 1, splitContexts);
 
     Assert(actualSplitCount <= 3);
@@ -2406,7 +2545,7 @@ Recycler::DoBackgroundParallelMark()
     MarkContext * splitContexts[2] = { &parallelMarkContext2, &parallelMarkContext3 };
     if (this->enableParallelMark)
     {
-        Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+        Assert(this->maxParallelism > 1 && this->maxParallelism <= Recycler::MaxParallelism);
         if (this->maxParallelism > 2)
         {
             actualSplitCount = markContext.Split(this->maxParallelism - 2, splitContexts);
@@ -2579,6 +2718,9 @@ Recycler::EndMark()
         oomRescan |= EndMarkCheckOOMRescan();
     }
 
+    // After the callbacks, which may have revived objects
+    ProcessObjectCollectTokens();
+
     // GC-CONSIDER: Consider keeping some page around
     GCETW(GC_DECOMMIT_CONCURRENT_COLLECT_PAGE_ALLOCATOR_START, (this));
 
@@ -2588,12 +2730,18 @@ Recycler::EndMark()
     parallelMarkContext1.Cleanup();
     parallelMarkContext2.Cleanup();
     parallelMarkContext3.Cleanup();
+#if ENABLE_CONCURRENT_GC
+    parallelMarkSharedContext.Cleanup();
+#endif
 
     // Decommit all pages
     markContext.DecommitPages();
     parallelMarkContext1.DecommitPages();
     parallelMarkContext2.DecommitPages();
     parallelMarkContext3.DecommitPages();
+#if ENABLE_CONCURRENT_GC
+    parallelMarkSharedContext.DecommitPages();
+#endif
 
     GCETW(GC_DECOMMIT_CONCURRENT_COLLECT_PAGE_ALLOCATOR_STOP, (this));
 
@@ -2807,12 +2955,16 @@ Recycler::Sweep(bool concurrent)
     }
 
     RECYCLER_PROFILE_EXEC_BEGIN(this, concurrent? Js::ConcurrentSweepPhase : Js::SweepPhase);
+    const uint64 sweepStart = GetPhaseTimestamp();
 
 #if ENABLE_PARTIAL_GC
     recyclerSweepInstance.BeginSweep(this, rescanRootBytes, adjustPartialHeuristics);
 #else
     recyclerSweepInstance.BeginSweep(this);
 #endif
+#if ENABLE_CONCURRENT_GC
+    recyclerSweepInstance.SetLazySweep(!concurrent && this->DoLazySweep());
+#endif
 
     this->SweepHeap(concurrent, *recyclerSweep);
 #if ENABLE_CONCURRENT_GC
@@ -2848,6 +3000,7 @@ Recycler::Sweep(bool concurrent)
         recyclerSweep->EndSweep();
     }
 
+    this->phaseSweepTicks += GetPhaseTimestamp() - sweepStart;
     RECYCLER_PROFILE_EXEC_END(this, concurrent? Js::ConcurrentSweepPhase : Js::SweepPhase);
 
     this->collectionState = CollectionStatePostSweepRedeferralCallback;
@@ -3241,6 +3394,7 @@ template BOOL Recycler::CollectNow<CollectNowForceInThreadExternalNoStack>();
 template BOOL Recycler::CollectNow<CollectOnRecoverFromOutOfMemory>();
 template BOOL Recycler::CollectNow<CollectNowDefault>();
 template BOOL Recycler::CollectNow<CollectOnSuspendCleanup>();
+template BOOL Recycler::CollectNow<CollectOnMemoryPressure>();
 template BOOL Recycler::CollectNow<CollectNowDefaultLSCleanup>();
 
 #if defined(CHECK_MEMORY_LEAK) || defined(LEAK_REPORT)
@@ -3511,7 +3665,9 @@ Recycler::DoCollectWrapped(CollectionFlags flags)
 #endif
 
     this->allowDispose = (flags & CollectOverride_AllowDispose) == CollectOverride_AllowDispose;
+    const uint pauseStartTickCount = ::GetTickCount();
     BOOL collected = collectionWrapper->ExecuteRecyclerCollectionFunction(this, &Recycler::DoCollect, flags);
+    this->RecordPause(pauseStartTickCount);
 
 #if ENABLE_CONCURRENT_GC
     Assert(IsConcurrentExecutingState() || IsConcurrentFinishedState() || !CollectionInProgress());
@@ -3621,6 +3777,7 @@ Recycler::DoCollect(CollectionFlags flags)
 #if DBG
         collectionCount++;
 #endif
+        this->phaseCollectionCount++;
         collectionState = Collection_PreCollection;
         collectionWrapper->PreCollectionCallBack(flags);
         collectionState = CollectionStateNotCollecting;
@@ -3915,6 +4072,16 @@ Recycler::EnsureNotCollecting()
 }
 
 void Recycler::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+{
+    EnumerateObjects(infoBits, [](void * address, size_t size, ObjectInfoBits attributes, void * context)
+    {
+        (*(void (**)(void *, size_t))context)(address, size);
+    }, &CallBackFunction);
+}
+
+// Enumerate the allocated objects that have all of the given infoBits set (all objects for NoBit).
+// Enumeration doesn't allocate, and the callback must not allocate from or collect this recycler.
+void Recycler::EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context)
 {
     // Make sure we are not collecting
     EnsureNotCollecting();
@@ -3929,7 +4096,12 @@ void Recycler::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction
     }
 #endif
 
-    autoHeap.EnumerateObjects(infoBits, CallBackFunction);
+#if ENABLE_CONCURRENT_GC
+    // Objects in blocks pending lazy sweep may be dead; sweep them so they aren't enumerated
+    this->FinishLazySweep();
+#endif
+
+    autoHeap.EnumerateObjects(infoBits, callback, context);
     // GC-TODO: Explicit heap?
 }
 
@@ -3957,7 +4129,7 @@ Recycler::IsReentrantState() const
 }
 #endif
 
-#if defined(ENABLE_JS_ETW) && defined(NTBUILD)
+#if (defined(ENABLE_JS_ETW) && defined(NTBUILD)) || defined(ENABLE_GC_USDT)
 template <Js::Phase phase> static ETWEventGCActivationKind GetETWEventGCActivationKind();
 template <> ETWEventGCActivationKind GetETWEventGCActivationKind<Js::GarbageCollectPhase>() { return ETWEvent_GarbageCollect; }
 template <> ETWEventGCActivationKind GetETWEventGCActivationKind<Js::ThreadCollectPhase>() { return ETWEvent_ThreadCollect; }
@@ -3971,6 +4143,9 @@ Recycler::CollectionBegin()
 {
     RECYCLER_PROFILE_EXEC_BEGIN2(this, Js::RecyclerPhase, phase);
     GCETW_INTERNAL(GC_START, (this, GetETWEventGCActivationKind<phase>()));
+
+    // The probes carry the heap's used bytes, so that a tracer can take the bytes freed from the difference
+    GCUSDT(GC_START, (this, GetETWEventGCActivationKind<phase>(), this->GetUsedBytes()));
 }
 
 template <Js::Phase phase>
@@ -3978,6 +4153,7 @@ void
 Recycler::CollectionEnd()
 {
     GCETW_INTERNAL(GC_STOP, (this, GetETWEventGCActivationKind<phase>()));
+    GCUSDT(GC_STOP, (this, GetETWEventGCActivationKind<phase>(), this->GetUsedBytes()));
     RECYCLER_PROFILE_EXEC_END2(this, phase, Js::RecyclerPhase);
 }
 
@@ -4396,6 +4572,13 @@ Recycler::InitializeConcurrent(JsUtil::ThreadService *threadService)
             throw Js::OutOfMemoryException();
         }
 
+        // Manual reset, so that finishing the mark can wake every idle parallel mark worker at once
+        parallelMarkWorkEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+        if (parallelMarkWorkEvent == nullptr)
+        {
+            throw Js::OutOfMemoryException();
+        }
+
 #if DBG_DUMP
         markContext.GetPageAllocator()->debugName = _u("ConcurrentCollect");
 #endif
@@ -4424,6 +4607,11 @@ Recycler::InitializeConcurrent(JsUtil::ThreadService *threadService)
             CloseHandle(concurrentWorkDoneEvent);
             concurrentWorkDoneEvent = nullptr;
         }
+        if (parallelMarkWorkEvent)
+        {
+            CloseHandle(parallelMarkWorkEvent);
+            parallelMarkWorkEvent = nullptr;
+        }
 #ifdef IDLE_DECOMMIT_ENABLED
         if (concurrentIdleDecommitEvent)
         {
@@ -4598,6 +4786,9 @@ Recycler::FinalizeConcurrent(bool restoreState)
     CloseHandle(concurrentWorkDoneEvent);
     concurrentWorkDoneEvent = nullptr;
 
+    CloseHandle(parallelMarkWorkEvent);
+    parallelMarkWorkEvent = nullptr;
+
     if (concurrentWorkReadyEvent != NULL)
     {
         CloseHandle(concurrentWorkReadyEvent);
@@ -4611,6 +4802,7 @@ Recycler::FinalizeConcurrent(bool restoreState)
         this->enableConcurrentMark = false;
         this->enableParallelMark = false;
         this->enableConcurrentSweep = false;
+        this->enableParallelSweep = false;
     }
 
     this->threadService = nullptr;
@@ -4633,11 +4825,15 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
 #if ENABLE_DEBUG_CONFIG_OPTIONS
     this->enableConcurrentMark = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ConcurrentMarkPhase);
     this->enableParallelMark = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase);
+    this->enableParallelMarkWorkStealing = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelMarkWorkStealingPhase);
     this->enableConcurrentSweep = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ConcurrentSweepPhase);
+    this->enableParallelSweep = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelSweepPhase);
 #else
     this->enableConcurrentMark = true;
     this->enableParallelMark = true;
+    this->enableParallelMarkWorkStealing = true;
     this->enableConcurrentSweep = true;
+    this->enableParallelSweep = true;
 #endif
 
     if (this->enableParallelMark && this->maxParallelism == 1)
@@ -4646,6 +4842,9 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
         this->enableParallelMark = false;
     }
 
+    // Parallel sweep runs on the parallel mark threads, alongside the concurrent thread
+    this->enableParallelSweep = this->enableParallelSweep && this->enableConcurrentSweep && this->enableParallelMark;
+
     if (threadService->HasCallback())
     {
         this->threadService = threadService;
@@ -4716,6 +4915,7 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
     this->enableConcurrentMark = false;
     this->enableParallelMark = false;
     this->enableConcurrentSweep = false;
+    this->enableParallelSweep = false;
 
     if (concurrentWorkReadyEvent)
     {
@@ -4821,6 +5021,9 @@ Recycler::StartBackgroundMark(bool foregroundResetMark, bool foregroundFindRoots
 {
     Assert(!this->CollectionInProgress());
 
+    // The marks may get reset on the concurrent thread, so finish any lazy sweep while we still own the heap
+    this->FinishLazySweep();
+
     CollectionState backgroundState = CollectionStateConcurrentResetMarks;
 
     bool doBackgroundFindRoots = true;
@@ -5177,9 +5380,123 @@ Recycler::BackgroundFinishMark()
 void
 Recycler::SweepPendingObjects(RecyclerSweep& recyclerSweep)
 {
+    if (recyclerSweep.IsParallelSweep())
+    {
+        this->DoBackgroundParallelSweep(recyclerSweep);
+    }
+
     autoHeap.SweepPendingObjects(recyclerSweep);
 }
 
+bool
+Recycler::DoParallelSweep() const
+{
+    if (!this->enableParallelSweep || this->maxParallelism <= 2)
+    {
+        // The concurrent thread does the sweep while the main thread keeps running script,
+        // so we need at least one more processor for a parallel thread to help out.
+        return false;
+    }
+
+#if ENABLE_PARTIAL_GC
+    // Partial sweep relinks the pending blocks as it goes; leave that to the background thread.
+    if (this->inPartialCollectMode)
+    {
+        return false;
+    }
+#endif
+
+    // NotifyFree reports each swept object to shared tracking state that isn't thread safe.
+    // Keep the sweep on one thread while any of that is being collected.
+#ifdef ENABLE_JS_ETW
+    if (EventEnabledJSCRIPT_RECYCLER_FREE_MEMORY())
+    {
+        return false;
+    }
+#endif
+#ifdef PROFILE_RECYCLER_ALLOC
+    if (this->trackerDictionary != nullptr)
+    {
+        return false;
+    }
+#endif
+#ifdef RECYCLER_TEST_SUPPORT
+    if (BinaryFeatureControl::RecyclerTest() && this->checkFn != NULL)
+    {
+        return false;
+    }
+#endif
+    return true;
+}
+
+bool
+Recycler::DoLazySweep() const
+{
+    if (!CUSTOM_CONFIG_FLAG(GetRecyclerFlagsTable(), RecyclerLazySweep))
+    {
+        return false;
+    }
+
+#if ENABLE_PARTIAL_GC
+    // Partial collect uses the pending sweep lists to decide which blocks to reuse
+    if (this->inPartialCollectMode)
+    {
+        return false;
+    }
+#endif
+
+    return !this->isShuttingDown;
+}
+
+void
+Recycler::FinishLazySweep()
+{
+    RECYCLER_PROFILE_EXEC_BEGIN(this, Js::LazySweepPhase);
+    autoHeap.FinishLazySweep();
+    RECYCLER_PROFILE_EXEC_END(this, Js::LazySweepPhase);
+}
+
+void
+Recycler::DoBackgroundParallelSweep(RecyclerSweep& recyclerSweep)
+{
+    Assert(recyclerSweep.IsBackground());
+    Assert(this->collectionState == CollectionStateConcurrentSweep);
+    Assert(this->recyclerSweep == &recyclerSweep);
+
+    if (!recyclerSweep.HasPendingSweepSmallHeapBlocks())
+    {
+        return;
+    }
+
+    RECYCLER_PROFILE_EXEC_BACKGROUND_BEGIN(this, Js::ParallelSweepPhase);
+
+    recyclerSweep.StartParallelSweep();
+
+    // The threads pull buckets from the shared index in recyclerSweep, so there is nothing to hand
+    // over if one fails to start; whichever threads are running will pick up its share.
+    // If the threads haven't been created yet, this will create them (or fail).
+    bool parallelSuccess1 = parallelThread1.StartConcurrent();
+    bool parallelSuccess2 = false;
+    if (parallelSuccess1 && this->maxParallelism > 3)
+    {
+        parallelSuccess2 = parallelThread2.StartConcurrent();
+    }
+
+    // Process our portion of the buckets.
+    autoHeap.ParallelSweepPendingObjects(recyclerSweep);
+
+    if (parallelSuccess1)
+    {
+        parallelThread1.WaitForConcurrent();
+    }
+    if (parallelSuccess2)
+    {
+        parallelThread2.WaitForConcurrent();
+    }
+
+    RECYCLER_PROFILE_EXEC_BACKGROUND_END(this, Js::ParallelSweepPhase);
+}
+
 void
 Recycler::ConcurrentTransferSweptObjects(RecyclerSweep& recyclerSweep)
 {
@@ -5213,10 +5530,91 @@ Recycler::FinishConcurrentCollectWrapped(CollectionFlags flags)
     this->skipStack = ((flags & CollectOverride_SkipStack) != 0);
     DebugOnly(this->isConcurrentGCOnIdle = (flags == CollectOnScriptIdle));
 #endif
+    const uint pauseStartTickCount = ::GetTickCount();
     BOOL collected = collectionWrapper->ExecuteRecyclerCollectionFunction(this, &Recycler::FinishConcurrentCollect, flags);
+    this->RecordPause(pauseStartTickCount);
     return collected;
 }
 
+void
+Recycler::RecordPause(uint pauseStartTickCount)
+{
+    if (this->pauseTargetTime == 0)
+    {
+        return;
+    }
+
+    const uint pauseTime = ::GetTickCount() - pauseStartTickCount;
+    if (pauseTime > this->pauseTargetTime)
+    {
+        this->pauseTargetMissCount++;
+        RecyclerVerboseTrace(GetRecyclerFlagsTable(), _u("Collection pause of %dms exceeded the pause target of %dms\n"), pauseTime, this->pauseTargetTime);
+    }
+}
+
+uint64
+Recycler::GetPhaseTimestamp()
+{
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    return (uint64)now.QuadPart;
+}
+
+void
+Recycler::GetPhaseTimes(PhaseTimes * phaseTimes) const
+{
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    auto toMicroseconds = [&](uint64 ticks) -> uint64
+    {
+        return frequency.QuadPart == 0 ? 0 : (ticks / frequency.QuadPart) * 1000000 + (ticks % frequency.QuadPart) * 1000000 / frequency.QuadPart;
+    };
+
+    phaseTimes->collectionCount = this->phaseCollectionCount;
+    phaseTimes->markMicroseconds = toMicroseconds(this->phaseMarkTicks);
+    phaseTimes->sweepMicroseconds = toMicroseconds(this->phaseSweepTicks);
+    phaseTimes->backgroundMarkMicroseconds = toMicroseconds(this->phaseBackgroundMarkTicks);
+    phaseTimes->backgroundSweepMicroseconds = toMicroseconds(this->phaseBackgroundSweepTicks);
+}
+
+void
+Recycler::SetAllocationSampling(size_t sampleInterval, AllocationSampleCallback callback, void * callbackState)
+{
+    Assert(sampleInterval == 0 || callback != nullptr);
+    this->allocationSampleInterval = sampleInterval;
+    this->allocationSampleBytesLeft = sampleInterval;
+    this->allocationSampleCallback = sampleInterval != 0 ? callback : nullptr;
+    this->allocationSampleCallbackState = sampleInterval != 0 ? callbackState : nullptr;
+}
+
+void
+Recycler::SampleAllocation(size_t size)
+{
+    this->allocationSampleBytesLeft = this->allocationSampleInterval;
+
+    // The callback runs in the middle of an allocation; don't sample the allocations it may make itself
+    if (this->inAllocationSample)
+    {
+        return;
+    }
+
+    this->inAllocationSample = true;
+    this->allocationSampleCallback(size, this->allocationSampleCallbackState);
+    this->inAllocationSample = false;
+}
+
+DWORD
+Recycler::CapWaitTimeToPauseTarget(DWORD waitTime) const
+{
+    // Waiting on the background thread blocks the mutator, so don't wait for longer than the host's pause target.
+    // If the wait times out, the collection is resumed later the same way a timed out finish mark is.
+    if (this->pauseTargetTime != 0 && waitTime != INFINITE && waitTime > this->pauseTargetTime)
+    {
+        return this->pauseTargetTime;
+    }
+    return waitTime;
+}
+
 BOOL
 Recycler::WaitForConcurrentThread(DWORD waitTime)
 {
@@ -5334,7 +5732,7 @@ Recycler::FinishConcurrentCollect(CollectionFlags flags)
     collectionParam.priorityBoostConcurrentSweepOverride = priorityBoost;
 #endif
 
-    const DWORD waitTime = forceInThread? INFINITE : RecyclerHeuristic::FinishConcurrentCollectWaitTime(this->GetRecyclerFlagsTable());
+    const DWORD waitTime = forceInThread? INFINITE : CapWaitTimeToPauseTarget(RecyclerHeuristic::FinishConcurrentCollectWaitTime(this->GetRecyclerFlagsTable()));
     GCETW(GC_FINISHCONCURRENTWAIT_START, (this, waitTime));
     const BOOL waited = WaitForConcurrentThread(waitTime);
     GCETW(GC_FINISHCONCURRENTWAIT_STOP, (this, !waited));
@@ -5369,8 +5767,10 @@ Recycler::FinishConcurrentCollect(CollectionFlags flags)
         AutoProtectPages protectPages(this, GetRecyclerFlagsTable().RecyclerProtectPagesOnRescan);
 #endif
 
-        const bool backgroundFinishMark = !forceInThread && concurrent && ((flags & CollectOverride_BackgroundFinishMark) != 0);
-        const DWORD finishMarkWaitTime = RecyclerHeuristic::BackgroundFinishMarkWaitTime(backgroundFinishMark, GetRecyclerFlagsTable());
+        // With a pause target, always try to finish mark in the background so the in-thread part is bounded by the target
+        const bool backgroundFinishMark = !forceInThread && concurrent &&
+            ((flags & CollectOverride_BackgroundFinishMark) != 0 || this->pauseTargetTime != 0);
+        const DWORD finishMarkWaitTime = CapWaitTimeToPauseTarget(RecyclerHeuristic::BackgroundFinishMarkWaitTime(backgroundFinishMark, GetRecyclerFlagsTable()));
         size_t rescanRootBytes = FinishMark(finishMarkWaitTime);
 
         if (rescanRootBytes == Recycler::InvalidScanRootBytes)
@@ -5545,6 +5945,7 @@ Recycler::DoBackgroundWork(bool forceForeground)
     {
         RECYCLER_PROFILE_EXEC_BACKGROUND_BEGIN(this, this->collectionState == CollectionStateConcurrentFinishMark?
             Js::BackgroundFinishMarkPhase : Js::ConcurrentMarkPhase);
+        const uint64 markStart = GetPhaseTimestamp();
         GCETW_INTERNAL(GC_START, (this, BackgroundMarkETWEventGCActivationKind(this->collectionState)));
         DebugOnly(this->markContext.GetPageAllocator()->SetConcurrentThreadId(::GetCurrentThreadId()));
         Assert(this->enableConcurrentMark);
@@ -5578,6 +5979,7 @@ Recycler::DoBackgroundWork(bool forceForeground)
             break;
         };
         GCETW_INTERNAL(GC_STOP, (this, BackgroundMarkETWEventGCActivationKind(this->collectionState)));
+        this->phaseBackgroundMarkTicks += GetPhaseTimestamp() - markStart;
         RECYCLER_PROFILE_EXEC_BACKGROUND_END(this, this->collectionState == CollectionStateConcurrentFinishMark?
             Js::BackgroundFinishMarkPhase : Js::ConcurrentMarkPhase);
 
@@ -5587,6 +5989,7 @@ Recycler::DoBackgroundWork(bool forceForeground)
     else
     {
         RECYCLER_PROFILE_EXEC_BACKGROUND_BEGIN(this, Js::ConcurrentSweepPhase);
+        const uint64 sweepStart = GetPhaseTimestamp();
         GCETW_INTERNAL(GC_START, (this, ETWEvent_ConcurrentSweep));
         GCETW(GC_BACKGROUNDZEROPAGE_START, (this));
 
@@ -5624,6 +6027,7 @@ Recycler::DoBackgroundWork(bool forceForeground)
         GCETW_INTERNAL(GC_STOP, (this, ETWEvent_ConcurrentSweep));
 
         Assert(this->collectionState == CollectionStateConcurrentSweep);
+        this->phaseBackgroundSweepTicks += GetPhaseTimestamp() - sweepStart;
         this->collectionState = CollectionStateTransferSweptWait;
         RECYCLER_PROFILE_EXEC_BACKGROUND_END(this, Js::ConcurrentSweepPhase);
     }
@@ -6117,6 +6521,11 @@ Recycler::ParallelWorkFunc()
             this->ProcessParallelMark(true, markContext);
             break;
 
+        case CollectionStateConcurrentSweep:
+            Assert(this->recyclerSweep != nullptr);
+            this->autoHeap.ParallelSweepPendingObjects(*this->recyclerSweep);
+            break;
+
         default:
             Assert(false);
     }
@@ -8128,6 +8537,86 @@ void Recycler::ClearObjectBeforeCollectCallbacks()
     Assert(objectBeforeCollectCallbackMap == nullptr);
 }
 
+void Recycler::SetObjectCollectToken(void* object, void* token)
+{
+    Assert(!this->IsInObjectBeforeCollectCallback());
+
+    if (token == nullptr)
+    {
+        if (objectCollectTokenMap != nullptr)
+        {
+            objectCollectTokenMap->Remove(object);
+        }
+        return;
+    }
+
+    if (objectCollectTokenMap == nullptr)
+    {
+        objectCollectTokenMap = HeapNew(ObjectCollectTokenMap, &HeapAllocator::Instance);
+    }
+
+    // Grow the token buffer up front, so that a collection can record a token for every object in the map
+    uint requiredCapacity = collectedObjectTokenCount + objectCollectTokenMap->Count() + 1;
+    if (requiredCapacity > collectedObjectTokenCapacity)
+    {
+        uint newCapacity = max(requiredCapacity, collectedObjectTokenCapacity * 2);
+        void** newTokens = HeapNewArray(void*, newCapacity);
+        if (collectedObjectTokenCount != 0)
+        {
+            js_memcpy_s(newTokens, newCapacity * sizeof(void*), collectedObjectTokens, collectedObjectTokenCount * sizeof(void*));
+        }
+        if (collectedObjectTokens != nullptr)
+        {
+            HeapDeleteArray(collectedObjectTokenCapacity, collectedObjectTokens);
+        }
+        collectedObjectTokens = newTokens;
+        collectedObjectTokenCapacity = newCapacity;
+    }
+
+    objectCollectTokenMap->Item(object, token);
+}
+
+void Recycler::ProcessObjectCollectTokens()
+{
+    if (this->objectCollectTokenMap == nullptr)
+    {
+        return;
+    }
+    Assert(this->IsMarkState());
+
+    // Tokens from an earlier collection that nobody took are dropped
+    collectedObjectTokenCount = 0;
+
+    objectCollectTokenMap->MapAndRemoveIf([&](const ObjectCollectTokenMap::EntryType& entry)
+    {
+        if (this->IsObjectMarked(entry.Key()))
+        {
+            return false;
+        }
+
+        Assert(collectedObjectTokenCount < collectedObjectTokenCapacity);
+        collectedObjectTokens[collectedObjectTokenCount++] = entry.Value();
+        return true;
+    });
+}
+
+void Recycler::ClearObjectCollectTokens()
+{
+    if (objectCollectTokenMap != nullptr)
+    {
+        HeapDelete(objectCollectTokenMap);
+        objectCollectTokenMap = nullptr;
+    }
+
+    if (collectedObjectTokens != nullptr)
+    {
+        HeapDeleteArray(collectedObjectTokenCapacity, collectedObjectTokens);
+        collectedObjectTokens = nullptr;
+    }
+    collectedObjectTokenCount = 0;
+    collectedObjectTokenCapacity = 0;
+}
+
 #ifdef RECYCLER_TEST_SUPPORT
 void Recycler::SetCheckFn(BOOL(*checkFn)(char* addr, size_t size))
 {
@@ -8187,13 +8676,14 @@ Recycler::NotifyFree(__in char *address, size_t size)
 #endif
 
 #ifdef RECYCLER_STATS
-    collectionStats.objectSweptCount++;
-    collectionStats.objectSweptBytes += size;
+    // Small blocks may be swept on several threads at once during a parallel sweep
+    RECYCLER_STATS_INTERLOCKED_INC(this, objectSweptCount);
+    RECYCLER_STATS_INTERLOCKED_ADD(this, objectSweptBytes, size);
 
     if (!isForceSweeping)
     {
-        collectionStats.objectSweptFreeListCount++;
-        collectionStats.objectSweptFreeListBytes += size;
+        RECYCLER_STATS_INTERLOCKED_INC(this, objectSweptFreeListCount);
+        RECYCLER_STATS_INTERLOCKED_ADD(this, objectSweptFreeListBytes, size);
     }
 #endif
 }
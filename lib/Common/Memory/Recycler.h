@@ -278,6 +278,7 @@ enum CollectionFlags
     CollectOnScriptCloseNonPrimary  = CollectNowConcurrent | CollectOverride_ExhaustiveCandidate | CollectOverride_AllowDispose,
     CollectOnRecoverFromOutOfMemory = CollectOverride_ForceInThread | CollectMode_DecommitNow,
     CollectOnSuspendCleanup         = CollectNowConcurrent | CollectMode_Exhaustive | CollectMode_DecommitNow | CollectOverride_DisableIdleFinish,
+    CollectOnMemoryPressure         = CollectNowExhaustive | CollectMode_DecommitNow | CollectMode_CacheCleanup | CollectOverride_Explicit,
 
     FinishConcurrentOnIdle          = CollectMode_Concurrent | CollectOverride_DisableIdleFinish,
     FinishConcurrentOnIdleAtRoot    = CollectMode_Concurrent | CollectOverride_DisableIdleFinish | CollectOverride_SkipStack,
@@ -826,8 +827,32 @@ private:
     PagePool parallelMarkPagePool2;
     PagePool parallelMarkPagePool3;
 
+#if ENABLE_CONCURRENT_GC
+    // Work stealing for parallel mark.
+    // A parallel mark worker that runs out of work registers itself as idle and waits on parallelMarkWorkEvent for mark
+    // stack entries to show up in parallelMarkSharedContext. Busy workers notice the idle count and copy entries to the
+    // shared context, and idle workers copy them into their own stacks. Entries are copied rather than chunks moved, so
+    // each mark stack keeps its own pages and the primary mark stack keeps its reserved pages.
+    // All of the state below except parallelMarkIdleCount is only accessed under parallelMarkWorkCriticalSection.
+    PagePool parallelMarkSharedPagePool;
+    MarkContext parallelMarkSharedContext;
+    CriticalSection parallelMarkWorkCriticalSection;
+    HANDLE parallelMarkWorkEvent;
+    uint volatile parallelMarkIdleCount;
+    uint parallelMarkBusyCount;
+    bool enableParallelMarkWorkStealing;
+
+    void StartParallelMarkWork();
+    bool StealParallelMarkWork(MarkContext * markContext);
+    void DonateParallelMarkWork(MarkContext * markContext);
+#endif
+
     bool IsMarkStackEmpty();
-    bool HasPendingMarkObjects() const { return markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects() || parallelMarkContext2.HasPendingMarkObjects() || parallelMarkContext3.HasPendingMarkObjects(); }
+    bool HasPendingMarkObjects() const { return markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects() || parallelMarkContext2.HasPendingMarkObjects() || parallelMarkContext3.HasPendingMarkObjects()
+#if ENABLE_CONCURRENT_GC
+        || parallelMarkSharedContext.HasPendingMarkObjects()
+#endif
+        ; }
     bool HasPendingTrackObjects() const { return markContext.HasPendingTrackObjects() || parallelMarkContext1.HasPendingTrackObjects() || parallelMarkContext2.HasPendingTrackObjects() || parallelMarkContext3.HasPendingTrackObjects(); }
 
     RecyclerCollectionWrapper * collectionWrapper;
@@ -942,9 +967,15 @@ private:
     bool enableConcurrentMark;
     bool enableParallelMark;
     bool enableConcurrentSweep;
+    bool enableParallelSweep;
 
     uint maxParallelism;        // Max # of total threads to run in parallel
 
+    // Parallel mark uses the main mark context plus one split target per additional thread. The split targets
+    // are the fixed parallelMarkContext1-3 members, run by the concurrent thread and parallelThread1-2, so this
+    // is also the most -RecyclerParallelism can ask for.
+    static const uint MaxParallelism = PageStack<MarkCandidate>::MaxSplitTargets + 1;
+
     byte backgroundRescanCount;             // for ETW events and stats
     byte backgroundFinishMarkCount;
     size_t backgroundRescanRootBytes;
@@ -1007,6 +1038,40 @@ private:
     uint tickCountNextCollection;
     uint tickCountNextFinishCollection;
 
+    DWORD pauseTargetTime;          // Host requested maximum in-thread pause in milliseconds, 0 for none
+    uint pauseTargetMissCount;      // Number of in-thread collection pauses that exceeded pauseTargetTime
+
+public:
+    // Always-on collection counters. The foreground times are spent on the thread that owns the recycler,
+    // and the background ones on the concurrent thread while that thread keeps running.
+    struct PhaseTimes
+    {
+        uint64 collectionCount;
+        uint64 markMicroseconds;
+        uint64 sweepMicroseconds;
+        uint64 backgroundMarkMicroseconds;
+        uint64 backgroundSweepMicroseconds;
+    };
+
+private:
+    // In QueryPerformanceCounter ticks; the background ones are only written by the concurrent thread
+    uint64 phaseCollectionCount;
+    uint64 phaseMarkTicks;
+    uint64 phaseSweepTicks;
+    uint64 phaseBackgroundMarkTicks;
+    uint64 phaseBackgroundSweepTicks;
+    static uint64 GetPhaseTimestamp();
+
+public:
+    typedef void (*AllocationSampleCallback)(size_t size, void * callbackState);
+
+private:
+    size_t allocationSampleInterval;    // Bytes allocated between allocation samples, 0 when not sampling
+    size_t allocationSampleBytesLeft;   // Bytes left to allocate before the next allocation sample
+    AllocationSampleCallback allocationSampleCallback;
+    void * allocationSampleCallbackState;
+    bool inAllocationSample;
+
     void (*outOfMemoryFunc)();
 #ifdef RECYCLER_TEST_SUPPORT
     BOOL (*checkFn)(char* addr, size_t size);
@@ -1268,6 +1333,14 @@ public:
 #endif
     }
 
+    void SetPauseTarget(DWORD milliseconds) { this->pauseTargetTime = milliseconds; }
+    DWORD GetPauseTarget() const { return this->pauseTargetTime; }
+    uint GetPauseTargetMissCount() const { return this->pauseTargetMissCount; }
+    void GetPhaseTimes(PhaseTimes * phaseTimes) const;
+
+    void SetAllocationSampling(size_t sampleInterval, AllocationSampleCallback callback, void * callbackState);
+    bool IsAllocationSampling() const { return this->allocationSampleInterval != 0; }
+
     static size_t GetAlignedSize(size_t size) { return HeapInfo::GetAlignedSize(size); }
 
     HeapInfo* GetAutoHeap() { return &autoHeap; }
@@ -1430,6 +1503,7 @@ public:
     void HeapFree(HeapInfo* eHeap,void* candidate);
 
     void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context);
 
     void RootAddRef(void* obj, uint *count = nullptr);
     void RootRelease(void* obj, uint *count = nullptr);
@@ -1582,6 +1656,10 @@ private:
     BOOL DoCollect(CollectionFlags flags);
     BOOL DoCollectWrapped(CollectionFlags flags);
     BOOL CollectOnAllocatorThread();
+    void RecordPause(uint pauseStartTickCount);
+    DWORD CapWaitTimeToPauseTarget(DWORD waitTime) const;
+    inline void CountAllocationSampleBytes(size_t size);
+    void SampleAllocation(size_t size);
 
 #if DBG
     void ResetThreadId();
@@ -1758,6 +1836,10 @@ private:
     char* GetScriptThreadStackTop();
 
     void SweepPendingObjects(RecyclerSweep& recyclerSweep);
+    bool DoParallelSweep() const;
+    void DoBackgroundParallelSweep(RecyclerSweep& recyclerSweep);
+    bool DoLazySweep() const;
+    void FinishLazySweep();
     void ConcurrentTransferSweptObjects(RecyclerSweep& recyclerSweep);
 #if ENABLE_PARTIAL_GC
     void ConcurrentPartialTransferSweptObjects(RecyclerSweep& recyclerSweep);
@@ -2037,6 +2119,34 @@ private:
     } objectBeforeCollectCallbackState;
 
     bool ProcessObjectBeforeCollectCallbacks(bool atShutdown = false);
+
+public:
+    // Objects with a collect token have the token recorded when they are collected, instead of
+    // a callback being invoked during the collection. The tokens are reported in one batch.
+    void SetObjectCollectToken(void* object, void* token);
+    template <class Fn>
+    void ReportCollectedObjectTokens(Fn fn)
+    {
+        if (collectedObjectTokenCount != 0)
+        {
+            uint count = collectedObjectTokenCount;
+            collectedObjectTokenCount = 0;
+            fn(collectedObjectTokens, count);
+        }
+    }
+private:
+    typedef JsUtil::BaseDictionary<void*, void*, HeapAllocator,
+        PrimeSizePolicy, RecyclerPointerComparer, JsUtil::SimpleDictionaryEntry, JsUtil::NoResizeLock> ObjectCollectTokenMap;
+    ObjectCollectTokenMap* objectCollectTokenMap;
+
+    // Always has room for a token per entry in objectCollectTokenMap, so recording tokens
+    // during the collection never allocates
+    void** collectedObjectTokens;
+    uint collectedObjectTokenCount;
+    uint collectedObjectTokenCapacity;
+
+    void ProcessObjectCollectTokens();
+    void ClearObjectCollectTokens();
 };
 
 
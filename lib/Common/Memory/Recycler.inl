@@ -324,6 +324,9 @@ Recycler::RealAllocFromBucket(HeapInfo* heap, size_t size)
     {
         sizeCat = (uint)HeapInfo::GetMediumObjectAlignedSizeNoCheck(size);
         memBlock = heap->MediumAlloc<attributes, nothrow>(this, sizeCat, size);
+#if defined(DUMP_FRAGMENTATION_STATS) && SMALLBLOCK_MEDIUM_ALLOC
+        heap->RecordMediumAllocRequest(size);
+#endif
     }
 #endif
 
@@ -373,6 +376,19 @@ Recycler::RealAllocFromBucket(HeapInfo* heap, size_t size)
 
 }
 
+inline void
+Recycler::CountAllocationSampleBytes(size_t size)
+{
+    if (size >= this->allocationSampleBytesLeft)
+    {
+        this->SampleAllocation(size);
+    }
+    else
+    {
+        this->allocationSampleBytesLeft -= size;
+    }
+}
+
 template <ObjectInfoBits attributes, bool nothrow>
 inline char*
 Recycler::RealAlloc(HeapInfo* heap, size_t size)
@@ -390,6 +406,11 @@ Recycler::RealAlloc(HeapInfo* heap, size_t size)
         FAULTINJECT_MEMORY_THROW(_u("Recycler"), size);
     }
 
+    if (this->allocationSampleInterval != 0)
+    {
+        this->CountAllocationSampleBytes(size);
+    }
+
     if (HeapInfo::IsSmallObject(size))
     {
         return RealAllocFromBucket<attributes, /* isSmallAlloc = */ true, nothrow>(heap, size);
@@ -78,7 +78,7 @@ RecyclerHeuristic::UncollectedAllocBytesCollection()
 
 #if ENABLE_CONCURRENT_GC
 uint
-RecyclerHeuristic::MaxBackgroundFinishMarkCount(Js::ConfigFlagsTable& flags)
+RecyclerHeuristic::MaxBackgroundFinishMarkCount(bool hasPauseTarget, Js::ConfigFlagsTable& flags)
 {
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     if (flags.IsEnabled(Js::MaxBackgroundFinishMarkCountFlag))
@@ -86,7 +86,7 @@ RecyclerHeuristic::MaxBackgroundFinishMarkCount(Js::ConfigFlagsTable& flags)
         return flags.MaxBackgroundFinishMarkCount;
     }
 #endif
-    return DefaultMaxBackgroundFinishMarkCount;
+    return hasPauseTarget ? PauseTargetMaxBackgroundFinishMarkCount : DefaultMaxBackgroundFinishMarkCount;
 }
 
 DWORD
@@ -37,7 +37,7 @@ public:
     // Constant heuristic that may be changed by switches
     static uint UncollectedAllocBytesCollection();
 #if ENABLE_CONCURRENT_GC
-    static uint MaxBackgroundFinishMarkCount(Js::ConfigFlagsTable&);
+    static uint MaxBackgroundFinishMarkCount(bool hasPauseTarget, Js::ConfigFlagsTable&);
     static DWORD BackgroundFinishMarkWaitTime(bool, Js::ConfigFlagsTable&);
     static size_t MinBackgroundRepeatMarkRescanBytes(Js::ConfigFlagsTable&);
     static DWORD FinishConcurrentCollectWaitTime(Js::ConfigFlagsTable&);
@@ -73,6 +73,7 @@ private:
     static const uint TickCountConcurrentPriorityBoost = 5000;                              // 5 second
     static const DWORD DefaultFinishConcurrentCollectWaitTime = 1000;                       // 1 second
     static const uint DefaultMaxBackgroundFinishMarkCount = 1;
+    static const uint PauseTargetMaxBackgroundFinishMarkCount = 4;                          // Retry more with a host pause target before finishing in-thread
     static const DWORD DefaultBackgroundFinishMarkWaitTime = 15; // ms
     static const size_t DefaultMinBackgroundRepeatMarkRescanBytes = 1 MEGABYTES;
 #endif
@@ -268,6 +268,7 @@ void
 RecyclerSweep::BackgroundSweep()
 {
     this->BeginBackground(forceForeground);
+    this->parallelSweep = this->IsBackground() && this->recycler->DoParallelSweep();
 
     // Finish the concurrent part of the first pass
     this->recycler->autoHeap.SweepSmallNonFinalizable(*this);
@@ -275,6 +276,7 @@ RecyclerSweep::BackgroundSweep()
     // Finish the rest of the sweep
     this->FinishSweep();
 
+    this->parallelSweep = false;
     this->EndBackground();
 }
 #endif
@@ -435,6 +437,40 @@ RecyclerSweep::SetHasPendingSweepSmallHeapBlocks()
     this->hasPendingSweepSmallHeapBlocks = true;
 }
 
+bool
+RecyclerSweep::IsParallelSweep() const
+{
+    return this->parallelSweep;
+}
+
+bool
+RecyclerSweep::IsLazySweep() const
+{
+    return this->lazySweep;
+}
+
+void
+RecyclerSweep::SetLazySweep(bool lazySweep)
+{
+    Assert(!this->HasSetupBackgroundSweep());
+    this->lazySweep = lazySweep;
+}
+
+void
+RecyclerSweep::StartParallelSweep()
+{
+    Assert(this->IsParallelSweep());
+    this->parallelSweepNextBucket = 0;
+}
+
+uint
+RecyclerSweep::GetNextParallelSweepBucket()
+{
+    // Buckets are handed out one at a time so that the threads balance out
+    // even though the pending sweep lists vary a lot in length between buckets
+    return (uint)(::InterlockedIncrement(&this->parallelSweepNextBucket) - 1);
+}
+
 void
 RecyclerSweep::BeginBackground(bool forceForeground)
 {
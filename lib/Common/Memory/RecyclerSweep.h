@@ -30,6 +30,11 @@ public:
 #if ENABLE_CONCURRENT_GC
     bool HasPendingSweepSmallHeapBlocks() const;
     void SetHasPendingSweepSmallHeapBlocks();
+    bool IsParallelSweep() const;
+    bool IsLazySweep() const;
+    void SetLazySweep(bool lazySweep);
+    void StartParallelSweep();
+    uint GetNextParallelSweepBucket();
     template <typename TBlockType>
     TBlockType *& GetPendingSweepBlockList(HeapBucketT<TBlockType> const * heapBucket);
     bool HasPendingEmptyBlocks() const;
@@ -159,6 +164,16 @@ private:
     bool hasPendingSweepSmallHeapBlocks;
     bool hasPendingEmptyBlocks;
     bool inPartialCollect;
+#if ENABLE_CONCURRENT_GC
+    // Set for a background sweep that queues the swept normal blocks on the pending sweep lists,
+    // so that their objects can be swept by the parallel threads in FinishSweep
+    bool parallelSweep;
+    // Set for an in-thread sweep that leaves the swept normal blocks on the buckets' lazy sweep lists
+    // instead of sweeping their objects; see HeapBucketT::LazySweepNextHeapBlock
+    bool lazySweep;
+    // Next bucket to be claimed by a thread participating in a parallel sweep of the pending sweep lists
+    LONG volatile parallelSweepNextBucket;
+#endif
 #if ENABLE_PARTIAL_GC
     bool adjustPartialHeuristics;
     size_t lastPartialUncollectedAllocBytes;
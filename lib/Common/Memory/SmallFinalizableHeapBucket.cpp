@@ -175,10 +175,10 @@ SmallFinalizableHeapBucketBaseT<TBlockType>::TransferDisposedObjects()
 
 template <class TBlockType>
 void
-SmallFinalizableHeapBucketBaseT<TBlockType>::EnumerateObjects(ObjectInfoBits infoBits, void(*CallBackFunction)(void * address, size_t size))
+SmallFinalizableHeapBucketBaseT<TBlockType>::EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context)
 {
-    __super::EnumerateObjects(infoBits, CallBackFunction);
-    HeapBucket::EnumerateObjects(this->pendingDisposeList, infoBits, CallBackFunction);
+    __super::EnumerateObjects(infoBits, callback, context);
+    HeapBucket::EnumerateObjects(this->pendingDisposeList, infoBits, callback, context);
 }
 
 #ifdef RECYCLER_SLOW_CHECK_ENABLED
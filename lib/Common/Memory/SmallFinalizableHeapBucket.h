@@ -23,7 +23,7 @@ public:
     void AggregateBucketStats(HeapBucketStats& stats);
 #endif
 protected:
-    void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context);
 
     friend class HeapBucket;
     template <class TBlockAttributes>
@@ -238,6 +238,8 @@ public:
     uint Rescan(Recycler * recycler, RescanFlags flags);
 #if ENABLE_CONCURRENT_GC
     void SweepPendingObjects(RecyclerSweep& recyclerSweep);
+    void ParallelSweepPendingObjects(RecyclerSweep& recyclerSweep);
+    void FinishLazySweep(Recycler * recycler);
 #endif
 #if ENABLE_PARTIAL_GC
     void SweepPartialReusePages(RecyclerSweep& recyclerSweep);
@@ -251,7 +253,7 @@ public:
     void SweepFinalizableObjects(RecyclerSweep& recyclerSweep);
     void DisposeObjects();
     void TransferDisposedObjects();
-    void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context);
     void FinalizeAllObjects();
     static unsigned int GetHeapBucketOffset() { return offsetof(HeapBucketGroup<TBlockAttributes>, heapBucket); }
 
@@ -174,6 +174,21 @@ SmallHeapBlockAllocator<TBlockType>::Set(BlockType * heapBlock)
 
     this->heapBlock = heapBlock;
     RECYCLER_SLOW_CHECK(this->heapBlock->CheckDebugFreeBitVector(true));
+
+#if defined(PROFILE_RECYCLER_ALLOC) || defined(RECYCLER_MEMORY_VERIFY) || defined(MEMSPECT_TRACKING) || defined(ETW_MEMORY_TRACKING)
+    // TrackNativeAllocatedObjects assumes bump allocation starts at the beginning of the block
+    if (this->pfnTrackNativeAllocatedObjectCallBack == nullptr)
+#endif
+    {
+        char * bumpAllocAddress = heapBlock->TryTakeFreeTailForBumpAllocation(heapBlock->heapBucket->heapInfo->recycler);
+        if (bumpAllocAddress != nullptr)
+        {
+            this->freeObjectList = (FreeObject *)bumpAllocAddress;
+            this->endAddress = heapBlock->GetEndAddress();
+            return;
+        }
+    }
+
     this->freeObjectList = this->heapBlock->freeObjectList;
 }
 
@@ -252,6 +252,15 @@ SmallNormalHeapBucketBase<TBlockType>::SweepPendingObjects(RecyclerSweep& recycl
         }
         else
 #endif
+        if (recyclerSweep.IsLazySweep())
+        {
+            // Leave the blocks for the allocator to sweep when it gets to them.
+            // They are all swept before the marks are reset for the next collection.
+            Assert(!recyclerSweep.IsBackground());
+            this->SetLazySweepHeapBlockList(list);
+            this->StartAllocationAfterSweep();
+        }
+        else
         {
             // We decided not to do a partial sweep.
             // Blocks in the pendingSweepList need to have a regular sweep.
@@ -269,6 +278,26 @@ SmallNormalHeapBucketBase<TBlockType>::SweepPendingObjects(RecyclerSweep& recycl
     Assert(!this->IsAllocationStopped());
 }
 
+template <typename TBlockType>
+void
+SmallNormalHeapBucketBase<TBlockType>::ParallelSweepPendingObjects(RecyclerSweep& recyclerSweep)
+{
+    Assert(recyclerSweep.IsBackground());
+    CompileAssert(!BaseT::IsLeafBucket);
+
+    // Only one thread claims any given bucket, and the pending sweep list is left in place; the list is
+    // spliced back into the bucket by SweepPendingObjects, which skips the blocks that were swept here.
+    TBlockType * const list = recyclerSweep.GetPendingSweepBlockList(this);
+    Recycler * const recycler = recyclerSweep.GetRecycler();
+#if ENABLE_PARTIAL_GC
+    Assert(!recycler->inPartialCollectMode);
+#endif
+    HeapBlockList::ForEach(list, [recycler](TBlockType * heapBlock)
+    {
+        heapBlock->template SweepObjects<SweepMode_Concurrent>(recycler);
+    });
+}
+
 template <typename TBlockType>
 template <SweepMode mode>
 TBlockType *
@@ -278,7 +307,11 @@ SmallNormalHeapBucketBase<TBlockType>::SweepPendingObjects(Recycler * recycler,
     HeapBlockList::ForEach(list, [recycler, &tail](TBlockType * heapBlock)
     {
         // Note, page heap blocks are never swept concurrently
-        heapBlock->template SweepObjects<mode>(recycler);
+        // Blocks may already have been swept by ParallelSweepPendingObjects
+        if (heapBlock->isPendingConcurrentSweep)
+        {
+            heapBlock->template SweepObjects<mode>(recycler);
+        }
         tail = heapBlock;
     });
     return tail;
@@ -448,12 +481,12 @@ SmallNormalHeapBucketBase<TBlockType>::FinishPartialCollect(RecyclerSweep * recy
 
 template <typename TBlockType>
 void
-SmallNormalHeapBucketBase<TBlockType>::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+SmallNormalHeapBucketBase<TBlockType>::EnumerateObjects(ObjectInfoBits infoBits, EnumerateObjectsCallback callback, void * context)
 {
-    __super::EnumerateObjects(infoBits, CallBackFunction);
-    HeapBucket::EnumerateObjects(partialHeapBlockList, infoBits, CallBackFunction);
+    __super::EnumerateObjects(infoBits, callback, context);
+    HeapBucket::EnumerateObjects(partialHeapBlockList, infoBits, callback, context);
 #if ENABLE_CONCURRENT_GC
-    HeapBucket::EnumerateObjects(partialSweptHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(partialSweptHeapBlockList, infoBits, callback, context);
 #endif
 }
 
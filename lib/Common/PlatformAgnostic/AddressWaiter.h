@@ -0,0 +1,27 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#ifndef RUNTIME_PLATFORM_AGNOSTIC_COMMON_ADDRESSWAITER
+#define RUNTIME_PLATFORM_AGNOSTIC_COMMON_ADDRESSWAITER
+
+#ifndef _WIN32
+namespace PlatformAgnostic
+{
+    // Blocks a thread on a 32-bit value until another thread changes it and calls Wake
+    // (futex on Linux). Used by Atomics.wait/wake; Windows uses per-waiter events instead.
+    class AddressWaiter
+    {
+    public:
+        // Returns false if the timeout (in milliseconds, or INFINITE) elapsed while
+        // the value still held expected.
+        static bool Wait(volatile int32 *address, int32 expected, uint32 timeout);
+
+        // Wakes the threads waiting on address; the caller changes the value first.
+        static void Wake(volatile int32 *address);
+    };
+} // namespace PlatformAgnostic
+#endif
+
+#endif // RUNTIME_PLATFORM_AGNOSTIC_COMMON_ADDRESSWAITER
@@ -82,7 +82,30 @@ namespace DateTime
 
 #else // ! _WIN32
 
-    typedef void* DaylightTimeHelperPlatformData;
+    // Remembers the result of the last conversion over an interval of input times that is known
+    // to share it, so that consecutive conversions don't have to go through the tz functions.
+    class TimeZoneOffsetCache // DateTime.cpp
+    {
+    public:
+        double start;
+        double end;
+        double delta;       // converted time minus input time
+        int bias;
+        int offset;
+        uint32 lastUpdateTickCount;
+        bool isDaylightSavings;
+
+        TimeZoneOffsetCache(): start(1), end(0), delta(0), bias(0), offset(0),
+            lastUpdateTickCount(0), isDaylightSavings(false) { }
+        bool IsValid(const double time);
+        void Update(const double time, const double convertedTime, const double probeTime, const bool probeMatches);
+    };
+
+    struct DaylightTimeHelperPlatformData // DateTime.cpp
+    {
+        TimeZoneOffsetCache utcToLocal;
+        TimeZoneOffsetCache localToUtc;
+    };
 
     #define __CC_PA_TIMEZONE_ABVR_NAME_LENGTH 32
     struct UtilityPlatformData
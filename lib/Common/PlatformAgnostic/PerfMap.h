@@ -0,0 +1,27 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#ifndef RUNTIME_PLATFORM_AGNOSTIC_COMMON_PERFMAP
+#define RUNTIME_PLATFORM_AGNOSTIC_COMMON_PERFMAP
+
+#ifdef __linux__
+namespace PlatformAgnostic
+{
+    // Publishes symbols for generated code to the Linux perf tools: one line per code range in
+    // /tmp/perf-<pid>.map, and optionally a jit-<pid>.dump file (jitdump format, with the code
+    // bytes) in the current directory for `perf inject --jit`.
+    class PerfMap
+    {
+    public:
+        // Opens the output files on first call; later calls return the first result.
+        static bool EnsureInitialized(bool writeJitDump);
+
+        // name is UTF-8 and null terminated.
+        static void LogCodeLoad(const void *address, size_t size, const char *name);
+    };
+} // namespace PlatformAgnostic
+#endif
+
+#endif // RUNTIME_PLATFORM_AGNOSTIC_COMMON_PERFMAP
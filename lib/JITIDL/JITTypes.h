@@ -796,6 +796,14 @@ typedef struct JITOutputIDL
     unsigned int propertyGuardCount;
     unsigned int ctorCachesCount;
 
+    // Time spent in the major backend phases, in microseconds
+    unsigned int irBuilderTime;
+    unsigned int globOptTime;
+    unsigned int lowererTime;
+    unsigned int regAllocTime;
+    unsigned int encoderTime;
+    unsigned int bailOutCount;
+
 #if defined(_M_X64)
     CHAKRA_PTR xdataAddr;
 #elif defined(_M_ARM) || defined(_M_ARM64)
@@ -425,7 +425,13 @@ typedef UINT32 DWORD;
         ///     Calling <c>JsSetException</c> will also dispatch the exception to the script debugger
         ///     (if any) giving the debugger a chance to break on the exception.
         /// </summary>
-        JsRuntimeAttributeDispatchSetExceptionsToDebugger = 0x00000040
+        JsRuntimeAttributeDispatchSetExceptionsToDebugger = 0x00000040,
+        /// <summary>
+        ///     The runtime will generate native code on a process-wide pool of background threads
+        ///     shared with other runtimes that specify this attribute, instead of on threads of its own.
+        ///     The pool is sized by the number of processors. Ignored if background work is disabled.
+        /// </summary>
+        JsRuntimeAttributeShareJitThreadPool = 0x00000080
     } JsRuntimeAttributes;
 
     /// <summary>
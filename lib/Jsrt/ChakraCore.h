@@ -38,7 +38,8 @@ typedef enum JsModuleHostInfoKind
     JsModuleHostInfo_Exception = 0x01,
     JsModuleHostInfo_HostDefined = 0x02,
     JsModuleHostInfo_NotifyModuleReadyCallback = 0x3,
-    JsModuleHostInfo_FetchImportedModuleCallback = 0x4
+    JsModuleHostInfo_FetchImportedModuleCallback = 0x4,
+    JsModuleHostInfo_FetchImportedModulesCallback = 0x5
 } JsModuleHostInfoKind;
 
 /// <summary>
@@ -57,6 +58,24 @@ typedef enum JsModuleHostInfoKind
 /// </returns>
 typedef JsErrorCode(CHAKRA_CALLBACK * FetchImportedModuleCallBack)(_In_ JsModuleRecord referencingModule, _In_ JsValueRef specifier, _Outptr_result_maybenull_ JsModuleRecord* dependentModuleRecord);
 
+/// <summary>
+///     User implemented callback to fetch all the imported modules of a module in one call.
+/// </summary>
+/// <remarks>
+/// Batched form of FetchImportedModuleCallBack. When set, it is used instead of FetchImportedModuleCallBack and receives every
+/// specifier of the referencing module that has not been resolved yet, so hosts that already know the module graph can
+/// answer with a single call.
+/// </remarks>
+/// <param name="referencingModule">The referencing module that is requesting the dependency modules.</param>
+/// <param name="specifierCount">The number of specifiers.</param>
+/// <param name="specifiers">The specifiers coming from the module source code.</param>
+/// <param name="dependentModuleRecords">Receives the ModuleRecord for each specifier, in the same order. Each entry must be set
+///                           to an existing or newly created ModuleRecord.</param>
+/// <returns>
+///     true if the operation succeeded, false otherwise.
+/// </returns>
+typedef JsErrorCode(CHAKRA_CALLBACK * FetchImportedModulesCallBack)(_In_ JsModuleRecord referencingModule, _In_ unsigned int specifierCount, _In_reads_(specifierCount) const JsValueRef* specifiers, _Out_writes_(specifierCount) JsModuleRecord* dependentModuleRecords);
+
 /// <summary>
 ///     User implemented callback to get notification when the module is ready.
 /// </summary>
@@ -547,5 +566,1397 @@ CHAKRA_API
         _In_ JsSourceContext sourceContext,
         _In_ JsValueRef sourceUrl,
         _Out_ JsValueRef *result);
+
+/// <summary>
+///     Sets the target maximum garbage collection pause for a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     When a pause target is set, the runtime waits for background collection work at most
+///     that long before returning to the host, and resumes the collection later instead. This
+///     trades collection throughput for shorter pauses, and the target is not a guarantee: pauses
+///     that could not be kept under the target are counted and can be retrieved with
+///     <c>JsGetRuntimeGCPauseTargetMissCount</c>.
+///     </para>
+///     <para>
+///     The runtime must not be active on another thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime whose pause target is to be set.</param>
+/// <param name="pauseTarget">The pause target in milliseconds, or 0 for no pause target.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeGCPauseTarget(
+        _In_ JsRuntimeHandle runtime,
+        _In_ unsigned int pauseTarget);
+
+/// <summary>
+///     Gets the number of garbage collection pauses that exceeded the runtime's pause target.
+/// </summary>
+/// <param name="runtime">The runtime whose pause target misses are to be retrieved.</param>
+/// <param name="missCount">The number of pauses that took longer than the pause target.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeGCPauseTargetMissCount(
+        _In_ JsRuntimeHandle runtime,
+        _Out_ unsigned int *missCount);
+
+/// <summary>
+///     The kind of a heap snapshot record.
+/// </summary>
+typedef enum _JsHeapSnapshotRecordKind
+{
+    /// <summary>
+    ///     An allocated object. <c>address</c>, <c>size</c> and <c>attributes</c> describe the object.
+    /// </summary>
+    JsHeapSnapshotRecordObject = 0,
+    /// <summary>
+    ///     A reference from the object at <c>address</c> to the object at <c>target</c>, found at
+    ///     byte offset <c>size</c> within the referencing object.
+    /// </summary>
+    JsHeapSnapshotRecordEdge = 1
+} JsHeapSnapshotRecordKind;
+
+/// <summary>
+///     A heap snapshot record.
+/// </summary>
+typedef struct _JsHeapSnapshotRecord
+{
+    JsHeapSnapshotRecordKind kind;
+    unsigned int attributes;
+    void *address;
+    void *target;
+    size_t size;
+} JsHeapSnapshotRecord;
+
+/// <summary>
+///     Called by the runtime with a chunk of heap snapshot records.
+/// </summary>
+/// <remarks>
+///     The callback is invoked while the heap is being walked and must not call back into the runtime.
+///     The records are only valid for the duration of the callback.
+/// </remarks>
+/// <param name="records">The records.</param>
+/// <param name="recordCount">The number of records.</param>
+/// <param name="callbackState">The state passed to <c>JsStreamHeapSnapshot</c>.</param>
+typedef void (CHAKRA_CALLBACK * JsHeapSnapshotCallback)(
+    _In_reads_(recordCount) const JsHeapSnapshotRecord *records,
+    _In_ unsigned int recordCount,
+    _In_opt_ void *callbackState);
+
+/// <summary>
+///     Streams a snapshot of a runtime's heap to a host callback.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Every allocated object is reported as an object record. Objects that can contain references are then
+///     scanned, and each pointer-sized field that refers to the start of a heap object is reported as an edge
+///     record. The scan is conservative: fields that only look like references are reported too.
+///     </para>
+///     <para>
+///     Records are delivered in fixed size chunks, and the walk doesn't allocate from the runtime's heap, so no
+///     garbage collection happens while the snapshot is taken. Object attributes are the internal allocation
+///     attributes of the object, and may change between versions.
+///     </para>
+///     <para>
+///     The runtime must not be active on another thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime whose heap is to be walked.</param>
+/// <param name="callback">The callback that receives the records.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsStreamHeapSnapshot(
+        _In_ JsRuntimeHandle runtime,
+        _In_ JsHeapSnapshotCallback callback,
+        _In_opt_ void *callbackState);
+
+/// <summary>
+///     An allocation site, aggregating the allocation samples taken in one script function at one bytecode offset.
+/// </summary>
+typedef struct _JsAllocationSite
+{
+    /// <summary>
+    ///     The source context of the script that contains the function.
+    /// </summary>
+    JsSourceContext sourceContext;
+    /// <summary>
+    ///     The zero-based line of the start of the function.
+    /// </summary>
+    unsigned int line;
+    /// <summary>
+    ///     The zero-based column of the start of the function.
+    /// </summary>
+    unsigned int column;
+    /// <summary>
+    ///     The bytecode offset within the function that allocated.
+    /// </summary>
+    unsigned int bytecodeOffset;
+    /// <summary>
+    ///     The number of samples taken at this site.
+    /// </summary>
+    size_t sampleCount;
+    /// <summary>
+    ///     The total size of the sampled allocations, in bytes.
+    /// </summary>
+    size_t sampledBytes;
+} JsAllocationSite;
+
+/// <summary>
+///     Called by the runtime for each allocation site of a runtime.
+/// </summary>
+/// <param name="site">The allocation site. It is only valid for the duration of the callback.</param>
+/// <param name="callbackState">The state passed to <c>JsGetAllocationSites</c>.</param>
+typedef void (CHAKRA_CALLBACK * JsAllocationSiteCallback)(
+    _In_ const JsAllocationSite *site,
+    _In_opt_ void *callbackState);
+
+/// <summary>
+///     Starts sampling the allocations of a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Once every <c>sampleInterval</c> bytes allocated, the script function and bytecode offset making the
+///     allocation are recorded. Allocations made by built-in library functions are attributed to the script that
+///     called them, and allocations made outside of script are not recorded. Samples are aggregated by site and
+///     can be retrieved with <c>JsGetAllocationSites</c>.
+///     </para>
+///     <para>
+///     Starting sampling discards the sites recorded before. The runtime must not be active on another thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime whose allocations are to be sampled.</param>
+/// <param name="sampleInterval">The number of bytes allocated between samples. Must be greater than 0.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsStartAllocationSampling(
+        _In_ JsRuntimeHandle runtime,
+        _In_ unsigned int sampleInterval);
+
+/// <summary>
+///     Stops sampling the allocations of a runtime. The sites recorded so far are kept.
+/// </summary>
+/// <param name="runtime">The runtime whose allocations are being sampled.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsStopAllocationSampling(
+        _In_ JsRuntimeHandle runtime);
+
+/// <summary>
+///     Enumerates the allocation sites recorded since allocation sampling was last started.
+/// </summary>
+/// <remarks>
+///     The callback must not call back into the runtime.
+/// </remarks>
+/// <param name="runtime">The runtime whose allocation sites are to be enumerated.</param>
+/// <param name="callback">The callback that receives the allocation sites.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetAllocationSites(
+        _In_ JsRuntimeHandle runtime,
+        _In_ JsAllocationSiteCallback callback,
+        _In_opt_ void *callbackState);
+
+/// <summary>
+///     The statistics of one function or loop body compiled by the JIT.
+/// </summary>
+typedef struct _JsJitCompileStatistics
+{
+    /// <summary>
+    ///     The source context of the script that contains the function.
+    /// </summary>
+    JsSourceContext sourceContext;
+    /// <summary>
+    ///     The zero-based line of the start of the function.
+    /// </summary>
+    unsigned int line;
+    /// <summary>
+    ///     The zero-based column of the start of the function.
+    /// </summary>
+    unsigned int column;
+    /// <summary>
+    ///     Whether a loop body of the function, rather than the whole function, was compiled.
+    /// </summary>
+    bool isLoopBody;
+    /// <summary>
+    ///     The time spent building the IR, including the IR of inlinees, in microseconds.
+    /// </summary>
+    unsigned int irBuilderTime;
+    /// <summary>
+    ///     The time spent in the global optimizer, in microseconds.
+    /// </summary>
+    unsigned int globOptTime;
+    /// <summary>
+    ///     The time spent lowering the IR, in microseconds.
+    /// </summary>
+    unsigned int lowererTime;
+    /// <summary>
+    ///     The time spent in register allocation, in microseconds.
+    /// </summary>
+    unsigned int regAllocTime;
+    /// <summary>
+    ///     The time spent encoding the machine code, in microseconds.
+    /// </summary>
+    unsigned int encoderTime;
+    /// <summary>
+    ///     The size of the emitted machine code, in bytes.
+    /// </summary>
+    unsigned int codeSize;
+    /// <summary>
+    ///     The number of bailouts inserted in the compiled code.
+    /// </summary>
+    unsigned int bailOutCount;
+} JsJitCompileStatistics;
+
+/// <summary>
+///     Called by the runtime each time the JIT completes code for a function or loop body.
+/// </summary>
+/// <remarks>
+///     The callback may be invoked on a background JIT thread and must not call back into the runtime.
+/// </remarks>
+/// <param name="statistics">The compile statistics. They are only valid for the duration of the callback.</param>
+/// <param name="callbackState">The state passed to <c>JsSetRuntimeJitCompileCallback</c>.</param>
+typedef void (CHAKRA_CALLBACK * JsJitCompileCallback)(
+    _In_ const JsJitCompileStatistics *statistics,
+    _In_opt_ void *callbackState);
+
+/// <summary>
+///     Sets a callback that receives the statistics of every function and loop body the JIT compiles.
+/// </summary>
+/// <remarks>
+///     Compilations in flight report to whichever callback is set when they complete. When this returns, no call
+///     to the previous callback is still running, so its state can be released.
+/// </remarks>
+/// <param name="runtime">The runtime whose compilations are to be reported.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <param name="jitCompileCallback">The callback, or <c>nullptr</c> to stop reporting.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeJitCompileCallback(
+        _In_ JsRuntimeHandle runtime,
+        _In_opt_ void *callbackState,
+        _In_opt_ JsJitCompileCallback jitCompileCallback);
+
+/// <summary>
+///     Sets whether the current script context keeps promise reaction jobs in an engine queue.
+/// </summary>
+/// <remarks>
+///     <para>
+///     While the queue is enabled, jobs are not passed to the callback set by
+///     <c>JsSetPromiseContinuationCallback</c>. The host runs them all with a single call to
+///     <c>JsRunPromiseTasks</c>, which avoids a host transition per job.
+///     </para>
+///     <para>
+///     Jobs queued before the queue is disabled stay queued until <c>JsRunPromiseTasks</c> runs them.
+///     The queue cannot be enabled while the runtime is recording or replaying time travel traces.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="enabled">Whether promise jobs are kept in the engine queue.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetPromiseTaskQueueEnabled(
+        _In_ bool enabled);
+
+/// <summary>
+///     Runs the promise reaction jobs in the engine queue of the current script context.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Jobs are run in the order they were queued, including jobs queued by the jobs being run, until the
+///     queue is empty. If a job throws, the call returns <c>JsErrorScriptException</c> and the jobs after
+///     it stay queued.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="taskCount">The number of jobs that were run, including a job that threw.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsRunPromiseTasks(
+        _Out_opt_ unsigned int *taskCount);
+
+/// <summary>
+///     A handle to the backing store of an ArrayBuffer that has been detached from its object.
+/// </summary>
+typedef void *JsArrayBufferContents;
+
+/// <summary>
+///     Detaches an ArrayBuffer and hands its backing store to the caller without copying it.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The ArrayBuffer and all its views have a length of 0 afterwards. The contents can be
+///     attached to an ArrayBuffer in any context or runtime with <c>JsCreateArrayBufferFromContents</c>,
+///     or released with <c>JsReleaseArrayBufferContents</c>. Exactly one of the two must be called.
+///     </para>
+///     <para>
+///     Only array buffers allocated by the engine or created with <c>JsCreateExternalArrayBuffer</c>
+///     can be detached. The finalize callback of an external array buffer moves with its contents.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="arrayBuffer">The ArrayBuffer to detach.</param>
+/// <param name="contents">The detached backing store.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsDetachArrayBuffer(
+        _In_ JsValueRef arrayBuffer,
+        _Out_ JsArrayBufferContents *contents);
+
+/// <summary>
+///     Creates an ArrayBuffer in the current script context that takes over detached contents.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The contents handle is consumed on success and must not be used again. If the call fails,
+///     the handle is still owned by the caller.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="contents">The backing store returned by <c>JsDetachArrayBuffer</c>.</param>
+/// <param name="result">The new ArrayBuffer.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateArrayBufferFromContents(
+        _In_ JsArrayBufferContents contents,
+        _Out_ JsValueRef *result);
+
+/// <summary>
+///     Frees detached ArrayBuffer contents that will not be attached to another ArrayBuffer.
+/// </summary>
+/// <remarks>
+///     Does not require a script context. The finalize callback of external contents is called.
+/// </remarks>
+/// <param name="contents">The backing store returned by <c>JsDetachArrayBuffer</c>.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsReleaseArrayBufferContents(
+        _In_ JsArrayBufferContents contents);
+
+/// <summary>
+///     Gets several properties of an object in one call.
+/// </summary>
+/// <remarks>
+///     <para>
+///     This is equivalent to calling <c>JsGetProperty</c> for each ID in order, but only enters
+///     the script context once.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="object">The object that contains the properties.</param>
+/// <param name="propertyIds">The IDs of the properties. Can be null if <c>count</c> is 0.</param>
+/// <param name="count">The number of property IDs.</param>
+/// <param name="values">Receives the value of each property. Can be null if <c>count</c> is 0.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetProperties(
+        _In_ JsValueRef object,
+        _In_reads_opt_(count) const JsPropertyIdRef *propertyIds,
+        _In_ unsigned int count,
+        _Out_writes_opt_(count) JsValueRef *values);
+
+/// <summary>
+///     Puts several properties of an object in one call.
+/// </summary>
+/// <remarks>
+///     <para>
+///     This is equivalent to calling <c>JsSetProperty</c> for each ID in order, but only enters
+///     the script context once. All arguments are validated before any property is set.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="object">The object that contains the properties.</param>
+/// <param name="propertyIds">The IDs of the properties. Can be null if <c>count</c> is 0.</param>
+/// <param name="values">The new value of each property. Can be null if <c>count</c> is 0.</param>
+/// <param name="count">The number of properties.</param>
+/// <param name="useStrictRules">The property sets should follow strict mode rules.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetProperties(
+        _In_ JsValueRef object,
+        _In_reads_opt_(count) const JsPropertyIdRef *propertyIds,
+        _In_reads_opt_(count) const JsValueRef *values,
+        _In_ unsigned int count,
+        _In_ bool useStrictRules);
+
+/// <summary>
+///     Creates a new object initialized with the given properties, like an object literal.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The object is allocated with inline slots for the properties, and objects created with the
+///     same list of property IDs share the same type.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="propertyIds">The IDs of the properties, in order. Can be null if <c>count</c> is 0.</param>
+/// <param name="values">The value of each property. Can be null if <c>count</c> is 0.</param>
+/// <param name="count">The number of properties.</param>
+/// <param name="object">The new object.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateObjectWithProperties(
+        _In_reads_opt_(count) const JsPropertyIdRef *propertyIds,
+        _In_reads_opt_(count) const JsValueRef *values,
+        _In_ unsigned int count,
+        _Out_ JsValueRef *object);
+
+/// <summary>
+///     A reference to an object template.
+/// </summary>
+/// <remarks>
+///     An object template is garbage collected like other references. Use <c>JsAddRef</c> to keep
+///     it alive across calls that may trigger a collection.
+/// </remarks>
+typedef JsRef JsObjectTemplate;
+
+/// <summary>
+///     Creates a template for objects that all have the same list of properties.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The type of the objects is built once, when the template is created. Each object created from
+///     the template is then a single allocation followed by the property values, with no type
+///     transitions.
+///     </para>
+///     <para>
+///     The template can only be used in the script context it was created in.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="propertyIds">The IDs of the properties, in order. An ID may only appear once.</param>
+/// <param name="count">The number of properties; must be greater than zero.</param>
+/// <param name="objectTemplate">The new object template.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateObjectTemplate(
+        _In_reads_(count) const JsPropertyIdRef *propertyIds,
+        _In_ unsigned int count,
+        _Out_ JsObjectTemplate *objectTemplate);
+
+/// <summary>
+///     Creates a new object from an object template.
+/// </summary>
+/// <remarks>
+///     Requires an active script context.
+/// <param name="objectTemplate">The object template, created by <c>JsCreateObjectTemplate</c> in the current script context.</param>
+/// <param name="objectTemplate">The object template.</param>
+/// <param name="values">The value of each property, in the order given to the template.</param>
+/// <param name="count">The number of values; must match the template.</param>
+/// <param name="object">The new object.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateObjectFromTemplate(
+        _In_ JsObjectTemplate objectTemplate,
+        _In_reads_(count) const JsValueRef *values,
+        _In_ unsigned int count,
+        _Out_ JsValueRef *object);
+
+/// <summary>
+///     Creates a JavascriptString that uses a Utf16 buffer owned by the host, without copying it.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The buffer must hold <c>length</c> characters followed by a null terminator, and must not
+///     change or be freed until the finalize callback is called. The callback is called when the
+///     string is collected. If the string is passed to another script context, that context gets
+///     its own copy.
+///     </para>
+///     <para>
+///     Fails with <c>JsErrorInvalidArgument</c> if the buffer is not null terminated, or if <c>length</c>
+///     is larger than the longest string the engine supports.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="content">Pointer to the null terminated string memory.</param>
+/// <param name="length">Number of characters within the string, not including the terminator.</param>
+/// <param name="finalizeCallback">A callback for when the string is collected.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <param name="value">JsValueRef representing the JavascriptString</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateExternalStringUtf16(
+        _In_reads_(length + 1) const uint16_t *content,
+        _In_ size_t length,
+        _In_opt_ JsFinalizeCallback finalizeCallback,
+        _In_opt_ void *callbackState,
+        _Out_ JsValueRef *value);
+
+/// <summary>
+///     The level of memory pressure reported by <c>JsNotifyMemoryPressure</c>.
+/// </summary>
+typedef enum _JsMemoryPressureLevel
+{
+    /// <summary>
+    ///     Free pages cached by the runtime should be returned to the system. No collection is done.
+    /// </summary>
+    JsMemoryPressureLow = 0,
+    /// <summary>
+    ///     A collection should be done, clearing caches and returning free pages to the system.
+    /// </summary>
+    JsMemoryPressureModerate = 1,
+    /// <summary>
+    ///     An exhaustive collection should be done, clearing caches and returning free pages to the system.
+    /// </summary>
+    JsMemoryPressureCritical = 2
+} JsMemoryPressureLevel;
+
+/// <summary>
+///     Tells a runtime that the process is running low on memory, so that it can release what it is able to.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The amount of work done is proportional to the level. Higher levels release more memory but take
+///     longer. JIT code of functions that are collected is freed along with them.
+///     </para>
+///     <para>
+///     The runtime must not be active on another thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime that should release memory.</param>
+/// <param name="level">The level of memory pressure.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsNotifyMemoryPressure(
+        _In_ JsRuntimeHandle runtime,
+        _In_ JsMemoryPressureLevel level);
+
+/// <summary>
+///     Tells the runtime that the host is idle for the given number of milliseconds, and that it can
+///     do pending idle processing now.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Unlike <c>JsIdle</c>, pending idle work is done right away instead of after the runtime's idle
+///     timeout. In-thread garbage collection pauses of that work are bounded by the deadline, in the
+///     same way as by <c>JsSetRuntimeGCPauseTarget</c>. A pause that takes longer than the deadline is
+///     counted by <c>JsGetRuntimeGCPauseTargetMissCount</c>.
+///     </para>
+///     <para>
+///     Idle processing must be enabled for the current runtime.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="deadline">The number of milliseconds the host is idle for. Must not be 0.</param>
+/// <param name="nextIdleTick">
+///     The next system tick when there will be more idle work to do. Can be null. Returns the
+///     maximum number of ticks if there no upcoming idle work to do.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsIdleWithDeadline(
+        _In_ unsigned int deadline,
+        _Out_opt_ unsigned int *nextIdleTick);
+
+/// <summary>
+///     A callback called once after a collection with the collect tokens of the objects it collected.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Use <c>JsSetRuntimeCollectedObjectsCallback</c> to register this callback, and
+///     <c>JsSetObjectCollectToken</c> to give objects a collect token.
+///     </para>
+///     <para>
+///     The callback is invoked at the end of a collection and must not call back into the runtime.
+///     The tokens are only valid for the duration of the callback.
+///     </para>
+/// </remarks>
+/// <param name="tokens">The collect tokens of the collected objects.</param>
+/// <param name="count">The number of tokens.</param>
+/// <param name="callbackState">The state passed to <c>JsSetRuntimeCollectedObjectsCallback</c>.</param>
+typedef void (CHAKRA_CALLBACK * JsCollectedObjectsCallback)(
+    _In_reads_(count) void * const *tokens,
+    _In_ unsigned int count,
+    _In_opt_ void *callbackState);
+
+/// <summary>
+///     Sets a callback that receives the collect tokens of the objects collected by each collection.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Unlike <c>JsSetObjectBeforeCollectCallback</c>, no host code runs while the collection is in
+///     progress, and collected objects can't be revived. Tokens of objects collected while no callback
+///     is set are dropped.
+///     </para>
+///     <para>
+///     The runtime must not be active on another thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime to register the callback on.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <param name="collectedObjectsCallback">The callback, or null to remove it.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeCollectedObjectsCallback(
+        _In_ JsRuntimeHandle runtime,
+        _In_opt_ void *callbackState,
+        _In_opt_ JsCollectedObjectsCallback collectedObjectsCallback);
+
+/// <summary>
+///     Sets the token that is reported to the <c>JsCollectedObjectsCallback</c> when an object is collected.
+/// </summary>
+/// <remarks>
+///     <para>
+///     An object has at most one collect token. Setting a token again replaces it, and a null token
+///     removes it. The token doesn't keep the object alive.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="ref">The object.</param>
+/// <param name="token">The token to report when the object is collected, or null.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetObjectCollectToken(
+        _In_ JsRef ref,
+        _In_opt_ void *token);
+
+/// <summary>
+///     Points a typed array created over an external ArrayBuffer at a different region of host memory.
+/// </summary>
+/// <remarks>
+///     <para>
+///     This lets a host reuse one typed array for a sequence of buffers, instead of creating an
+///     ArrayBuffer and a typed array for each one. The typed array must be the only view of an ArrayBuffer
+///     created by <c>JsCreateExternalArrayBuffer</c>, and must map all of it. The ArrayBuffer is updated
+///     too, and its previous finalize callback is called before this function returns.
+///     </para>
+///     <para>
+///     <c>byteLength</c> must be a multiple of the typed array's element size. The length of the typed
+///     array becomes <c>byteLength</c> divided by the element size.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="typedArray">The typed array.</param>
+/// <param name="data">A pointer to the new memory. Can be null if <c>byteLength</c> is 0.</param>
+/// <param name="byteLength">The number of bytes of the new memory.</param>
+/// <param name="finalizeCallback">A callback for when the new memory is no longer used by the ArrayBuffer.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsReplaceTypedArrayExternalData(
+        _In_ JsValueRef typedArray,
+        _Pre_maybenull_ _Pre_writable_byte_size_(byteLength) void *data,
+        _In_ unsigned int byteLength,
+        _In_opt_ JsFinalizeCallback finalizeCallback,
+        _In_opt_ void *callbackState);
+
+/// <summary>
+///     A handle to a value serialized with <c>JsSerializeValue</c>.
+/// </summary>
+typedef void *JsSerializedValue;
+
+/// <summary>
+///     Serializes a value so that a copy of it can be created in another script context or runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     This is a structured clone. Primitives other than symbols, plain objects, arrays, dates,
+///     ArrayBuffers and typed arrays are supported, and shared or cyclic references are preserved.
+///     Objects copy their own enumerable string-keyed properties, reading them through any getters.
+///     <c>JsErrorInvalidArgument</c> is returned for any other value, such as a function or a symbol.
+///     </para>
+///     <para>
+///     The array buffers in <c>transferList</c> are detached if serialization succeeds, and their
+///     contents move to the serialized value instead of being copied. They can only be deserialized once.
+///     </para>
+///     <para>
+///     The serialized value must be released with <c>JsReleaseSerializedValue</c>.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="value">The value to serialize.</param>
+/// <param name="transferList">The array buffers to transfer rather than copy. Can be null if <c>transferCount</c> is 0.</param>
+/// <param name="transferCount">The number of array buffers in <c>transferList</c>.</param>
+/// <param name="serializedValue">The serialized value.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSerializeValue(
+        _In_ JsValueRef value,
+        _In_reads_opt_(transferCount) const JsValueRef *transferList,
+        _In_ unsigned int transferCount,
+        _Out_ JsSerializedValue *serializedValue);
+
+/// <summary>
+///     Creates a serialized value from bytes returned by <c>JsGetSerializedValueBuffer</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The bytes are copied. They are only checked when the value is deserialized. Transferred array
+///     buffers can't be recreated this way, so values that transferred any must be passed by handle.
+///     </para>
+///     <para>
+///     Does not require a script context.
+///     </para>
+/// </remarks>
+/// <param name="bytes">The serialized bytes.</param>
+/// <param name="length">The number of serialized bytes.</param>
+/// <param name="serializedValue">The serialized value.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateSerializedValue(
+        _In_reads_bytes_(length) const BYTE *bytes,
+        _In_ unsigned int length,
+        _Out_ JsSerializedValue *serializedValue);
+
+/// <summary>
+///     Gets the bytes of a serialized value, for example to send them to another process.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The bytes are owned by the serialized value and stay valid until it is released. They use the
+///     byte order of the machine that wrote them.
+///     </para>
+///     <para>
+///     Does not require a script context.
+///     </para>
+/// </remarks>
+/// <param name="serializedValue">The serialized value.</param>
+/// <param name="bytes">The serialized bytes.</param>
+/// <param name="length">The number of serialized bytes.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetSerializedValueBuffer(
+        _In_ JsSerializedValue serializedValue,
+        _Outptr_result_bytebuffer_(*length) const BYTE **bytes,
+        _Out_ unsigned int *length);
+
+/// <summary>
+///     Creates a copy of a serialized value in the current script context.
+/// </summary>
+/// <remarks>
+///     <para>
+///     A serialized value can be deserialized any number of times, except that the array buffers it
+///     transferred are handed to the first deserialization only. Malformed bytes fail with
+///     <c>JsErrorInvalidArgument</c>.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="serializedValue">The serialized value.</param>
+/// <param name="result">The copy of the value.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsDeserializeValue(
+        _In_ JsSerializedValue serializedValue,
+        _Out_ JsValueRef *result);
+
+/// <summary>
+///     Releases a serialized value.
+/// </summary>
+/// <remarks>
+///     Does not require a script context. Transferred array buffer contents that were never
+///     deserialized are freed, and the finalize callback of external contents is called.
+/// </remarks>
+/// <param name="serializedValue">The serialized value.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsReleaseSerializedValue(
+        _In_ JsSerializedValue serializedValue);
+
+/// <summary>
+///     Turns per-context CPU time accounting on or off.
+/// </summary>
+/// <remarks>
+///     <para>
+///     While accounting is on, the CPU time of the calling thread is read whenever the host enters and
+///     leaves script, and around garbage collections that run on that thread. The time spent in a call
+///     is charged to the context it was entered in, including calls it makes into other contexts and
+///     collections that happen during it. Accounting is off by default, because reading the thread
+///     clock is a system call on some platforms.
+///     </para>
+///     <para>
+///     Turning accounting off also removes the limit set with <c>JsSetRuntimeScriptCpuTimeLimit</c>.
+///     </para>
+///     <para>
+///     Does not require a script context.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="enabled">Whether CPU time is accounted.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeCpuTimeAccounting(
+        _In_ JsRuntimeHandle runtime,
+        _In_ bool enabled);
+
+/// <summary>
+///     Gets the CPU time spent running script in a context while accounting was on.
+/// </summary>
+/// <remarks>
+///     <para>
+///     A call that is still in progress is included. Must be called on the thread the runtime of the
+///     context is active on, or while the runtime is not active on any thread.
+///     </para>
+/// </remarks>
+/// <param name="context">The script context.</param>
+/// <param name="scriptTime">The CPU time, in microseconds.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetContextCpuTime(
+        _In_ JsContextRef context,
+        _Out_ INT64 *scriptTime);
+
+/// <summary>
+///     Gets the CPU time the runtime's thread spent in garbage collections while accounting was on.
+/// </summary>
+/// <remarks>
+///     Only collections that run to completion on the runtime's thread are counted. Concurrent work done by
+///     the background thread isn't. Can be called from any thread.
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="gcTime">The CPU time, in microseconds.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeGcCpuTime(
+        _In_ JsRuntimeHandle runtime,
+        _Out_ INT64 *gcTime);
+
+/// <summary>
+///     Sets how much CPU time a single call into script may use before <c>JsCheckRuntimeScriptCpuTimeLimit</c>
+///     stops it.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The limit applies to each call from the host into script, and requires CPU time accounting to be on
+///     and the runtime to be created with <c>JsRuntimeAttributeAllowScriptInterrupt</c>. Setting a limit
+///     fails with <c>JsErrorInvalidArgument</c> while accounting is off, and turning accounting off removes
+///     the limit. A limit of 0 removes it.
+///     </para>
+///     <para>
+///     Can be called from any thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="limit">The CPU time limit, in microseconds.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeScriptCpuTimeLimit(
+        _In_ JsRuntimeHandle runtime,
+        _In_ INT64 limit);
+
+/// <summary>
+///     Stops the script running in a runtime if its current call has used up the limit set with
+///     <c>JsSetRuntimeScriptCpuTimeLimit</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///     This is meant to be called periodically by a watchdog thread. It reads the CPU clock of the thread
+///     running script, and if the limit is exceeded, disables execution as <c>JsDisableRuntimeExecution</c>
+///     does. Script notices that at its next function entry or loop iteration through the checks that are
+///     already there for <c>JsDisableRuntimeExecution</c>, so the limit adds no work to running script.
+///     The host has to call <c>JsEnableRuntimeExecution</c> before running script again.
+///     </para>
+///     <para>
+///     Can be called from any thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="exceeded">Whether the limit was exceeded and execution was disabled.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCheckRuntimeScriptCpuTimeLimit(
+        _In_ JsRuntimeHandle runtime,
+        _Out_opt_ bool *exceeded);
+
+/// <summary>
+///     Starts sampling the script call stacks of a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     A background thread asks for a sample once every <c>intervalMilliseconds</c> while script is running,
+///     and the runtime records the script call stack at the next interpreted function entry or call into the
+///     runtime. Samples are therefore taken at those points rather than at arbitrary instructions. Calls
+///     between jitted functions do not reach such a point, so jitted code is only sampled when it calls
+///     into the runtime, and a jitted loop that never does is not sampled at all. Built-in library functions
+///     are attributed to the script that called them. The most recent <c>sampleCapacity</c> samples are kept and can be retrieved with
+///     <c>JsGetRuntimeSamplingProfile</c>.
+///     </para>
+///     <para>
+///     Starting sampling discards the samples recorded before. The runtime must not be active on another
+///     thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime whose script is to be sampled.</param>
+/// <param name="intervalMilliseconds">The time between samples, in milliseconds. Must be greater than 0.</param>
+/// <param name="sampleCapacity">The number of samples to keep. Must be greater than 0.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsStartRuntimeSampling(
+        _In_ JsRuntimeHandle runtime,
+        _In_ unsigned int intervalMilliseconds,
+        _In_ unsigned int sampleCapacity);
+
+/// <summary>
+///     Stops sampling the script call stacks of a runtime. The samples recorded so far are kept.
+/// </summary>
+/// <param name="runtime">The runtime whose script is being sampled.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsStopRuntimeSampling(
+        _In_ JsRuntimeHandle runtime);
+
+/// <summary>
+///     Gets the samples recorded since sampling was last started, as a pprof profile.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The profile is an uncompressed <c>perftools.profiles.Profile</c> protocol buffer, as read by the
+///     pprof tool. Each sample has a count and a CPU time of one sampling interval, and a location for each
+///     script frame with its function, script URL and line.
+///     </para>
+///     <para>
+///     Call with a null buffer to get the size of the profile. The runtime must not be active on another
+///     thread.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime that was sampled.</param>
+/// <param name="buffer">The buffer to write the profile into, or null.</param>
+/// <param name="bufferSize">The size of the buffer, in bytes.</param>
+/// <param name="profileSize">The size of the profile, in bytes.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if the buffer is
+///     too small, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeSamplingProfile(
+        _In_ JsRuntimeHandle runtime,
+        _Out_writes_bytes_opt_(bufferSize) BYTE *buffer,
+        _In_ unsigned int bufferSize,
+        _Out_ unsigned int *profileSize);
+
+/// <summary>
+///     The category of a script context counter.
+/// </summary>
+typedef enum _JsContextCounterCategory
+{
+    /// <summary>
+    ///     The number of bailouts from jitted code, by bailout kind. Bailouts that only check result
+    ///     conditions, such as overflow, are reported as <c>BailOutKindBitsOnly</c>.
+    /// </summary>
+    JsContextCounterBailOut = 0,
+    /// <summary>
+    ///     The number of rejits, by rejit reason.
+    /// </summary>
+    JsContextCounterRejit = 1,
+    /// <summary>
+    ///     The number of inline cache lookups made by the runtime (<c>GetLookups</c>, <c>SetLookups</c>) and
+    ///     how many of them missed every cache (<c>GetMisses</c>, <c>SetMisses</c>). Lookups that hit in
+    ///     jitted code don't reach the runtime and aren't counted.
+    /// </summary>
+    JsContextCounterInlineCache = 2
+} JsContextCounterCategory;
+
+/// <summary>
+///     Called by the runtime for each counter of a script context.
+/// </summary>
+/// <param name="category">The category of the counter.</param>
+/// <param name="name">The name of the counter within its category. It is only valid for the duration of the callback.</param>
+/// <param name="value">The value of the counter.</param>
+/// <param name="callbackState">The state passed to <c>JsGetContextCounters</c>.</param>
+typedef void (CHAKRA_CALLBACK * JsContextCounterCallback)(
+    _In_ JsContextCounterCategory category,
+    _In_z_ const char *name,
+    _In_ INT64 value,
+    _In_opt_ void *callbackState);
+
+/// <summary>
+///     Enumerates the counters of a script context.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The counters are always on and count from the creation of the context. Bailout and rejit counters
+///     are only reported once they are nonzero.
+///     </para>
+///     <para>
+///     The counters are updated by the runtime's thread without synchronization, so this must be called on
+///     that thread. The callback must not call back into the runtime.
+///     </para>
+/// </remarks>
+/// <param name="context">The script context.</param>
+/// <param name="callback">The callback that receives the counters.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetContextCounters(
+        _In_ JsContextRef context,
+        _In_ JsContextCounterCallback callback,
+        _In_opt_ void *callbackState);
+
+/// <summary>
+///     The time a runtime's garbage collector spent in its mark and sweep phases.
+/// </summary>
+typedef struct _JsGcPhaseTimes
+{
+    /// <summary>
+    ///     The number of collections started.
+    /// </summary>
+    INT64 collectionCount;
+    /// <summary>
+    ///     The time spent marking on the runtime's thread, in microseconds.
+    /// </summary>
+    INT64 markTime;
+    /// <summary>
+    ///     The time spent sweeping on the runtime's thread, in microseconds.
+    /// </summary>
+    INT64 sweepTime;
+    /// <summary>
+    ///     The time spent marking on the background thread, in microseconds.
+    /// </summary>
+    INT64 backgroundMarkTime;
+    /// <summary>
+    ///     The time spent sweeping on the background thread, in microseconds.
+    /// </summary>
+    INT64 backgroundSweepTime;
+} JsGcPhaseTimes;
+
+/// <summary>
+///     Gets the time a runtime's garbage collector spent in its mark and sweep phases.
+/// </summary>
+/// <remarks>
+///     The times are elapsed time, always on, and count from the creation of the runtime. Can be called from
+///     any thread, in which case the times of a collection in progress may not be up to date.
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="phaseTimes">The phase times.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeGcPhaseTimes(
+        _In_ JsRuntimeHandle runtime,
+        _Out_ JsGcPhaseTimes *phaseTimes);
+
+/// <summary>
+///     A perf hint: a place where the runtime had to produce slower code than it could have.
+/// </summary>
+/// <remarks>
+///     The strings are only valid for the duration of the callback.
+/// </remarks>
+typedef struct _JsPerfHint
+{
+    /// <summary>
+    ///     A stable identifier of the kind of hint, such as <c>"HasTryBlock"</c>.
+    /// </summary>
+    const char *name;
+    /// <summary>
+    ///     What was found in the code.
+    /// </summary>
+    const uint16_t *description;
+    /// <summary>
+    ///     What it costs.
+    /// </summary>
+    const uint16_t *consequences;
+    /// <summary>
+    ///     How the code can be changed to avoid it.
+    /// </summary>
+    const uint16_t *suggestion;
+    /// <summary>
+    ///     Whether the function is left unoptimized, rather than optimized less well.
+    /// </summary>
+    bool isNotOptimized;
+    /// <summary>
+    ///     The source context of the script that contains the function.
+    /// </summary>
+    JsSourceContext sourceContext;
+    /// <summary>
+    ///     The url of the script, or <c>nullptr</c> for dynamic code such as <c>eval</c>.
+    /// </summary>
+    const uint16_t *sourceUrl;
+    /// <summary>
+    ///     The display name of the function.
+    /// </summary>
+    const uint16_t *functionName;
+    /// <summary>
+    ///     The zero-based line of the code the hint is about, or of the start of the function.
+    /// </summary>
+    unsigned int line;
+    /// <summary>
+    ///     The zero-based column of the code the hint is about, or of the start of the function.
+    /// </summary>
+    unsigned int column;
+    /// <summary>
+    ///     The number of hints dropped by the rate limit since the last one was reported.
+    /// </summary>
+    unsigned int droppedCount;
+} JsPerfHint;
+
+/// <summary>
+///     Called by the runtime for each perf hint.
+/// </summary>
+/// <remarks>
+///     The callback may be invoked on a background JIT thread and must not call back into the runtime.
+/// </remarks>
+/// <param name="perfHint">The hint. It is only valid for the duration of the callback.</param>
+/// <param name="callbackState">The state passed to <c>JsSetRuntimePerfHintCallback</c>.</param>
+typedef void (CHAKRA_CALLBACK * JsPerfHintCallback)(
+    _In_ const JsPerfHint *perfHint,
+    _In_opt_ void *callbackState);
+
+/// <summary>
+///     Sets a callback that receives the perf hints of a runtime, such as functions that are not optimized
+///     because they contain a <c>try</c> block, or <c>arguments</c> objects that could not be kept on the stack.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Only the critical hints are reported, and at most <c>maxHintsPerSecond</c> of them in each second; the
+///     number dropped in between is given with the next reported hint. Most hints are found when code is
+///     compiled, so the same function is usually reported once per tier rather than on every call.
+///     </para>
+///     <para>
+///     Hints are not reported for code compiled by an out of process JIT.
+///     </para>
+///     <para>
+///     When this returns, no call to the previous callback is still running, so its state can be released.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime whose hints are to be reported.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <param name="perfHintCallback">The callback, or <c>nullptr</c> to stop reporting.</param>
+/// <param name="maxHintsPerSecond">The most hints to report in each second.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimePerfHintCallback(
+        _In_ JsRuntimeHandle runtime,
+        _In_opt_ void *callbackState,
+        _In_opt_ JsPerfHintCallback perfHintCallback,
+        _In_ unsigned int maxHintsPerSecond);
+
+/// <summary>
+///     The memory held by a function for its bytecode, inline caches and jitted code.
+/// </summary>
+/// <remarks>
+///     The strings are only valid for the duration of the callback.
+/// </remarks>
+typedef struct _JsFunctionMemoryUsage
+{
+    /// <summary>
+    ///     The source context of the script that contains the function.
+    /// </summary>
+    JsSourceContext sourceContext;
+    /// <summary>
+    ///     The display name of the function.
+    /// </summary>
+    const uint16_t *functionName;
+    /// <summary>
+    ///     The zero-based line of the start of the function.
+    /// </summary>
+    unsigned int line;
+    /// <summary>
+    ///     The zero-based column of the start of the function.
+    /// </summary>
+    unsigned int column;
+    /// <summary>
+    ///     The size of the bytecode, in bytes.
+    /// </summary>
+    size_t byteCodeSize;
+    /// <summary>
+    ///     The size of the constant and auxiliary data the bytecode refers to, in bytes.
+    /// </summary>
+    size_t auxiliaryDataSize;
+    /// <summary>
+    ///     An estimate of the size of the inline caches, in bytes, from their number.
+    /// </summary>
+    size_t inlineCacheSize;
+    /// <summary>
+    ///     The size of the jitted code of all of the function's entry points, including loop bodies, in bytes.
+    /// </summary>
+    size_t nativeCodeSize;
+    /// <summary>
+    ///     The size of the data the jitted code refers to, such as constants, guards and inlinee frame records,
+    ///     in bytes.
+    /// </summary>
+    size_t nativeDataSize;
+    /// <summary>
+    ///     The number of entry points, including loop bodies, that have jitted code.
+    /// </summary>
+    unsigned int nativeEntryPointCount;
+} JsFunctionMemoryUsage;
+
+/// <summary>
+///     Called by the runtime for each function of a script context.
+/// </summary>
+/// <param name="usage">The memory usage of the function. It is only valid for the duration of the callback.</param>
+/// <param name="callbackState">The state passed to <c>JsGetContextFunctionMemoryUsage</c>.</param>
+typedef void (CHAKRA_CALLBACK * JsFunctionMemoryUsageCallback)(
+    _In_ const JsFunctionMemoryUsage *usage,
+    _In_opt_ void *callbackState);
+
+/// <summary>
+///     Enumerates the memory usage of each function of a script context.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Only functions that have been compiled to bytecode are reported; deferred functions that have not
+///     been called yet hold no bytecode.
+///     </para>
+///     <para>
+///     This must be called on the runtime's thread. The callback must not call back into the runtime.
+///     </para>
+/// </remarks>
+/// <param name="context">The script context.</param>
+/// <param name="callback">The callback that receives the memory usage of each function.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetContextFunctionMemoryUsage(
+        _In_ JsContextRef context,
+        _In_ JsFunctionMemoryUsageCallback callback,
+        _In_opt_ void *callbackState);
+
+/// <summary>
+///     Sets the code aging policy of a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     By default, the jitted code of functions that are no longer called is only discarded once the runtime's
+///     native code approaches its limit. With a non-zero <c>gcCount</c>, the jitted code of functions that were
+///     not called during the last <c>gcCount</c> collections is discarded regardless; the functions go back to
+///     the interpreter and may be jitted again if they become hot.
+///     </para>
+///     <para>
+///     Code is never discarded while a debugger is attaching, or for functions that are on the stack.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="gcCount">The number of collections after which unused code is discarded, or 0 for the default.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeCodeAgingPolicy(
+        _In_ JsRuntimeHandle runtime,
+        _In_ unsigned int gcCount);
+
+/// <summary>
+///     Sets the redeferral policy of a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Redeferral discards the bytecode, inline caches, profile data and jitted code of functions that are no
+///     longer called, and reverts them to the state they were in before their first call; they are parsed
+///     again if they are called later. By default, the runtime checks for such functions at intervals it picks
+///     from the number of collections since it started. With a non-zero <c>gcCount</c>, it checks every
+///     <c>gcCount</c> collections, and redefers the functions that were not called since the last check.
+///     </para>
+///     <para>
+///     Functions that are on the stack, that other functions' jitted code has inlined, or whose script context
+///     is being debugged are not redeferred. Functions recompiled several times need proportionally longer
+///     without calls before they are redeferred.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="gcCount">The number of collections between checks, or 0 for the default.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeRedeferralPolicy(
+        _In_ JsRuntimeHandle runtime,
+        _In_ unsigned int gcCount);
 #endif // NTBUILD
 #endif // _CHAKRACORE_H_
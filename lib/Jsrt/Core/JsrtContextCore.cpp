@@ -120,6 +120,48 @@ HRESULT ChakraCoreHostScriptContext::FetchImportedModule(Js::ModuleRecordBase* r
     return E_INVALIDARG;
 }
 
+HRESULT ChakraCoreHostScriptContext::FetchImportedModules(Js::ModuleRecordBase* referencingModule, uint specifierCount, LPCOLESTR const* specifiers, Js::ModuleRecordBase** dependentModuleRecords)
+{
+    if (fetchImportedModulesCallback == nullptr)
+    {
+        // Hosts that only registered the single specifier callback get one call per specifier.
+        for (uint i = 0; i < specifierCount; i++)
+        {
+            HRESULT hr = FetchImportedModule(referencingModule, specifiers[i], &dependentModuleRecords[i]);
+            if (FAILED(hr))
+            {
+                return hr;
+            }
+        }
+        return NOERROR;
+    }
+
+    Js::ScriptContext* scriptContext = GetScriptContext();
+    Recycler* recycler = scriptContext->GetRecycler();
+    // Allocated from the recycler so the specifier strings stay alive while the host runs.
+    Js::Var* specifierVars = RecyclerNewArrayZ(recycler, Js::Var, specifierCount);
+    for (uint i = 0; i < specifierCount; i++)
+    {
+        specifierVars[i] = Js::JavascriptString::NewCopySz(specifiers[i], scriptContext);
+    }
+    {
+        AUTO_NO_EXCEPTION_REGION;
+        JsErrorCode errorCode = fetchImportedModulesCallback(referencingModule, specifierCount, specifierVars, reinterpret_cast<JsModuleRecord*>(dependentModuleRecords));
+        if (errorCode == JsNoError)
+        {
+            for (uint i = 0; i < specifierCount; i++)
+            {
+                if (dependentModuleRecords[i] == nullptr)
+                {
+                    return E_INVALIDARG;
+                }
+            }
+            return NOERROR;
+        }
+    }
+    return E_INVALIDARG;
+}
+
 HRESULT ChakraCoreHostScriptContext::NotifyHostAboutModuleReady(Js::ModuleRecordBase* referencingModule, Js::Var exceptionVar)
 {
     if (notifyModuleReadyCallback == nullptr)
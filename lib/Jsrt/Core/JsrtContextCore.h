@@ -28,7 +28,8 @@ public:
     ChakraCoreHostScriptContext(Js::ScriptContext* scriptContext)
         : HostScriptContext(scriptContext),
         notifyModuleReadyCallback(nullptr),
-        fetchImportedModuleCallback(nullptr)
+        fetchImportedModuleCallback(nullptr),
+        fetchImportedModulesCallback(nullptr)
     {
     }
     ~ChakraCoreHostScriptContext()
@@ -167,6 +168,8 @@ public:
 
     HRESULT FetchImportedModule(Js::ModuleRecordBase* referencingModule, LPCOLESTR specifier, Js::ModuleRecordBase** dependentModuleRecord) override;
 
+    HRESULT FetchImportedModules(Js::ModuleRecordBase* referencingModule, uint specifierCount, LPCOLESTR const* specifiers, Js::ModuleRecordBase** dependentModuleRecords) override;
+
     HRESULT NotifyHostAboutModuleReady(Js::ModuleRecordBase* referencingModule, Js::Var exceptionVar) override;
 
     void SetNotifyModuleReadyCallback(NotifyModuleReadyCallback notifyCallback) { this->notifyModuleReadyCallback = notifyCallback; }
@@ -175,6 +178,9 @@ public:
     void SetFetchImportedModuleCallback(FetchImportedModuleCallBack fetchCallback) { this->fetchImportedModuleCallback = fetchCallback ; }
     FetchImportedModuleCallBack GetFetchImportedModuleCallback() const { return this->fetchImportedModuleCallback; }
 
+    void SetFetchImportedModulesCallback(FetchImportedModulesCallBack fetchCallback) { this->fetchImportedModulesCallback = fetchCallback; }
+    FetchImportedModulesCallBack GetFetchImportedModulesCallback() const { return this->fetchImportedModulesCallback; }
+
 #if DBG_DUMP || defined(PROFILE_EXEC) || defined(PROFILE_MEM)
     void EnsureParentInfo(Js::ScriptContext* scriptContext = NULL) override
     {
@@ -185,5 +191,6 @@ public:
 
 private:
     FetchImportedModuleCallBack fetchImportedModuleCallback;
+    FetchImportedModulesCallBack fetchImportedModulesCallback;
     NotifyModuleReadyCallback notifyModuleReadyCallback;
 };
@@ -162,6 +162,9 @@ JsSetModuleHostInfo(
         case JsModuleHostInfo_FetchImportedModuleCallback:
             currentContext->GetHostScriptContext()->SetFetchImportedModuleCallback(static_cast<FetchImportedModuleCallBack>(hostInfo));
             break;
+        case JsModuleHostInfo_FetchImportedModulesCallback:
+            currentContext->GetHostScriptContext()->SetFetchImportedModulesCallback(static_cast<FetchImportedModulesCallBack>(hostInfo));
+            break;
         case JsModuleHostInfo_NotifyModuleReadyCallback:
             currentContext->GetHostScriptContext()->SetNotifyModuleReadyCallback(static_cast<NotifyModuleReadyCallback>(hostInfo));
             break;
@@ -203,6 +206,9 @@ JsGetModuleHostInfo(
         case JsModuleHostInfo_FetchImportedModuleCallback:
             *hostInfo = currentContext->GetHostScriptContext()->GetFetchImportedModuleCallback();
             break;
+        case JsModuleHostInfo_FetchImportedModulesCallback:
+            *hostInfo = currentContext->GetHostScriptContext()->GetFetchImportedModulesCallback();
+            break;
         case JsModuleHostInfo_NotifyModuleReadyCallback:
             *hostInfo = currentContext->GetHostScriptContext()->GetNotifyModuleReadyCallback();
             break;
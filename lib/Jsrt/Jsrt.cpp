@@ -6,6 +6,7 @@
 #include "JsrtInternal.h"
 #include "JsrtExternalObject.h"
 #include "JsrtExternalArrayBuffer.h"
+#include "JsrtExternalString.h"
 #include "jsrtHelper.h"
 
 #include "JsrtSourceHolder.h"
@@ -247,7 +248,8 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
             JsRuntimeAttributeDisableEval |
             JsRuntimeAttributeDisableNativeCodeGeneration |
             JsRuntimeAttributeEnableExperimentalFeatures |
-            JsRuntimeAttributeDispatchSetExceptionsToDebugger
+            JsRuntimeAttributeDispatchSetExceptionsToDebugger |
+            JsRuntimeAttributeShareJitThreadPool
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
             | JsRuntimeAttributeSerializeLibraryByteCode
 #endif
@@ -274,6 +276,12 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
             threadContext->EnableBgJit(false);
 #endif
         }
+#if ENABLE_NATIVE_CODEGEN
+        else if (attributes & JsRuntimeAttributeShareJitThreadPool)
+        {
+            threadContext->ShareJitThreadPool(true);
+        }
+#endif
 
         if (!threadContext->IsRentalThreadingEnabledInJSRT()
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
@@ -495,6 +503,9 @@ CHAKRA_API JsDisposeRuntime(_In_ JsRuntimeHandle runtimeHandle)
         }
 #endif
 
+#ifndef NTBUILD
+        runtime->SetCollectedObjectsCallback(nullptr, nullptr);
+#endif
         runtime->SetBeforeCollectCallback(nullptr, nullptr);
         threadContext->CloseForJSRT();
         HeapDelete(threadContext);
@@ -1568,6 +1579,59 @@ CHAKRA_API JsCreateExternalArrayBuffer(_Pre_maybenull_ _Pre_writable_byte_size_(
     });
 }
 
+static Js::JavascriptFunction* GetTypedArrayConstructor(Js::JavascriptLibrary* library, JsTypedArrayType arrayType)
+{
+    switch (arrayType)
+    {
+    case JsArrayTypeInt8:
+        return library->GetInt8ArrayConstructor();
+    case JsArrayTypeUint8:
+        return library->GetUint8ArrayConstructor();
+    case JsArrayTypeUint8Clamped:
+        return library->GetUint8ClampedArrayConstructor();
+    case JsArrayTypeInt16:
+        return library->GetInt16ArrayConstructor();
+    case JsArrayTypeUint16:
+        return library->GetUint16ArrayConstructor();
+    case JsArrayTypeInt32:
+        return library->GetInt32ArrayConstructor();
+    case JsArrayTypeUint32:
+        return library->GetUint32ArrayConstructor();
+    case JsArrayTypeFloat32:
+        return library->GetFloat32ArrayConstructor();
+    case JsArrayTypeFloat64:
+        return library->GetFloat64ArrayConstructor();
+    default:
+        return nullptr;
+    }
+}
+
+static uint32 GetTypedArrayElementSize(JsTypedArrayType arrayType)
+{
+    switch (arrayType)
+    {
+    case JsArrayTypeInt8:
+        return sizeof(int8);
+    case JsArrayTypeUint8:
+    case JsArrayTypeUint8Clamped:
+        return sizeof(uint8);
+    case JsArrayTypeInt16:
+        return sizeof(int16);
+    case JsArrayTypeUint16:
+        return sizeof(uint16);
+    case JsArrayTypeInt32:
+        return sizeof(int32);
+    case JsArrayTypeUint32:
+        return sizeof(uint32);
+    case JsArrayTypeFloat32:
+        return sizeof(float);
+    case JsArrayTypeFloat64:
+        return sizeof(double);
+    default:
+        return 0;
+    }
+}
+
 CHAKRA_API JsCreateTypedArray(_In_ JsTypedArrayType arrayType, _In_ JsValueRef baseArray, _In_ unsigned int byteOffset,
     _In_ unsigned int elementLength, _Out_ JsValueRef *result)
 {
@@ -1594,7 +1658,6 @@ CHAKRA_API JsCreateTypedArray(_In_ JsTypedArrayType arrayType, _In_ JsValueRef b
             return JsErrorInvalidArgument;
         }
 
-        Js::JavascriptFunction* constructorFunc = nullptr;
         Js::Var values[4] =
         {
             library->GetUndefined(),
@@ -1609,36 +1672,9 @@ CHAKRA_API JsCreateTypedArray(_In_ JsTypedArrayType arrayType, _In_ JsValueRef b
         Js::CallInfo info(Js::CallFlags_New, fromArrayBuffer ? 4 : 2);
         Js::Arguments args(info, values);
 
-        switch (arrayType)
+        Js::JavascriptFunction* constructorFunc = GetTypedArrayConstructor(library, arrayType);
+        if (constructorFunc == nullptr)
         {
-        case JsArrayTypeInt8:
-            constructorFunc = library->GetInt8ArrayConstructor();
-            break;
-        case JsArrayTypeUint8:
-            constructorFunc = library->GetUint8ArrayConstructor();
-            break;
-        case JsArrayTypeUint8Clamped:
-            constructorFunc = library->GetUint8ClampedArrayConstructor();
-            break;
-        case JsArrayTypeInt16:
-            constructorFunc = library->GetInt16ArrayConstructor();
-            break;
-        case JsArrayTypeUint16:
-            constructorFunc = library->GetUint16ArrayConstructor();
-            break;
-        case JsArrayTypeInt32:
-            constructorFunc = library->GetInt32ArrayConstructor();
-            break;
-        case JsArrayTypeUint32:
-            constructorFunc = library->GetUint32ArrayConstructor();
-            break;
-        case JsArrayTypeFloat32:
-            constructorFunc = library->GetFloat32ArrayConstructor();
-            break;
-        case JsArrayTypeFloat64:
-            constructorFunc = library->GetFloat64ArrayConstructor();
-            break;
-        default:
             return JsErrorInvalidArgument;
         }
 
@@ -2882,7 +2918,15 @@ JsErrorCode RunScriptCore(JsValueRef scriptSource, const byte *script, size_t cb
 
         if (sourceContextInfo == nullptr)
         {
-            sourceContextInfo = scriptContext->CreateSourceContextInfo(sourceContext, sourceUrl, wcslen(sourceUrl), nullptr);
+            uint sourceHash = 0;
+#ifdef DYNAMIC_PROFILE_STORAGE
+            if (CONFIG_FLAG(DynamicProfileCacheBySourceHash))
+            {
+                sourceHash = SourceContextInfo::ComputeSourceHash(script, cb);
+            }
+#endif
+            sourceContextInfo = scriptContext->CreateSourceContextInfo(sourceContext, sourceUrl, wcslen(sourceUrl), nullptr,
+                nullptr, 0, sourceHash, sourceHash != 0 ? cb : 0);
         }
 
         const int chsize = (loadScriptFlag & LoadScriptFlag_Utf8Source) ?
@@ -4105,13 +4149,28 @@ CHAKRA_API JsCreateStringUtf8(
 {
     PARAM_NOT_NULL(content);
 
-    utf8::NarrowToWide wstr((LPCSTR)content, length);
-    if (!wstr)
-    {
-        return JsErrorOutOfMemory;
-    }
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PARAM_NOT_NULL(value);
+
+        // A UTF8 buffer never decodes to more characters than it has bytes
+        if (!Js::IsValidCharCount(length))
+        {
+            Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
+        }
 
-    return JsPointerToString(wstr, wstr.Length(), value);
+        // Decode straight into the string's buffer instead of going through a temporary UTF16 copy
+        charcount_t charLength = utf8::ByteIndexIntoCharacterIndex(content, length);
+        char16* buffer = RecyclerNewArrayLeaf(scriptContext->GetRecycler(), char16, charLength + 1);
+        utf8::DecodeIntoAndNullTerminate(buffer, content, charLength, utf8::doAllowInvalidWCHARs);
+
+        PERFORM_JSRT_TTD_RECORD_ACTION(scriptContext, RecordJsRTCreateString, buffer, charLength);
+
+        *value = Js::JavascriptString::NewWithBuffer(buffer, charLength, scriptContext);
+
+        PERFORM_JSRT_TTD_RECORD_ACTION_RESULT(scriptContext, value);
+
+        return JsNoError;
+    });
 }
 
 CHAKRA_API JsCreateStringUtf16(
@@ -4553,4 +4612,1982 @@ CHAKRA_API JsRunSerialized(
         sourceContext, // use the same user provided sourceContext as scriptLoadSourceContext
         buffer, bufferVal, sourceContext, url, false, result);
 }
+
+CHAKRA_API JsSetRuntimeGCPauseTarget(_In_ JsRuntimeHandle runtimeHandle, _In_ unsigned int pauseTarget)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->EnsureRecycler()->SetPauseTarget(pauseTarget);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetRuntimeGCPauseTargetMissCount(_In_ JsRuntimeHandle runtimeHandle, _Out_ unsigned int *missCount)
+{
+    PARAM_NOT_NULL(missCount);
+    *missCount = 0;
+
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Recycler * recycler = threadContext->GetRecycler();
+        if (recycler != nullptr)
+        {
+            *missCount = recycler->GetPauseTargetMissCount();
+        }
+        return JsNoError;
+    });
+}
+
+class JsrtHeapSnapshotWriter
+{
+public:
+    JsrtHeapSnapshotWriter(Recycler * recycler, JsHeapSnapshotCallback callback, void * callbackState) :
+        recycler(recycler), callback(callback), callbackState(callbackState), recordCount(0)
+    {
+    }
+
+    static void ObjectCallback(void * address, size_t size, ObjectInfoBits attributes, void * context)
+    {
+        ((JsrtHeapSnapshotWriter *)context)->WriteObject(address, size, attributes);
+    }
+
+    void Flush()
+    {
+        if (recordCount != 0)
+        {
+            callback(records, recordCount, callbackState);
+            recordCount = 0;
+        }
+    }
+
+private:
+    // Records are buffered on the stack so that the heap walk doesn't allocate
+    static const uint ChunkRecordCount = 256;
+
+    void WriteObject(void * address, size_t size, ObjectInfoBits attributes)
+    {
+        WriteRecord(JsHeapSnapshotRecordObject, attributes, address, nullptr, size);
+
+        if ((attributes & LeafBit) != 0)
+        {
+            return;
+        }
+
+        // Conservatively report every aligned field that points to the start of a heap object
+        void ** fields = (void **)address;
+        size_t fieldCount = size / sizeof(void *);
+        for (size_t i = 0; i < fieldCount; i++)
+        {
+            void * candidate = fields[i];
+            if (candidate != nullptr && candidate != address && recycler->IsValidObject(candidate))
+            {
+                WriteRecord(JsHeapSnapshotRecordEdge, 0, address, candidate, i * sizeof(void *));
+            }
+        }
+    }
+
+    void WriteRecord(JsHeapSnapshotRecordKind kind, unsigned int attributes, void * address, void * target, size_t size)
+    {
+        JsHeapSnapshotRecord& record = records[recordCount];
+        record.kind = kind;
+        record.attributes = attributes;
+        record.address = address;
+        record.target = target;
+        record.size = size;
+
+        if (++recordCount == ChunkRecordCount)
+        {
+            Flush();
+        }
+    }
+
+    Recycler * recycler;
+    JsHeapSnapshotCallback callback;
+    void * callbackState;
+    uint recordCount;
+    JsHeapSnapshotRecord records[ChunkRecordCount];
+};
+
+CHAKRA_API JsStreamHeapSnapshot(_In_ JsRuntimeHandle runtimeHandle, _In_ JsHeapSnapshotCallback callback, _In_opt_ void *callbackState)
+{
+    PARAM_NOT_NULL(callback);
+
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->GetRecycler() && threadContext->GetRecycler()->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Recycler * recycler = threadContext->EnsureRecycler();
+        JsrtHeapSnapshotWriter writer(recycler, callback, callbackState);
+        recycler->EnumerateObjects(NoBit, &JsrtHeapSnapshotWriter::ObjectCallback, &writer);
+        writer.Flush();
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsStartAllocationSampling(_In_ JsRuntimeHandle runtimeHandle, _In_ unsigned int sampleInterval)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        if (sampleInterval == 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->GetRecycler() && threadContext->GetRecycler()->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->EnsureAllocationSiteProfiler()->Start(sampleInterval);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsStopAllocationSampling(_In_ JsRuntimeHandle runtimeHandle)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->GetRecycler() && threadContext->GetRecycler()->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Js::AllocationSiteProfiler * profiler = threadContext->GetAllocationSiteProfiler();
+        if (profiler != nullptr)
+        {
+            profiler->Stop();
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetAllocationSites(_In_ JsRuntimeHandle runtimeHandle, _In_ JsAllocationSiteCallback callback, _In_opt_ void *callbackState)
+{
+    PARAM_NOT_NULL(callback);
+
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->GetRecycler() && threadContext->GetRecycler()->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        // The sites are updated by allocations on the runtime's thread
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Js::AllocationSiteProfiler * profiler = threadContext->GetAllocationSiteProfiler();
+        if (profiler != nullptr)
+        {
+            profiler->MapSites([&](Js::AllocationSiteProfiler::SiteKey const& key, Js::AllocationSiteProfiler::SiteData const& data)
+            {
+                JsAllocationSite site;
+                site.sourceContext = (JsSourceContext)key.sourceContext;
+                site.line = key.line;
+                site.column = key.column;
+                site.bytecodeOffset = key.bytecodeOffset;
+                site.sampleCount = data.sampleCount;
+                site.sampledBytes = data.sampledBytes;
+                callback(&site, callbackState);
+            });
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSetRuntimeJitCompileCallback(_In_ JsRuntimeHandle runtimeHandle, _In_opt_ void *callbackState, _In_opt_ JsJitCompileCallback jitCompileCallback)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        JsrtRuntime::FromHandle(runtimeHandle)->SetJitCompileCallback(jitCompileCallback, callbackState);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSetPromiseTaskQueueEnabled(_In_ bool enabled)
+{
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext * scriptContext) -> JsErrorCode {
+#if ENABLE_TTD
+        // Jobs in the engine queue are not recorded as host enqueue events, so they can't be replayed
+        if (enabled && scriptContext->GetThreadContext()->IsRuntimeInTTDMode())
+        {
+            return JsErrorNotImplemented;
+        }
+#endif
+
+        scriptContext->GetLibrary()->SetUseEngineTaskQueue(enabled);
+        return JsNoError;
+    },
+    /*allowInObjectBeforeCollectCallback*/true);
+}
+
+CHAKRA_API JsRunPromiseTasks(_Out_opt_ unsigned int *taskCount)
+{
+    if (taskCount != nullptr)
+    {
+        *taskCount = 0;
+    }
+
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        Js::JavascriptLibrary* library = scriptContext->GetLibrary();
+        Js::Var task;
+        while ((task = library->DequeueEngineTask()) != nullptr)
+        {
+            if (taskCount != nullptr)
+            {
+                (*taskCount)++;
+            }
+
+            Js::Var undefined = library->GetUndefined();
+            Js::Arguments args(Js::CallInfo(1), &undefined);
+            Js::JavascriptFunction::FromVar(task)->CallRootFunction(args, scriptContext, true);
+        }
+
+        return JsNoError;
+    });
+}
+
+static bool CanDetachArrayBufferContents(Js::ArrayBuffer* arrayBuffer)
+{
+    // Other array buffers either don't own their memory or own it in a way no other context can free
+    return VirtualTableInfo<Js::JavascriptArrayBuffer>::HasVirtualTable(arrayBuffer) ||
+        VirtualTableInfo<Js::CrossSiteObject<Js::JavascriptArrayBuffer>>::HasVirtualTable(arrayBuffer) ||
+        VirtualTableInfo<Js::JsrtExternalArrayBuffer>::HasVirtualTable(arrayBuffer) ||
+        VirtualTableInfo<Js::CrossSiteObject<Js::JsrtExternalArrayBuffer>>::HasVirtualTable(arrayBuffer);
+}
+
+static Js::ArrayBufferDetachedStateBase* DetachArrayBufferContents(Js::ScriptContext* scriptContext, Js::ArrayBuffer* arrayBuffer)
+{
+    Assert(!arrayBuffer->IsDetached() && CanDetachArrayBufferContents(arrayBuffer));
+
+    uint32 byteLength = arrayBuffer->GetByteLength();
+    Js::ArrayBufferDetachedStateBase* state = arrayBuffer->DetachAndGetState();
+    if (state->allocationType != Js::ArrayBufferAllocationType::External)
+    {
+        // The memory is reported again to the recycler of the context that takes it over
+        scriptContext->GetRecycler()->ReportExternalMemoryFree(byteLength);
+    }
+    return state;
+}
+
+// Creates an ArrayBuffer over detached contents. The contents are consumed only if this succeeds.
+static JsErrorCode CreateArrayBufferFromDetachedState(Js::ScriptContext* scriptContext, Js::ArrayBufferDetachedStateBase* state, Js::ArrayBuffer** result)
+{
+    Js::JavascriptLibrary* library = scriptContext->GetLibrary();
+    Js::ArrayBuffer* arrayBuffer;
+
+    if (state->allocationType == Js::ArrayBufferAllocationType::External)
+    {
+        Js::JsrtExternalArrayBufferDetachedState* externalState = static_cast<Js::JsrtExternalArrayBufferDetachedState*>(state);
+        arrayBuffer = Js::JsrtExternalArrayBuffer::New(
+            externalState->buffer,
+            externalState->bufferLength,
+            externalState->finalizeCallback,
+            externalState->callbackState,
+            library->GetArrayBufferType());
+    }
+    else
+    {
+        Recycler* recycler = scriptContext->GetRecycler();
+        if (!recycler->ReportExternalMemoryAllocation(state->bufferLength))
+        {
+            recycler->CollectNow<CollectOnTypedArrayAllocation>();
+            if (!recycler->ReportExternalMemoryAllocation(state->bufferLength))
+            {
+                return JsErrorOutOfMemory;
+            }
+        }
+        arrayBuffer = Js::ArrayBuffer::NewFromDetachedState(state, library);
+    }
+
+    state->MarkAsClaimed();
+    state->CleanUp();
+
+    *result = arrayBuffer;
+    return JsNoError;
+}
+
+CHAKRA_API JsDetachArrayBuffer(_In_ JsValueRef arrayBuffer, _Out_ JsArrayBufferContents *contents)
+{
+    PARAM_NOT_NULL(contents);
+    *contents = nullptr;
+
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        VALIDATE_INCOMING_REFERENCE(arrayBuffer, scriptContext);
+
+        if (!Js::ArrayBuffer::Is(arrayBuffer))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::ArrayBuffer* buffer = Js::ArrayBuffer::FromVar(arrayBuffer);
+        if (buffer->IsDetached() || !CanDetachArrayBufferContents(buffer))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        *contents = DetachArrayBufferContents(scriptContext, buffer);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsCreateArrayBufferFromContents(_In_ JsArrayBufferContents contents, _Out_ JsValueRef *result)
+{
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        PARAM_NOT_NULL(contents);
+        PARAM_NOT_NULL(result);
+        *result = JS_INVALID_REFERENCE;
+
+        Js::ArrayBuffer* arrayBuffer;
+        JsErrorCode errorCode = CreateArrayBufferFromDetachedState(scriptContext, static_cast<Js::ArrayBufferDetachedStateBase*>(contents), &arrayBuffer);
+        if (errorCode != JsNoError)
+        {
+            return errorCode;
+        }
+
+        *result = arrayBuffer;
+        JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(*result));
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsReleaseArrayBufferContents(_In_ JsArrayBufferContents contents)
+{
+    PARAM_NOT_NULL(contents);
+
+    BEGIN_JSRT_NO_EXCEPTION
+    {
+        static_cast<Js::ArrayBufferDetachedStateBase*>(contents)->CleanUp();
+    }
+    END_JSRT_NO_EXCEPTION
+}
+
+CHAKRA_API JsGetProperties(_In_ JsValueRef object, _In_reads_opt_(count) const JsPropertyIdRef *propertyIds, _In_ unsigned int count, _Out_writes_opt_(count) JsValueRef *values)
+{
+    return ContextAPIWrapper<true>([&] (Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        VALIDATE_INCOMING_OBJECT(object, scriptContext);
+        if (count != 0)
+        {
+            PARAM_NOT_NULL(propertyIds);
+            PARAM_NOT_NULL(values);
+        }
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            VALIDATE_INCOMING_PROPERTYID(propertyIds[i]);
+            values[i] = nullptr;
+        }
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            values[i] = Js::JavascriptOperators::OP_GetProperty((Js::Var)object, ((Js::PropertyRecord *)propertyIds[i])->GetPropertyId(), scriptContext);
+            Assert(values[i] == nullptr || !Js::CrossSite::NeedMarshalVar(values[i], scriptContext));
+        }
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSetProperties(_In_ JsValueRef object, _In_reads_opt_(count) const JsPropertyIdRef *propertyIds, _In_reads_opt_(count) const JsValueRef *values, _In_ unsigned int count, _In_ bool useStrictRules)
+{
+    return ContextAPIWrapper<true>([&] (Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        VALIDATE_INCOMING_OBJECT(object, scriptContext);
+        if (count != 0)
+        {
+            PARAM_NOT_NULL(propertyIds);
+            PARAM_NOT_NULL(values);
+        }
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            VALIDATE_INCOMING_PROPERTYID(propertyIds[i]);
+            JsValueRef value = values[i];
+            VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+        }
+
+        const Js::PropertyOperationFlags flags = useStrictRules ? Js::PropertyOperation_StrictMode : Js::PropertyOperation_None;
+        for (unsigned int i = 0; i < count; i++)
+        {
+            Js::JavascriptOperators::OP_SetProperty(object, ((Js::PropertyRecord *)propertyIds[i])->GetPropertyId(), values[i], scriptContext,
+                nullptr, flags);
+        }
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsCreateObjectWithProperties(_In_reads_opt_(count) const JsPropertyIdRef *propertyIds, _In_reads_opt_(count) const JsValueRef *values, _In_ unsigned int count, _Out_ JsValueRef *object)
+{
+    return ContextAPIWrapper<true>([&] (Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        PARAM_NOT_NULL(object);
+        *object = nullptr;
+        if (count != 0)
+        {
+            PARAM_NOT_NULL(propertyIds);
+            PARAM_NOT_NULL(values);
+        }
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            VALIDATE_INCOMING_PROPERTYID(propertyIds[i]);
+            JsValueRef value = values[i];
+            VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+        }
+
+        // Size the inline slots like an object literal with the same number of members so the
+        // properties below are added without growing the slot array.
+        const Js::PropertyIndex inlineSlotCapacity =
+            (Js::PropertyIndex)min(count, (unsigned int)MaxPreInitializedObjectTypeInlineSlotCount);
+        Js::DynamicObject * newObject = scriptContext->GetLibrary()->CreateObject(false, inlineSlotCapacity);
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            Js::JavascriptOperators::OP_InitProperty(newObject, ((Js::PropertyRecord *)propertyIds[i])->GetPropertyId(), values[i]);
+        }
+
+        *object = newObject;
+        return JsNoError;
+    });
+}
+
+// The property list and the object literal type shared by all objects created from a template.
+// The type is the same one an object literal with these members would use, so it is built once
+// by PathTypeHandlerBase::CreateTypeForNewScObject and every instance starts out in its final shape.
+class JsrtObjectTemplate
+{
+public:
+    static JsrtObjectTemplate * New(Js::ScriptContext * scriptContext, Js::PropertyIdArray * propertyIds)
+    {
+        JsrtObjectTemplate * objectTemplate = RecyclerNew(scriptContext->GetRecycler(), JsrtObjectTemplate, scriptContext, propertyIds);
+        Js::JavascriptOperators::EnsureObjectLiteralType(scriptContext, propertyIds, &objectTemplate->literalType);
+        return objectTemplate;
+    }
+
+    // Templates are opaque handles, so check that one really came from JsCreateObjectTemplate before using it
+    static bool Is(Recycler * recycler, void * ref)
+    {
+        return recycler->IsValidObject(ref, sizeof(JsrtObjectTemplate)) && static_cast<JsrtObjectTemplate *>(ref)->tag == Tag;
+    }
+
+    Js::ScriptContext * GetScriptContext() const { return this->scriptContext; }
+    const Js::PropertyIdArray * GetPropertyIds() const { return this->propertyIds; }
+
+    Js::DynamicObject * CreateObject()
+    {
+        return Js::DynamicObject::FromVar(Js::JavascriptOperators::NewScObjectLiteral(this->scriptContext, this->propertyIds, &this->literalType));
+    }
+
+private:
+    JsrtObjectTemplate(Js::ScriptContext * scriptContext, Js::PropertyIdArray * propertyIds) :
+        tag(Tag), scriptContext(scriptContext), propertyIds(propertyIds), literalType(nullptr)
+    {
+    }
+
+    // Sits where a script object would have its vtable
+    static const uint32 Tag = 0x4C50544A; // "JTPL"
+
+    const uint32 tag;
+    Js::ScriptContext * scriptContext;
+    Js::PropertyIdArray * propertyIds;
+    Js::DynamicType * literalType;
+};
+
+CHAKRA_API JsCreateObjectTemplate(_In_reads_(count) const JsPropertyIdRef *propertyIds, _In_ unsigned int count, _Out_ JsObjectTemplate *objectTemplate)
+{
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        PARAM_NOT_NULL(objectTemplate);
+        *objectTemplate = nullptr;
+        PARAM_NOT_NULL(propertyIds);
+
+        if (count == 0 || count > Js::PropertyIndexRanges<Js::PropertyIndex>::MaxValue)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Recycler * recycler = scriptContext->GetRecycler();
+        Js::PropertyIdArray * propIds = RecyclerNewPlus(recycler, count * sizeof(Js::PropertyId), Js::PropertyIdArray, count, 0);
+        for (unsigned int i = 0; i < count; i++)
+        {
+            VALIDATE_INCOMING_PROPERTYID(propertyIds[i]);
+            const Js::PropertyId propertyId = ((Js::PropertyRecord *)propertyIds[i])->GetPropertyId();
+            for (unsigned int j = 0; j < i; j++)
+            {
+                if (propIds->elements[j] == propertyId)
+                {
+                    return JsErrorInvalidArgument;
+                }
+            }
+            propIds->elements[i] = propertyId;
+        }
+
+        *objectTemplate = JsrtObjectTemplate::New(scriptContext, propIds);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsCreateObjectFromTemplate(_In_ JsObjectTemplate objectTemplate, _In_reads_(count) const JsValueRef *values, _In_ unsigned int count, _Out_ JsValueRef *object)
+{
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        PARAM_NOT_NULL(objectTemplate);
+        PARAM_NOT_NULL(values);
+        PARAM_NOT_NULL(object);
+        *object = nullptr;
+
+        if (!JsrtObjectTemplate::Is(scriptContext->GetRecycler(), objectTemplate))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        JsrtObjectTemplate * jsrtTemplate = static_cast<JsrtObjectTemplate *>(objectTemplate);
+        if (jsrtTemplate->GetScriptContext() != scriptContext)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        const Js::PropertyIdArray * propIds = jsrtTemplate->GetPropertyIds();
+        if (count != propIds->count)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            JsValueRef value = values[i];
+            VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+        }
+
+        // The properties already exist on the instance's type, so initializing them only stores the values.
+        Js::DynamicObject * newObject = jsrtTemplate->CreateObject();
+        for (unsigned int i = 0; i < count; i++)
+        {
+            JsValueRef value = values[i];
+            VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+            Js::JavascriptOperators::OP_InitProperty(newObject, propIds->elements[i], value);
+        }
+
+        *object = newObject;
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsCreateExternalStringUtf16(
+    _In_reads_(length + 1) const uint16_t *content,
+    _In_ size_t length,
+    _In_opt_ JsFinalizeCallback finalizeCallback,
+    _In_opt_ void *callbackState,
+    _Out_ JsValueRef *value)
+{
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        PARAM_NOT_NULL(content);
+        PARAM_NOT_NULL(value);
+        *value = nullptr;
+
+        // The buffer belongs to the host, nothing is allocated for it, so a length no string can have is a bad argument.
+        // Check it before reading the terminator at content[length].
+        if (!Js::IsValidCharCount(length))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        // JavascriptString contents are always null terminated
+        if (content[length] != 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        *value = Js::JsrtExternalString::New(reinterpret_cast<const char16*>(content), static_cast<charcount_t>(length),
+            finalizeCallback, callbackState, scriptContext);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsNotifyMemoryPressure(_In_ JsRuntimeHandle runtimeHandle, _In_ JsMemoryPressureLevel level)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->GetRecycler() && threadContext->GetRecycler()->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        // Collections decommit the recycler's free pages themselves
+        switch (level)
+        {
+        case JsMemoryPressureLow:
+            break;
+        case JsMemoryPressureModerate:
+            threadContext->EnsureRecycler()->CollectNow<CollectNowDecommitNowExplicit>();
+            break;
+        case JsMemoryPressureCritical:
+            threadContext->EnsureRecycler()->CollectNow<CollectOnMemoryPressure>();
+            break;
+        default:
+            return JsErrorInvalidArgument;
+        }
+
+        threadContext->DecommitFreePages();
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsIdleWithDeadline(_In_ unsigned int deadline, _Out_opt_ unsigned int *nextIdleTick)
+{
+    return ContextAPINoScriptWrapper_NoRecord([&] (Js::ScriptContext * scriptContext) -> JsErrorCode {
+        if (nextIdleTick != nullptr)
+        {
+            *nextIdleTick = 0;
+        }
+
+        if (deadline == 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        if (scriptContext->GetThreadContext()->GetRecycler() && scriptContext->GetThreadContext()->GetRecycler()->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (scriptContext->GetThreadContext()->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        JsrtRuntime * runtime = JsrtContext::GetCurrent()->GetRuntime();
+
+        if (!runtime->UseIdle())
+        {
+            return JsErrorIdleNotEnabled;
+        }
+
+        unsigned int ticks = runtime->IdleWithDeadline(deadline);
+
+        if (nextIdleTick != nullptr)
+        {
+            *nextIdleTick = ticks;
+        }
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSetRuntimeCollectedObjectsCallback(_In_ JsRuntimeHandle runtime, _In_opt_ void *callbackState, _In_opt_ JsCollectedObjectsCallback collectedObjectsCallback)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        JsrtRuntime::FromHandle(runtime)->SetCollectedObjectsCallback(collectedObjectsCallback, callbackState);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSetObjectCollectToken(_In_ JsRef ref, _In_opt_ void *token)
+{
+    VALIDATE_JSREF(ref);
+
+    if (Js::TaggedNumber::Is(ref))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext * scriptContext) -> JsErrorCode {
+        Recycler * recycler = scriptContext->GetRecycler();
+        if (!recycler->IsValidObject(ref))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        recycler->SetObjectCollectToken(ref, token);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsReplaceTypedArrayExternalData(_In_ JsValueRef typedArray, _Pre_maybenull_ _Pre_writable_byte_size_(byteLength) void *data,
+    _In_ unsigned int byteLength, _In_opt_ JsFinalizeCallback finalizeCallback, _In_opt_ void *callbackState)
+{
+    VALIDATE_JSREF(typedArray);
+
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        VALIDATE_INCOMING_OBJECT(typedArray, scriptContext);
+
+        if (!Js::TypedArrayBase::Is(typedArray) || (data == nullptr && byteLength > 0))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::TypedArrayBase* typedArrayBase = Js::TypedArrayBase::FromVar(typedArray);
+        Js::ArrayBufferBase* arrayBuffer = typedArrayBase->GetArrayBuffer();
+        if (!VirtualTableInfo<Js::JsrtExternalArrayBuffer>::HasVirtualTable(arrayBuffer))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::JsrtExternalArrayBuffer* externalArrayBuffer = static_cast<Js::JsrtExternalArrayBuffer*>(arrayBuffer);
+        if (!externalArrayBuffer->IsOnlyFullView(typedArrayBase) ||
+            byteLength % typedArrayBase->GetBytesPerElement() != 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        externalArrayBuffer->ReplaceExternalBuffer(typedArrayBase, reinterpret_cast<BYTE*>(data), byteLength, finalizeCallback, callbackState);
+        return JsNoError;
+    });
+}
+
+// A value written by JsSerializeValue, together with the contents of the array buffers it transfers.
+// The bytes start with a version, followed by one tag per value. Objects are numbered in the order they
+// are written so that later references to them, including cycles, are written as back references.
+class JsrtSerializedValue
+{
+public:
+    static const BYTE Version = 1;
+
+    enum class Tag : BYTE
+    {
+        Undefined = 1,
+        Null,
+        False,
+        True,
+        Int32,
+        Double,
+        String,
+        Object,
+        Array,
+        End,
+        BackReference,
+        Date,
+        ArrayBuffer,
+        TransferredArrayBuffer,
+        TypedArray
+    };
+
+    JsrtSerializedValue() : buffer(nullptr), length(0), capacity(0), transferredContents(nullptr), transferCount(0) {}
+
+    ~JsrtSerializedValue()
+    {
+        for (uint32 i = 0; i < transferCount; i++)
+        {
+            if (transferredContents[i] != nullptr)
+            {
+                transferredContents[i]->CleanUp();
+            }
+        }
+        if (transferredContents != nullptr)
+        {
+            HeapDeleteArray(transferCount, transferredContents);
+        }
+        if (buffer != nullptr)
+        {
+            HeapDeleteArray(capacity, buffer);
+        }
+    }
+
+    const BYTE * GetBuffer() const { return buffer; }
+    uint32 GetLength() const { return length; }
+    uint32 GetTransferCount() const { return transferCount; }
+
+    bool Append(const void *bytes, uint32 count)
+    {
+        if (count > UINT32_MAX - length)
+        {
+            return false;
+        }
+        uint32 newLength = length + count;
+
+        if (newLength > capacity)
+        {
+            const uint32 minCapacity = 0x100;
+            uint32 newCapacity = capacity < minCapacity ? minCapacity : capacity;
+            while (newCapacity < newLength)
+            {
+                newCapacity = newCapacity > UINT32_MAX / 2 ? newLength : newCapacity * 2;
+            }
+
+            BYTE *newBuffer = HeapNewNoThrowArray(BYTE, newCapacity);
+            if (newBuffer == nullptr)
+            {
+                return false;
+            }
+            if (buffer != nullptr)
+            {
+                js_memcpy_s(newBuffer, newCapacity, buffer, length);
+                HeapDeleteArray(capacity, buffer);
+            }
+            buffer = newBuffer;
+            capacity = newCapacity;
+        }
+
+        if (count > 0)
+        {
+            js_memcpy_s(buffer + length, capacity - length, bytes, count);
+        }
+        length = newLength;
+        return true;
+    }
+
+    bool InitializeTransfers(uint32 count)
+    {
+        Assert(transferredContents == nullptr);
+        if (count == 0)
+        {
+            return true;
+        }
+
+        transferredContents = HeapNewNoThrowArrayZ(Js::ArrayBufferDetachedStateBase*, count);
+        if (transferredContents == nullptr)
+        {
+            return false;
+        }
+        transferCount = count;
+        return true;
+    }
+
+    void SetTransferredContents(uint32 index, Js::ArrayBufferDetachedStateBase* state)
+    {
+        Assert(index < transferCount && transferredContents[index] == nullptr);
+        transferredContents[index] = state;
+    }
+
+    // Returns null if the index is out of range or the contents were already taken by a deserialization
+    Js::ArrayBufferDetachedStateBase* GetTransferredContents(uint32 index) const
+    {
+        return index < transferCount ? transferredContents[index] : nullptr;
+    }
+
+    void ForgetTransferredContents(uint32 index)
+    {
+        Assert(index < transferCount);
+        transferredContents[index] = nullptr;
+    }
+
+private:
+    BYTE *buffer;
+    uint32 length;
+    uint32 capacity;
+    Js::ArrayBufferDetachedStateBase** transferredContents;
+    uint32 transferCount;
+};
+
+class JsrtValueSerializer
+{
+public:
+    JsrtValueSerializer(Js::ScriptContext *scriptContext, JsrtSerializedValue *serializedValue, const JsValueRef *transferList, uint32 transferCount) :
+        scriptContext(scriptContext),
+        serializedValue(serializedValue),
+        transferList(transferList),
+        transferCount(transferCount),
+        objectIndices(&HeapAllocator::Instance),
+        // Keeps the written objects alive, so that the address of a collected object can't be mistaken for a back reference
+        objects(RecyclerNew(scriptContext->GetRecycler(), JsUtil::List<Js::Var, Recycler>, scriptContext->GetRecycler()))
+    {
+    }
+
+    JsErrorCode Serialize(Js::Var value)
+    {
+        Write(JsrtSerializedValue::Version);
+        return WriteValue(value);
+    }
+
+private:
+    typedef JsrtSerializedValue::Tag Tag;
+
+    template <typename T>
+    void Write(T value)
+    {
+        WriteBytes(&value, sizeof(T));
+    }
+
+    void WriteBytes(const void *bytes, uint32 count)
+    {
+        if (!serializedValue->Append(bytes, count))
+        {
+            Js::Throw::OutOfMemory();
+        }
+    }
+
+    void WriteTag(Tag tag)
+    {
+        Write(static_cast<BYTE>(tag));
+    }
+
+    void WriteString(Js::JavascriptString *string)
+    {
+        charcount_t length = string->GetLength();
+        if (length > UINT32_MAX / sizeof(char16))
+        {
+            Js::Throw::OutOfMemory();
+        }
+
+        WriteTag(Tag::String);
+        Write<uint32>(length);
+        WriteBytes(string->GetString(), length * sizeof(char16));
+    }
+
+    JsErrorCode WriteValue(Js::Var value)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+
+        const Js::TypeId typeId = Js::JavascriptOperators::GetTypeId(value);
+        switch (typeId)
+        {
+        case Js::TypeIds_Undefined:
+            WriteTag(Tag::Undefined);
+            return JsNoError;
+        case Js::TypeIds_Null:
+            WriteTag(Tag::Null);
+            return JsNoError;
+        case Js::TypeIds_Boolean:
+            WriteTag(Js::JavascriptBoolean::FromVar(value)->GetValue() ? Tag::True : Tag::False);
+            return JsNoError;
+        case Js::TypeIds_Integer:
+            WriteTag(Tag::Int32);
+            Write<int32>(Js::TaggedInt::ToInt32(value));
+            return JsNoError;
+        case Js::TypeIds_Number:
+        case Js::TypeIds_Int64Number:
+        case Js::TypeIds_UInt64Number:
+            WriteTag(Tag::Double);
+            Write<double>(Js::JavascriptConversion::ToNumber(value, scriptContext));
+            return JsNoError;
+        case Js::TypeIds_String:
+            WriteString(Js::JavascriptString::FromVar(value));
+            return JsNoError;
+        default:
+            break;
+        }
+
+        if (!IsSupportedObject(value, typeId))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::RecyclableObject *object = Js::RecyclableObject::FromVar(value);
+        uint32 index;
+        if (objectIndices.TryGetValue(object, &index))
+        {
+            WriteTag(Tag::BackReference);
+            Write<uint32>(index);
+            return JsNoError;
+        }
+        objectIndices.Add(object, objects->Count());
+        objects->Add(object);
+
+        if (typeId == Js::TypeIds_Object)
+        {
+            WriteTag(Tag::Object);
+            return WriteProperties(object);
+        }
+        else if (Js::JavascriptArray::Is(typeId) || typeId == Js::TypeIds_ES5Array)
+        {
+            WriteTag(Tag::Array);
+            Write<uint32>(Js::JavascriptArray::FromAnyArray(object)->GetLength());
+            return WriteProperties(object);
+        }
+        else if (typeId == Js::TypeIds_Date)
+        {
+            WriteTag(Tag::Date);
+            Write<double>(Js::JavascriptDate::FromVar(object)->GetTime());
+            return JsNoError;
+        }
+        else if (typeId == Js::TypeIds_ArrayBuffer)
+        {
+            return WriteArrayBuffer(Js::ArrayBuffer::FromVar(object));
+        }
+        else
+        {
+            Js::TypedArrayBase *typedArray = Js::TypedArrayBase::FromVar(object);
+            WriteTag(Tag::TypedArray);
+            Write<BYTE>(static_cast<BYTE>(GetTypedArrayType(typeId)));
+            Write<uint32>(typedArray->GetByteOffset());
+            Write<uint32>(typedArray->GetLength());
+            return WriteValue(typedArray->GetArrayBuffer());
+        }
+    }
+
+    static bool IsSupportedObject(Js::Var value, Js::TypeId typeId)
+    {
+        return (typeId == Js::TypeIds_Object && !JsrtExternalObject::Is(value)) ||
+            Js::JavascriptArray::Is(typeId) ||
+            typeId == Js::TypeIds_ES5Array ||
+            typeId == Js::TypeIds_Date ||
+            typeId == Js::TypeIds_ArrayBuffer ||
+            (typeId >= Js::TypeIds_TypedArraySCAMin && typeId <= Js::TypeIds_TypedArraySCAMax);
+    }
+
+    JsErrorCode WriteArrayBuffer(Js::ArrayBuffer *arrayBuffer)
+    {
+        for (uint32 i = 0; i < transferCount; i++)
+        {
+            if (transferList[i] == static_cast<Js::Var>(arrayBuffer))
+            {
+                WriteTag(Tag::TransferredArrayBuffer);
+                Write<uint32>(i);
+                return JsNoError;
+            }
+        }
+
+        if (arrayBuffer->IsDetached())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        WriteTag(Tag::ArrayBuffer);
+        Write<uint32>(arrayBuffer->GetByteLength());
+        WriteBytes(arrayBuffer->GetBuffer(), arrayBuffer->GetByteLength());
+        return JsNoError;
+    }
+
+    // Writes the own enumerable string-keyed properties, the same ones JSON.stringify visits
+    JsErrorCode WriteProperties(Js::RecyclableObject *object)
+    {
+        Js::JavascriptStaticEnumerator enumerator;
+        if (object->GetEnumerator(&enumerator, EnumeratorFlags::SnapShotSemantics, scriptContext))
+        {
+            Js::RecyclableObject *undefined = scriptContext->GetLibrary()->GetUndefined();
+            Js::PropertyId propertyId;
+            Js::Var propertyNameVar;
+            while ((propertyNameVar = enumerator.MoveAndGetNext(propertyId)) != nullptr)
+            {
+                if (Js::JavascriptOperators::IsUndefinedObject(propertyNameVar, undefined))
+                {
+                    continue;
+                }
+
+                Js::JavascriptString *propertyName = Js::JavascriptString::FromVar(propertyNameVar);
+                Js::Var propertyValue = Js::JavascriptOperators::OP_GetElementI(object, propertyName, scriptContext);
+
+                WriteString(propertyName);
+                JsErrorCode errorCode = WriteValue(propertyValue);
+                if (errorCode != JsNoError)
+                {
+                    return errorCode;
+                }
+            }
+        }
+
+        WriteTag(Tag::End);
+        return JsNoError;
+    }
+
+    Js::ScriptContext *scriptContext;
+    JsrtSerializedValue *serializedValue;
+    const JsValueRef *transferList;
+    uint32 transferCount;
+    JsUtil::BaseDictionary<Js::RecyclableObject*, uint32, HeapAllocator> objectIndices;
+    JsUtil::List<Js::Var, Recycler> *objects;
+};
+
+// Reads values written by JsrtValueSerializer. The bytes may come from the host, so every tag, length and
+// back reference is checked and malformed input fails with JsErrorInvalidArgument.
+class JsrtValueDeserializer
+{
+public:
+    JsrtValueDeserializer(Js::ScriptContext *scriptContext, JsrtSerializedValue *serializedValue) :
+        scriptContext(scriptContext),
+        serializedValue(serializedValue),
+        position(serializedValue->GetBuffer()),
+        end(serializedValue->GetBuffer() + serializedValue->GetLength()),
+        objects(RecyclerNew(scriptContext->GetRecycler(), JsUtil::List<Js::Var, Recycler>, scriptContext->GetRecycler()))
+    {
+    }
+
+    JsErrorCode Deserialize(Js::Var *result)
+    {
+        BYTE version;
+        if (!Read(&version) || version != JsrtSerializedValue::Version)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        JsErrorCode errorCode = ReadValue(result);
+        if (errorCode == JsNoError && position != end)
+        {
+            return JsErrorInvalidArgument;
+        }
+        return errorCode;
+    }
+
+private:
+    typedef JsrtSerializedValue::Tag Tag;
+
+    template <typename T>
+    bool Read(T *value)
+    {
+        if (static_cast<size_t>(end - position) < sizeof(T))
+        {
+            return false;
+        }
+        memcpy(value, position, sizeof(T));
+        position += sizeof(T);
+        return true;
+    }
+
+    bool ReadBytes(uint32 count, const BYTE **bytes)
+    {
+        if (static_cast<size_t>(end - position) < count)
+        {
+            return false;
+        }
+        *bytes = position;
+        position += count;
+        return true;
+    }
+
+    bool ReadChars(const char16 **chars, uint32 *length)
+    {
+        const BYTE *bytes;
+        if (!Read(length) ||
+            *length > static_cast<size_t>(end - position) / sizeof(char16) ||
+            !ReadBytes(*length * sizeof(char16), &bytes))
+        {
+            return false;
+        }
+        *chars = reinterpret_cast<const char16*>(bytes);
+        return true;
+    }
+
+    void AddObject(Js::Var object)
+    {
+        objects->Add(object);
+    }
+
+    JsErrorCode ReadValue(Js::Var *result)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+
+        Js::JavascriptLibrary *library = scriptContext->GetLibrary();
+
+        BYTE tag;
+        if (!Read(&tag))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        switch (static_cast<Tag>(tag))
+        {
+        case Tag::Undefined:
+            *result = library->GetUndefined();
+            return JsNoError;
+        case Tag::Null:
+            *result = library->GetNull();
+            return JsNoError;
+        case Tag::False:
+            *result = library->GetFalse();
+            return JsNoError;
+        case Tag::True:
+            *result = library->GetTrue();
+            return JsNoError;
+        case Tag::Int32:
+        {
+            int32 value;
+            if (!Read(&value))
+            {
+                return JsErrorInvalidArgument;
+            }
+            *result = Js::JavascriptNumber::ToVar(value, scriptContext);
+            return JsNoError;
+        }
+        case Tag::Double:
+        {
+            double value;
+            if (!Read(&value))
+            {
+                return JsErrorInvalidArgument;
+            }
+            // Checked, since a NaN with an arbitrary payload must not be taken for a tagged value
+            *result = Js::JavascriptNumber::ToVarWithCheck(value, scriptContext);
+            return JsNoError;
+        }
+        case Tag::String:
+        {
+            const char16 *chars;
+            uint32 length;
+            if (!ReadChars(&chars, &length))
+            {
+                return JsErrorInvalidArgument;
+            }
+            *result = Js::JavascriptString::NewCopyBuffer(chars, length, scriptContext);
+            return JsNoError;
+        }
+        case Tag::Object:
+        {
+            Js::DynamicObject *object = library->CreateObject();
+            AddObject(object);
+            *result = object;
+            return ReadProperties(object);
+        }
+        case Tag::Array:
+        {
+            uint32 length;
+            if (!Read(&length))
+            {
+                return JsErrorInvalidArgument;
+            }
+
+            // The length is applied last, so that a bogus length doesn't allocate anything up front
+            Js::JavascriptArray *array = library->CreateArray();
+            AddObject(array);
+            *result = array;
+
+            JsErrorCode errorCode = ReadProperties(array);
+            if (errorCode == JsNoError && length > array->GetLength())
+            {
+                array->SetLength(length);
+            }
+            return errorCode;
+        }
+        case Tag::BackReference:
+        {
+            uint32 index;
+            if (!Read(&index) || index >= static_cast<uint32>(objects->Count()) || objects->Item(index) == nullptr)
+            {
+                return JsErrorInvalidArgument;
+            }
+            *result = objects->Item(index);
+            return JsNoError;
+        }
+        case Tag::Date:
+        {
+            double value;
+            if (!Read(&value))
+            {
+                return JsErrorInvalidArgument;
+            }
+            *result = library->CreateDate(value);
+            AddObject(*result);
+            return JsNoError;
+        }
+        case Tag::ArrayBuffer:
+        {
+            uint32 length;
+            const BYTE *bytes;
+            if (!Read(&length) || !ReadBytes(length, &bytes))
+            {
+                return JsErrorInvalidArgument;
+            }
+
+            Js::ArrayBuffer *arrayBuffer = library->CreateArrayBuffer(length);
+            if (length > 0)
+            {
+                js_memcpy_s(arrayBuffer->GetBuffer(), arrayBuffer->GetByteLength(), bytes, length);
+            }
+            *result = arrayBuffer;
+            AddObject(arrayBuffer);
+            return JsNoError;
+        }
+        case Tag::TransferredArrayBuffer:
+        {
+            uint32 index;
+            if (!Read(&index))
+            {
+                return JsErrorInvalidArgument;
+            }
+
+            Js::ArrayBufferDetachedStateBase *state = serializedValue->GetTransferredContents(index);
+            if (state == nullptr)
+            {
+                return JsErrorInvalidArgument;
+            }
+
+            Js::ArrayBuffer *arrayBuffer;
+            JsErrorCode errorCode = CreateArrayBufferFromDetachedState(scriptContext, state, &arrayBuffer);
+            if (errorCode != JsNoError)
+            {
+                return errorCode;
+            }
+            serializedValue->ForgetTransferredContents(index);
+
+            *result = arrayBuffer;
+            AddObject(arrayBuffer);
+            return JsNoError;
+        }
+        case Tag::TypedArray:
+            return ReadTypedArray(result);
+        default:
+            return JsErrorInvalidArgument;
+        }
+    }
+
+    JsErrorCode ReadTypedArray(Js::Var *result)
+    {
+        BYTE arrayType;
+        uint32 byteOffset;
+        uint32 length;
+        if (!Read(&arrayType) || !Read(&byteOffset) || !Read(&length))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::JavascriptLibrary *library = scriptContext->GetLibrary();
+        Js::JavascriptFunction *constructorFunc = GetTypedArrayConstructor(library, static_cast<JsTypedArrayType>(arrayType));
+        if (constructorFunc == nullptr)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        // The typed array was numbered before its buffer, so its slot is reserved until it exists
+        int index = objects->Count();
+        AddObject(nullptr);
+
+        Js::Var arrayBuffer;
+        JsErrorCode errorCode = ReadValue(&arrayBuffer);
+        if (errorCode != JsNoError)
+        {
+            return errorCode;
+        }
+        if (!Js::ArrayBuffer::Is(arrayBuffer))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        // The offset and length come from the bytes, so check them here rather than let the constructor throw
+        Js::ArrayBuffer *buffer = Js::ArrayBuffer::FromVar(arrayBuffer);
+        const uint32 elementSize = GetTypedArrayElementSize(static_cast<JsTypedArrayType>(arrayType));
+        if (buffer->IsDetached() || byteOffset % elementSize != 0 ||
+            (uint64)byteOffset + (uint64)length * elementSize > buffer->GetByteLength())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::Var values[4] =
+        {
+            library->GetUndefined(),
+            arrayBuffer,
+            Js::JavascriptNumber::ToVar(byteOffset, scriptContext),
+            Js::JavascriptNumber::ToVar(length, scriptContext)
+        };
+        Js::CallInfo info(Js::CallFlags_New, 4);
+        Js::Arguments args(info, values);
+
+        *result = Js::JavascriptFunction::CallAsConstructor(constructorFunc, /* overridingNewTarget = */nullptr, args, scriptContext);
+        objects->Item(index, *result);
+        return JsNoError;
+    }
+
+    JsErrorCode ReadProperties(Js::RecyclableObject *object)
+    {
+        while (true)
+        {
+            BYTE tag;
+            if (!Read(&tag))
+            {
+                return JsErrorInvalidArgument;
+            }
+            if (tag == static_cast<BYTE>(Tag::End))
+            {
+                return JsNoError;
+            }
+
+            const char16 *name;
+            uint32 nameLength;
+            if (tag != static_cast<BYTE>(Tag::String) || !ReadChars(&name, &nameLength) || nameLength > INT_MAX)
+            {
+                return JsErrorInvalidArgument;
+            }
+
+            Js::PropertyRecord const *propertyRecord;
+            scriptContext->GetOrAddPropertyRecord(name, static_cast<int>(nameLength), &propertyRecord);
+
+            Js::Var value;
+            JsErrorCode errorCode = ReadValue(&value);
+            if (errorCode != JsNoError)
+            {
+                return errorCode;
+            }
+
+            // Defines own properties, so that names like __proto__ and indexed setters on the prototype chain
+            // (such as one on Array.prototype) are never reached
+            if (propertyRecord->IsNumeric())
+            {
+                object->SetItem(propertyRecord->GetNumericValue(), value, Js::PropertyOperation_None);
+            }
+            else
+            {
+                Js::JavascriptOperators::InitProperty(object, propertyRecord->GetPropertyId(), value);
+            }
+        }
+    }
+
+    Js::ScriptContext *scriptContext;
+    JsrtSerializedValue *serializedValue;
+    const BYTE *position;
+    const BYTE *end;
+    JsUtil::List<Js::Var, Recycler> *objects;
+};
+
+CHAKRA_API JsSerializeValue(_In_ JsValueRef value, _In_reads_opt_(transferCount) const JsValueRef *transferList,
+    _In_ unsigned int transferCount, _Out_ JsSerializedValue *serializedValue)
+{
+    PARAM_NOT_NULL(serializedValue);
+    *serializedValue = nullptr;
+
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+        if (transferCount > 0)
+        {
+            PARAM_NOT_NULL(transferList);
+        }
+
+        // Everything that will be transferred is checked before any of it is detached
+        for (unsigned int i = 0; i < transferCount; i++)
+        {
+            Js::Var transfer = transferList[i];
+            VALIDATE_INCOMING_REFERENCE(transfer, scriptContext);
+            if (!Js::ArrayBuffer::Is(transfer))
+            {
+                return JsErrorInvalidArgument;
+            }
+
+            Js::ArrayBuffer *arrayBuffer = Js::ArrayBuffer::FromVar(transfer);
+            if (arrayBuffer->IsDetached() || !CanDetachArrayBufferContents(arrayBuffer))
+            {
+                return JsErrorInvalidArgument;
+            }
+            for (unsigned int j = 0; j < i; j++)
+            {
+                if (transferList[j] == transferList[i])
+                {
+                    return JsErrorInvalidArgument;
+                }
+            }
+        }
+
+        AutoPtr<JsrtSerializedValue> result(HeapNew(JsrtSerializedValue));
+        if (!result->InitializeTransfers(transferCount))
+        {
+            return JsErrorOutOfMemory;
+        }
+
+        JsrtValueSerializer serializer(scriptContext, result, transferList, transferCount);
+        JsErrorCode errorCode = serializer.Serialize(value);
+        if (errorCode != JsNoError)
+        {
+            return errorCode;
+        }
+
+        // A getter may have detached one of them in the meantime
+        for (unsigned int i = 0; i < transferCount; i++)
+        {
+            if (Js::ArrayBuffer::FromVar(transferList[i])->IsDetached())
+            {
+                return JsErrorInvalidArgument;
+            }
+        }
+
+        for (unsigned int i = 0; i < transferCount; i++)
+        {
+            result->SetTransferredContents(i, DetachArrayBufferContents(scriptContext, Js::ArrayBuffer::FromVar(transferList[i])));
+        }
+
+        *serializedValue = result.Detach();
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsCreateSerializedValue(_In_reads_bytes_(length) const BYTE *bytes, _In_ unsigned int length, _Out_ JsSerializedValue *serializedValue)
+{
+    PARAM_NOT_NULL(serializedValue);
+    *serializedValue = nullptr;
+    if (length > 0)
+    {
+        PARAM_NOT_NULL(bytes);
+    }
+
+    JsrtSerializedValue *result = HeapNewNoThrow(JsrtSerializedValue);
+    if (result == nullptr)
+    {
+        return JsErrorOutOfMemory;
+    }
+    if (!result->Append(bytes, length))
+    {
+        HeapDelete(result);
+        return JsErrorOutOfMemory;
+    }
+
+    *serializedValue = result;
+    return JsNoError;
+}
+
+CHAKRA_API JsGetSerializedValueBuffer(_In_ JsSerializedValue serializedValue, _Outptr_result_bytebuffer_(*length) const BYTE **bytes, _Out_ unsigned int *length)
+{
+    PARAM_NOT_NULL(serializedValue);
+    PARAM_NOT_NULL(bytes);
+    PARAM_NOT_NULL(length);
+
+    JsrtSerializedValue *value = static_cast<JsrtSerializedValue*>(serializedValue);
+    *bytes = value->GetBuffer();
+    *length = value->GetLength();
+    return JsNoError;
+}
+
+CHAKRA_API JsDeserializeValue(_In_ JsSerializedValue serializedValue, _Out_ JsValueRef *result)
+{
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        PARAM_NOT_NULL(serializedValue);
+        PARAM_NOT_NULL(result);
+        *result = JS_INVALID_REFERENCE;
+
+        Js::Var value;
+        JsrtValueDeserializer deserializer(scriptContext, static_cast<JsrtSerializedValue*>(serializedValue));
+        JsErrorCode errorCode = deserializer.Deserialize(&value);
+        if (errorCode != JsNoError)
+        {
+            return errorCode;
+        }
+
+        *result = value;
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsReleaseSerializedValue(_In_ JsSerializedValue serializedValue)
+{
+    PARAM_NOT_NULL(serializedValue);
+
+    BEGIN_JSRT_NO_EXCEPTION
+    {
+        HeapDelete(static_cast<JsrtSerializedValue*>(serializedValue));
+    }
+    END_JSRT_NO_EXCEPTION
+}
+
+// The thread clocks count in 100ns units, the API in microseconds
+static INT64 CpuTimeToMicroseconds(uint64 cpuTime)
+{
+    return static_cast<INT64>(cpuTime / 10);
+}
+
+CHAKRA_API JsSetRuntimeCpuTimeAccounting(_In_ JsRuntimeHandle runtime, _In_ bool enabled)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        ThreadContext *threadContext = JsrtRuntime::FromHandle(runtime)->GetThreadContext();
+        threadContext->SetCpuTimeAccountingEnabled(enabled);
+        if (!enabled)
+        {
+            // The script CPU time limit is measured from the start time recorded by accounting, so it goes away with it
+            threadContext->SetScriptCpuTimeLimit(0);
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetContextCpuTime(_In_ JsContextRef context, _Out_ INT64 *scriptTime)
+{
+    VALIDATE_JSREF(context);
+    PARAM_NOT_NULL(scriptTime);
+    *scriptTime = 0;
+
+    if (!JsrtContext::Is(context))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    JsrtContext *jsrtContext = static_cast<JsrtContext *>(context);
+
+    // A call in progress is read from the clock of the calling thread, so it has to be the runtime's thread
+    ThreadContextScope scope(jsrtContext->GetRuntime()->GetThreadContext());
+    if (!scope.IsValid())
+    {
+        return JsErrorWrongThread;
+    }
+
+    *scriptTime = CpuTimeToMicroseconds(jsrtContext->GetScriptContext()->GetScriptCpuTime());
+    return JsNoError;
+}
+
+CHAKRA_API JsGetRuntimeGcCpuTime(_In_ JsRuntimeHandle runtime, _Out_ INT64 *gcTime)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+    PARAM_NOT_NULL(gcTime);
+
+    *gcTime = CpuTimeToMicroseconds(JsrtRuntime::FromHandle(runtime)->GetThreadContext()->GetGcCpuTime());
+    return JsNoError;
+}
+
+CHAKRA_API JsSetRuntimeScriptCpuTimeLimit(_In_ JsRuntimeHandle runtime, _In_ INT64 limit)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+    if (limit < 0)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    ThreadContext *threadContext = JsrtRuntime::FromHandle(runtime)->GetThreadContext();
+    if (limit > 0 && !threadContext->TestThreadContextFlag(ThreadContextFlagCanDisableExecution))
+    {
+        return JsErrorCannotDisableExecution;
+    }
+
+    // Without accounting no start time is recorded for script calls and the limit would never be hit
+    if (limit > 0 && !threadContext->IsCpuTimeAccountingEnabled())
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    // A limit too large to convert to clock units can't be reached, saturate it
+    int64 limitInClockUnits;
+    if (Int64Math::Mul(limit, 10, &limitInClockUnits))
+    {
+        limitInClockUnits = _I64_MAX;
+    }
+
+    threadContext->SetScriptCpuTimeLimit(static_cast<uint64>(limitInClockUnits));
+    return JsNoError;
+}
+
+CHAKRA_API JsCheckRuntimeScriptCpuTimeLimit(_In_ JsRuntimeHandle runtime, _Out_opt_ bool *exceeded)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+    if (exceeded != nullptr)
+    {
+        *exceeded = false;
+    }
+
+    ThreadContext *threadContext = JsrtRuntime::FromHandle(runtime)->GetThreadContext();
+    if (!threadContext->TestThreadContextFlag(ThreadContextFlagCanDisableExecution))
+    {
+        return JsErrorCannotDisableExecution;
+    }
+
+    bool limitExceeded = threadContext->CheckScriptCpuTimeLimit();
+    if (exceeded != nullptr)
+    {
+        *exceeded = limitExceeded;
+    }
+    return JsNoError;
+}
+
+CHAKRA_API JsStartRuntimeSampling(_In_ JsRuntimeHandle runtimeHandle, _In_ unsigned int intervalMilliseconds, _In_ unsigned int sampleCapacity)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        if (intervalMilliseconds == 0 || sampleCapacity == 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        if (!threadContext->EnsureScriptSampler()->Start(intervalMilliseconds, sampleCapacity))
+        {
+            return JsErrorOutOfMemory;
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsStopRuntimeSampling(_In_ JsRuntimeHandle runtimeHandle)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Js::ScriptSampler * sampler = threadContext->GetScriptSampler();
+        if (sampler != nullptr)
+        {
+            sampler->Stop();
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetRuntimeSamplingProfile(_In_ JsRuntimeHandle runtimeHandle, _Out_writes_bytes_opt_(bufferSize) BYTE *buffer, _In_ unsigned int bufferSize, _Out_ unsigned int *profileSize)
+{
+    PARAM_NOT_NULL(profileSize);
+    *profileSize = 0;
+
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Js::ScriptSampler * sampler = threadContext->EnsureScriptSampler();
+        size_t size = sampler->WriteProfile(buffer, bufferSize);
+        if (size > UINT_MAX)
+        {
+            return JsErrorOutOfMemory;
+        }
+
+        *profileSize = (unsigned int)size;
+        if (buffer != nullptr && bufferSize < size)
+        {
+            return JsErrorInvalidArgument;
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetContextCounters(_In_ JsContextRef context, _In_ JsContextCounterCallback callback, _In_opt_ void *callbackState)
+{
+    VALIDATE_JSREF(context);
+    PARAM_NOT_NULL(callback);
+
+    if (!JsrtContext::Is(context))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    JsrtContext *jsrtContext = static_cast<JsrtContext *>(context);
+    ThreadContextScope scope(jsrtContext->GetRuntime()->GetThreadContext());
+    if (!scope.IsValid())
+    {
+        return JsErrorWrongThread;
+    }
+
+    Js::ScriptContext *scriptContext = jsrtContext->GetScriptContext();
+
+#if ENABLE_NATIVE_CODEGEN
+    for (uint kind = 0; kind < IR::BailOutKindEnd; kind++)
+    {
+        uint count = scriptContext->GetBailOutKindCount(kind);
+        if (count != 0)
+        {
+            // A kind of 0 is a bailout on result conditions alone, see IR::BailOutKindBits
+            callback(JsContextCounterBailOut, kind == 0 ? "BailOutKindBitsOnly" : BailOutKindNames[kind], count, callbackState);
+        }
+    }
+#endif
+
+    for (uint reason = 0; reason < NumRejitReasons; reason++)
+    {
+        uint count = scriptContext->GetRejitReasonCount(reason);
+        if (count != 0)
+        {
+            callback(JsContextCounterRejit, RejitReasonNames[reason], count, callbackState);
+        }
+    }
+
+    callback(JsContextCounterInlineCache, "GetLookups", (INT64)scriptContext->GetInlineCacheGetLookupCount(), callbackState);
+    callback(JsContextCounterInlineCache, "GetMisses", (INT64)scriptContext->GetInlineCacheGetMissCount(), callbackState);
+    callback(JsContextCounterInlineCache, "SetLookups", (INT64)scriptContext->GetInlineCacheSetLookupCount(), callbackState);
+    callback(JsContextCounterInlineCache, "SetMisses", (INT64)scriptContext->GetInlineCacheSetMissCount(), callbackState);
+    return JsNoError;
+}
+
+CHAKRA_API JsGetRuntimeGcPhaseTimes(_In_ JsRuntimeHandle runtime, _Out_ JsGcPhaseTimes *phaseTimes)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+    PARAM_NOT_NULL(phaseTimes);
+    memset(phaseTimes, 0, sizeof(*phaseTimes));
+
+    Recycler *recycler = JsrtRuntime::FromHandle(runtime)->GetThreadContext()->GetRecycler();
+    if (recycler != nullptr)
+    {
+        Recycler::PhaseTimes times;
+        recycler->GetPhaseTimes(&times);
+        phaseTimes->collectionCount = (INT64)times.collectionCount;
+        phaseTimes->markTime = (INT64)times.markMicroseconds;
+        phaseTimes->sweepTime = (INT64)times.sweepMicroseconds;
+        phaseTimes->backgroundMarkTime = (INT64)times.backgroundMarkMicroseconds;
+        phaseTimes->backgroundSweepTime = (INT64)times.backgroundSweepMicroseconds;
+    }
+    return JsNoError;
+}
+
+CHAKRA_API JsSetRuntimePerfHintCallback(_In_ JsRuntimeHandle runtimeHandle, _In_opt_ void *callbackState, _In_opt_ JsPerfHintCallback perfHintCallback, _In_ unsigned int maxHintsPerSecond)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        JsrtRuntime::FromHandle(runtimeHandle)->SetPerfHintCallback(perfHintCallback, callbackState, maxHintsPerSecond);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetContextFunctionMemoryUsage(_In_ JsContextRef context, _In_ JsFunctionMemoryUsageCallback callback, _In_opt_ void *callbackState)
+{
+    VALIDATE_JSREF(context);
+    PARAM_NOT_NULL(callback);
+
+    if (!JsrtContext::Is(context))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    JsrtContext *jsrtContext = static_cast<JsrtContext *>(context);
+    ThreadContextScope scope(jsrtContext->GetRuntime()->GetThreadContext());
+    if (!scope.IsValid())
+    {
+        return JsErrorWrongThread;
+    }
+
+    jsrtContext->GetScriptContext()->MapFunction([&](Js::FunctionBody *functionBody)
+    {
+        if (functionBody->GetByteCode() == nullptr)
+        {
+            return;
+        }
+
+        Js::FunctionBody::MemoryUsage memoryUsage;
+        functionBody->GetMemoryUsage(&memoryUsage);
+
+        JsFunctionMemoryUsage usage;
+        usage.sourceContext = (JsSourceContext)functionBody->GetHostSourceContext();
+        usage.functionName = reinterpret_cast<const uint16_t *>(functionBody->GetExternalDisplayName());
+        usage.line = functionBody->GetLineNumber();
+        usage.column = functionBody->GetColumnNumber();
+        usage.byteCodeSize = memoryUsage.byteCodeBytes;
+        usage.auxiliaryDataSize = memoryUsage.auxiliaryDataBytes;
+        usage.inlineCacheSize = memoryUsage.inlineCacheBytes;
+        usage.nativeCodeSize = memoryUsage.nativeCodeBytes;
+        usage.nativeDataSize = memoryUsage.nativeDataBytes;
+        usage.nativeEntryPointCount = memoryUsage.nativeEntryPointCount;
+        callback(&usage, callbackState);
+    });
+    return JsNoError;
+}
+
+CHAKRA_API JsSetRuntimeCodeAgingPolicy(_In_ JsRuntimeHandle runtimeHandle, _In_ unsigned int gcCount)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext()->SetCodeAgingGcCount(gcCount);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSetRuntimeRedeferralPolicy(_In_ JsRuntimeHandle runtimeHandle, _In_ unsigned int gcCount)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext()->SetRedeferralGcCount(gcCount);
+        return JsNoError;
+    });
+}
 #endif // NTBUILD
@@ -25,4 +25,34 @@ namespace Js
             finalizeCallback(callbackState);
         }
     }
+
+    ArrayBufferDetachedStateBase* JsrtExternalArrayBuffer::DetachAndGetState()
+    {
+        ArrayBufferDetachedStateBase* state = ExternalArrayBuffer::DetachAndGetState();
+
+        // The detached state owns the buffer now, so this object must not finalize it
+        finalizeCallback = nullptr;
+        callbackState = nullptr;
+        return state;
+    }
+
+    void JsrtExternalArrayBuffer::ReplaceExternalBuffer(TypedArrayBase* typedArray, byte *buffer, uint32 length, JsFinalizeCallback finalizeCallback, void *callbackState)
+    {
+        JsFinalizeCallback oldFinalizeCallback = this->finalizeCallback;
+        void *oldCallbackState = this->callbackState;
+
+        ReplaceBufferOfOnlyView(typedArray, buffer, length);
+        this->finalizeCallback = finalizeCallback;
+        this->callbackState = callbackState;
+
+        if (oldFinalizeCallback != nullptr)
+        {
+            oldFinalizeCallback(oldCallbackState);
+        }
+    }
+
+    ArrayBufferDetachedStateBase* JsrtExternalArrayBuffer::CreateDetachedState(BYTE* buffer, uint32 bufferLength)
+    {
+        return HeapNew(JsrtExternalArrayBufferDetachedState, buffer, bufferLength, finalizeCallback, callbackState);
+    }
 }
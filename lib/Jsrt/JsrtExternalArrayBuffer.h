@@ -16,10 +16,52 @@ namespace Js {
     public:
         static JsrtExternalArrayBuffer* New(byte *buffer, uint32 length, JsFinalizeCallback finalizeCallback, void *callbackState, DynamicType *type);
         void Finalize(bool isShutdown) override;
+        virtual ArrayBufferDetachedStateBase* DetachAndGetState() override;
+
+        // Points this buffer and its only view at new host memory, finalizing the old memory
+        void ReplaceExternalBuffer(TypedArrayBase* typedArray, byte *buffer, uint32 length, JsFinalizeCallback finalizeCallback, void *callbackState);
+
+    protected:
+        virtual ArrayBufferDetachedStateBase* CreateDetachedState(BYTE* buffer, DECLSPEC_GUARD_OVERFLOW uint32 bufferLength) override;
 
     private:
         JsFinalizeCallback finalizeCallback;
         void *callbackState;
     };
+
+    // Detached external buffer; the finalizer moves with it to the array buffer it is re-attached to
+    class JsrtExternalArrayBufferDetachedState : public ArrayBufferDetachedStateBase
+    {
+    public:
+        JsFinalizeCallback finalizeCallback;
+        void *callbackState;
+
+        JsrtExternalArrayBufferDetachedState(BYTE* buffer, uint32 bufferLength, JsFinalizeCallback finalizeCallback, void *callbackState)
+            : ArrayBufferDetachedStateBase(TypeIds_ArrayBuffer, buffer, bufferLength, ArrayBufferAllocationType::External),
+            finalizeCallback(finalizeCallback),
+            callbackState(callbackState)
+        {}
+
+        virtual void ClearSelfOnly() override
+        {
+            HeapDelete(this);
+        }
+
+        virtual void DiscardState() override
+        {
+            if (this->finalizeCallback != nullptr)
+            {
+                this->finalizeCallback(this->callbackState);
+                this->finalizeCallback = nullptr;
+            }
+            this->buffer = nullptr;
+            this->bufferLength = 0;
+        }
+
+        virtual void Discard() override
+        {
+            ClearSelfOnly();
+        }
+    };
     AUTO_REGISTER_RECYCLER_OBJECT_DUMPER(JsrtExternalArrayBuffer, &Js::RecyclableObject::DumpObjectFunction);
 }
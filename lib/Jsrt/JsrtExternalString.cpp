@@ -0,0 +1,50 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "jsrtHelper.h"
+#include "JsrtExternalString.h"
+
+namespace Js
+{
+    JsrtExternalString::JsrtExternalString(StaticType* type, const char16* content, charcount_t charLength, JsFinalizeCallback finalizeCallback, void *callbackState)
+        : JavascriptString(type, charLength, content), finalizeCallback(finalizeCallback), callbackState(callbackState)
+    {
+        AssertMsg(!type->GetScriptContext()->GetRecycler()->IsValidObject((void *)content),
+            "JsrtExternalString should not be used with GC strings");
+        Assert(content[charLength] == _u('\0'));
+    }
+
+    JsrtExternalString* JsrtExternalString::New(const char16* content, charcount_t charLength, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext* scriptContext)
+    {
+        Recycler* recycler = scriptContext->GetRecycler();
+        return RecyclerNewFinalized(recycler, JsrtExternalString, scriptContext->GetLibrary()->GetStringTypeStatic(), content, charLength, finalizeCallback, callbackState);
+    }
+
+    RecyclableObject * JsrtExternalString::CloneToScriptContext(ScriptContext* requestContext)
+    {
+        // The copy must not depend on the lifetime of the host buffer
+        return JavascriptString::NewCopyBuffer(this->GetSz(), this->GetLength(), requestContext);
+    }
+
+    void const * JsrtExternalString::GetOriginalStringReference()
+    {
+        // The buffer is not a GC allocation; substrings have to keep this string (and so the
+        // host buffer) alive instead
+        return this;
+    }
+
+    void JsrtExternalString::Finalize(bool isShutdown)
+    {
+        if (finalizeCallback != nullptr)
+        {
+            JsrtCallbackState scope(nullptr);
+            finalizeCallback(callbackState);
+        }
+    }
+
+    void JsrtExternalString::Dispose(bool isShutdown)
+    {
+    }
+}
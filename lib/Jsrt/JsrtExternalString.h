@@ -0,0 +1,29 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js {
+    // A string whose characters stay in host memory. The host is told through the finalize
+    // callback when the string is collected and the buffer can be released.
+    class JsrtExternalString sealed : public JavascriptString
+    {
+    protected:
+        JsrtExternalString(StaticType* type, const char16* content, charcount_t charLength, JsFinalizeCallback finalizeCallback, void *callbackState);
+        DEFINE_VTABLE_CTOR(JsrtExternalString, JavascriptString);
+        DECLARE_CONCRETE_STRING_CLASS;
+
+    public:
+        static JsrtExternalString* New(const char16* content, charcount_t charLength, JsFinalizeCallback finalizeCallback, void *callbackState, ScriptContext* scriptContext);
+        virtual RecyclableObject * CloneToScriptContext(ScriptContext* requestContext) override;
+        virtual void const * GetOriginalStringReference() override;
+        void Finalize(bool isShutdown) override;
+        void Dispose(bool isShutdown) override;
+
+    private:
+        JsFinalizeCallback finalizeCallback;
+        void *callbackState;
+    };
+    AUTO_REGISTER_RECYCLER_OBJECT_DUMPER(JsrtExternalString, &Js::RecyclableObject::DumpObjectFunction);
+}
@@ -15,6 +15,14 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
     this->collectCallback = NULL;
     this->beforeCollectCallback = NULL;
     this->callbackContext = NULL;
+#ifndef NTBUILD
+    this->collectedObjectsCallback = NULL;
+    this->collectedObjectsCallbackState = NULL;
+    this->jitCompileCallback = NULL;
+    this->jitCompileCallbackState = NULL;
+    this->perfHintCallback = NULL;
+    this->perfHintCallbackState = NULL;
+#endif
     this->allocationPolicyManager = threadContext->GetAllocationPolicyManager();
     this->useIdle = useIdle;
     this->dispatchExceptions = dispatchExceptions;
@@ -61,6 +69,9 @@ void JsrtRuntime::Uninitialize()
         RentalThreadContextManager::DestroyThreadContext(tmpThreadContext);
         HeapDelete(currentRuntime);
     }
+
+    // Release the segments the runtimes gave up for each other
+    PageSegmentPool::ReleaseAll();
 }
 
 void JsrtRuntime::CloseContexts()
@@ -76,32 +87,52 @@ void JsrtRuntime::SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollect
 {
     if (beforeCollectCallback != NULL)
     {
-        if (this->collectCallback == NULL)
-        {
-            this->collectCallback = this->threadContext->AddRecyclerCollectCallBack(RecyclerCollectCallbackStatic, this);
-        }
-
         this->beforeCollectCallback = beforeCollectCallback;
         this->callbackContext = callbackContext;
     }
     else
     {
-        if (this->collectCallback != NULL)
-        {
-            this->threadContext->RemoveRecyclerCollectCallBack(this->collectCallback);
-            this->collectCallback = NULL;
-        }
-
         this->beforeCollectCallback = NULL;
         this->callbackContext = NULL;
     }
+    UpdateRecyclerCollectCallback();
+}
+
+#ifndef NTBUILD
+void JsrtRuntime::SetCollectedObjectsCallback(JsCollectedObjectsCallback collectedObjectsCallback, void * collectedObjectsCallbackState)
+{
+    this->collectedObjectsCallback = collectedObjectsCallback;
+    this->collectedObjectsCallbackState = collectedObjectsCallback != NULL ? collectedObjectsCallbackState : NULL;
+    UpdateRecyclerCollectCallback();
+}
+#endif
+
+void JsrtRuntime::UpdateRecyclerCollectCallback()
+{
+    bool needCollectCallback = this->beforeCollectCallback != NULL;
+#ifndef NTBUILD
+    needCollectCallback = needCollectCallback || this->collectedObjectsCallback != NULL;
+#endif
+
+    if (needCollectCallback)
+    {
+        if (this->collectCallback == NULL)
+        {
+            this->collectCallback = this->threadContext->AddRecyclerCollectCallBack(RecyclerCollectCallbackStatic, this);
+        }
+    }
+    else if (this->collectCallback != NULL)
+    {
+        this->threadContext->RemoveRecyclerCollectCallBack(this->collectCallback);
+        this->collectCallback = NULL;
+    }
 }
 
 void JsrtRuntime::RecyclerCollectCallbackStatic(void * context, RecyclerCollectCallBackFlags flags)
 {
-    if (flags & Collect_Begin)
+    JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
+    if ((flags & Collect_Begin) && _this->beforeCollectCallback != NULL)
     {
-        JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
         try
         {
             JsrtCallbackState scope(reinterpret_cast<ThreadContext*>(_this->GetThreadContext()));
@@ -112,13 +143,115 @@ void JsrtRuntime::RecyclerCollectCallbackStatic(void * context, RecyclerCollectC
             AssertMsg(false, "Unexpected non-engine exception.");
         }
     }
+#ifndef NTBUILD
+    else if ((flags & Collect_End) && _this->collectedObjectsCallback != NULL)
+    {
+        Recycler * recycler = _this->GetThreadContext()->GetRecycler();
+        recycler->ReportCollectedObjectTokens([&](void ** tokens, uint count)
+        {
+            try
+            {
+                JsrtCallbackState scope(reinterpret_cast<ThreadContext*>(_this->GetThreadContext()));
+                _this->collectedObjectsCallback(tokens, count, _this->collectedObjectsCallbackState);
+            }
+            catch (...)
+            {
+                AssertMsg(false, "Unexpected non-engine exception.");
+            }
+        });
+    }
+#endif
+}
+
+#ifndef NTBUILD
+void JsrtRuntime::SetJitCompileCallback(JsJitCompileCallback jitCompileCallback, void * jitCompileCallbackState)
+{
+    // Clearing the thread context's callback waits for deliveries in flight, so no codegen can see the
+    // fields below while they are being updated
+    this->threadContext->SetJitCompileCallback(nullptr, nullptr);
+    this->jitCompileCallbackState = jitCompileCallbackState;
+    this->jitCompileCallback = jitCompileCallback;
+    if (jitCompileCallback != NULL)
+    {
+        this->threadContext->SetJitCompileCallback(JitCompileCallbackStatic, this);
+    }
 }
 
+void JsrtRuntime::JitCompileCallbackStatic(void * context, ThreadContext::JitCompileStatistics const& statistics)
+{
+    JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
+    JsJitCompileCallback callback = _this->jitCompileCallback;
+    if (callback == NULL)
+    {
+        return;
+    }
+
+    JsJitCompileStatistics jitStatistics;
+    jitStatistics.sourceContext = (JsSourceContext)statistics.functionBody->GetHostSourceContext();
+    jitStatistics.line = statistics.functionBody->GetLineNumber();
+    jitStatistics.column = statistics.functionBody->GetColumnNumber();
+    jitStatistics.isLoopBody = statistics.isLoopBody;
+    jitStatistics.irBuilderTime = statistics.irBuilderTime;
+    jitStatistics.globOptTime = statistics.globOptTime;
+    jitStatistics.lowererTime = statistics.lowererTime;
+    jitStatistics.regAllocTime = statistics.regAllocTime;
+    jitStatistics.encoderTime = statistics.encoderTime;
+    jitStatistics.codeSize = statistics.codeSize;
+    jitStatistics.bailOutCount = statistics.bailOutCount;
+    callback(&jitStatistics, _this->jitCompileCallbackState);
+}
+
+void JsrtRuntime::SetPerfHintCallback(JsPerfHintCallback perfHintCallback, void * perfHintCallbackState, uint maxHintsPerSecond)
+{
+    // As with the JIT compile callback, clearing the thread context's callback waits for reports in flight
+    this->threadContext->SetPerfHintCallback(nullptr, nullptr, 0);
+    this->perfHintCallbackState = perfHintCallbackState;
+    this->perfHintCallback = perfHintCallback;
+    if (perfHintCallback != NULL)
+    {
+        this->threadContext->SetPerfHintCallback(PerfHintCallbackStatic, this, maxHintsPerSecond);
+    }
+}
+
+void JsrtRuntime::PerfHintCallbackStatic(void * context, ThreadContext::PerfHintReport const& report)
+{
+    JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
+    JsPerfHintCallback callback = _this->perfHintCallback;
+    if (callback == NULL)
+    {
+        return;
+    }
+
+    const PerfHintItem& item = s_perfHintContainer[(uint)report.hint];
+    Js::FunctionBody * functionBody = report.functionBody;
+    SourceContextInfo * sourceContextInfo = functionBody->GetSourceContextInfo();
+
+    JsPerfHint perfHint;
+    perfHint.name = item.name;
+    perfHint.description = reinterpret_cast<const uint16_t *>(item.description);
+    perfHint.consequences = reinterpret_cast<const uint16_t *>(item.consequences);
+    perfHint.suggestion = reinterpret_cast<const uint16_t *>(item.suggestion);
+    perfHint.isNotOptimized = item.isNotOptimized;
+    perfHint.sourceContext = (JsSourceContext)functionBody->GetHostSourceContext();
+    perfHint.sourceUrl = sourceContextInfo->IsDynamic() ? nullptr : reinterpret_cast<const uint16_t *>(sourceContextInfo->url);
+    perfHint.functionName = reinterpret_cast<const uint16_t *>(functionBody->GetExternalDisplayName());
+    perfHint.line = report.line;
+    perfHint.column = report.column;
+    perfHint.droppedCount = report.droppedCount;
+    callback(&perfHint, _this->perfHintCallbackState);
+}
+#endif
+
 unsigned int JsrtRuntime::Idle()
 {
     return this->threadService.Idle();
 }
 
+unsigned int JsrtRuntime::IdleWithDeadline(unsigned int deadline)
+{
+    return this->threadService.IdleWithDeadline(deadline);
+}
+
 void JsrtRuntime::EnsureJsrtDebugManager()
 {
     if (this->jsrtDebugManager == nullptr)
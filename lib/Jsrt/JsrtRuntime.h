@@ -31,11 +31,17 @@ public:
 
     bool UseIdle() const { return useIdle; }
     unsigned int Idle();
+    unsigned int IdleWithDeadline(unsigned int deadline);
 
     bool DispatchExceptions() const { return dispatchExceptions; }
 
     void CloseContexts();
     void SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollectCallback, void * callbackContext);
+#ifndef NTBUILD
+    void SetCollectedObjectsCallback(JsCollectedObjectsCallback collectedObjectsCallback, void * collectedObjectsCallbackState);
+    void SetJitCompileCallback(JsJitCompileCallback jitCompileCallback, void * jitCompileCallbackState);
+    void SetPerfHintCallback(JsPerfHintCallback perfHintCallback, void * perfHintCallbackState, uint maxHintsPerSecond);
+#endif
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     void SetSerializeByteCodeForLibrary(bool set) { serializeByteCodeForLibrary = set; }
@@ -47,7 +53,12 @@ public:
     JsrtDebugManager * GetJsrtDebugManager();
 
 private:
+    void UpdateRecyclerCollectCallback();
     static void __cdecl RecyclerCollectCallbackStatic(void * context, RecyclerCollectCallBackFlags flags);
+#ifndef NTBUILD
+    static void __cdecl JitCompileCallbackStatic(void * context, ThreadContext::JitCompileStatistics const& statistics);
+    static void __cdecl PerfHintCallbackStatic(void * context, ThreadContext::PerfHintReport const& report);
+#endif
 
 private:
     ThreadContext * threadContext;
@@ -57,6 +68,14 @@ private:
     JsBeforeCollectCallback beforeCollectCallback;
     JsrtThreadService threadService;
     void * callbackContext;
+#ifndef NTBUILD
+    JsCollectedObjectsCallback collectedObjectsCallback;
+    void * collectedObjectsCallbackState;
+    JsJitCompileCallback jitCompileCallback;
+    void * jitCompileCallbackState;
+    JsPerfHintCallback perfHintCallback;
+    void * perfHintCallbackState;
+#endif
     bool useIdle;
     bool dispatchExceptions;
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
@@ -37,6 +37,32 @@ unsigned int JsrtThreadService::Idle()
     return nextIdleTick;
 }
 
+unsigned int JsrtThreadService::IdleWithDeadline(unsigned int deadline)
+{
+    Assert(deadline != 0);
+
+    if (nextIdleTick == UINT_MAX)
+    {
+        // No idle work is scheduled
+        return nextIdleTick;
+    }
+
+    // The host is idle for the whole deadline, so pending idle work doesn't need to wait for
+    // its timeout. Bound the in-thread pauses of that work by the deadline.
+    Recycler * recycler = GetThreadContext()->GetRecycler();
+    DWORD pauseTarget = recycler->GetPauseTarget();
+    if (pauseTarget == 0 || pauseTarget > deadline)
+    {
+        recycler->SetPauseTarget(deadline);
+    }
+
+    AdvanceIdleCollect();
+    IdleCollect();
+
+    recycler->SetPauseTarget(pauseTarget);
+    return nextIdleTick;
+}
+
 bool JsrtThreadService::OnScheduleIdleCollect(uint ticks, bool /* canScheduleAsTask */)
 {
     nextIdleTick = GetTickCount() + ticks;
@@ -14,6 +14,7 @@ public:
 
     bool Initialize(ThreadContext *threadContext);
     unsigned int Idle();
+    unsigned int IdleWithDeadline(unsigned int deadline);
 
     // Does nothing, we don't force idle collection for JSRT
     void SetForceOneIdleCollection() override {}
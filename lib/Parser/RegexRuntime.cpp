@@ -417,6 +417,92 @@ namespace UnifiedRegex
     }
 #endif
 
+    // ----------------------------------------------------------------------
+    // Vectorized scanning (used by the literal scanners and the SyncToChar* instructions)
+    // ----------------------------------------------------------------------
+
+    // Comparison stats only count scalar compares, so the vector paths are skipped while profiling
+    inline bool UseSimdScan()
+    {
+        return !PHASE_OFF1(Js::RegexSimdSyncPhase) && !REGEX_CONFIG_FLAG(RegexProfile);
+    }
+
+    // Advance inputOffset over whole blocks of 8 characters holding neither c0 nor c1, stopping at the first match.
+    // The caller's scalar loop handles the final partial block.
+    inline void SkipToChar2(const Char* const input, CharCount& inputOffset, const CharCount inputLength, const Char c0, const Char c1)
+    {
+#if defined(_M_IX86) || defined(_M_X64)
+        CompileAssert(sizeof(Char) == sizeof(uint16));
+        if (!UseSimdScan())
+        {
+            return;
+        }
+
+        const __m128i match0 = _mm_set1_epi16((short)c0);
+        const __m128i match1 = _mm_set1_epi16((short)c1);
+        while (inputOffset < inputLength && inputLength - inputOffset >= 8)
+        {
+            const __m128i block = _mm_loadu_si128((const __m128i *)(input + inputOffset));
+            const int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(block, match0), _mm_cmpeq_epi16(block, match1)));
+            if (mask != 0)
+            {
+                DWORD index;
+                _BitScanForward(&index, (DWORD)mask);
+                inputOffset += index / sizeof(Char);
+                return;
+            }
+            inputOffset += 8;
+        }
+#endif
+    }
+
+    // Look for a case sensitive literal (of at most MaxSimdLiteralLength characters) 8 start positions at a time,
+    // using its first and last characters as a filter. Returns true with inputOffset at the first match; otherwise
+    // inputOffset is left at the first start position not yet examined, for the caller's scalar scanner to resume from.
+    static const CharCount MaxSimdLiteralLength = 16;
+
+    inline bool FindLiteral(const char16* const input, const CharCount inputLength, CharCount& inputOffset, const char16* const pat, const CharCount patLen)
+    {
+        Assert(patLen >= 2);
+        Assert(inputOffset <= inputLength);
+#if defined(_M_IX86) || defined(_M_X64)
+        if (patLen > MaxSimdLiteralLength || !UseSimdScan())
+        {
+            return false;
+        }
+
+        const CharCount lastPatCharIndex = patLen - 1;
+        const __m128i first = _mm_set1_epi16((short)pat[0]);
+        const __m128i last = _mm_set1_epi16((short)pat[lastPatCharIndex]);
+
+        // Each block covers start positions [offset, offset + 8), reading up to offset + 7 + lastPatCharIndex
+        CharCount offset = inputOffset;
+        while (inputLength - offset >= 8 + lastPatCharIndex)
+        {
+            const __m128i blockFirst = _mm_loadu_si128((const __m128i *)(input + offset));
+            const __m128i blockLast = _mm_loadu_si128((const __m128i *)(input + offset + lastPatCharIndex));
+            DWORD mask = (DWORD)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi16(blockFirst, first), _mm_cmpeq_epi16(blockLast, last)));
+            while (mask != 0)
+            {
+                DWORD index;
+                _BitScanForward(&index, mask);
+                const CharCount candidate = offset + index / sizeof(char16);
+                if (patLen == 2 || memcmp(input + candidate + 1, pat + 1, (patLen - 2) * sizeof(char16)) == 0)
+                {
+                    inputOffset = candidate;
+                    return true;
+                }
+
+                // Clear both mask bits of this character
+                mask &= ~((DWORD)0x3 << index);
+            }
+            offset += 8;
+        }
+        inputOffset = offset;
+#endif
+        return false;
+    }
+
     // ----------------------------------------------------------------------
     // Char2LiteralScannerMixin
     // ----------------------------------------------------------------------
@@ -428,6 +514,11 @@ namespace UnifiedRegex
             return false;
         }
 
+        if (FindLiteral(input, inputLength, inputOffset, cs, 2))
+        {
+            return true;
+        }
+
         const uint matchC0 = Chars<char16>::CTU(cs[0]);
         const uint matchC1 = Chars<char16>::CTU(cs[1]);
 
@@ -524,6 +615,10 @@ namespace UnifiedRegex
     ScannerMixinT<ScannerT>::Match(Matcher& matcher, const char16 * const input, const CharCount inputLength, CharCount& inputOffset) const
     {
         Assert(length <= matcher.program->rep.insts.litbufLen - offset);
+        if (length >= 2 && FindLiteral(input, inputLength, inputOffset, matcher.program->rep.insts.litbuf + offset, length))
+        {
+            return true;
+        }
         return scanner.template Match<1>
             ( input
             , inputLength
@@ -1656,6 +1751,7 @@ namespace UnifiedRegex
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
+        SkipToChar2(input, inputOffset, inputLength, matchC, matchC);
         while (inputOffset < inputLength && input[inputOffset] != matchC)
         {
 #if ENABLE_REGEX_CONFIG_OPTIONS
@@ -1690,6 +1786,7 @@ namespace UnifiedRegex
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
+        SkipToChar2(input, inputOffset, inputLength, matchC0, matchC1);
         while (inputOffset < inputLength && input[inputOffset] != matchC0 && input[inputOffset] != matchC1)
         {
 #if ENABLE_REGEX_CONFIG_OPTIONS
@@ -1793,6 +1890,7 @@ namespace UnifiedRegex
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
+        SkipToChar2(input, inputOffset, inputLength, matchC, matchC);
         while (inputOffset < inputLength && input[inputOffset] != matchC)
         {
 #if ENABLE_REGEX_CONFIG_OPTIONS
@@ -1830,6 +1928,7 @@ namespace UnifiedRegex
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
+        SkipToChar2(input, inputOffset, inputLength, matchC0, matchC1);
         while (inputOffset < inputLength && (input[inputOffset] != matchC0 && input[inputOffset] != matchC1))
         {
 #if ENABLE_REGEX_CONFIG_OPTIONS
@@ -1951,6 +2050,7 @@ namespace UnifiedRegex
             inputOffset = matchStart + backup.lower;
 
         const Char matchC = c;
+        SkipToChar2(input, inputOffset, inputLength, matchC, matchC);
         while (inputOffset < inputLength && input[inputOffset] != matchC)
         {
 #if ENABLE_REGEX_CONFIG_OPTIONS
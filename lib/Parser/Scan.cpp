@@ -1586,6 +1586,46 @@ tokens Scanner<EncodingPolicy>::ScanStringConstant(OLECHAR delim, EncodedCharPtr
     return ScanStringConstant<false, false>(delim, pp);
 }
 
+/*****************************************************************************
+*
+*  Skip the run of comment characters that need no handling: single unit
+*  characters other than line breaks, NUL and stopChar. For UTF8 source this
+*  is done 16 bytes at a time; the caller handles the character we stop at.
+*/
+template<typename EncodingPolicy>
+typename Scanner<EncodingPolicy>::EncodedCharPtr Scanner<EncodingPolicy>::SkipCommentRun(EncodedCharPtr p, EncodedCharPtr last, EncodedChar stopChar)
+{
+#if defined(_M_IX86) || defined(_M_X64)
+    if (EncodingPolicy::MultiUnitEncoding && !PHASE_OFF1(Js::FastCommentScanPhase))
+    {
+        Assert(sizeof(EncodedChar) == 1);
+        const __m128i stop = _mm_set1_epi8((char)stopChar);
+        const __m128i newLine = _mm_set1_epi8(kchNWL);
+        const __m128i carriageReturn = _mm_set1_epi8(kchRET);
+        const __m128i nul = _mm_setzero_si128();
+
+        // The source is NUL terminated at last, so only read whole blocks before it
+        while (last - p >= 16)
+        {
+            const __m128i block = _mm_loadu_si128((const __m128i *)p);
+            __m128i special = _mm_or_si128(_mm_cmpeq_epi8(block, stop), _mm_cmpeq_epi8(block, newLine));
+            special = _mm_or_si128(special, _mm_or_si128(_mm_cmpeq_epi8(block, carriageReturn), _mm_cmpeq_epi8(block, nul)));
+
+            // Bytes with the high bit set start or continue a multi unit character
+            const int mask = _mm_movemask_epi8(special) | _mm_movemask_epi8(block);
+            if (mask != 0)
+            {
+                DWORD index;
+                _BitScanForward(&index, (DWORD)mask);
+                return p + index;
+            }
+            p += 16;
+        }
+    }
+#endif
+    return p;
+}
+
 /*****************************************************************************
 *
 *  Consume a C-style comment.
@@ -1601,6 +1641,7 @@ tokens Scanner<EncodingPolicy>::SkipComment(EncodedCharPtr *pp, /* out */ bool*
 
     for (;;)
     {
+        p = SkipCommentRun(p, last, '*');
         switch((ch = this->ReadFirst(p, last)))
         {
         case '*':
@@ -2157,6 +2198,7 @@ LSkipLineComment:
                 pchT = NULL;
                 for (;;)
                 {
+                    p = SkipCommentRun(p, last, kchNWL);
                     switch ((ch = this->ReadFirst(p, last)))
                     {
                     case kchLS:         // 0x2028, classifies as new line
@@ -758,6 +758,7 @@ private:
     BOOL FastIdentifierContinue(EncodedCharPtr&p, EncodedCharPtr last);
     tokens ScanIdentifierContinue(bool identifyKwds, bool fHasEscape, bool fHasMultiChar, EncodedCharPtr pchMin, EncodedCharPtr p, EncodedCharPtr *pp);
     tokens SkipComment(EncodedCharPtr *pp, /* out */ bool* containTypeDef);
+    EncodedCharPtr SkipCommentRun(EncodedCharPtr p, EncodedCharPtr last, EncodedChar stopChar);
     tokens ScanRegExpConstant(ArenaAllocator* alloc);
     tokens ScanRegExpConstantNoAST(ArenaAllocator* alloc);
     BOOL oFScanNumber(double *pdbl, bool& likelyInt);
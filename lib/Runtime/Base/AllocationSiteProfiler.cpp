@@ -0,0 +1,92 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+
+namespace Js
+{
+    AllocationSiteProfiler::AllocationSiteProfiler(ThreadContext * threadContext) :
+        threadContext(threadContext),
+        sampleInterval(0),
+        siteMap(&HeapAllocator::Instance)
+    {
+    }
+
+    AllocationSiteProfiler::~AllocationSiteProfiler()
+    {
+        this->Stop();
+    }
+
+    void AllocationSiteProfiler::Start(size_t sampleInterval)
+    {
+        Assert(sampleInterval != 0);
+        this->sampleInterval = sampleInterval;
+        this->siteMap.Clear();
+        this->threadContext->EnsureRecycler()->SetAllocationSampling(sampleInterval, &AllocationSiteProfiler::SampleCallback, this);
+    }
+
+    void AllocationSiteProfiler::Stop()
+    {
+        if (this->sampleInterval == 0)
+        {
+            return;
+        }
+
+        this->sampleInterval = 0;
+        Recycler * recycler = this->threadContext->GetRecycler();
+        if (recycler != nullptr)
+        {
+            recycler->SetAllocationSampling(0, nullptr, nullptr);
+        }
+    }
+
+    void AllocationSiteProfiler::SampleCallback(size_t size, void * callbackState)
+    {
+        ((AllocationSiteProfiler *)callbackState)->Sample(size);
+    }
+
+    void AllocationSiteProfiler::Sample(size_t size)
+    {
+        // Allocations made outside of script, e.g. by the host, have no allocation site
+        ScriptEntryExitRecord * entryExitRecord = this->threadContext->GetScriptEntryExit();
+        if (!this->threadContext->IsInScript() || entryExitRecord == nullptr)
+        {
+            return;
+        }
+
+        // Attribute allocations made by library code to the script that called it
+        JavascriptStackWalker walker(entryExitRecord->scriptContext, TRUE);
+        JavascriptFunction * function = nullptr;
+        if (!walker.GetNonLibraryCodeCaller(&function) || function == nullptr || !function->GetFunctionInfo()->HasBody())
+        {
+            return;
+        }
+
+        FunctionBody * functionBody = function->GetFunctionInfo()->GetFunctionBody();
+        SiteKey key;
+        key.sourceContext = functionBody->GetHostSourceContext();
+        key.line = functionBody->GetLineNumber();
+        key.column = functionBody->GetColumnNumber();
+        key.bytecodeOffset = walker.GetByteCodeOffset();
+
+        // The sample is taken in the middle of an allocation that may not be allowed to throw; drop it on OOM
+        try
+        {
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
+
+            SiteData * data = nullptr;
+            if (!this->siteMap.TryGetReference(key, &data))
+            {
+                SiteData newData = { 0, 0 };
+                int index = this->siteMap.Add(key, newData);
+                data = this->siteMap.GetReferenceAt(index);
+            }
+            data->sampleCount++;
+            data->sampledBytes += size;
+        }
+        catch (Js::OutOfMemoryException)
+        {
+        }
+    }
+}
@@ -0,0 +1,58 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // Samples a thread's recycler allocations once every sampleInterval bytes, and aggregates the samples by
+    // the script function and bytecode offset that made them. Sites are keyed by source position instead of
+    // FunctionBody so that they stay valid after the function is collected.
+    class AllocationSiteProfiler
+    {
+    public:
+        struct SiteKey
+        {
+            DWORD_PTR sourceContext;
+            ULONG line;
+            ULONG column;
+            uint32 bytecodeOffset;
+
+            operator hash_t() const { return (hash_t)sourceContext ^ (line << 16) ^ column ^ (bytecodeOffset << 8); }
+            bool operator ==(const SiteKey &other) const
+            {
+                return sourceContext == other.sourceContext && line == other.line &&
+                    column == other.column && bytecodeOffset == other.bytecodeOffset;
+            }
+        };
+
+        struct SiteData
+        {
+            size_t sampleCount;
+            size_t sampledBytes;
+        };
+
+        AllocationSiteProfiler(ThreadContext * threadContext);
+        ~AllocationSiteProfiler();
+
+        void Start(size_t sampleInterval);
+        void Stop();
+        bool IsSampling() const { return this->sampleInterval != 0; }
+        size_t GetSampleInterval() const { return this->sampleInterval; }
+
+        template <typename Fn>
+        void MapSites(Fn fn) const
+        {
+            this->siteMap.Map(fn);
+        }
+
+    private:
+        static void SampleCallback(size_t size, void * callbackState);
+        void Sample(size_t size);
+
+        ThreadContext * threadContext;
+        size_t sampleInterval;
+        JsUtil::BaseDictionary<SiteKey, SiteData, HeapAllocator> siteMap;
+    };
+}
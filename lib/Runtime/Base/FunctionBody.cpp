@@ -15,6 +15,9 @@
 #ifdef VTUNE_PROFILING
 #include "Base/VTuneChakraProfile.h"
 #endif
+#ifdef PERF_MAP_PROFILING
+#include "Base/PerfMapChakraProfile.h"
+#endif
 
 #ifdef DYNAMIC_PROFILE_MUTATOR
 #include "Language/DynamicProfileMutator.h"
@@ -973,6 +976,60 @@ namespace Js
         }
     }
 
+    void
+    FunctionBody::GetMemoryUsage(MemoryUsage * usage) const
+    {
+        memset(usage, 0, sizeof(MemoryUsage));
+
+        ByteBlock * byteCode = this->GetByteCode();
+        if (byteCode != nullptr)
+        {
+            usage->byteCodeBytes = byteCode->GetLength();
+        }
+        ByteBlock * auxBlock = this->GetAuxiliaryData();
+        if (auxBlock != nullptr)
+        {
+            usage->auxiliaryDataBytes += auxBlock->GetLength();
+        }
+        ByteBlock * auxContextBlock = this->GetAuxiliaryContextData();
+        if (auxContextBlock != nullptr)
+        {
+            usage->auxiliaryDataBytes += auxContextBlock->GetLength();
+        }
+
+        // The caches are allocated individually, with one pointer per cache in the function's cache array
+        if (this->inlineCaches != nullptr)
+        {
+            usage->inlineCacheBytes =
+                (size_t)this->GetInlineCacheCount() * (sizeof(void*) + sizeof(InlineCache)) +
+                (size_t)this->GetIsInstInlineCacheCount() * (sizeof(void*) + sizeof(IsInstInlineCache));
+        }
+
+#if ENABLE_NATIVE_CODEGEN
+        auto addEntryPoint = [usage](EntryPointInfo * entryPoint)
+        {
+            if (entryPoint->IsCodeGenDone())
+            {
+                usage->nativeCodeBytes += entryPoint->GetCodeSize();
+                usage->nativeDataBytes += entryPoint->GetNativeDataSize();
+                usage->nativeEntryPointCount++;
+            }
+        };
+
+        this->MapEntryPoints([&](int, FunctionEntryPointInfo * entryPoint)
+        {
+            addEntryPoint(entryPoint);
+        });
+        this->MapLoopHeaders([&](uint, LoopHeader * loopHeader)
+        {
+            loopHeader->MapEntryPoints([&](int, LoopEntryPointInfo * entryPoint)
+            {
+                addEntryPoint(entryPoint);
+            });
+        });
+#endif
+    }
+
     const char16* ParseableFunctionInfo::GetExternalDisplayName() const
     {
         return GetExternalDisplayName(this);
@@ -3580,6 +3637,9 @@ namespace Js
                 this->SetOriginalEntryPoint(this->m_scriptContext->GetNextDynamicInterpreterThunk(&this->m_dynamicInterpreterThunk));
             }
             JS_ETW(EtwTrace::LogMethodInterpreterThunkLoadEvent(this));
+#ifdef PERF_MAP_PROFILING
+            PerfMapChakraProfile::LogMethodInterpreterThunkLoadEvent(this);
+#endif
         }
         else
         {
@@ -3702,6 +3762,9 @@ namespace Js
 #ifdef VTUNE_PROFILING
         VTuneChakraProfile::LogMethodNativeLoadEvent(this, entryPointInfo);
 #endif
+#ifdef PERF_MAP_PROFILING
+        PerfMapChakraProfile::LogMethodNativeLoadEvent(this, entryPointInfo);
+#endif
 
 #ifdef _M_ARM
         // For ARM we need to make sure that pipeline is synchronized with memory/cache for newly jitted code.
@@ -3769,6 +3832,9 @@ namespace Js
         JS_ETW(EtwTrace::LogLoopBodyLoadEvent(this, loopHeader, ((LoopEntryPointInfo*)entryPointInfo), ((uint16)loopNum)));
 #ifdef VTUNE_PROFILING
         VTuneChakraProfile::LogLoopBodyLoadEvent(this, loopHeader, ((LoopEntryPointInfo*)entryPointInfo), ((uint16)loopNum));
+#endif
+#ifdef PERF_MAP_PROFILING
+        PerfMapChakraProfile::LogLoopBodyLoadEvent(this, ((LoopEntryPointInfo*)entryPointInfo), ((uint16)loopNum));
 #endif
     }
 #endif
@@ -5907,10 +5973,26 @@ namespace Js
             uint i = 0;
             uint plainInlineCacheEnd = GetRootObjectLoadInlineCacheStart();
             __analysis_assume(plainInlineCacheEnd <= totalCacheCount);
-            for (; i < plainInlineCacheEnd; i++)
+            // The plain caches are allocated in contiguous runs, so the caches the interpreter goes through are
+            // adjacent and take one arena allocation per run. Each cache is still freed on its own (see
+            // CleanUpInlineCaches): a run is made of cache-sized, cache-aligned slots, and the inline cache
+            // allocator free-lists and rewinds by slot. Arena memory tracking, however, expects every free to
+            // match a reported allocation, so with tracking on each cache gets its own allocation.
+#if defined(MEMSPECT_TRACKING) || defined(ETW_MEMORY_TRACKING)
+            const uint maxRunLength = 1;
+#else
+            const uint maxRunLength = MaxPolymorphicInlineCacheSize;
+#endif
+            CompileAssert(sizeof(InlineCache) % InlineCacheAllocatorInfo::ObjectAlignment == 0);
+            while (i < plainInlineCacheEnd)
             {
-                inlineCaches[i] = AllocatorNewZ(InlineCacheAllocator,
-                    this->m_scriptContext->GetInlineCacheAllocator(), InlineCache);
+                uint runLength = min(plainInlineCacheEnd - i, maxRunLength);
+                InlineCache * run = AllocatorNewArrayZ(InlineCacheAllocator,
+                    this->m_scriptContext->GetInlineCacheAllocator(), InlineCache, runLength);
+                for (uint j = 0; j < runLength; j++, i++)
+                {
+                    inlineCaches[i] = &run[j];
+                }
             }
             Js::RootObjectBase * rootObject = this->GetRootObject();
             ThreadContext * threadContext = this->GetScriptContext()->GetThreadContext();
@@ -7599,6 +7681,9 @@ namespace Js
                         {
                             unregisteredInlineCacheCount++;
                         }
+                        // Plain caches may be slots of a run allocated by AllocateInlineCache; freeing one slot at a
+                        // time is only valid for cache-aligned slots.
+                        Assert(((size_t)inlineCache & (InlineCacheAllocatorInfo::ObjectAlignment - 1)) == 0);
                         AllocatorDelete(InlineCacheAllocator, this->m_scriptContext->GetInlineCacheAllocator(), inlineCache);
                     }
                 }
@@ -9025,6 +9110,28 @@ namespace Js
         }
     }
 
+    size_t EntryPointInfo::GetNativeDataSize() const
+    {
+        // The native data is freed on cleanup without clearing the pointers, so only look at it while the code is live
+        if (!this->IsCodeGenDone())
+        {
+            return 0;
+        }
+
+        if (this->nativeDataBuffer != nullptr) // OOP JIT
+        {
+            NativeDataBuffer* buffer = (NativeDataBuffer*)(this->nativeDataBuffer - offsetof(NativeDataBuffer, data));
+            return buffer->len;
+        }
+
+        if (this->inProcJITNaticeCodedata != nullptr)
+        {
+            return GetNativeCodeDataSize(this->inProcJITNaticeCodedata);
+        }
+
+        return 0;
+    }
+
     void EntryPointInfo::FreeJitTransferData()
     {
         JitTransferData* jitTransferData = this->jitTransferData;
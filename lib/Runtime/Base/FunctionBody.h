@@ -624,6 +624,7 @@ namespace Js
         char** GetNativeDataBufferRef() { return &nativeDataBuffer; }
         char* GetNativeDataBuffer() { return nativeDataBuffer; }
         void SetInProcJITNativeCodeData(NativeCodeData* nativeCodeData) { inProcJITNaticeCodedata = nativeCodeData; }
+        size_t GetNativeDataSize() const;
         void SetNumberChunks(CodeGenNumberChunk* chunks)
         {
             Assert(numberPageSegments == nullptr);
@@ -2606,6 +2607,19 @@ namespace Js
         Var GetFormalsPropIdArrayOrNullObj();
         ByteBlock* GetByteCode() const;
         ByteBlock* GetOriginalByteCode(); // Returns original bytecode without probes (such as BPs).
+
+        // The memory held by the function for its bytecode, inline caches and jitted code. The inline cache
+        // size is an estimate from the cache counts; the native sizes cover every entry point with code.
+        struct MemoryUsage
+        {
+            size_t byteCodeBytes;
+            size_t auxiliaryDataBytes;
+            size_t inlineCacheBytes;
+            size_t nativeCodeBytes;
+            size_t nativeDataBytes;
+            uint nativeEntryPointCount;
+        };
+        void GetMemoryUsage(MemoryUsage * usage) const;
         Js::ByteCodeCache * GetByteCodeCache() const { return this->byteCodeCache; }
         void SetByteCodeCache(Js::ByteCodeCache *byteCodeCache)
         {
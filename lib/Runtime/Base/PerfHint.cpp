@@ -6,11 +6,16 @@
 
 const PerfHintItem s_perfHintContainer[] =
 {
-#define PERFHINT_REASON(name, isNotOptimized, level, desc, consequences, suggestion) {desc, consequences, suggestion, level, isNotOptimized},
+#define PERFHINT_REASON(name, isNotOptimized, level, desc, consequences, suggestion) {#name, desc, consequences, suggestion, level, isNotOptimized},
 #include "PerfHintDescriptions.h"
 #undef PERFHINT_REASON
 };
 
+bool IsPerfHintEnabled(Js::ScriptContext * scriptContext)
+{
+    return PHASE_TRACE1(Js::PerfHintPhase) || scriptContext->GetThreadContext()->GetPerfHintCallback()->IsSet();
+}
+
 void WritePerfHint(PerfHints hint, Js::FunctionBody * functionBody, uint byteCodeOffset /*= Js::Constants::NoByteCodeOffset*/)
 {
     Assert(functionBody);
@@ -21,32 +26,60 @@ void WritePerfHint(PerfHints hint, Js::FunctionBody * functionBody, uint byteCod
     int level = CONFIG_FLAG(PerfHintLevel);
     Assert(level <= (int)PerfHintLevels::VERBOSE);
 
-    if ((int)item.level <= level)
+    // Only the critical hints go to the host; the verbose ones would use up its rate limit
+    ThreadContext * threadContext = functionBody->GetScriptContext()->GetThreadContext();
+    ThreadContext::BackgroundCallback<ThreadContext::PerfHintCallbackFunction> * perfHintCallback = threadContext->GetPerfHintCallback();
+    uint droppedCount = 0;
+    bool report = perfHintCallback->IsSet() && item.level == PerfHintLevels::L1 && threadContext->TryBeginPerfHintReport(&droppedCount);
+    bool trace = PHASE_TRACE1(Js::PerfHintPhase) && (int)item.level <= level;
+
+    if (report || trace)
     {
         ULONG lineNumber = functionBody->GetLineNumber();
         LONG columnNumber = functionBody->GetColumnNumber();
-        if (byteCodeOffset != Js::Constants::NoByteCodeOffset)
+        bool hasByteCodeOffset = byteCodeOffset != Js::Constants::NoByteCodeOffset;
+        if (hasByteCodeOffset)
         {
             functionBody->GetLineCharOffset(byteCodeOffset, &lineNumber, &columnNumber, false /*canAllocateLineCache*/);
+        }
 
-            // returned values are 0-based. Adjusting.
-            lineNumber++;
-            columnNumber++;
+        if (report)
+        {
+            ThreadContext::PerfHintReport perfHintReport;
+            perfHintReport.hint = hint;
+            perfHintReport.functionBody = functionBody;
+            perfHintReport.line = lineNumber;
+            perfHintReport.column = columnNumber;
+            perfHintReport.droppedCount = droppedCount;
+            perfHintCallback->Invoke([&](ThreadContext::PerfHintCallbackFunction function, void * context)
+            {
+                function(context, perfHintReport);
+            });
         }
 
-        // We will print the short name.
-        TCHAR shortName[255];
-        Js::FunctionBody::GetShortNameFromUrl(functionBody->GetSourceName(), shortName, 255);
-
-        OUTPUT_TRACE(Js::PerfHintPhase, _u("%s : %s {\n      Function : %s [%s @ %u, %u]\n  Consequences : %s\n    Suggestion : %s\n}\n"),
-            item.isNotOptimized ? _u("Not optimized") : _u("Optimized"),
-            item.description,
-            functionBody->GetExternalDisplayName(),
-            shortName,
-            lineNumber,
-            columnNumber,
-            item.consequences,
-            item.suggestion);
-        Output::Flush();
+        if (trace)
+        {
+            if (hasByteCodeOffset)
+            {
+                // returned values are 0-based. Adjusting.
+                lineNumber++;
+                columnNumber++;
+            }
+
+            // We will print the short name.
+            TCHAR shortName[255];
+            Js::FunctionBody::GetShortNameFromUrl(functionBody->GetSourceName(), shortName, 255);
+
+            OUTPUT_TRACE(Js::PerfHintPhase, _u("%s : %s {\n      Function : %s [%s @ %u, %u]\n  Consequences : %s\n    Suggestion : %s\n}\n"),
+                item.isNotOptimized ? _u("Not optimized") : _u("Optimized"),
+                item.description,
+                functionBody->GetExternalDisplayName(),
+                shortName,
+                lineNumber,
+                columnNumber,
+                item.consequences,
+                item.suggestion);
+            Output::Flush();
+        }
     }
 }
@@ -20,6 +20,7 @@ enum PerfHints : uint
 
 struct PerfHintItem
 {
+    const char * name;
     LPCWSTR description;
     LPCWSTR consequences;
     LPCWSTR suggestion;
@@ -29,5 +30,7 @@ struct PerfHintItem
 
 extern const PerfHintItem s_perfHintContainer[];
 
+// Whether hints are wanted, either for -trace:PerfHint or for a host callback
+bool IsPerfHintEnabled(Js::ScriptContext * scriptContext);
 void WritePerfHint(PerfHints hint, Js::FunctionBody * functionBody, uint byteCodeOffset = Js::Constants::NoByteCodeOffset);
 
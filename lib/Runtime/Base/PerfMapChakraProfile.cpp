@@ -0,0 +1,112 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+
+#ifdef PERF_MAP_PROFILING
+
+#include "PerfMapChakraProfile.h"
+
+static const char PerfMapDynamicCode[] = "Dynamic code";
+
+//
+// The flags can be set by the host after the dll is loaded, so the output files are opened
+// on the first code load instead of at process attach.
+//
+bool PerfMapChakraProfile::IsEnabled()
+{
+    return CONFIG_FLAG_RELEASE(PerfMap) && PlatformAgnostic::PerfMap::EnsureInitialized(CONFIG_FLAG_RELEASE(PerfJitDump));
+}
+
+void PerfMapChakraProfile::LogMethodInterpreterThunkLoadEvent(Js::FunctionBody* body)
+{
+#if DYNAMIC_INTERPRETER_THUNK
+    if (IsEnabled())
+    {
+        LogCodeLoad(body, body->GetDynamicInterpreterEntryPoint(), body->GetDynamicInterpreterThunkSize(), "Interpreted", 0);
+    }
+#endif
+}
+
+void PerfMapChakraProfile::LogMethodNativeLoadEvent(Js::FunctionBody* body, Js::FunctionEntryPointInfo* entryPoint)
+{
+#if ENABLE_NATIVE_CODEGEN
+    if (IsEnabled())
+    {
+        const char* tier = entryPoint->GetJitMode() == ExecutionMode::SimpleJit ? "SimpleJit" : "FullJit";
+        LogCodeLoad(body, (void*)entryPoint->GetNativeAddress(), entryPoint->GetCodeSize(), tier, 0);
+    }
+#endif
+}
+
+void PerfMapChakraProfile::LogLoopBodyLoadEvent(Js::FunctionBody* body, Js::LoopEntryPointInfo* entryPoint, uint16 loopNumber)
+{
+#if ENABLE_NATIVE_CODEGEN
+    if (IsEnabled())
+    {
+        LogCodeLoad(body, (void*)entryPoint->GetNativeAddress(), entryPoint->GetCodeSize(), "FullJit", loopNumber + 1);
+    }
+#endif
+}
+
+//
+// Writes "JS:<name> [Loop <n>] [<tier>] <url>:<line>"; perf shows it verbatim in place of the address.
+//
+void PerfMapChakraProfile::LogCodeLoad(Js::FunctionBody* body, const void* address, size_t size, const char* tier, uint loopNumber)
+{
+    if (address == nullptr || size == 0)
+    {
+        return;
+    }
+
+    const char16* methodName = body->GetExternalDisplayName();
+    size_t methodLength = min(wcslen(methodName), (size_t)UINT_MAX);
+    size_t utf8MethodLength = methodLength * 3 + 1;
+    utf8char_t* utf8MethodName = HeapNewNoThrowArray(utf8char_t, utf8MethodLength);
+    if (utf8MethodName == nullptr)
+    {
+        return;
+    }
+    utf8::EncodeIntoAndNullTerminate(utf8MethodName, methodName, (charcount_t)methodLength);
+
+    const char* url = PerfMapDynamicCode;
+    utf8char_t* utf8Url = nullptr;
+    size_t utf8UrlLength = 0;
+    if (!body->GetSourceContextInfo()->IsDynamic() && body->GetSourceContextInfo()->url != nullptr)
+    {
+        const char16* sourceUrl = body->GetSourceContextInfo()->url;
+        size_t urlLength = min(wcslen(sourceUrl), (size_t)UINT_MAX);
+        utf8UrlLength = urlLength * 3 + 1;
+        utf8Url = HeapNewNoThrowArray(utf8char_t, utf8UrlLength);
+        if (utf8Url != nullptr)
+        {
+            utf8::EncodeIntoAndNullTerminate(utf8Url, sourceUrl, (charcount_t)urlLength);
+            url = (const char*)utf8Url;
+        }
+    }
+
+    size_t nameLength = utf8MethodLength + utf8UrlLength + strlen(url) + /* fixed text, loop number, tier and line */ 64;
+    char* name = HeapNewNoThrowArray(char, nameLength);
+    if (name != nullptr)
+    {
+        if (loopNumber != 0)
+        {
+            sprintf_s(name, nameLength, "JS:%s Loop %u [%s] %s:%u", (const char*)utf8MethodName, loopNumber, tier, url, (uint)body->GetLineNumber());
+        }
+        else
+        {
+            sprintf_s(name, nameLength, "JS:%s [%s] %s:%u", (const char*)utf8MethodName, tier, url, (uint)body->GetLineNumber());
+        }
+        PlatformAgnostic::PerfMap::LogCodeLoad(address, size, name);
+        HeapDeleteArray(nameLength, name);
+    }
+
+    if (utf8Url != nullptr)
+    {
+        HeapDeleteArray(utf8UrlLength, utf8Url);
+    }
+    HeapDeleteArray(utf8MethodLength, utf8MethodName);
+}
+
+#endif /* PERF_MAP_PROFILING */
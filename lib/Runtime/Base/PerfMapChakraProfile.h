@@ -0,0 +1,24 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#ifdef PERF_MAP_PROFILING
+
+//
+// Names JIT code and dynamic interpreter thunks for the Linux perf tools (-PerfMap, -PerfJitDump).
+//
+class PerfMapChakraProfile
+{
+public:
+    static void LogMethodInterpreterThunkLoadEvent(Js::FunctionBody* body);
+    static void LogMethodNativeLoadEvent(Js::FunctionBody* body, Js::FunctionEntryPointInfo* entryPoint);
+    static void LogLoopBodyLoadEvent(Js::FunctionBody* body, Js::LoopEntryPointInfo* entryPoint, uint16 loopNumber);
+
+private:
+    static bool IsEnabled();
+    static void LogCodeLoad(Js::FunctionBody* body, const void* address, size_t size, const char* tier, uint loopNumber);
+};
+
+#endif
@@ -72,6 +72,14 @@ namespace Js
         threadContext(threadContext),
         scriptStartEventHandler(nullptr),
         scriptEndEventHandler(nullptr),
+        scriptCpuTime(0),
+        scriptCpuTimeStart(0),
+        bailOutKindCounts(nullptr),
+        rejitReasonCounters(nullptr),
+        inlineCacheGetLookupCount(0),
+        inlineCacheGetMissCount(0),
+        inlineCacheSetLookupCount(0),
+        inlineCacheSetMissCount(0),
 #ifdef FAULT_INJECTION
         disposeScriptByFaultInjectionEventHandler(nullptr),
 #endif
@@ -314,6 +322,12 @@ namespace Js
 
         this->valueOfInlineCache = AllocatorNewZ(InlineCacheAllocator, GetInlineCacheAllocator(), InlineCache);
         this->toStringInlineCache = AllocatorNewZ(InlineCacheAllocator, GetInlineCacheAllocator(), InlineCache);
+        this->proxyGetTrapInlineCache = AllocatorNewZ(InlineCacheAllocator, GetInlineCacheAllocator(), InlineCache);
+        this->proxySetTrapInlineCache = AllocatorNewZ(InlineCacheAllocator, GetInlineCacheAllocator(), InlineCache);
+        this->proxyHasTrapInlineCache = AllocatorNewZ(InlineCacheAllocator, GetInlineCacheAllocator(), InlineCache);
+
+        this->bailOutKindCounts = AnewArrayZ(GeneralAllocator(), uint, IR::BailOutKindEnd);
+        this->rejitReasonCounters = AnewArrayZ(GeneralAllocator(), uint, NumRejitReasons);
 
 #ifdef REJIT_STATS
         if (PHASE_STATS1(Js::ReJITPhase))
@@ -1972,6 +1986,12 @@ namespace Js
 
     void ScriptContext::OnScriptStart(bool isRoot, bool isScript)
     {
+        // Nested calls into other contexts are charged to the context that was entered from the host
+        if (threadContext->GetCallRootLevel() == 1 && threadContext->IsCpuTimeAccountingEnabled())
+        {
+            this->scriptCpuTimeStart = threadContext->BeginScriptCpuTime();
+        }
+
         const bool isForcedEnter = this->GetDebugContext() != nullptr ? this->GetDebugContext()->GetProbeContainer()->isForcedToEnterScriptStart : false;
         if (this->scriptStartEventHandler != nullptr && ((isRoot && threadContext->GetCallRootLevel() == 1) || isForcedEnter))
         {
@@ -1994,6 +2014,13 @@ namespace Js
 
     void ScriptContext::OnScriptEnd(bool isRoot, bool isForcedEnd)
     {
+        if (this->scriptCpuTimeStart != 0 && threadContext->GetCallRootLevel() == 1)
+        {
+            this->scriptCpuTime = this->GetScriptCpuTime();
+            this->scriptCpuTimeStart = 0;
+            threadContext->EndScriptCpuTime();
+        }
+
         if ((isRoot && threadContext->GetCallRootLevel() == 1) || isForcedEnd)
         {
             if (this->scriptEndEventHandler != nullptr)
@@ -2003,6 +2030,36 @@ namespace Js
         }
     }
 
+    void ScriptContext::CountBailOut(IR::BailOutKind kind)
+    {
+        uint kindNoBits = (uint)(kind & ~IR::BailOutKindBits);
+        if (this->bailOutKindCounts != nullptr && kindNoBits < IR::BailOutKindEnd)
+        {
+            this->bailOutKindCounts[kindNoBits]++;
+        }
+    }
+
+    void ScriptContext::CountRejit(RejitReason reason)
+    {
+        Assert(reason < NumRejitReasons);
+        if (this->rejitReasonCounters != nullptr)
+        {
+            this->rejitReasonCounters[reason]++;
+        }
+    }
+
+    uint64 ScriptContext::GetScriptCpuTime() const
+    {
+        if (this->scriptCpuTimeStart == 0)
+        {
+            return this->scriptCpuTime;
+        }
+
+        // Include the call in progress
+        uint64 now = ThreadContext::GetThreadCpuTime(GetCurrentThread());
+        return now > this->scriptCpuTimeStart ? this->scriptCpuTime + (now - this->scriptCpuTimeStart) : this->scriptCpuTime;
+    }
+
 #ifdef FAULT_INJECTION
     void ScriptContext::DisposeScriptContextByFaultInjection() {
         if (this->disposeScriptByFaultInjectionEventHandler != nullptr)
@@ -2355,7 +2412,8 @@ namespace Js
     // Makes a copy of the URL to be stored in the map.
     //
     SourceContextInfo * ScriptContext::CreateSourceContextInfo(DWORD_PTR sourceContext, char16 const * url, size_t len,
-        IActiveScriptDataCache* profileDataCache, char16 const * sourceMapUrl /*= NULL*/, size_t sourceMapUrlLen /*= 0*/)
+        IActiveScriptDataCache* profileDataCache, char16 const * sourceMapUrl /*= NULL*/, size_t sourceMapUrlLen /*= 0*/,
+        uint sourceHash /*= 0*/, size_t sourceByteCount /*= 0*/)
     {
         // Take etw rundown lock on this thread context. We are going to init/add to sourceContextInfoMap.
         AutoCriticalSection autocs(GetThreadContext()->GetEtwRundownCriticalSection());
@@ -2366,6 +2424,8 @@ namespace Js
         sourceContextInfo->sourceContextId = this->GetNextSourceContextId();
         sourceContextInfo->dwHostSourceContext = sourceContext;
         sourceContextInfo->isHostDynamicDocument = false;
+        sourceContextInfo->sourceHash = sourceHash;
+        sourceContextInfo->sourceByteCount = sourceByteCount;
 #if ENABLE_PROFILE_INFO
         sourceContextInfo->sourceDynamicProfileManager = nullptr;
 #endif
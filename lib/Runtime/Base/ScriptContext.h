@@ -116,6 +116,7 @@ public:
     virtual HRESULT EnqueuePromiseTask(Js::Var varTask) = 0;
 
     virtual HRESULT FetchImportedModule(Js::ModuleRecordBase* referencingModule, LPCOLESTR specifier, Js::ModuleRecordBase** dependentModuleRecord) = 0;
+    virtual HRESULT FetchImportedModules(Js::ModuleRecordBase* referencingModule, uint specifierCount, LPCOLESTR const* specifiers, Js::ModuleRecordBase** dependentModuleRecords) = 0;
     virtual HRESULT NotifyHostAboutModuleReady(Js::ModuleRecordBase* referencingModule, Js::Var exceptionVar) = 0;
 
     Js::ScriptContext* GetScriptContext() { return scriptContext; }
@@ -499,6 +500,9 @@ namespace Js
 
         InlineCache * GetValueOfInlineCache() const { return valueOfInlineCache;}
         InlineCache * GetToStringInlineCache() const { return toStringInlineCache; }
+        InlineCache * GetProxyGetTrapInlineCache() const { return proxyGetTrapInlineCache; }
+        InlineCache * GetProxySetTrapInlineCache() const { return proxySetTrapInlineCache; }
+        InlineCache * GetProxyHasTrapInlineCache() const { return proxyHasTrapInlineCache; }
 
         FunctionBody * GetFakeGlobalFuncForUndefer() const { return fakeGlobalFuncForUndefer; }
         void SetFakeGlobalFuncForUndefer(FunctionBody * func) { fakeGlobalFuncForUndefer.Root(func, GetRecycler()); }
@@ -538,6 +542,9 @@ namespace Js
 
         InlineCache * valueOfInlineCache;
         InlineCache * toStringInlineCache;
+        InlineCache * proxyGetTrapInlineCache;
+        InlineCache * proxySetTrapInlineCache;
+        InlineCache * proxyHasTrapInlineCache;
 
         typedef JsUtil::BaseHashSet<Js::PropertyId, ArenaAllocator> PropIdSetForConstProp;
         PropIdSetForConstProp * intConstPropsOnGlobalObject;
@@ -787,6 +794,17 @@ private:
         HaltCallback* scriptEngineHaltCallback;
         EventHandler scriptStartEventHandler;
         EventHandler scriptEndEventHandler;
+        // Thread CPU time of the outermost script calls entered in this context, see ThreadContext::BeginScriptCpuTime
+        uint64 scriptCpuTime;
+        uint64 scriptCpuTimeStart;
+        // Always-on counters, only updated on the script thread. Bailouts are counted by their kind without
+        // the condition bits, and inline cache lookups only when they reach the runtime, not in jitted code.
+        uint * bailOutKindCounts;
+        uint * rejitReasonCounters;
+        uint64 inlineCacheGetLookupCount;
+        uint64 inlineCacheGetMissCount;
+        uint64 inlineCacheSetLookupCount;
+        uint64 inlineCacheSetMissCount;
 #ifdef FAULT_INJECTION
         EventHandler disposeScriptByFaultInjectionEventHandler;
 #endif
@@ -1035,7 +1053,8 @@ private:
         SourceContextInfo * GetSourceContextInfo(uint hash);
         SourceContextInfo * CreateSourceContextInfo(uint hash, DWORD_PTR hostSourceContext);
         SourceContextInfo * CreateSourceContextInfo(DWORD_PTR hostSourceContext, char16 const * url, size_t len,
-            IActiveScriptDataCache* profileDataCache, char16 const * sourceMapUrl = nullptr, size_t sourceMapUrlLen = 0);
+            IActiveScriptDataCache* profileDataCache, char16 const * sourceMapUrl = nullptr, size_t sourceMapUrlLen = 0,
+            uint sourceHash = 0, size_t sourceByteCount = 0);
 
 #if defined(LEAK_REPORT) || defined(CHECK_MEMORY_LEAK)
         void ClearSourceContextInfoMaps()
@@ -1257,6 +1276,20 @@ private:
 
         void OnScriptStart(bool isRoot, bool isScript);
         void OnScriptEnd(bool isRoot, bool isForcedEnd);
+        uint64 GetScriptCpuTime() const;
+
+        void CountBailOut(IR::BailOutKind kind);
+        void CountRejit(RejitReason reason);
+        void CountInlineCacheGetLookup() { this->inlineCacheGetLookupCount++; }
+        void CountInlineCacheGetMiss() { this->inlineCacheGetMissCount++; }
+        void CountInlineCacheSetLookup() { this->inlineCacheSetLookupCount++; }
+        void CountInlineCacheSetMiss() { this->inlineCacheSetMissCount++; }
+        uint GetBailOutKindCount(uint kind) const { return this->bailOutKindCounts ? this->bailOutKindCounts[kind] : 0; }
+        uint GetRejitReasonCount(uint reason) const { return this->rejitReasonCounters ? this->rejitReasonCounters[reason] : 0; }
+        uint64 GetInlineCacheGetLookupCount() const { return this->inlineCacheGetLookupCount; }
+        uint64 GetInlineCacheGetMissCount() const { return this->inlineCacheGetMissCount; }
+        uint64 GetInlineCacheSetLookupCount() const { return this->inlineCacheSetLookupCount; }
+        uint64 GetInlineCacheSetMissCount() const { return this->inlineCacheSetMissCount; }
 
         template <bool stackProbe, bool leaveForHost>
         bool LeaveScriptStart(void * frameAddress);
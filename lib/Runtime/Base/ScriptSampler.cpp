@@ -0,0 +1,484 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+
+namespace Js
+{
+    // Field numbers from profile.proto in github.com/google/pprof
+    enum PprofField
+    {
+        PprofProfile_SampleType = 1,
+        PprofProfile_Sample = 2,
+        PprofProfile_Location = 4,
+        PprofProfile_Function = 5,
+        PprofProfile_StringTable = 6,
+        PprofProfile_PeriodType = 11,
+        PprofProfile_Period = 12,
+
+        PprofValueType_Type = 1,
+        PprofValueType_Unit = 2,
+
+        PprofSample_LocationId = 1,
+        PprofSample_Value = 2,
+
+        PprofLocation_Id = 1,
+        PprofLocation_Line = 4,
+
+        PprofLine_FunctionId = 1,
+        PprofLine_Line = 2,
+
+        PprofFunction_Id = 1,
+        PprofFunction_Name = 2,
+        PprofFunction_SystemName = 3,
+        PprofFunction_FileName = 4,
+        PprofFunction_StartLine = 5,
+    };
+
+    // Fixed entries at the start of the string table; each function then adds its name and its file name
+    enum PprofString
+    {
+        PprofString_Empty,
+        PprofString_Samples,
+        PprofString_Count,
+        PprofString_Cpu,
+        PprofString_Nanoseconds,
+        PprofString_FirstFunction
+    };
+
+    static const char * const PprofFixedStrings[] = { "", "samples", "count", "cpu", "nanoseconds" };
+    CompileAssert(_countof(PprofFixedStrings) == PprofString_FirstFunction);
+
+    static const uint32 InvalidIndex = (uint32)-1;
+
+    // Writes protobuf fields into a buffer, or only counts their size if there is no buffer. Nested messages
+    // are written by a function that is called twice, once to count the length prefix and once to write.
+    class ProtobufWriter
+    {
+    public:
+        ProtobufWriter(BYTE * buffer) : buffer(buffer), position(0) {}
+
+        size_t GetPosition() const { return this->position; }
+
+        void WriteVarint(uint64 value)
+        {
+            do
+            {
+                BYTE byte = (BYTE)(value & 0x7F);
+                value >>= 7;
+                if (value != 0)
+                {
+                    byte |= 0x80;
+                }
+                this->WriteBytes(&byte, 1);
+            } while (value != 0);
+        }
+
+        void WriteVarintField(uint field, uint64 value)
+        {
+            this->WriteTag(field, WireType_Varint);
+            this->WriteVarint(value);
+        }
+
+        void WriteBytesField(uint field, const void * data, size_t length)
+        {
+            this->WriteTag(field, WireType_LengthDelimited);
+            this->WriteVarint(length);
+            this->WriteBytes(data, length);
+        }
+
+        template <typename Fn>
+        void WriteMessageField(uint field, Fn writeFields)
+        {
+            ProtobufWriter counter(nullptr);
+            writeFields(counter);
+            this->WriteTag(field, WireType_LengthDelimited);
+            this->WriteVarint(counter.GetPosition());
+            writeFields(*this);
+        }
+
+    private:
+        enum WireType
+        {
+            WireType_Varint = 0,
+            WireType_LengthDelimited = 2
+        };
+
+        void WriteTag(uint field, WireType wireType)
+        {
+            this->WriteVarint(((uint64)field << 3) | wireType);
+        }
+
+        void WriteBytes(const void * data, size_t length)
+        {
+            if (this->buffer != nullptr)
+            {
+                js_memcpy_s(this->buffer + this->position, length, data, length);
+            }
+            this->position += length;
+        }
+
+        BYTE * buffer;
+        size_t position;
+    };
+
+    ScriptSampler::ScriptSampler(ThreadContext * threadContext) :
+        threadContext(threadContext),
+        samplerThread(nullptr),
+        stopEvent(nullptr),
+        intervalMilliseconds(0),
+        sampleRequested(false),
+        sampleCapacity(0),
+        sampleCount(0),
+        stacks(nullptr),
+        stackDepths(nullptr),
+        functionMap(&HeapAllocator::Instance),
+        functions(&HeapAllocator::Instance),
+        frameMap(&HeapAllocator::Instance),
+        frames(&HeapAllocator::Instance)
+    {
+    }
+
+    ScriptSampler::~ScriptSampler()
+    {
+        this->Stop();
+        this->Clear();
+    }
+
+    bool ScriptSampler::Start(uint intervalMilliseconds, uint sampleCapacity)
+    {
+        Assert(intervalMilliseconds != 0 && sampleCapacity != 0);
+
+        this->Stop();
+        this->Clear();
+
+        this->sampleCapacity = sampleCapacity;
+        this->intervalMilliseconds = intervalMilliseconds;
+        this->stacks = HeapNewNoThrowArray(uint32, (size_t)sampleCapacity * MaxStackDepth);
+        this->stackDepths = HeapNewNoThrowArray(uint16, sampleCapacity);
+        this->stopEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+        if (this->stacks == nullptr || this->stackDepths == nullptr || this->stopEvent == nullptr)
+        {
+            this->Clear();
+            return false;
+        }
+
+        this->samplerThread = (HANDLE)PlatformAgnostic::Thread::Create(0, &ScriptSampler::StaticThreadProc, this, PlatformAgnostic::Thread::ThreadInitRunImmediately);
+        if (this->samplerThread == nullptr)
+        {
+            this->Clear();
+            return false;
+        }
+        return true;
+    }
+
+    void ScriptSampler::Stop()
+    {
+        if (this->samplerThread == nullptr)
+        {
+            return;
+        }
+
+        SetEvent(this->stopEvent);
+        WaitForSingleObject(this->samplerThread, INFINITE);
+        CloseHandle(this->samplerThread);
+        this->samplerThread = nullptr;
+        this->sampleRequested = false;
+    }
+
+    // Frees the samples; the ring buffer is kept only while sampling or until the next start
+    void ScriptSampler::Clear()
+    {
+        Assert(this->samplerThread == nullptr);
+
+        if (this->stopEvent != nullptr)
+        {
+            CloseHandle(this->stopEvent);
+            this->stopEvent = nullptr;
+        }
+        if (this->stacks != nullptr)
+        {
+            HeapDeleteArray((size_t)this->sampleCapacity * MaxStackDepth, this->stacks);
+            this->stacks = nullptr;
+        }
+        if (this->stackDepths != nullptr)
+        {
+            HeapDeleteArray(this->sampleCapacity, this->stackDepths);
+            this->stackDepths = nullptr;
+        }
+        this->sampleCapacity = 0;
+        this->sampleCount = 0;
+
+        for (int i = 0; i < this->functions.Count(); i++)
+        {
+            FunctionData& data = this->functions.Item(i);
+            FreeUtf8(&data.name);
+            FreeUtf8(&data.fileName);
+        }
+        this->functions.Clear();
+        this->functionMap.Clear();
+        this->frames.Clear();
+        this->frameMap.Clear();
+    }
+
+    unsigned int CALLBACK ScriptSampler::StaticThreadProc(LPVOID lpParameter)
+    {
+        ((ScriptSampler *)lpParameter)->ThreadProc();
+        return 0;
+    }
+
+    // Only raises the flag; the stack is walked by the script thread itself at its next stack probe, because
+    // the stack walker can't run against a thread that is stopped at an arbitrary instruction.
+    void ScriptSampler::ThreadProc()
+    {
+        while (WaitForSingleObject(this->stopEvent, this->intervalMilliseconds) == WAIT_TIMEOUT)
+        {
+            if (this->threadContext->IsScriptActive())
+            {
+                this->sampleRequested = true;
+            }
+        }
+    }
+
+    void ScriptSampler::TakeSample(ScriptContext * scriptContext, PVOID returnAddress)
+    {
+        this->sampleRequested = false;
+        if (this->stacks == nullptr || !this->threadContext->IsScriptActive())
+        {
+            return;
+        }
+
+        uint sampleIndex = (uint)(this->sampleCount % this->sampleCapacity);
+        uint32 * stack = this->stacks + (size_t)sampleIndex * MaxStackDepth;
+        uint16 depth = 0;
+
+        // Once the ring is full this slot holds the oldest sample, which is lost even if this one is dropped
+        this->stackDepths[sampleIndex] = 0;
+
+        // Interning may allocate; drop the sample rather than fail the script on OOM
+        try
+        {
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
+
+            JavascriptStackWalker walker(scriptContext, TRUE, returnAddress);
+            JavascriptFunction * function = nullptr;
+            while (depth < MaxStackDepth && walker.GetCaller(&function))
+            {
+                // Built-ins have no body and are attributed to their script caller
+                if (function == nullptr || !function->GetFunctionInfo()->HasBody())
+                {
+                    continue;
+                }
+
+                FunctionBody * functionBody = function->GetFunctionInfo()->GetFunctionBody();
+                ULONG line = functionBody->GetLineNumber();
+                if (!functionBody->GetUtf8SourceInfo()->GetIsLibraryCode())
+                {
+                    LONG column;
+                    functionBody->GetLineCharOffset(walker.GetByteCodeOffset(), &line, &column);
+                }
+
+                uint32 functionIndex = this->InternFunction(functionBody);
+                if (functionIndex == InvalidIndex)
+                {
+                    return;
+                }
+                stack[depth++] = this->InternFrame(functionIndex, line);
+            }
+        }
+        catch (Js::OutOfMemoryException)
+        {
+            return;
+        }
+
+        if (depth != 0)
+        {
+            this->stackDepths[sampleIndex] = depth;
+            this->sampleCount++;
+        }
+    }
+
+    uint32 ScriptSampler::InternFunction(FunctionBody * functionBody)
+    {
+        uint key = functionBody->GetFunctionNumber();
+        uint32 index;
+        if (this->functionMap.TryGetValue(key, &index))
+        {
+            return index;
+        }
+
+        FunctionData data;
+        data.name = EncodeUtf8(functionBody->GetExternalDisplayName());
+        data.fileName = EncodeUtf8(functionBody->GetSourceName());
+        data.startLine = functionBody->GetLineNumber();
+        if (data.name.buffer == nullptr || data.fileName.buffer == nullptr)
+        {
+            FreeUtf8(&data.name);
+            FreeUtf8(&data.fileName);
+            return InvalidIndex;
+        }
+
+        try
+        {
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
+            index = (uint32)this->functions.Add(data);
+        }
+        catch (Js::OutOfMemoryException)
+        {
+            FreeUtf8(&data.name);
+            FreeUtf8(&data.fileName);
+            return InvalidIndex;
+        }
+
+        this->functionMap.Add(key, index);
+        return index;
+    }
+
+    uint32 ScriptSampler::InternFrame(uint32 functionIndex, ULONG line)
+    {
+        uint64 key = ((uint64)functionIndex << 32) | line;
+        uint32 index;
+        if (this->frameMap.TryGetValue(key, &index))
+        {
+            return index;
+        }
+
+        FrameData data = { functionIndex, line };
+        index = (uint32)this->frames.Add(data);
+        this->frameMap.Add(key, index);
+        return index;
+    }
+
+    ScriptSampler::Utf8String ScriptSampler::EncodeUtf8(const char16 * str)
+    {
+        Utf8String result = { nullptr, 0, 0 };
+        if (str == nullptr)
+        {
+            str = _u("");
+        }
+
+        size_t length = min(wcslen(str), (size_t)UINT_MAX);
+        result.bufferSize = length * 3 + 1;
+        result.buffer = HeapNewNoThrowArray(utf8char_t, result.bufferSize);
+        if (result.buffer != nullptr)
+        {
+            result.length = utf8::EncodeIntoAndNullTerminate(result.buffer, str, (charcount_t)length);
+        }
+        return result;
+    }
+
+    void ScriptSampler::FreeUtf8(Utf8String * str)
+    {
+        if (str->buffer != nullptr)
+        {
+            HeapDeleteArray(str->bufferSize, str->buffer);
+            str->buffer = nullptr;
+        }
+    }
+
+    // Location i + 1 is frame i and function i + 1 is function i, as pprof reserves id 0. Each sample counts
+    // once and for the sampling interval of CPU time, and its locations are listed from the leaf out.
+    size_t ScriptSampler::WriteProfile(BYTE * buffer, size_t bufferSize) const
+    {
+        uint64 intervalNanoseconds = (uint64)this->intervalMilliseconds * 1000000;
+        uint storedSamples = (uint)min(this->sampleCount, (uint64)this->sampleCapacity);
+
+        auto writeProfile = [&](ProtobufWriter& writer)
+        {
+            writer.WriteMessageField(PprofProfile_SampleType, [&](ProtobufWriter& valueType)
+            {
+                valueType.WriteVarintField(PprofValueType_Type, PprofString_Samples);
+                valueType.WriteVarintField(PprofValueType_Unit, PprofString_Count);
+            });
+            writer.WriteMessageField(PprofProfile_SampleType, [&](ProtobufWriter& valueType)
+            {
+                valueType.WriteVarintField(PprofValueType_Type, PprofString_Cpu);
+                valueType.WriteVarintField(PprofValueType_Unit, PprofString_Nanoseconds);
+            });
+
+            for (uint i = 0; i < storedSamples; i++)
+            {
+                const uint32 * stack = this->stacks + (size_t)i * MaxStackDepth;
+                uint16 depth = this->stackDepths[i];
+                if (depth == 0)
+                {
+                    continue;
+                }
+                writer.WriteMessageField(PprofProfile_Sample, [&](ProtobufWriter& sample)
+                {
+                    sample.WriteMessageField(PprofSample_LocationId, [&](ProtobufWriter& locationIds)
+                    {
+                        for (uint16 frame = 0; frame < depth; frame++)
+                        {
+                            locationIds.WriteVarint((uint64)stack[frame] + 1);
+                        }
+                    });
+                    sample.WriteMessageField(PprofSample_Value, [&](ProtobufWriter& values)
+                    {
+                        values.WriteVarint(1);
+                        values.WriteVarint(intervalNanoseconds);
+                    });
+                });
+            }
+
+            for (int i = 0; i < this->frames.Count(); i++)
+            {
+                const FrameData& frame = this->frames.Item(i);
+                writer.WriteMessageField(PprofProfile_Location, [&](ProtobufWriter& location)
+                {
+                    location.WriteVarintField(PprofLocation_Id, (uint64)i + 1);
+                    location.WriteMessageField(PprofLocation_Line, [&](ProtobufWriter& line)
+                    {
+                        line.WriteVarintField(PprofLine_FunctionId, (uint64)frame.functionIndex + 1);
+                        line.WriteVarintField(PprofLine_Line, (uint64)frame.line + 1);
+                    });
+                });
+            }
+
+            for (int i = 0; i < this->functions.Count(); i++)
+            {
+                const FunctionData& data = this->functions.Item(i);
+                uint64 nameIndex = PprofString_FirstFunction + (uint64)i * 2;
+                writer.WriteMessageField(PprofProfile_Function, [&](ProtobufWriter& function)
+                {
+                    function.WriteVarintField(PprofFunction_Id, (uint64)i + 1);
+                    function.WriteVarintField(PprofFunction_Name, nameIndex);
+                    function.WriteVarintField(PprofFunction_SystemName, nameIndex);
+                    function.WriteVarintField(PprofFunction_FileName, nameIndex + 1);
+                    function.WriteVarintField(PprofFunction_StartLine, (uint64)data.startLine + 1);
+                });
+            }
+
+            for (uint i = 0; i < _countof(PprofFixedStrings); i++)
+            {
+                writer.WriteBytesField(PprofProfile_StringTable, PprofFixedStrings[i], strlen(PprofFixedStrings[i]));
+            }
+            for (int i = 0; i < this->functions.Count(); i++)
+            {
+                const FunctionData& data = this->functions.Item(i);
+                writer.WriteBytesField(PprofProfile_StringTable, data.name.buffer, data.name.length);
+                writer.WriteBytesField(PprofProfile_StringTable, data.fileName.buffer, data.fileName.length);
+            }
+
+            writer.WriteMessageField(PprofProfile_PeriodType, [&](ProtobufWriter& valueType)
+            {
+                valueType.WriteVarintField(PprofValueType_Type, PprofString_Cpu);
+                valueType.WriteVarintField(PprofValueType_Unit, PprofString_Nanoseconds);
+            });
+            writer.WriteVarintField(PprofProfile_Period, intervalNanoseconds);
+        };
+
+        ProtobufWriter counter(nullptr);
+        writeProfile(counter);
+        size_t profileSize = counter.GetPosition();
+
+        if (buffer != nullptr && bufferSize >= profileSize)
+        {
+            ProtobufWriter writer(buffer);
+            writeProfile(writer);
+            Assert(writer.GetPosition() == profileSize);
+        }
+        return profileSize;
+    }
+}
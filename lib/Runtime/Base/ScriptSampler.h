@@ -0,0 +1,81 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // Samples the script call stacks of a thread at a fixed interval. A background thread raises a flag once
+    // per interval while script is active, and the script thread takes the sample at its next disposing stack
+    // probe, where walking the stack and allocating are safe. Jitted code only reaches one when it calls into
+    // the runtime, so a jitted loop that only calls other jitted code is not sampled until it does. Samples are kept in a ring buffer of interned frames,
+    // so that the most recent ones are kept once it is full, and are written out as a pprof profile.
+    class ScriptSampler
+    {
+    public:
+        static const uint MaxStackDepth = 64;
+
+        ScriptSampler(ThreadContext * threadContext);
+        ~ScriptSampler();
+
+        bool Start(uint intervalMilliseconds, uint sampleCapacity);
+        void Stop();
+        bool IsSampling() const { return this->samplerThread != nullptr; }
+        bool IsSampleRequested() const { return this->sampleRequested; }
+
+        void TakeSample(ScriptContext * scriptContext, PVOID returnAddress);
+
+        // Writes the samples as an uncompressed pprof protobuf, and returns the number of bytes it takes.
+        // Nothing is written if the buffer is too small.
+        size_t WriteProfile(BYTE * buffer, size_t bufferSize) const;
+
+    private:
+        struct Utf8String
+        {
+            utf8char_t * buffer;
+            size_t bufferSize;
+            size_t length;
+        };
+
+        struct FunctionData
+        {
+            Utf8String name;
+            Utf8String fileName;
+            ULONG startLine;
+        };
+
+        struct FrameData
+        {
+            uint32 functionIndex;
+            ULONG line;
+        };
+
+        static unsigned int CALLBACK StaticThreadProc(LPVOID lpParameter);
+        void ThreadProc();
+
+        void Clear();
+        uint32 InternFunction(FunctionBody * functionBody);
+        uint32 InternFrame(uint32 functionIndex, ULONG line);
+        static Utf8String EncodeUtf8(const char16 * str);
+        static void FreeUtf8(Utf8String * str);
+
+        ThreadContext * threadContext;
+        HANDLE samplerThread;
+        HANDLE stopEvent;
+        uint intervalMilliseconds;
+        volatile bool sampleRequested;
+
+        // Ring buffer of samples; sample i has stackDepths[i] frame indices starting at stacks[i * MaxStackDepth]
+        uint sampleCapacity;
+        uint64 sampleCount;
+        uint32 * stacks;
+        uint16 * stackDepths;
+
+        // Keyed by function number, which is unique in the thread context and outlives the function body
+        JsUtil::BaseDictionary<uint, uint32, HeapAllocator> functionMap;
+        JsUtil::List<FunctionData, HeapAllocator> functions;
+        JsUtil::BaseDictionary<uint64, uint32, HeapAllocator> frameMap;
+        JsUtil::List<FrameData, HeapAllocator> frames;
+    };
+}
@@ -211,7 +211,7 @@ JsUtil::JobProcessor * ThreadBoundThreadContextManager::GetSharedJobProcessor()
         if (s_sharedJobProcessor == NULL)
         {
             // We don't need to have allocation policy manager for web worker.
-            s_sharedJobProcessor = HeapNew(JsUtil::BackgroundJobProcessor, NULL, NULL, false /*disableParallelThreads*/);
+            s_sharedJobProcessor = HeapNew(JsUtil::BackgroundJobProcessor, NULL, NULL, false /*disableParallelThreads*/, true /*isProcessWide*/);
         }
     }
 
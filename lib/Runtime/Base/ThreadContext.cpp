@@ -107,6 +107,7 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     threadService(threadServiceCallback),
     isOptimizedForManyInstances(Js::Configuration::Global.flags.OptimizeForManyInstances),
     bgJit(Js::Configuration::Global.flags.BgJit),
+    isJitThreadPoolShared(false),
     pageAllocator(allocationPolicyManager, PageAllocatorType_Thread, Js::Configuration::Global.flags, 0, PageAllocator::DefaultMaxFreePageCount,
         false
 #if ENABLE_BACKGROUND_PAGE_FREEING
@@ -120,11 +121,25 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     jobProcessor(nullptr),
 #endif
     interruptPoller(nullptr),
+    allocationSiteProfiler(nullptr),
+    scriptSampler(nullptr),
+    perfHintMaxPerSecond(0),
+    perfHintWindowStart(0),
+    perfHintWindowCount(0),
+    perfHintDroppedCount(0),
+    cpuTimeAccountingEnabled(false),
+    gcCpuTime(0),
+    gcCpuTimeStart(0),
+    scriptCpuTimeLimit(0),
+    scriptCpuTimeStart(0),
+    scriptCpuTimeThread(nullptr),
+    scriptCpuTimeThreadId(ThreadContext::NoThread),
     expirableCollectModeGcCount(-1),
     expirableObjectList(nullptr),
     expirableObjectDisposeList(nullptr),
     numExpirableObjects(0),
     disableExpiration(false),
+    codeAgingGcCount(0),
     callRootLevel(0),
     nextTypeId((Js::TypeId)Js::Constants::ReservedTypeIds),
     entryExitRecord(nullptr),
@@ -191,6 +206,7 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     redeferralState(InitialRedeferralState),
     gcSinceLastRedeferral(0),
     gcSinceCallCountsCollected(0),
+    redeferralGcCount(0),
     tridentLoadAddress(nullptr),
     m_remoteThreadContextInfo(nullptr),
     debugManager(nullptr)
@@ -417,6 +433,24 @@ ThreadContext::~ThreadContext()
         interruptPoller = nullptr;
     }
 
+    if (scriptCpuTimeThread != nullptr)
+    {
+        CloseHandle(scriptCpuTimeThread);
+        scriptCpuTimeThread = nullptr;
+    }
+
+    if (allocationSiteProfiler)
+    {
+        HeapDelete(allocationSiteProfiler);
+        allocationSiteProfiler = nullptr;
+    }
+
+    if (scriptSampler)
+    {
+        HeapDelete(scriptSampler);
+        scriptSampler = nullptr;
+    }
+
 #if DBG
     // ThreadContext dtor may be running on a different thread.
     // Recycler may call finalizer that free temp Arenas, which will free pages back to
@@ -471,6 +505,7 @@ ThreadContext::~ThreadContext()
             HeapDelete(this->propertyMap);
             this->propertyMap = nullptr;
         }
+        this->propertyRecordsById.Clear();
 
 #if ENABLE_NATIVE_CODEGEN
         if (this->m_jitNumericProperties != nullptr)
@@ -856,9 +891,16 @@ ThreadContext::GetPropertyNameImpl(Js::PropertyId propertyId)
     }
 
     const Js::PropertyRecord * propertyRecord = nullptr;
-    if (locked) { propertyMap->LockResize(); }
-    bool found = propertyMap->TryGetValueAt(propertyIndex, &propertyRecord);
-    if (locked) { propertyMap->UnlockResize(); }
+    bool found;
+    if (locked)
+    {
+        propertyRecord = propertyRecordsById.Item(propertyIndex);
+        found = propertyRecord != nullptr;
+    }
+    else
+    {
+        found = propertyMap->TryGetValueAt(propertyIndex, &propertyRecord);
+    }
 
     AssertMsg(found && propertyRecord != nullptr, "using invalid propertyid");
     return propertyRecord;
@@ -944,6 +986,7 @@ void ThreadContext::InitializePropertyMaps()
             HeapDelete(this->propertyMap);
         }
         this->propertyMap = nullptr;
+        this->propertyRecordsById.Clear();
 
         this->caseInvariantPropertySet = nullptr;
         memset(propertyNamesDirect, 0, 128*sizeof(Js::PropertyRecord *));
@@ -1099,7 +1142,8 @@ ThreadContext::AddPropertyRecordInternal(const Js::PropertyRecord * propertyReco
     }
 #endif
 
-    // Add to the map
+    // Add to the maps. The index is set first, as a stale entry for an unused id is harmless if adding to the map fails.
+    propertyRecordsById.SetItem(propertyId - Js::PropertyIds::_none, propertyRecord);
     propertyMap->Add(propertyRecord);
 
 #if ENABLE_NATIVE_CODEGEN
@@ -1273,6 +1317,7 @@ void ThreadContext::InvalidatePropertyRecord(const Js::PropertyRecord * property
     }
 #endif
     this->propertyMap->Remove(propertyRecord);
+    this->propertyRecordsById.SetItem(propertyRecord->GetPropertyId() - Js::PropertyIds::_none, nullptr);
     PropertyRecordTrace(_u("Reclaimed property '%s' at 0x%08x, pid = %d\n"),
         propertyRecord->GetBuffer(), propertyRecord, propertyRecord->GetPropertyId());
 }
@@ -1371,7 +1416,7 @@ ThreadContext::ForceCleanPropertyMap()
 JsUtil::JobProcessor *
 ThreadContext::GetJobProcessor()
 {
-    if(bgJit && isOptimizedForManyInstances)
+    if(bgJit && (isOptimizedForManyInstances || isJitThreadPoolShared))
     {
         return ThreadBoundThreadContextManager::GetSharedJobProcessor();
     }
@@ -1717,6 +1762,13 @@ ThreadContext::ProbeStack(size_t size, Js::ScriptContext *scriptContext, PVOID r
 {
     this->ProbeStackNoDispose(size, scriptContext, returnAddress);
 
+    // Stack probes that may dispose are also where the script sampler takes its samples, as running
+    // arbitrary code there is already allowed.
+    if (this->scriptSampler != nullptr && this->scriptSampler->IsSampleRequested())
+    {
+        this->scriptSampler->TakeSample(scriptContext, returnAddress);
+    }
+
     // BACKGROUND-GC TODO: If we're stuck purely in JITted code, we should have the
     // background GC thread modify the threads stack limit to trigger the runtime stack probe
     if (this->callDispose && this->recycler->NeedDispose())
@@ -2536,6 +2588,13 @@ ThreadContext::PreCollectionCallBack(CollectionFlags flags)
 #endif
     }
 
+    // Only collections that run to completion on this thread are charged, since the thread goes back to
+    // script while a concurrent one is in progress
+    if (this->cpuTimeAccountingEnabled && !concurrent)
+    {
+        this->gcCpuTimeStart = max<uint64>(GetThreadCpuTime(GetCurrentThread()), 1);
+    }
+
     RecyclerCollectCallBackFlags callBackFlags = (RecyclerCollectCallBackFlags)
         ((concurrent ? Collect_Begin_Concurrent : Collect_Begin) | (partial? Collect_Begin_Partial : Collect_Begin));
     CollectionCallBack(callBackFlags);
@@ -2585,6 +2644,16 @@ ThreadContext::PostCollectionCallBack()
 {
     CollectionCallBack(Collect_End);
 
+    if (this->gcCpuTimeStart != 0)
+    {
+        uint64 now = GetThreadCpuTime(GetCurrentThread());
+        if (now > this->gcCpuTimeStart)
+        {
+            this->gcCpuTime += now - this->gcCpuTimeStart;
+        }
+        this->gcCpuTimeStart = 0;
+    }
+
     TryExitExpirableCollectMode();
 
     // Recycler is null in the case where the ThreadContext is in the process of creating the recycler and
@@ -2631,6 +2700,11 @@ ThreadContext::DoTryRedeferral() const
         return false;
     }
 
+    if (this->redeferralGcCount != 0)
+    {
+        return gcSinceCallCountsCollected >= this->redeferralGcCount;
+    }
+
     switch (this->redeferralState)
     {
         case InitialRedeferralState:
@@ -2668,6 +2742,11 @@ ThreadContext::DoRedeferFunctionBodies() const
         return false;
     }
 
+    if (this->redeferralGcCount != 0)
+    {
+        return gcSinceLastRedeferral >= this->redeferralGcCount;
+    }
+
     switch (this->redeferralState)
     {
         case InitialRedeferralState:
@@ -2688,6 +2767,11 @@ ThreadContext::DoRedeferFunctionBodies() const
 uint
 ThreadContext::GetRedeferralCollectionInterval() const
 {
+    if (this->redeferralGcCount != 0)
+    {
+        return this->redeferralGcCount;
+    }
+
     switch(this->redeferralState)
     {
         case InitialRedeferralState:
@@ -2708,6 +2792,11 @@ ThreadContext::GetRedeferralCollectionInterval() const
 uint
 ThreadContext::GetRedeferralInactiveThreshold() const
 {
+    if (this->redeferralGcCount != 0)
+    {
+        return this->redeferralGcCount;
+    }
+
     switch(this->redeferralState)
     {
         case InitialRedeferralState:
@@ -2765,6 +2854,64 @@ ThreadContext::TryRedeferral()
     }
 }
 
+Js::AllocationSiteProfiler *
+ThreadContext::EnsureAllocationSiteProfiler()
+{
+    if (this->allocationSiteProfiler == nullptr)
+    {
+        this->allocationSiteProfiler = HeapNew(Js::AllocationSiteProfiler, this);
+    }
+    return this->allocationSiteProfiler;
+}
+
+Js::ScriptSampler *
+ThreadContext::EnsureScriptSampler()
+{
+    if (this->scriptSampler == nullptr)
+    {
+        this->scriptSampler = HeapNew(Js::ScriptSampler, this);
+    }
+    return this->scriptSampler;
+}
+
+void
+ThreadContext::SetPerfHintCallback(PerfHintCallbackFunction callback, void * context, uint maxPerSecond)
+{
+    // Clearing the callback waits for reports in flight, and no new report starts until the callback is set
+    // again, so the rate limit can be reset without racing a report
+    this->perfHintCallback.Set(nullptr, nullptr);
+    this->perfHintMaxPerSecond = maxPerSecond;
+    this->perfHintWindowStart = GetTickCount();
+    this->perfHintWindowCount = 0;
+    this->perfHintDroppedCount = 0;
+    this->perfHintCallback.Set(callback, context);
+}
+
+//
+// Hints come from the script thread and the background JIT threads, so the window is kept with interlocked
+// operations rather than a lock. Two threads may both restart a window that has just expired, which at worst
+// lets a few more hints through.
+//
+bool
+ThreadContext::TryBeginPerfHintReport(uint * droppedCount)
+{
+    DWORD now = GetTickCount();
+    if (now - this->perfHintWindowStart >= 1000)
+    {
+        this->perfHintWindowStart = now;
+        this->perfHintWindowCount = 0;
+    }
+
+    if ((uint)InterlockedIncrement(&this->perfHintWindowCount) > this->perfHintMaxPerSecond)
+    {
+        InterlockedIncrement(&this->perfHintDroppedCount);
+        return false;
+    }
+
+    *droppedCount = (uint)InterlockedExchange(&this->perfHintDroppedCount, 0);
+    return true;
+}
+
 void
 ThreadContext::GetActiveFunctions(ActiveFunctionSet * pActiveFuncs)
 {
@@ -2876,7 +3023,7 @@ ThreadContext::TryExitExpirableCollectMode()
         }
 
         if (this->expirableCollectModeGcCount == 0 &&
-            (this->recycler->InCacheCleanupCollection() || CONFIG_FLAG(ForceExpireOnNonCacheCollect)))
+            (this->recycler->InCacheCleanupCollection() || CONFIG_FLAG(ForceExpireOnNonCacheCollect) || this->codeAgingGcCount != 0))
         {
             OUTPUT_TRACE(Js::ExpirableCollectPhase, _u("Completing Expirable Object Collection\n"));
 
@@ -2928,11 +3075,12 @@ ThreadContext::TryEnterExpirableCollectMode()
     double currentThreadNativeCodeRatio = ((double) GetCodeSize()) / Js::Constants::MaxThreadJITCodeHeapSize;
 
     OUTPUT_TRACE(Js::ExpirableCollectPhase, _u("Current native code ratio: %f\n"), currentThreadNativeCodeRatio);
-    if (currentThreadNativeCodeRatio > entryPointCollectionThreshold)
+    if (currentThreadNativeCodeRatio > entryPointCollectionThreshold || this->codeAgingGcCount != 0)
     {
         OUTPUT_TRACE(Js::ExpirableCollectPhase, _u("Setting up Expirable Object Collection\n"));
 
-        this->expirableCollectModeGcCount = Js::Configuration::Global.flags.ExpirableCollectionGCCount;
+        this->expirableCollectModeGcCount = this->codeAgingGcCount != 0 ?
+            (int)this->codeAgingGcCount : Js::Configuration::Global.flags.ExpirableCollectionGCCount;
 
         ExpirableObjectList::Iterator expirableObjectIterator(this->expirableObjectList);
 
@@ -4498,6 +4646,68 @@ void InterruptPoller::GetStatementCount(ULONG *pluHi, ULONG *pluLo)
     *pluHi = (ULONG)(statements >> 32);
 }
 
+uint64 ThreadContext::GetThreadCpuTime(HANDLE thread)
+{
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetThreadTimes(thread, &creationTime, &exitTime, &kernelTime, &userTime))
+    {
+        return 0;
+    }
+
+    return (((uint64)kernelTime.dwHighDateTime << 32) | kernelTime.dwLowDateTime) +
+        (((uint64)userTime.dwHighDateTime << 32) | userTime.dwLowDateTime);
+}
+
+uint64 ThreadContext::BeginScriptCpuTime()
+{
+    DWORD threadId = ::GetCurrentThreadId();
+    if (threadId != this->scriptCpuTimeThreadId)
+    {
+        // The runtime moved to another thread, so the watchdog has to read a different clock
+        AutoCriticalSection autocs(&this->csScriptCpuTimeThread);
+        if (this->scriptCpuTimeThread != nullptr)
+        {
+            CloseHandle(this->scriptCpuTimeThread);
+            this->scriptCpuTimeThread = nullptr;
+        }
+
+        HANDLE thread;
+        if (DuplicateHandle(GetCurrentProcess(), GetCurrentThread(), GetCurrentProcess(), &thread, 0, FALSE, DUPLICATE_SAME_ACCESS))
+        {
+            this->scriptCpuTimeThread = thread;
+        }
+        this->scriptCpuTimeThreadId = threadId;
+    }
+
+    // 0 means outside of script, so a thread that hasn't been charged any time yet starts at 1
+    uint64 start = max<uint64>(GetThreadCpuTime(GetCurrentThread()), 1);
+    this->scriptCpuTimeStart = start;
+    return start;
+}
+
+// Called by a watchdog on any thread. Script is stopped the same way as by DisableExecution, through the
+// stack limit checked at function entry and loop back edges, so the limit costs nothing while script runs.
+bool ThreadContext::CheckScriptCpuTimeLimit()
+{
+    Assert(TestThreadContextFlag(ThreadContextFlagCanDisableExecution));
+
+    AutoCriticalSection autocs(&this->csScriptCpuTimeThread);
+    uint64 start = this->scriptCpuTimeStart;
+    if (this->scriptCpuTimeLimit == 0 || start == 0 || this->scriptCpuTimeThread == nullptr)
+    {
+        return false;
+    }
+
+    uint64 now = GetThreadCpuTime(this->scriptCpuTimeThread);
+    if (now < start || now - start < this->scriptCpuTimeLimit)
+    {
+        return false;
+    }
+
+    this->DisableExecution();
+    return true;
+}
+
 void ThreadContext::DisableExecution()
 {
     Assert(TestThreadContextFlag(ThreadContextFlagCanDisableExecution));
@@ -9,6 +9,8 @@ namespace Js
     class ScriptContext;
     struct InlineCache;
     class DebugManager;
+    class AllocationSiteProfiler;
+    class ScriptSampler;
     class CodeGenRecyclableData;
     struct ReturnedValue;
     typedef JsUtil::List<ReturnedValue*> ReturnedValueList;
@@ -334,6 +336,82 @@ public:
         void * context;
     };
 
+    struct JitCompileStatistics
+    {
+        Js::FunctionBody * functionBody;
+        bool isLoopBody;
+        uint irBuilderTime;
+        uint globOptTime;
+        uint lowererTime;
+        uint regAllocTime;
+        uint encoderTime;
+        uint codeSize;
+        uint bailOutCount;
+    };
+    typedef void (__cdecl *JitCompileCallbackFunction)(void * context, JitCompileStatistics const& statistics);
+
+    // A host callback that may be invoked on background JIT threads. The function and its context are published
+    // together as one immutable record, and Set does not return while a call through the previous record is still
+    // running, so the caller can release the old context as soon as it has been replaced.
+    template <typename TCallbackFunction>
+    class BackgroundCallback
+    {
+    public:
+        BackgroundCallback() : record(nullptr) {}
+        ~BackgroundCallback() { Set(nullptr, nullptr); }
+
+        void Set(TCallbackFunction function, void * context)
+        {
+            Record * newRecord = function != nullptr ? HeapNew(Record, function, context) : nullptr;
+
+            AutoCriticalSection autocs(&this->cs);
+            Record * oldRecord = (Record *)InterlockedExchangePointer((PVOID volatile *)&this->record, newRecord);
+            if (oldRecord != nullptr)
+            {
+                HeapDelete(oldRecord);
+            }
+        }
+
+        bool IsSet() const { return this->record != nullptr; }
+
+        template <typename Fn>
+        void Invoke(Fn fn)
+        {
+            if (this->record == nullptr)
+            {
+                return;
+            }
+
+            AutoCriticalSection autocs(&this->cs);
+            Record * current = this->record;
+            if (current != nullptr)
+            {
+                fn(current->function, current->context);
+            }
+        }
+
+    private:
+        struct Record
+        {
+            Record(TCallbackFunction function, void * context) : function(function), context(context) {}
+            TCallbackFunction const function;
+            void * const context;
+        };
+
+        Record * volatile record;
+        CriticalSection cs;
+    };
+
+    struct PerfHintReport
+    {
+        PerfHints hint;
+        Js::FunctionBody * functionBody;
+        ULONG line;
+        ULONG column;
+        uint droppedCount;
+    };
+    typedef void (__cdecl *PerfHintCallbackFunction)(void * context, PerfHintReport const& report);
+
     struct WorkerThread
     {
         // Abstract notion to hold onto threadHandle of worker thread
@@ -472,9 +550,13 @@ private:
 
 public:
     typedef JsUtil::BaseHashSet<const Js::PropertyRecord *, HeapAllocator, PrimeSizePolicy, const Js::PropertyRecord *,
-        Js::PropertyRecordStringHashComparer, JsUtil::SimpleHashedEntry, JsUtil::AsymetricResizeLock> PropertyMap;
+        Js::PropertyRecordStringHashComparer, JsUtil::SimpleHashedEntry, JsUtil::NoResizeLock> PropertyMap;
     PropertyMap * propertyMap;
 
+    // The records of propertyMap by property index, kept in step with it, for the lookups of background
+    // JIT threads. Unlike the map, it is never moved on growth, so they don't need to take its resize lock.
+    JsUtil::ConcurrentReadArray<const Js::PropertyRecord *> propertyRecordsById;
+
     typedef JsUtil::BaseHashSet<Js::CaseInvariantPropertyListWithHashCode*, Recycler, PowerOf2SizePolicy, Js::CaseInvariantPropertyListWithHashCode*, JsUtil::NoCaseComparer, JsUtil::SimpleDictionaryEntry>
         PropertyNoCaseSetType;
     typedef JsUtil::WeaklyReferencedKeyDictionary<Js::Type, bool> TypeHashSet;
@@ -661,6 +743,7 @@ private:
     RedeferralState redeferralState;
     uint gcSinceLastRedeferral;
     uint gcSinceCallCountsCollected;
+    uint redeferralGcCount;
 
     static const uint InitialRedeferralDelay = 5;
     static const uint StartupRedeferralCheckInterval = 10;
@@ -740,6 +823,7 @@ private:
     bool hasCollectionCallBack;
     bool isOptimizedForManyInstances;
     bool bgJit;
+    bool isJitThreadPoolShared;
 
     // We report library code to profiler only if called directly by user code. Not if called by library implementation.
     bool isProfilingUserCode;
@@ -832,6 +916,7 @@ public:
     uint GetCallRootLevel() const { return callRootLevel; }
 
     PageAllocator * GetPageAllocator() { return &pageAllocator; }
+    void DecommitFreePages() { pageAllocator.DecommitNow(); }
 
     AllocationPolicyManager * GetAllocationPolicyManager() { return allocationPolicyManager; }
 
@@ -886,6 +971,38 @@ public:
     void SetInterruptPoller(InterruptPoller *poller) { interruptPoller = poller; }
     InterruptPoller *GetInterruptPoller() const { return interruptPoller; }
     BOOL HasInterruptPoller() const { return interruptPoller != nullptr; }
+
+    Js::AllocationSiteProfiler *EnsureAllocationSiteProfiler();
+    Js::AllocationSiteProfiler *GetAllocationSiteProfiler() const { return allocationSiteProfiler; }
+
+    Js::ScriptSampler *EnsureScriptSampler();
+    Js::ScriptSampler *GetScriptSampler() const { return scriptSampler; }
+
+    // The callback is invoked on the thread that did the codegen, which may be a background JIT thread
+    void SetJitCompileCallback(JitCompileCallbackFunction callback, void * context) { jitCompileCallback.Set(callback, context); }
+    BackgroundCallback<JitCompileCallbackFunction> * GetJitCompileCallback() { return &jitCompileCallback; }
+
+    // Critical perf hints are reported to the callback, at most maxPerSecond of them in each one second
+    // window. Like the JIT compile callback, it may be invoked on a background JIT thread.
+    void SetPerfHintCallback(PerfHintCallbackFunction callback, void * context, uint maxPerSecond);
+    BackgroundCallback<PerfHintCallbackFunction> * GetPerfHintCallback() { return &perfHintCallback; }
+    bool TryBeginPerfHintReport(uint * droppedCount);
+
+    // Code aging: when gcCount is non-zero, jitted entry points that have not been called for that many
+    // collections are expired on every cycle, instead of only when the native code heap nears its limit.
+    void SetCodeAgingGcCount(uint gcCount) { codeAgingGcCount = gcCount; }
+    uint GetCodeAgingGcCount() const { return codeAgingGcCount; }
+
+    // CPU time accounting, in the 100ns units of GetThreadTimes. It is off by default, since reading the thread
+    // clock at each script entry and exit is a system call on some platforms.
+    void SetCpuTimeAccountingEnabled(bool enabled) { cpuTimeAccountingEnabled = enabled; }
+    bool IsCpuTimeAccountingEnabled() const { return cpuTimeAccountingEnabled; }
+    uint64 GetGcCpuTime() const { return gcCpuTime; }
+    uint64 BeginScriptCpuTime();
+    void EndScriptCpuTime() { scriptCpuTimeStart = 0; }
+    void SetScriptCpuTimeLimit(uint64 limit) { scriptCpuTimeLimit = limit; }
+    bool CheckScriptCpuTimeLimit();
+    static uint64 GetThreadCpuTime(HANDLE thread);
     void CheckScriptInterrupt();
     void CheckInterruptPoll();
 
@@ -1164,6 +1281,12 @@ public:
     uint GetRedeferralCollectionInterval() const;
     uint GetRedeferralInactiveThreshold() const;
     void GetActiveFunctions(ActiveFunctionSet * pActive);
+
+    // Redeferral policy: when gcCount is non-zero, the call counts are collected and functions that were not
+    // called since the previous check are redeferred every gcCount collections, in place of the startup and
+    // main intervals of the default policy.
+    void SetRedeferralGcCount(uint gcCount) { redeferralGcCount = gcCount; }
+    uint GetRedeferralGcCount() const { return redeferralGcCount; }
 #if DBG
     uint redeferredFunctions;
     uint recoveredBytes;
@@ -1566,6 +1689,7 @@ public:
     int numExpirableObjects;
     int expirableCollectModeGcCount;
     bool disableExpiration;
+    uint codeAgingGcCount;
 
     bool InExpirableCollectMode();
     void TryEnterExpirableCollectMode();
@@ -1635,6 +1759,15 @@ public:
         Assert(!jobProcessor || enableBgJit == bgJit);
         bgJit = enableBgJit;
     }
+
+    // Use the process-wide background job processor for jitting instead of one owned by this thread context
+    bool IsJitThreadPoolShared() const { return isJitThreadPoolShared; }
+
+    void ShareJitThreadPool(const bool share)
+    {
+        Assert(!jobProcessor || share == isJitThreadPoolShared);
+        isJitThreadPoolShared = share;
+    }
 #endif
 
     void* GetJSRTRuntime() const { return jsrtRuntime; }
@@ -1648,6 +1781,25 @@ private:
     void CreateNoCasePropertyMap();
 
     InterruptPoller *interruptPoller;
+    Js::AllocationSiteProfiler *allocationSiteProfiler;
+    Js::ScriptSampler *scriptSampler;
+    BackgroundCallback<JitCompileCallbackFunction> jitCompileCallback;
+    BackgroundCallback<PerfHintCallbackFunction> perfHintCallback;
+    uint perfHintMaxPerSecond;
+    DWORD perfHintWindowStart;
+    volatile LONG perfHintWindowCount;
+    volatile LONG perfHintDroppedCount;
+
+    bool cpuTimeAccountingEnabled;
+    uint64 gcCpuTime;
+    uint64 gcCpuTimeStart;
+    uint64 scriptCpuTimeLimit;
+    // Thread CPU time when the outermost script call started, or 0 outside of script. Read by the watchdog.
+    volatile uint64 scriptCpuTimeStart;
+    // A real handle to the thread running script, so that other threads can read its clock
+    HANDLE scriptCpuTimeThread;
+    DWORD scriptCpuTimeThreadId;
+    CriticalSection csScriptCpuTimeThread;
 
     void CollectionCallBack(RecyclerCollectCallBackFlags flags);
 
@@ -150,6 +150,17 @@ bool ThreadServiceWrapperBase::IdleCollect()
     return hasScheduledIdleCollect;
 }
 
+// Make a pending idle collection due now, so that the next IdleCollect
+// runs it instead of waiting for the idle timeout to pass
+void ThreadServiceWrapperBase::AdvanceIdleCollect()
+{
+    if (needIdleCollect)
+    {
+        IDLE_COLLECT_VERBOSE_TRACE(_u("AdvanceIdleCollect- collection due now\n"));
+        tickCountNextIdleCollection = GetTickCount();
+    }
+}
+
 void ThreadServiceWrapperBase::FinishIdleCollect(ThreadServiceWrapperBase::FinishReason reason)
 {
     Assert(reason == FinishReason::FinishReasonIdleTimerSetupFailed ||
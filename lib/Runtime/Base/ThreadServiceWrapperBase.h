@@ -34,6 +34,7 @@ protected:
     void Shutdown();
 
     bool IdleCollect();
+    void AdvanceIdleCollect();
     void FinishIdleCollect(FinishReason reason);
     void ClearForceOneIdleCollection();
 
@@ -3449,7 +3449,7 @@ void ByteCodeGenerator::EmitOneFunction(ParseNode *pnode)
     }
 
 #ifdef PERF_HINT
-    if (PHASE_TRACE1(Js::PerfHintPhase) && !byteCodeFunction->GetIsGlobalFunc())
+    if (IsPerfHintEnabled(byteCodeFunction->GetScriptContext()) && !byteCodeFunction->GetIsGlobalFunc())
     {
         if (byteCodeFunction->GetHasTry())
         {
@@ -11361,7 +11361,7 @@ void Emit(ParseNode *pnode, ByteCodeGenerator *byteCodeGenerator, FuncInfo *func
         byteCodeGenerator->EndStatement(pnode);
 
 #ifdef PERF_HINT
-        if (PHASE_TRACE1(Js::PerfHintPhase))
+        if (IsPerfHintEnabled(byteCodeGenerator->GetScriptContext()))
         {
             WritePerfHint(PerfHints::HasWithBlock, funcInfo->byteCodeFunction->GetFunctionBody(), byteCodeGenerator->Writer()->GetCurrentOffset() - 1);
         }
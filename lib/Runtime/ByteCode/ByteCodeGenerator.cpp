@@ -2383,7 +2383,7 @@ FuncInfo* PreVisitFunction(ParseNode* pnode, ByteCodeGenerator* byteCodeGenerato
             {
                 bool doStackArgsOpt = (!pnode->sxFnc.HasAnyWriteToFormals() || funcInfo->GetIsStrictMode());
 #ifdef PERF_HINT
-                if (PHASE_TRACE1(Js::PerfHintPhase) && !doStackArgsOpt)
+                if (IsPerfHintEnabled(byteCodeGenerator->GetScriptContext()) && !doStackArgsOpt)
                 {
                     WritePerfHint(PerfHints::HeapArgumentsDueToWriteToFormals, funcInfo->GetParsedFunctionBody(), 0);
                 }
@@ -2395,7 +2395,7 @@ FuncInfo* PreVisitFunction(ParseNode* pnode, ByteCodeGenerator* byteCodeGenerato
                 {
                     doStackArgsOpt = false;
 #ifdef PERF_HINT
-                    if (PHASE_TRACE1(Js::PerfHintPhase))
+                    if (IsPerfHintEnabled(byteCodeGenerator->GetScriptContext()))
                     {
                         if (pnode->sxFnc.HasWithStmt())
                         {
@@ -3007,7 +3007,7 @@ FuncInfo* PostVisitFunction(ParseNode* pnode, ByteCodeGenerator* byteCodeGenerat
             {
                 top->SetHasHeapArguments(true, false /*= Optimize arguments in backend*/);
 #ifdef PERF_HINT
-                if (PHASE_TRACE1(Js::PerfHintPhase))
+                if (IsPerfHintEnabled(byteCodeGenerator->GetScriptContext()))
                 {
                     WritePerfHint(PerfHints::HeapArgumentsDueToNonLocalRef, top->GetParsedFunctionBody(), 0);
                 }
@@ -61,10 +61,25 @@ SourceContextInfo* SourceContextInfo::Clone(Js::ScriptContext* scriptContext) co
             oldUrl? wcslen(oldUrl) : 0,
             NULL,
             oldSourceMapUrl,
-            oldSourceMapUrl ? wcslen(oldSourceMapUrl) : 0);
+            oldSourceMapUrl ? wcslen(oldSourceMapUrl) : 0,
+            this->sourceHash,
+            this->sourceByteCount);
         newSourceContextInfo->nextLocalFunctionId = this->nextLocalFunctionId;
         newSourceContextInfo->sourceContextId = this->sourceContextId;
         newSourceContextInfo->EnsureInitialized();
     }
     return newSourceContextInfo;
 }
+
+uint SourceContextInfo::ComputeSourceHash(__in_bcount(byteCount) byte const * source, size_t byteCount)
+{
+    // 32-bit FNV-1a. Profiles are validated against the function bodies when they are loaded,
+    // so a collision only costs us the cached profile, not correctness.
+    uint hash = 2166136261u;
+    for (size_t i = 0; i < byteCount; i++)
+    {
+        hash ^= source[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
@@ -38,9 +38,13 @@ public:
 #if ENABLE_PROFILE_INFO
     Js::SourceDynamicProfileManager * sourceDynamicProfileManager;
 #endif
+    uint sourceHash;                    // hash of the script source, or 0 if the host didn't provide it
+    size_t sourceByteCount;             // size of the hashed source
 
     void EnsureInitialized();
     bool IsDynamic() const { return dwHostSourceContext == Js::Constants::NoHostSourceContext || isHostDynamicDocument; }
     bool IsSourceProfileLoaded() const;
     SourceContextInfo* Clone(Js::ScriptContext* scriptContext) const;
+
+    static uint ComputeSourceHash(__in_bcount(byteCount) byte const * source, size_t byteCount);
 };
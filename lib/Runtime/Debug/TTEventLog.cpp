@@ -2954,10 +2954,23 @@ namespace TTD
         this->m_threadContext->TTDContext->TTDWriteInitializeFunction(outUri.UriByteLength, outUri.UriBytes);
 
         JsTTDStreamHandle logHandle = iofp.pfGetResourceStream(outUri.UriByteLength, outUri.UriBytes, "ttdlog.log", false, true, nullptr, nullptr);
-        TTD_LOG_WRITER writer(logHandle, TTD_COMPRESSED_OUTPUT, iofp.pfWriteBytesToStream, iofp.pfFlushAndCloseStream);
+#if ENABLE_TTD_INTERNAL_DIAGNOSTICS
+        if(!Js::Configuration::Global.flags.TTDBinaryFormat)
+        {
+            TextFormatWriter writer(logHandle, TTD_COMPRESSED_OUTPUT, iofp.pfWriteBytesToStream, iofp.pfFlushAndCloseStream);
+            this->EmitLogToWriter(&writer);
+            return;
+        }
+#endif
+
+        BinaryFormatWriter writer(logHandle, TTD_COMPRESSED_OUTPUT, iofp.pfWriteBytesToStream, iofp.pfFlushAndCloseStream);
+        this->EmitLogToWriter(&writer);
+    }
 
-        writer.WriteRecordStart();
-        writer.AdjustIndent(1);
+    void EventLog::EmitLogToWriter(FileWriter* writer)
+    {
+        writer->WriteRecordStart();
+        writer->AdjustIndent(1);
 
         TTString archString;
 #if defined(_M_IX86)
@@ -2972,7 +2985,7 @@ namespace TTD
         this->m_miscSlabAllocator.CopyNullTermStringInto(_u("unknown"), archString);
 #endif
 
-        writer.WriteString(NSTokens::Key::arch, archString);
+        writer->WriteString(NSTokens::Key::arch, archString);
 
         TTString platformString;
 #if defined(_WIN32)
@@ -2983,7 +2996,7 @@ namespace TTD
         this->m_miscSlabAllocator.CopyNullTermStringInto(_u("Linux"), platformString);
 #endif
 
-        writer.WriteString(NSTokens::Key::platform, platformString);
+        writer->WriteString(NSTokens::Key::platform, platformString);
 
 #if ENABLE_TTD_INTERNAL_DIAGNOSTICS
         bool diagEnabled = true;
@@ -2991,17 +3004,17 @@ namespace TTD
         bool diagEnabled = false;
 #endif
 
-        writer.WriteBool(NSTokens::Key::diagEnabled, diagEnabled, NSTokens::Separator::CommaSeparator);
+        writer->WriteBool(NSTokens::Key::diagEnabled, diagEnabled, NSTokens::Separator::CommaSeparator);
 
         uint64 usedSpace = 0;
         uint64 reservedSpace = 0;
         this->m_eventSlabAllocator.ComputeMemoryUsed(&usedSpace, &reservedSpace);
 
-        writer.WriteUInt64(NSTokens::Key::usedMemory, usedSpace, NSTokens::Separator::CommaSeparator);
-        writer.WriteUInt64(NSTokens::Key::reservedMemory, reservedSpace, NSTokens::Separator::CommaSeparator);
+        writer->WriteUInt64(NSTokens::Key::usedMemory, usedSpace, NSTokens::Separator::CommaSeparator);
+        writer->WriteUInt64(NSTokens::Key::reservedMemory, reservedSpace, NSTokens::Separator::CommaSeparator);
 
         uint32 ecount = this->m_eventList.Count();
-        writer.WriteLengthValue(ecount, NSTokens::Separator::CommaAndBigSpaceSeparator);
+        writer->WriteLengthValue(ecount, NSTokens::Separator::CommaAndBigSpaceSeparator);
 
 #if ENABLE_TTD_INTERNAL_DIAGNOSTICS
         JsUtil::Stack<int64, HeapAllocator> callNestingStack(&HeapAllocator::Instance);
@@ -3009,15 +3022,15 @@ namespace TTD
 
         bool firstElem = true;
 
-        writer.WriteSequenceStart_DefaultKey(NSTokens::Separator::CommaSeparator);
-        writer.AdjustIndent(1);
-        writer.WriteSeperator(NSTokens::Separator::BigSpaceSeparator);
+        writer->WriteSequenceStart_DefaultKey(NSTokens::Separator::CommaSeparator);
+        writer->AdjustIndent(1);
+        writer->WriteSeperator(NSTokens::Separator::BigSpaceSeparator);
         for(auto iter = this->m_eventList.GetIteratorAtFirst(); iter.IsValid(); iter.MoveNext())
         {
             const NSLogEvents::EventLogEntry* evt = iter.Current();
 
             NSTokens::Separator sep = firstElem ? NSTokens::Separator::NoSeparator : NSTokens::Separator::BigSpaceSeparator;
-            NSLogEvents::EventLogEntry_Emit(evt, this->m_eventListVTable, &writer, this->m_threadContext, sep);
+            NSLogEvents::EventLogEntry_Emit(evt, this->m_eventListVTable, writer, this->m_threadContext, sep);
 
             firstElem = false;
 #if ENABLE_TTD_INTERNAL_DIAGNOSTICS
@@ -3026,7 +3039,7 @@ namespace TTD
             bool isRegisterCall = (evt->EventKind == NSLogEvents::EventKind::ExternalCbRegisterCall);
             if(isJsRTCall | isExternalCall | isRegisterCall)
             {
-                writer.WriteSequenceStart(NSTokens::Separator::BigSpaceSeparator);
+                writer->WriteSequenceStart(NSTokens::Separator::BigSpaceSeparator);
 
                 int64 lastNestedTime = -1;
                 if(isJsRTCall)
@@ -3045,9 +3058,9 @@ namespace TTD
 
                 if(lastNestedTime != evt->EventTimeStamp)
                 {
-                    writer.AdjustIndent(1);
+                    writer->AdjustIndent(1);
 
-                    writer.WriteSeperator(NSTokens::Separator::BigSpaceSeparator);
+                    writer->WriteSeperator(NSTokens::Separator::BigSpaceSeparator);
                     firstElem = true;
                 }
             }
@@ -3058,23 +3071,23 @@ namespace TTD
 
                 if(!isJsRTCall & !isExternalCall & !isRegisterCall)
                 {
-                    writer.AdjustIndent(-1);
-                    writer.WriteSeperator(NSTokens::Separator::BigSpaceSeparator);
+                    writer->AdjustIndent(-1);
+                    writer->WriteSeperator(NSTokens::Separator::BigSpaceSeparator);
                 }
-                writer.WriteSequenceEnd();
+                writer->WriteSequenceEnd();
 
                 while(!callNestingStack.Empty() && eTime == callNestingStack.Peek())
                 {
                     callNestingStack.Pop();
 
-                    writer.AdjustIndent(-1);
-                    writer.WriteSequenceEnd(NSTokens::Separator::BigSpaceSeparator);
+                    writer->AdjustIndent(-1);
+                    writer->WriteSequenceEnd(NSTokens::Separator::BigSpaceSeparator);
                 }
             }
 #endif
         }
-        writer.AdjustIndent(-1);
-        writer.WriteSequenceEnd(NSTokens::Separator::BigSpaceSeparator);
+        writer->AdjustIndent(-1);
+        writer->WriteSequenceEnd(NSTokens::Separator::BigSpaceSeparator);
 
         //we haven't moved the properties to their serialized form them take care of it
         TTDAssert(this->m_propertyRecordList.Count() == 0, "We only compute this when we are ready to emit.");
@@ -3093,80 +3106,92 @@ namespace TTD
         }
 
         //emit the properties
-        writer.WriteLengthValue(this->m_propertyRecordList.Count(), NSTokens::Separator::CommaSeparator);
+        writer->WriteLengthValue(this->m_propertyRecordList.Count(), NSTokens::Separator::CommaSeparator);
 
-        writer.WriteSequenceStart_DefaultKey(NSTokens::Separator::CommaSeparator);
-        writer.AdjustIndent(1);
+        writer->WriteSequenceStart_DefaultKey(NSTokens::Separator::CommaSeparator);
+        writer->AdjustIndent(1);
         bool firstProperty = true;
         for(auto iter = this->m_propertyRecordList.GetIterator(); iter.IsValid(); iter.MoveNext())
         {
             NSTokens::Separator sep = (!firstProperty) ? NSTokens::Separator::CommaAndBigSpaceSeparator : NSTokens::Separator::BigSpaceSeparator;
-            NSSnapType::EmitSnapPropertyRecord(iter.Current(), &writer, sep);
+            NSSnapType::EmitSnapPropertyRecord(iter.Current(), writer, sep);
 
             firstProperty = false;
         }
-        writer.AdjustIndent(-1);
-        writer.WriteSequenceEnd(NSTokens::Separator::BigSpaceSeparator);
+        writer->AdjustIndent(-1);
+        writer->WriteSequenceEnd(NSTokens::Separator::BigSpaceSeparator);
 
         //do top level script processing here
-        writer.WriteLengthValue(this->m_loadedTopLevelScripts.Count(), NSTokens::Separator::CommaSeparator);
-        writer.WriteSequenceStart_DefaultKey(NSTokens::Separator::CommaSeparator);
-        writer.AdjustIndent(1);
+        writer->WriteLengthValue(this->m_loadedTopLevelScripts.Count(), NSTokens::Separator::CommaSeparator);
+        writer->WriteSequenceStart_DefaultKey(NSTokens::Separator::CommaSeparator);
+        writer->AdjustIndent(1);
         bool firstLoadScript = true;
         for(auto iter = this->m_loadedTopLevelScripts.GetIterator(); iter.IsValid(); iter.MoveNext())
         {
             NSTokens::Separator sep = (!firstLoadScript) ? NSTokens::Separator::CommaAndBigSpaceSeparator : NSTokens::Separator::BigSpaceSeparator;
-            NSSnapValues::EmitTopLevelLoadedFunctionBodyInfo(iter.Current(), this->m_threadContext, &writer, sep);
+            NSSnapValues::EmitTopLevelLoadedFunctionBodyInfo(iter.Current(), this->m_threadContext, writer, sep);
 
             firstLoadScript = false;
         }
-        writer.AdjustIndent(-1);
-        writer.WriteSequenceEnd(NSTokens::Separator::BigSpaceSeparator);
+        writer->AdjustIndent(-1);
+        writer->WriteSequenceEnd(NSTokens::Separator::BigSpaceSeparator);
 
-        writer.WriteLengthValue(this->m_newFunctionTopLevelScripts.Count(), NSTokens::Separator::CommaSeparator);
-        writer.WriteSequenceStart_DefaultKey(NSTokens::Separator::CommaSeparator);
-        writer.AdjustIndent(1);
+        writer->WriteLengthValue(this->m_newFunctionTopLevelScripts.Count(), NSTokens::Separator::CommaSeparator);
+        writer->WriteSequenceStart_DefaultKey(NSTokens::Separator::CommaSeparator);
+        writer->AdjustIndent(1);
         bool firstNewScript = true;
         for(auto iter = this->m_newFunctionTopLevelScripts.GetIterator(); iter.IsValid(); iter.MoveNext())
         {
             NSTokens::Separator sep = (!firstNewScript) ? NSTokens::Separator::CommaAndBigSpaceSeparator : NSTokens::Separator::BigSpaceSeparator;
-            NSSnapValues::EmitTopLevelNewFunctionBodyInfo(iter.Current(), this->m_threadContext, &writer, sep);
+            NSSnapValues::EmitTopLevelNewFunctionBodyInfo(iter.Current(), this->m_threadContext, writer, sep);
 
             firstNewScript = false;
         }
-        writer.AdjustIndent(-1);
-        writer.WriteSequenceEnd(NSTokens::Separator::BigSpaceSeparator);
+        writer->AdjustIndent(-1);
+        writer->WriteSequenceEnd(NSTokens::Separator::BigSpaceSeparator);
 
-        writer.WriteLengthValue(this->m_evalTopLevelScripts.Count(), NSTokens::Separator::CommaSeparator);
-        writer.WriteSequenceStart_DefaultKey(NSTokens::Separator::CommaSeparator);
-        writer.AdjustIndent(1);
+        writer->WriteLengthValue(this->m_evalTopLevelScripts.Count(), NSTokens::Separator::CommaSeparator);
+        writer->WriteSequenceStart_DefaultKey(NSTokens::Separator::CommaSeparator);
+        writer->AdjustIndent(1);
         bool firstEvalScript = true;
         for(auto iter = this->m_evalTopLevelScripts.GetIterator(); iter.IsValid(); iter.MoveNext())
         {
             NSTokens::Separator sep = (!firstEvalScript) ? NSTokens::Separator::CommaAndBigSpaceSeparator : NSTokens::Separator::BigSpaceSeparator;
-            NSSnapValues::EmitTopLevelEvalFunctionBodyInfo(iter.Current(), this->m_threadContext, &writer, sep);
+            NSSnapValues::EmitTopLevelEvalFunctionBodyInfo(iter.Current(), this->m_threadContext, writer, sep);
 
             firstEvalScript = false;
         }
-        writer.AdjustIndent(-1);
-        writer.WriteSequenceEnd(NSTokens::Separator::BigSpaceSeparator);
+        writer->AdjustIndent(-1);
+        writer->WriteSequenceEnd(NSTokens::Separator::BigSpaceSeparator);
         //
 
-        writer.AdjustIndent(-1);
-        writer.WriteRecordEnd(NSTokens::Separator::BigSpaceSeparator);
+        writer->AdjustIndent(-1);
+        writer->WriteRecordEnd(NSTokens::Separator::BigSpaceSeparator);
 
-        writer.FlushAndClose();
+        writer->FlushAndClose();
     }
 
     void EventLog::ParseLogInto(const IOStreamFunctions& iofp, size_t uriByteLength, const byte* uriBytes)
     {
         JsTTDStreamHandle logHandle = iofp.pfGetResourceStream(uriByteLength, uriBytes, "ttdlog.log", true, false, nullptr, nullptr);
-        TTD_LOG_READER reader(logHandle, TTD_COMPRESSED_OUTPUT, iofp.pfReadBytesFromStream, iofp.pfFlushAndCloseStream);
+        if(ReadFileFormat(logHandle, iofp.pfReadBytesFromStream) == FileFormat::Text)
+        {
+            TextFormatReader reader(logHandle, TTD_COMPRESSED_OUTPUT, iofp.pfReadBytesFromStream, iofp.pfFlushAndCloseStream);
+            this->ParseLogFromReader(&reader);
+        }
+        else
+        {
+            BinaryFormatReader reader(logHandle, TTD_COMPRESSED_OUTPUT, iofp.pfReadBytesFromStream, iofp.pfFlushAndCloseStream);
+            this->ParseLogFromReader(&reader);
+        }
+    }
 
-        reader.ReadRecordStart();
+    void EventLog::ParseLogFromReader(FileReader* reader)
+    {
+        reader->ReadRecordStart();
 
         TTString archString;
-        reader.ReadString(NSTokens::Key::arch, this->m_miscSlabAllocator, archString);
+        reader->ReadString(NSTokens::Key::arch, this->m_miscSlabAllocator, archString);
 
 #if defined(_M_IX86)
         TTDAssert(wcscmp(_u("x86"), archString.Contents) == 0, "Mismatch in arch between record and replay!!!");
@@ -3180,9 +3205,9 @@ namespace TTD
 
         //This is informational only so just read off the value and ignore
         TTString platformString;
-        reader.ReadString(NSTokens::Key::platform, this->m_miscSlabAllocator, platformString);
+        reader->ReadString(NSTokens::Key::platform, this->m_miscSlabAllocator, platformString);
 
-        bool diagEnabled = reader.ReadBool(NSTokens::Key::diagEnabled, true);
+        bool diagEnabled = reader->ReadBool(NSTokens::Key::diagEnabled, true);
 
 #if ENABLE_TTD_INTERNAL_DIAGNOSTICS
         TTDAssert(diagEnabled, "Diag was enabled in record so it shoud be in replay as well!!!");
@@ -3190,8 +3215,8 @@ namespace TTD
         TTDAssert(!diagEnabled, "Diag was *not* enabled in record so it shoud *not* be in replay either!!!");
 #endif
 
-        reader.ReadUInt64(NSTokens::Key::usedMemory, true);
-        reader.ReadUInt64(NSTokens::Key::reservedMemory, true);
+        reader->ReadUInt64(NSTokens::Key::usedMemory, true);
+        reader->ReadUInt64(NSTokens::Key::reservedMemory, true);
 
 #if ENABLE_TTD_INTERNAL_DIAGNOSTICS
         JsUtil::Stack<int64, HeapAllocator> callNestingStack(&HeapAllocator::Instance);
@@ -3199,12 +3224,12 @@ namespace TTD
         bool doSep = false;
 #endif
 
-        uint32 ecount = reader.ReadLengthValue(true);
-        reader.ReadSequenceStart_WDefaultKey(true);
+        uint32 ecount = reader->ReadLengthValue(true);
+        reader->ReadSequenceStart_WDefaultKey(true);
         for(uint32 i = 0; i < ecount; ++i)
         {
             NSLogEvents::EventLogEntry* evt = this->m_eventList.GetNextAvailableEntry();
-            NSLogEvents::EventLogEntry_Parse(evt, this->m_eventListVTable, false, this->m_threadContext, &reader, this->m_eventSlabAllocator);
+            NSLogEvents::EventLogEntry_Parse(evt, this->m_eventListVTable, false, this->m_threadContext, reader, this->m_eventSlabAllocator);
 
 #if ENABLE_TTD_INTERNAL_DIAGNOSTICS
             bool isJsRTCall = (evt->EventKind == NSLogEvents::EventKind::CallExistingFunctionActionTag);
@@ -3212,7 +3237,7 @@ namespace TTD
             bool isRegisterCall = (evt->EventKind == NSLogEvents::EventKind::ExternalCbRegisterCall);
             if(isJsRTCall | isExternalCall | isRegisterCall)
             {
-                reader.ReadSequenceStart(false);
+                reader->ReadSequenceStart(false);
 
                 int64 lastNestedTime = -1;
                 if(isJsRTCall)
@@ -3235,52 +3260,52 @@ namespace TTD
             while(callNestingStack.Count() != 0 && evt->EventTimeStamp == callNestingStack.Peek())
             {
                 callNestingStack.Pop();
-                reader.ReadSequenceEnd();
+                reader->ReadSequenceEnd();
             }
 #endif
         }
-        reader.ReadSequenceEnd();
+        reader->ReadSequenceEnd();
 
         //parse the properties
-        uint32 propertyCount = reader.ReadLengthValue(true);
-        reader.ReadSequenceStart_WDefaultKey(true);
+        uint32 propertyCount = reader->ReadLengthValue(true);
+        reader->ReadSequenceStart_WDefaultKey(true);
         for(uint32 i = 0; i < propertyCount; ++i)
         {
             NSSnapType::SnapPropertyRecord* sRecord = this->m_propertyRecordList.NextOpenEntry();
-            NSSnapType::ParseSnapPropertyRecord(sRecord, i != 0, &reader, this->m_miscSlabAllocator);
+            NSSnapType::ParseSnapPropertyRecord(sRecord, i != 0, reader, this->m_miscSlabAllocator);
         }
-        reader.ReadSequenceEnd();
+        reader->ReadSequenceEnd();
 
         //do top level script processing here
-        uint32 loadedScriptCount = reader.ReadLengthValue(true);
-        reader.ReadSequenceStart_WDefaultKey(true);
+        uint32 loadedScriptCount = reader->ReadLengthValue(true);
+        reader->ReadSequenceStart_WDefaultKey(true);
         for(uint32 i = 0; i < loadedScriptCount; ++i)
         {
             NSSnapValues::TopLevelScriptLoadFunctionBodyResolveInfo* fbInfo = this->m_loadedTopLevelScripts.NextOpenEntry();
-            NSSnapValues::ParseTopLevelLoadedFunctionBodyInfo(fbInfo, i != 0, this->m_threadContext, &reader, this->m_miscSlabAllocator);
+            NSSnapValues::ParseTopLevelLoadedFunctionBodyInfo(fbInfo, i != 0, this->m_threadContext, reader, this->m_miscSlabAllocator);
         }
-        reader.ReadSequenceEnd();
+        reader->ReadSequenceEnd();
 
-        uint32 newScriptCount = reader.ReadLengthValue(true);
-        reader.ReadSequenceStart_WDefaultKey(true);
+        uint32 newScriptCount = reader->ReadLengthValue(true);
+        reader->ReadSequenceStart_WDefaultKey(true);
         for(uint32 i = 0; i < newScriptCount; ++i)
         {
             NSSnapValues::TopLevelNewFunctionBodyResolveInfo* fbInfo = this->m_newFunctionTopLevelScripts.NextOpenEntry();
-            NSSnapValues::ParseTopLevelNewFunctionBodyInfo(fbInfo, i != 0, this->m_threadContext, &reader, this->m_miscSlabAllocator);
+            NSSnapValues::ParseTopLevelNewFunctionBodyInfo(fbInfo, i != 0, this->m_threadContext, reader, this->m_miscSlabAllocator);
         }
-        reader.ReadSequenceEnd();
+        reader->ReadSequenceEnd();
 
-        uint32 evalScriptCount = reader.ReadLengthValue(true);
-        reader.ReadSequenceStart_WDefaultKey(true);
+        uint32 evalScriptCount = reader->ReadLengthValue(true);
+        reader->ReadSequenceStart_WDefaultKey(true);
         for(uint32 i = 0; i < evalScriptCount; ++i)
         {
             NSSnapValues::TopLevelEvalFunctionBodyResolveInfo* fbInfo = this->m_evalTopLevelScripts.NextOpenEntry();
-            NSSnapValues::ParseTopLevelEvalFunctionBodyInfo(fbInfo, i != 0, this->m_threadContext, &reader, this->m_miscSlabAllocator);
+            NSSnapValues::ParseTopLevelEvalFunctionBodyInfo(fbInfo, i != 0, this->m_threadContext, reader, this->m_miscSlabAllocator);
         }
-        reader.ReadSequenceEnd();
+        reader->ReadSequenceEnd();
         //
 
-        reader.ReadRecordEnd();
+        reader->ReadRecordEnd();
     }
 }
 
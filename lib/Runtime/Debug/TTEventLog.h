@@ -711,6 +711,10 @@ namespace TTD
 
         void EmitLog();
         void ParseLogInto(const IOStreamFunctions& iofp, size_t uriByteLength, const byte* uriBytes);
+
+    private:
+        void EmitLogToWriter(FileWriter* writer);
+        void ParseLogFromReader(FileReader* reader);
     };
 
     //A class to ensure that even when exceptions are thrown the pop action for the TTD call stack is executed -- defined after EventLog so we can refer to it in the .h file
@@ -40,6 +40,28 @@ namespace TTD
 
     //////////////////
 
+    //The marker at the start of a stream for each format (for text it is the UTF-16 byte order marker)
+    static const byte TextFormatMarker[2] = { 0xFF, 0xFE };
+    static const byte BinaryFormatMarker[2] = { 0x54, 0x42 };
+
+    FileFormat ReadFileFormat(JsTTDStreamHandle handle, TTDReadBytesFromStreamCallback pfRead)
+    {
+        byte formatMarker[2] = { 0x0, 0x0 };
+        size_t readCount = 0;
+        bool success = pfRead(handle, formatMarker, 2, &readCount);
+        TTDAssert(success && readCount == 2, "Failed to read the format marker!");
+
+        if(formatMarker[0] == TextFormatMarker[0] && formatMarker[1] == TextFormatMarker[1])
+        {
+            return FileFormat::Text;
+        }
+
+        TTDAssert(formatMarker[0] == BinaryFormatMarker[0] && formatMarker[1] == BinaryFormatMarker[1], "Format marker is incorrect!");
+        return FileFormat::Binary;
+    }
+
+    //////////////////
+
     void FileWriter::WriteBlock(const byte* buff, size_t bufflen)
     {
         TTDAssert(bufflen != 0, "Shouldn't be writing empty blocks");
@@ -166,8 +188,7 @@ namespace TTD
     TextFormatWriter::TextFormatWriter(JsTTDStreamHandle handle, bool doCompression, TTDWriteBytesToStreamCallback pfWrite, TTDFlushAndCloseStreamCallback pfClose)
         : FileWriter(handle, doCompression, pfWrite, pfClose), m_keyNameArray(nullptr), m_keyNameLengthArray(nullptr), m_indentSize(0)
     {
-        byte byteOrderMarker[2] = { 0xFF, 0xFE };
-        this->WriteRawByteBuff(byteOrderMarker, 2);
+        this->WriteRawByteBuff(TextFormatMarker, 2);
 
         NSTokens::InitKeyNamesArray(&(this->m_keyNameArray), &(this->m_keyNameLengthArray));
     }
@@ -416,7 +437,7 @@ namespace TTD
     BinaryFormatWriter::BinaryFormatWriter(JsTTDStreamHandle handle, bool doCompression, TTDWriteBytesToStreamCallback pfWrite, TTDFlushAndCloseStreamCallback pfClose)
         : FileWriter(handle, doCompression, pfWrite, pfClose)
     {
-        ;
+        this->WriteRawByteBuff(BinaryFormatMarker, 2);
     }
 
     BinaryFormatWriter::~BinaryFormatWriter()
@@ -1141,9 +1162,7 @@ namespace TTD
     TextFormatReader::TextFormatReader(JsTTDStreamHandle handle, bool doDecompress, TTDReadBytesFromStreamCallback pfRead, TTDFlushAndCloseStreamCallback pfClose)
         : FileReader(handle, doDecompress, pfRead, pfClose), m_charListPrimary(&HeapAllocator::Instance), m_charListOpt(&HeapAllocator::Instance), m_charListDiscard(&HeapAllocator::Instance), m_keyNameArray(nullptr), m_keyNameLengthArray(nullptr)
     {
-        byte byteOrderMarker[2] = { 0x0, 0x0 };
-        this->ReadBytesInto(byteOrderMarker, 2);
-        TTDAssert(byteOrderMarker[0] == 0xFF && byteOrderMarker[1] == 0xFE, "Byte Order Marker is incorrect!");
+        //The byte order marker has already been read by ReadFileFormat
 
         NSTokens::InitKeyNamesArray(&(this->m_keyNameArray), &(this->m_keyNameLengthArray));
     }
@@ -1684,6 +1703,8 @@ namespace TTD
 
     void BinaryFormatReader::ReadInlineCode(_Out_writes_(length) char16* code, uint32 length, bool readSeparator)
     {
+        this->ReadSeperator(readSeparator);
+
         uint32 wlen = 0;
         this->ReadBytesInto_Fixed<uint32>(wlen);
         TTDAssert(wlen == length, "Not exepcted string length!!!");
@@ -691,6 +691,16 @@ namespace TTD
         virtual void ReadInlineCode(_Out_writes_(length) char16* code, uint32 length, bool readSeparator = false) override;
     };
 
+    //The format a log or snapshot stream was written in
+    enum class FileFormat
+    {
+        Text,
+        Binary
+    };
+
+    //Read the format marker that the writers put at the start of a stream -- the matching reader then reads the rest of it
+    FileFormat ReadFileFormat(JsTTDStreamHandle handle, TTDReadBytesFromStreamCallback pfRead);
+
     //////////////////
 
 #if ENABLE_OBJECT_SOURCE_TRACKING
@@ -564,8 +564,17 @@ namespace TTD
         const IOStreamFunctions& iops = threadContext->TTDContext->TTDStreamFunctions;
         JsTTDStreamHandle snapHandle = iops.pfGetResourceStream(uri.UriByteLength, uri.UriBytes, asciiResourceName, false, true, nullptr, nullptr);
 
-        TTD_SNAP_WRITER snapwriter(snapHandle, TTD_COMPRESSED_OUTPUT, iops.pfWriteBytesToStream, iops.pfFlushAndCloseStream);
+#if ENABLE_TTD_INTERNAL_DIAGNOSTICS
+        if(!Js::Configuration::Global.flags.TTDBinaryFormat)
+        {
+            TextFormatWriter snapwriter(snapHandle, TTD_COMPRESSED_OUTPUT, iops.pfWriteBytesToStream, iops.pfFlushAndCloseStream);
+            this->EmitSnapshotToFile(&snapwriter, threadContext);
+            snapwriter.FlushAndClose();
+            return;
+        }
+#endif
 
+        BinaryFormatWriter snapwriter(snapHandle, TTD_COMPRESSED_OUTPUT, iops.pfWriteBytesToStream, iops.pfFlushAndCloseStream);
         this->EmitSnapshotToFile(&snapwriter, threadContext);
         snapwriter.FlushAndClose();
     }
@@ -579,10 +588,16 @@ namespace TTD
         const IOStreamFunctions& iops = threadContext->TTDContext->TTDStreamFunctions;
         JsTTDStreamHandle snapHandle = iops.pfGetResourceStream(uri.UriByteLength, uri.UriBytes, asciiResourceName, true, false, nullptr, nullptr);
 
-        TTD_SNAP_READER snapreader(snapHandle, TTD_COMPRESSED_OUTPUT, iops.pfReadBytesFromStream, iops.pfFlushAndCloseStream);
-        SnapShot* snap = SnapShot::ParseSnapshotFromFile(&snapreader);
-
-        return snap;
+        if(ReadFileFormat(snapHandle, iops.pfReadBytesFromStream) == FileFormat::Text)
+        {
+            TextFormatReader snapreader(snapHandle, TTD_COMPRESSED_OUTPUT, iops.pfReadBytesFromStream, iops.pfFlushAndCloseStream);
+            return SnapShot::ParseSnapshotFromFile(&snapreader);
+        }
+        else
+        {
+            BinaryFormatReader snapreader(snapHandle, TTD_COMPRESSED_OUTPUT, iops.pfReadBytesFromStream, iops.pfFlushAndCloseStream);
+            return SnapShot::ParseSnapshotFromFile(&snapreader);
+        }
     }
 
 #if ENABLE_SNAPSHOT_COMPARE
@@ -357,10 +357,12 @@ namespace TTD
 
     void MarkTable::Clear()
     {
-        if(this->m_capcity == TTD_MARK_TABLE_INIT_SIZE)
+        //Keep the table at its current size if the heap we just walked filled a reasonable part of it -- the next snapshot
+        //will walk a heap of about the same size and this saves re-growing (and re-hashing) the table for every snapshot
+        if(this->m_capcity == TTD_MARK_TABLE_INIT_SIZE || (this->m_capcity >> 4) < this->m_count)
         {
-            memset(this->m_addrArray, 0, TTD_MARK_TABLE_INIT_SIZE * sizeof(uint64));
-            memset(this->m_markArray, 0, TTD_MARK_TABLE_INIT_SIZE * sizeof(MarkTableTag));
+            memset(this->m_addrArray, 0, this->m_capcity * sizeof(uint64));
+            memset(this->m_markArray, 0, this->m_capcity * sizeof(MarkTableTag));
         }
         else
         {
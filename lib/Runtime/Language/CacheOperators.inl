@@ -33,6 +33,8 @@ namespace Js
         Assert(IsPolymorphicInlineCacheAvailable == !!propertyValueInfo->GetPolymorphicInlineCache());
         Assert(!ReturnOperationInfo || operationInfo);
 
+        requestContext->CountInlineCacheGetLookup();
+
         if(CheckLocal || CheckProto || CheckAccessor)
         {
             InlineCache *const inlineCache = IsInlineCacheAvailable ? propertyValueInfo->GetInlineCache() : nullptr;
@@ -91,6 +93,7 @@ namespace Js
 
         if(!CheckTypePropertyCache)
         {
+            requestContext->CountInlineCacheGetMiss();
             return false;
         }
 
@@ -105,6 +108,7 @@ namespace Js
                     ReturnOperationInfo ? operationInfo : nullptr,
                     propertyValueInfo))
         {
+            requestContext->CountInlineCacheGetMiss();
             return false;
         }
 
@@ -147,6 +151,8 @@ namespace Js
         Assert(IsPolymorphicInlineCacheAvailable == !!propertyValueInfo->GetPolymorphicInlineCache());
         Assert(!ReturnOperationInfo || operationInfo);
 
+        requestContext->CountInlineCacheSetLookup();
+
         if(CheckLocal || CheckLocalTypeWithoutProperty || CheckAccessor)
         {
             InlineCache *const inlineCache = IsInlineCacheAvailable ? propertyValueInfo->GetInlineCache() : nullptr;
@@ -204,6 +210,7 @@ namespace Js
 
         if(!CheckTypePropertyCache)
         {
+            requestContext->CountInlineCacheSetMiss();
             return false;
         }
 
@@ -217,6 +224,7 @@ namespace Js
                 ReturnOperationInfo ? operationInfo : nullptr,
                 propertyValueInfo))
         {
+            requestContext->CountInlineCacheSetMiss();
             return false;
         }
 
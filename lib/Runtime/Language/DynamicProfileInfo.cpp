@@ -550,6 +550,8 @@ namespace Js
         localPolyCallSiteInfo->functionIds[1] = functionId;
         localPolyCallSiteInfo->sourceIds[0] = oldSourceId;
         localPolyCallSiteInfo->sourceIds[1] = sourceId;
+        localPolyCallSiteInfo->callCounts[0] = 1;
+        localPolyCallSiteInfo->callCounts[1] = 1;
         localPolyCallSiteInfo->next = funcBody->GetPolymorphicCallSiteInfoHead();
 
         for (int i = 2; i < maxPolymorphicInliningSize; i++)
@@ -591,13 +593,19 @@ namespace Js
             if (callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->functionIds[i] == curFunctionId &&
                 callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->sourceIds[i] == curSourceId)
             {
-                // we have it already
+                // we have it already, just count the call so that the hottest callees get inlined first
+                uint16 *callCount = &callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->callCounts[i];
+                if (*callCount != UINT16_MAX)
+                {
+                    (*callCount)++;
+                }
                 return;
             }
             else if (callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->functionIds[i] == CallSiteNoInfo)
             {
                 callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->functionIds[i] = curFunctionId;
                 callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->sourceIds[i] = curSourceId;
+                callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->callCounts[i] = 1;
                 this->currentInlinerVersion++;
                 return;
             }
@@ -608,7 +616,8 @@ namespace Js
         {
             char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
 
-            Output::Print(_u("INLINING (Polymorphic): More than 4 functions at this call site \t callSiteId: %d\t calleeFunctionId: %d TopFunc %s (%s)\n"),
+            Output::Print(_u("INLINING (Polymorphic): More than %d functions at this call site \t callSiteId: %d\t calleeFunctionId: %d TopFunc %s (%s)\n"),
+                maxPolymorphicInliningSize,
                 callSiteId,
                 curFunctionId,
                 inliner->GetDisplayName(),
@@ -619,7 +628,7 @@ namespace Js
 #endif
 
 #ifdef PERF_HINT
-        if (PHASE_TRACE1(Js::PerfHintPhase))
+        if (IsPerfHintEnabled(inliner->GetScriptContext()))
         {
             WritePerfHint(PerfHints::PolymorphicInilineCap, inliner);
         }
@@ -685,11 +694,24 @@ namespace Js
         {
             PolymorphicCallSiteInfo *polymorphicCallSiteInfo = callSiteInfo[callSiteId].u.polymorphicCallSiteInfo;
 
+            // Hand out the callees from the most to the least frequently called. The slots are filled in
+            // order and unused slots have a zero count, so a stable sort keeps them at the end.
+            uint order[maxPolymorphicInliningSize];
+            for (uint i = 0; i < maxPolymorphicInliningSize; i++)
+            {
+                uint j = i;
+                for (; j > 0 && polymorphicCallSiteInfo->callCounts[order[j - 1]] < polymorphicCallSiteInfo->callCounts[i]; j--)
+                {
+                    order[j] = order[j - 1];
+                }
+                order[j] = i;
+            }
+
             for (uint i = 0; i < functionBodyArrayLength; i++)
             {
                 Js::LocalFunctionId localFunctionId;
                 Js::SourceId localSourceId;
-                if (!polymorphicCallSiteInfo->GetFunction(i, &localFunctionId, &localSourceId))
+                if (!polymorphicCallSiteInfo->GetFunction(order[i], &localFunctionId, &localSourceId))
                 {
                     AssertMsg(i >= 2, "We found at least two function Body");
                     return true;
@@ -1073,6 +1095,10 @@ namespace Js
         this->dynamicProfileFunctionInfo->arrayCallSiteCount = functionBody->GetProfiledArrayCallSiteCount();
         this->dynamicProfileFunctionInfo->fldInfoCount = functionBody->GetProfiledFldCount();
         this->dynamicProfileFunctionInfo->slotInfoCount = functionBody->GetProfiledSlotCount();
+#ifdef DYNAMIC_PROFILE_STORAGE
+        // Profiles kept in memory are always for the same byte code
+        this->dynamicProfileFunctionInfo->byteCodeHash = 0;
+#endif
     }
 
     void DynamicProfileInfo::Save(ScriptContext * scriptContext)
@@ -1094,10 +1120,12 @@ namespace Js
 
         scriptContext->GetSourceContextInfoMap()->Map([&](DWORD_PTR dwHostSourceContext, SourceContextInfo * sourceContextInfo)
         {
-            if (sourceContextInfo->sourceDynamicProfileManager != nullptr && sourceContextInfo->url != nullptr
+            char16 keyBuffer[SourceDynamicProfileManager::MaxStorageKeyLength];
+            char16 const * key = SourceDynamicProfileManager::GetDynamicProfileStorageKey(sourceContextInfo, keyBuffer);
+            if (sourceContextInfo->sourceDynamicProfileManager != nullptr && key != nullptr
                 && !sourceContextInfo->IsDynamic())
             {
-                sourceContextInfo->sourceDynamicProfileManager->SaveToDynamicProfileStorage(sourceContextInfo->url);
+                sourceContextInfo->sourceDynamicProfileManager->SaveToDynamicProfileStorage(key);
             }
         });
 #endif
@@ -1125,6 +1153,14 @@ namespace Js
         }
 
 #ifdef DYNAMIC_PROFILE_STORAGE
+        // Matching counts are not enough for a profile loaded from storage, as the script may have been
+        // edited since it was saved. Reject it unless it was collected on the same byte code.
+        if (this->dynamicProfileFunctionInfo->byteCodeHash != 0
+            && this->dynamicProfileFunctionInfo->byteCodeHash != ComputeByteCodeHash(functionBody))
+        {
+            return false;
+        }
+
         this->functionBody = functionBody;
 #endif
 
@@ -1756,6 +1792,7 @@ namespace Js
         FunctionBody * functionBody = this->GetFunctionBody();
         Js::ArgSlot paramInfoCount = functionBody->GetProfiledInParamsCount();
         if (!writer->Write(functionBody->GetLocalFunctionId())
+            || !writer->Write(ComputeByteCodeHash(functionBody))
             || !writer->Write(paramInfoCount)
             || !writer->WriteArray(this->parameterInfo, paramInfoCount)
             || !writer->Write(functionBody->GetProfiledLdElemCount())
@@ -1819,6 +1856,7 @@ namespace Js
         ThisInfo thisInfo;
         Bits bits;
         uint32 recursiveInlineInfo = 0;
+        uint byteCodeHash = 0;
 
         try
         {
@@ -1829,6 +1867,11 @@ namespace Js
                 return nullptr;
             }
 
+            if (!reader->Read(&byteCodeHash))
+            {
+                return nullptr;
+            }
+
             if (!reader->Read(&paramInfoCount))
             {
                 return nullptr;
@@ -2012,6 +2055,7 @@ namespace Js
             dynamicProfileFunctionInfo->switchCount = switchCount;
             dynamicProfileFunctionInfo->returnTypeInfoCount = returnTypeInfoCount;
             dynamicProfileFunctionInfo->loopCount = loopCount;
+            dynamicProfileFunctionInfo->byteCodeHash = byteCodeHash;
 
             DynamicProfileInfo * dynamicProfileInfo = RecyclerNew(recycler, DynamicProfileInfo);
             dynamicProfileInfo->dynamicProfileFunctionInfo = dynamicProfileFunctionInfo;
@@ -2050,6 +2094,16 @@ namespace Js
     template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*);
     template bool DynamicProfileInfo::Serialize<BufferWriter>(BufferWriter*);
 
+    uint DynamicProfileInfo::ComputeByteCodeHash(FunctionBody * functionBody)
+    {
+        ByteBlock * byteCode = functionBody->GetByteCode();
+        if (byteCode == nullptr)
+        {
+            return 0;
+        }
+        return SourceContextInfo::ComputeSourceHash(byteCode->GetBuffer(), byteCode->GetLength());
+    }
+
     void DynamicProfileInfo::UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext)
     {
         // We don't clear old dynamic data here, because if a function is inlined, it will never go through the
@@ -2234,7 +2288,6 @@ IR::BailOutKind IR::EquivalentToMonoTypeCheckBailOutKind(IR::BailOutKind kind)
     }
 }
 
-#if ENABLE_DEBUG_CONFIG_OPTIONS
 const char *const BailOutKindNames[] =
 {
 #define BAIL_OUT_KIND_LAST(n)               "" STRINGIZE(n) ""
@@ -2244,6 +2297,7 @@ const char *const BailOutKindNames[] =
 #include "BailOutKind.h"
 };
 
+#if ENABLE_DEBUG_CONFIG_OPTIONS
 IR::BailOutKind const BailOutKindValidBits[] =
 {
 #define BAIL_OUT_KIND(n, bits)               (IR::BailOutKind)bits,
@@ -36,6 +36,9 @@ namespace IR
     BailOutKind EquivalentToMonoTypeCheckBailOutKind(BailOutKind kind);
 }
 
+// Indexed by the kind without its bits, for the kinds before IR::BailOutKindBitsStart
+extern const char *const BailOutKindNames[];
+
 #if ENABLE_DEBUG_CONFIG_OPTIONS
 const char *GetBailOutKindName(IR::BailOutKind kind);
 bool IsValidBailOutKindAndBits(IR::BailOutKind bailOutKind);
@@ -63,6 +66,9 @@ namespace Js
         ProfileId switchCount;
         uint loopCount;
         uint fldInfoCount;
+#ifdef DYNAMIC_PROFILE_STORAGE
+        uint byteCodeHash;      // hash of the byte code the profile was collected on, or 0 if not known
+#endif
     };
 
     enum ThisType : BYTE
@@ -431,7 +437,7 @@ namespace Js
         static FldInfoFlags FldInfoFlagsFromSlotType(SlotType slotType);
         static FldInfoFlags MergeFldInfoFlags(FldInfoFlags oldFlags, FldInfoFlags newFlags);
 
-        const static uint maxPolymorphicInliningSize = 4;
+        const static uint maxPolymorphicInliningSize = 8;
 
 #if DBG_DUMP
         static void DumpScriptContext(ScriptContext * scriptContext);
@@ -573,6 +579,7 @@ namespace Js
         bool Serialize(T * writer);
 
         static void UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext);
+        static uint ComputeByteCodeHash(FunctionBody * functionBody);
 #endif
         static Js::LocalFunctionId const CallSiteMixed = (Js::LocalFunctionId)-1;
         static Js::LocalFunctionId const CallSiteCrossContext = (Js::LocalFunctionId)-2;
@@ -825,6 +832,7 @@ namespace Js
     {
         Js::LocalFunctionId functionIds[DynamicProfileInfo::maxPolymorphicInliningSize];
         Js::SourceId sourceIds[DynamicProfileInfo::maxPolymorphicInliningSize];
+        uint16 callCounts[DynamicProfileInfo::maxPolymorphicInliningSize];
         PolymorphicCallSiteInfo *next;
         bool GetFunction(uint index, Js::LocalFunctionId *functionId, Js::SourceId *sourceId)
         {
@@ -15,12 +15,15 @@ HANDLE DynamicProfileStorage::mutex = nullptr;
 char16 DynamicProfileStorage::cacheDrive[_MAX_DRIVE];
 char16 DynamicProfileStorage::cacheDir[_MAX_DIR];
 char16 DynamicProfileStorage::catalogFilename[_MAX_PATH];
+#ifndef _WIN32
+char16 DynamicProfileStorage::lockFilename[_MAX_PATH];
+#endif
 CriticalSection DynamicProfileStorage::cs;
 DynamicProfileStorage::InfoMap DynamicProfileStorage::infoMap(&NoCheckHeapAllocator::Instance);
 DynamicProfileStorage::TimeType DynamicProfileStorage::creationTime = DynamicProfileStorage::TimeType();
 int32 DynamicProfileStorage::lastOffset = 0;
 DWORD const DynamicProfileStorage::MagicNumber = 20100526;
-DWORD const DynamicProfileStorage::FileFormatVersion = 2;
+DWORD const DynamicProfileStorage::FileFormatVersion = 3;
 DWORD DynamicProfileStorage::nextFileId = 0;
 #if DBG
 bool DynamicProfileStorage::locked = false;
@@ -252,6 +255,57 @@ char const * DynamicProfileStorage::StorageInfo::ReadRecord() const
     return record;
 }
 
+char const * DynamicProfileStorage::StorageInfo::MapRecord(__out HANDLE * mapping, __out DWORD * size) const
+{
+    char16 cacheFilename[_MAX_PATH];
+    this->GetFilename(cacheFilename);
+    HANDLE file = CreateFile(cacheFilename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+#if DBG_DUMP
+        if (DynamicProfileStorage::DoTrace())
+        {
+            Output::Print(_u("TRACE: DynamicProfileStorage: Unable to open cache dir file '%s'"), cacheFilename);
+            Output::Flush();
+        }
+#endif
+        return nullptr;
+    }
+
+    char const * view = nullptr;
+    DWORD fileSize = GetFileSize(file, NULL);
+    // Can't map an empty file, and a valid record is never empty anyway
+    if (fileSize != INVALID_FILE_SIZE && fileSize != 0)
+    {
+        *mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (*mapping != nullptr)
+        {
+            view = (char const *)MapViewOfFile(*mapping, FILE_MAP_READ, 0, 0, 0);
+            if (view == nullptr)
+            {
+                CloseHandle(*mapping);
+            }
+        }
+    }
+
+    // The mapping keeps the file open
+    CloseHandle(file);
+    if (view == nullptr)
+    {
+        Output::Print(_u("ERROR: DynamicProfileStorage: Unable to map '%s'"), cacheFilename);
+        Output::Flush();
+        return nullptr;
+    }
+    *size = fileSize;
+    return view;
+}
+
+void DynamicProfileStorage::StorageInfo::UnmapRecord(char const * view, HANDLE mapping)
+{
+    UnmapViewOfFile(view);
+    CloseHandle(mapping);
+}
+
 bool DynamicProfileStorage::StorageInfo::WriteRecord(__in_ecount(sizeof(DWORD) + *record)char const * record) const
 {
     char16 cacheFilename[_MAX_PATH];
@@ -701,8 +755,34 @@ void DynamicProfileStorage::DisableCacheDir()
 
 bool DynamicProfileStorage::AcquireLock()
 {
-    Assert(mutex != nullptr);
     Assert(!locked);
+#ifndef _WIN32
+    // Named mutexes aren't supported by the PAL. Opening a file without sharing takes an exclusive
+    // advisory lock on it instead, which serializes the cache directory across processes.
+    Assert(mutex == nullptr);
+    for (;;)
+    {
+        mutex = CreateFile(lockFilename, GENERIC_WRITE, 0, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (mutex != INVALID_HANDLE_VALUE)
+        {
+#if DBG
+            locked = true;
+#endif
+            return true;
+        }
+        mutex = nullptr;
+        DWORD error = GetLastError();
+        if (error != ERROR_SHARING_VIOLATION)
+        {
+            Output::Print(_u("ERROR: DynamicProfileStorage: Unable to lock '%s' (%d)\n"), lockFilename, error);
+            Output::Flush();
+            DisableCacheDir();
+            return false;
+        }
+        Sleep(1);
+    }
+#else
+    Assert(mutex != nullptr);
     DWORD ret = WaitForSingleObject(mutex, INFINITE);
     if (ret == WAIT_OBJECT_0 || ret == WAIT_ABANDONED)
     {
@@ -716,6 +796,7 @@ bool DynamicProfileStorage::AcquireLock()
     DisableCacheDir();
 
     return false;
+#endif
 }
 
 bool DynamicProfileStorage::ReleaseLock()
@@ -725,10 +806,19 @@ bool DynamicProfileStorage::ReleaseLock()
 #if DBG
     locked = false;
 #endif
+#ifndef _WIN32
+    BOOL released = CloseHandle(mutex);
+    mutex = nullptr;
+    if (released)
+    {
+        return true;
+    }
+#else
     if (ReleaseMutex(mutex))
     {
         return true;
     }
+#endif
     DisableCacheDir();
     Output::Print(_u("ERROR: DynamicProfileStorage: Unable to release mutex"));
     Output::Flush();
@@ -739,6 +829,7 @@ bool DynamicProfileStorage::SetupCacheDir(__in_z char16 const * dirname)
 {
     Assert(enabled);
 
+#ifdef _WIN32
     mutex = CreateMutex(NULL, FALSE, _u("JSDPCACHE"));
     if (mutex == nullptr)
     {
@@ -746,13 +837,12 @@ bool DynamicProfileStorage::SetupCacheDir(__in_z char16 const * dirname)
         Output::Flush();
         return false;
     }
+#endif
 
+    // The cache directory lives in the temp directory unless one is given. The lock file lives
+    // in the cache directory on non-Windows platforms, so creating it can't be done under the lock;
+    // CreateDirectory is atomic, so that's fine.
     useCacheDir = true;
-    if (!AcquireLock())
-    {
-        return false;
-    }
-
     char16 tempPath[_MAX_PATH];
     if (dirname == nullptr)
     {
@@ -762,7 +852,6 @@ bool DynamicProfileStorage::SetupCacheDir(__in_z char16 const * dirname)
             DisableCacheDir();
             Output::Print(_u("ERROR: DynamicProfileStorage: Can't setup cache directory: Unable to create directory\n"));
             Output::Flush();
-            ReleaseLock();
             return false;
         }
 
@@ -771,7 +860,6 @@ bool DynamicProfileStorage::SetupCacheDir(__in_z char16 const * dirname)
             DisableCacheDir();
             Output::Print(_u("ERROR: DynamicProfileStorage: Can't setup cache directory: Unable to create directory\n"));
             Output::Flush();
-            ReleaseLock();
             return false;
         }
         dirname = tempPath;
@@ -784,6 +872,14 @@ bool DynamicProfileStorage::SetupCacheDir(__in_z char16 const * dirname)
     wcscat_s(cacheDir, cacheExt);
 
     _wmakepath_s(catalogFilename, cacheDrive, cacheDir, _u("jsdpcache_master"), _u(".dpc"));
+#ifndef _WIN32
+    _wmakepath_s(lockFilename, cacheDrive, cacheDir, _u("jsdpcache_lock"), _u(".dpl"));
+#endif
+
+    if (!AcquireLock())
+    {
+        return false;
+    }
     bool succeed = LoadCacheCatalog();
     ReleaseLock();
 
@@ -60,6 +60,9 @@ private:
     static TimeType creationTime;
     static int32 lastOffset;
     static HANDLE mutex;
+#ifndef _WIN32
+    static char16 lockFilename[_MAX_PATH];
+#endif
     static CriticalSection cs;
     static DWORD nextFileId;
 #if DBG
@@ -73,6 +76,8 @@ private:
     public:
         void GetFilename(_Out_writes_z_(_MAX_PATH) char16 filename[_MAX_PATH]) const;
         char const * ReadRecord() const;
+        char const * MapRecord(__out HANDLE * mapping, __out DWORD * size) const;
+        static void UnmapRecord(char const * view, HANDLE mapping);
         bool WriteRecord(__in_ecount(sizeof(DWORD) + *record) char const * record) const;
         bool isFileStorage;
         union
@@ -81,6 +86,20 @@ private:
             char const * record;
         };
     };
+    // Unmaps a record view and releases the cache directory lock, even if deserializing it throws
+    class AutoUnmapRecordAndReleaseLock
+    {
+    public:
+        AutoUnmapRecordAndReleaseLock(char const * view, HANDLE mapping) : view(view), mapping(mapping) {}
+        ~AutoUnmapRecordAndReleaseLock()
+        {
+            StorageInfo::UnmapRecord(view, mapping);
+            ReleaseLock();
+        }
+    private:
+        char const * view;
+        HANDLE mapping;
+    };
     typedef JsUtil::BaseDictionary<char16 const *, StorageInfo, NoCheckHeapAllocator, PrimeSizePolicy, DefaultComparer, JsUtil::DictionaryEntry> InfoMap;
     static InfoMap infoMap;
 };
@@ -112,15 +131,19 @@ DynamicProfileStorage::Load(char16 const * filename, Fn loadFn)
 #endif
         return nullptr;
     }
-    char const * record;
+    Js::SourceDynamicProfileManager * sourceDynamicProfileManager;
     if (info->isFileStorage)
     {
+        // Deserialize straight out of a read-only view of the record file. The view is only valid
+        // while we hold the lock, since another process may rewrite the file once it is released.
         Assert(useCacheDir);
         Assert(locked);
-        record = info->ReadRecord();
-        ReleaseLock();
-        if (record == nullptr)
+        HANDLE mapping;
+        DWORD size;
+        char const * view = info->MapRecord(&mapping, &size);
+        if (view == nullptr)
         {
+            ReleaseLock();
 #if DBG_DUMP
             if (DynamicProfileStorage::DoTrace())
             {
@@ -130,17 +153,13 @@ DynamicProfileStorage::Load(char16 const * filename, Fn loadFn)
 #endif
             return nullptr;
         }
+        AutoUnmapRecordAndReleaseLock autoUnmap(view, mapping);
+        sourceDynamicProfileManager = loadFn(view, size);
     }
     else
     {
-        record = info->record;
-    }
-    Js::SourceDynamicProfileManager * sourceDynamicProfileManager = loadFn(GetRecordBuffer(record), GetRecordSize(record));
-    if (info->isFileStorage)
-    {
-        // The data is backed by a file, we can delete the memory
-        Assert(useCacheDir);
-        DeleteRecord(record);
+        char const * record = info->record;
+        sourceDynamicProfileManager = loadFn(GetRecordBuffer(record), GetRecordSize(record));
     }
 #if DBG_DUMP
     if (DynamicProfileStorage::DoTrace() && sourceDynamicProfileManager)
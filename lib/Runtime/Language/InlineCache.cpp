@@ -667,7 +667,25 @@ namespace Js
     bool PolymorphicInlineCache::IsFull()
     {
         Assert(this->size <= 0x20);
-        return this->inlineCachesFillInfo == ((1 << (this->size - 1)) << 1) - 1;
+        const int32 fullFillInfo = ((1 << (this->size - 1)) << 1) - 1;
+        if (this->inlineCachesFillInfo != fullFillInfo)
+        {
+            return false;
+        }
+
+        // Entries can go stale without the fill info knowing about it: invalidation clears individual inline caches, and
+        // the inline cache allocator zeroes caches with dead weak references during GC. Recompute the fill info before
+        // reporting the cache as full, so that colliding entries can still be moved to the slots that were freed.
+        RefreshInlineCachesFillInfo();
+        return this->inlineCachesFillInfo == fullFillInfo;
+    }
+
+    void PolymorphicInlineCache::RefreshInlineCachesFillInfo()
+    {
+        for (uint i = 0; i < this->size; ++i)
+        {
+            UpdateInlineCachesFillInfo(i, !inlineCaches[i].IsEmpty());
+        }
     }
 
     void PolymorphicInlineCache::CacheLocal(
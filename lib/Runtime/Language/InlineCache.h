@@ -506,6 +506,8 @@ namespace Js
         }
 
     private:
+        void RefreshInlineCachesFillInfo();
+
         uint GetNextInlineCacheIndex(uint index) const
         {
             if (++index == GetSize())
@@ -713,6 +713,10 @@ namespace Js
                     }
                 }
 
+                // Size the trace up front so that capturing up to the default limit takes a single allocation. The frames only
+                // hold the function body and byte code offset, names and positions are looked up when the stack property is read.
+                stackTrace->EnsureArray((int32)min<uint64>(stackCrawlLimit, DefaultStackTraceLimit));
+
                 do
                 {
                     JavascriptExceptionContext::StackFrame stackFrame(jsFunc, walker, crawlStackForWER);
@@ -1027,7 +1031,14 @@ namespace Js
             if (JavascriptOperators::DefineOwnPropertyDescriptor(obj, PropertyIds::stack, stackPropertyDescriptor, false, &scriptContext))
             {
                 obj->SetInternalProperty(InternalPropertyIds::StackTrace, stackTrace, PropertyOperationFlags::PropertyOperation_None, NULL);
-                obj->SetInternalProperty(InternalPropertyIds::StackTraceCache, NULL, PropertyOperationFlags::PropertyOperation_None, NULL);
+
+                // Only clear a formatted string left from an earlier trace, errors that are thrown and caught without reading
+                // the stack property never get the cache slot added
+                Var cache = nullptr;
+                if (obj->GetInternalProperty(obj, InternalPropertyIds::StackTraceCache, &cache, NULL, &scriptContext) && cache != nullptr)
+                {
+                    obj->SetInternalProperty(InternalPropertyIds::StackTraceCache, NULL, PropertyOperationFlags::PropertyOperation_None, NULL);
+                }
             }
         }
         END_TRANSLATE_EXCEPTION_AND_ERROROBJECT_TO_HRESULT_INSCRIPT(hr)
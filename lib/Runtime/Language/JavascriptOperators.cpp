@@ -133,6 +133,20 @@ namespace Js
                 *propertyNameString = indexStr;
                 return IndexType_JavascriptString;
             }
+
+            if (VirtualTableInfo<Js::PropertyString>::HasVirtualTable(indexStr))
+            {
+                // A PropertyString already knows its record, and whether the name is an array index,
+                // so there is no need to parse or hash the name again.
+                PropertyRecord const * stringPropertyRecord = ((PropertyString*)indexStr)->GetPropertyRecord();
+                if (stringPropertyRecord->IsNumeric())
+                {
+                    *index = stringPropertyRecord->GetNumericValue();
+                    return IndexType_Number;
+                }
+                *propertyRecord = stringPropertyRecord;
+                return IndexType_PropertyId;
+            }
             return GetIndexTypeFromString(propertyName, propertyLength, scriptContext, index, propertyRecord, createIfNotFound);
         }
     }
@@ -789,6 +789,37 @@ namespace Js
                 instance);
     }
 
+    void ProfilingHelpers::ProfiledLdFldCacheHit_Jit(
+        const Var value,
+        const InlineCacheIndex inlineCacheIndex,
+        void *const framePointer)
+    {
+        // Called by SimpleJit after its fast path loaded a field through the local inline cache. Nothing runs between the
+        // hit and this call, so the cache still describes the slot the value came from.
+        ScriptFunction *const scriptFunction =
+            ScriptFunction::FromVar(JavascriptCallStackLayout::FromFramePointer(framePointer)->functionObject);
+        FunctionBody *const functionBody = scriptFunction->GetFunctionBody();
+        InlineCache *const inlineCache = GetInlineCache(scriptFunction, inlineCacheIndex);
+        Assert(inlineCache->IsLocal());
+
+        DynamicProfileInfo *const dynamicProfileInfo = functionBody->GetDynamicProfileInfo();
+        FldInfoFlags fldInfoFlags = FldInfo_NoInfo;
+
+        // Same as an inline cache hit in ProfiledLdFld
+        const FldInfoFlags oldflags = dynamicProfileInfo->GetFldInfo(functionBody, inlineCacheIndex)->flags;
+        if ((oldflags != FldInfo_NoInfo) && !(oldflags & FldInfo_FromLocal))
+        {
+            fldInfoFlags = DynamicProfileInfo::MergeFldInfoFlags(fldInfoFlags, FldInfo_Polymorphic);
+        }
+        fldInfoFlags = DynamicProfileInfo::MergeFldInfoFlags(fldInfoFlags, FldInfo_FromLocal);
+        fldInfoFlags =
+            DynamicProfileInfo::MergeFldInfoFlags(
+                fldInfoFlags,
+                TypeHasAuxSlotTag(inlineCache->u.local.type) ? FldInfo_FromAuxSlots : FldInfo_FromInlineSlots);
+
+        dynamicProfileInfo->RecordFieldAccess(functionBody, inlineCacheIndex, value, fldInfoFlags);
+    }
+
     template<bool Root, bool Method, bool CallApplyTarget>
     Var ProfilingHelpers::ProfiledLdFld(
         const Var instance,
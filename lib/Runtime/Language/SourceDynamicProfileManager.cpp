@@ -305,9 +305,11 @@ namespace Js
         Recycler* recycler = scriptContext->GetRecycler();
 
 #ifdef DYNAMIC_PROFILE_STORAGE
-        if(DynamicProfileStorage::IsEnabled() && info->url != nullptr)
+        char16 keyBuffer[MaxStorageKeyLength];
+        char16 const * key = GetDynamicProfileStorageKey(info, keyBuffer);
+        if(DynamicProfileStorage::IsEnabled() && key != nullptr)
         {
-            manager = DynamicProfileStorage::Load(info->url, [recycler](char const * buffer, uint length) -> SourceDynamicProfileManager *
+            manager = DynamicProfileStorage::Load(key, [recycler](char const * buffer, uint length) -> SourceDynamicProfileManager *
             {
                 BufferReader reader(buffer, length);
                 return SourceDynamicProfileManager::Deserialize(&reader, recycler);
@@ -438,6 +440,22 @@ namespace Js
         return true;
     }
 
+    //
+    // Records are keyed by url unless the host hashed the source (-DynamicProfileCacheBySourceHash),
+    // in which case a restarted process finds the profile no matter where the script is loaded from.
+    //
+    char16 const *
+    SourceDynamicProfileManager::GetDynamicProfileStorageKey(SourceContextInfo const * info, _Out_writes_z_(MaxStorageKeyLength) char16 keyBuffer[MaxStorageKeyLength])
+    {
+        if (info->sourceHash != 0)
+        {
+            // '#' can't start an absolute url, so these don't collide with url keys in an existing cache
+            swprintf_s(keyBuffer, MaxStorageKeyLength, _u("#%08x:%llu"), info->sourceHash, (unsigned long long)info->sourceByteCount);
+            return keyBuffer;
+        }
+        return info->url;
+    }
+
     void
     SourceDynamicProfileManager::SaveToDynamicProfileStorage(char16 const * url)
     {
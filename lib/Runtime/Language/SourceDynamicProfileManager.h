@@ -37,6 +37,10 @@ namespace Js
         bool LoadFromProfileCache(IActiveScriptDataCache* profileDataCache, LPCWSTR url);
         IActiveScriptDataCache* GetProfileCache() { return profileDataCache; }
         uint GetStartupFunctionsLength() { return (this->startupFunctions ? this->startupFunctions->Length() : 0); }
+#ifdef DYNAMIC_PROFILE_STORAGE
+        static const size_t MaxStorageKeyLength = 40;
+        static char16 const * GetDynamicProfileStorageKey(SourceContextInfo const * info, _Out_writes_z_(MaxStorageKeyLength) char16 keyBuffer[MaxStorageKeyLength]);
+#endif
 
     private:
         friend class DynamicProfileInfo;
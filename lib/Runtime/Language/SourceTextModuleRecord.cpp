@@ -595,23 +595,34 @@ namespace Js
                 ArenaAllocator* allocator = scriptContext->GeneralAllocator();
                 childrenModuleSet = (ChildModuleRecordSet*)AllocatorNew(ArenaAllocator, allocator, ChildModuleRecordSet, allocator);
             }
-            requestedModuleList->MapUntil([&](IdentPtr specifier) {
-                ModuleRecordBase* moduleRecordBase = nullptr;
-                SourceTextModuleRecord* moduleRecord = nullptr;
+            // Hand every specifier that isn't resolved yet to the host in a single request so hosts that
+            // already know the module graph don't pay a callback and a string marshal per import.
+            BEGIN_TEMP_ALLOCATOR(tempAllocator, scriptContext, _u("ModuleSpecifiers"));
+            uint requestedCount = 0;
+            requestedModuleList->Map([&](IdentPtr specifier) { requestedCount++; });
+            uint specifierCount = 0;
+            LPCOLESTR* specifiers = AnewArray(tempAllocator, LPCOLESTR, requestedCount);
+            requestedModuleList->Map([&](IdentPtr specifier) {
                 LPCOLESTR moduleName = specifier->Psz();
-                bool itemFound = childrenModuleSet->TryGetValue(moduleName, &moduleRecord);
-                if (!itemFound)
+                if (!childrenModuleSet->ContainsKey(moduleName))
                 {
-                    hr = scriptContext->GetHostScriptContext()->FetchImportedModule(this, moduleName, &moduleRecordBase);
-                    if (FAILED(hr))
+                    specifiers[specifierCount++] = moduleName;
+                }
+            });
+            if (specifierCount != 0)
+            {
+                ModuleRecordBase** moduleRecordBases = AnewArrayZ(tempAllocator, ModuleRecordBase*, specifierCount);
+                hr = scriptContext->GetHostScriptContext()->FetchImportedModules(this, specifierCount, specifiers, moduleRecordBases);
+                if (SUCCEEDED(hr))
+                {
+                    for (uint i = 0; i < specifierCount; i++)
                     {
-                        return true;
+                        SourceTextModuleRecord* moduleRecord = SourceTextModuleRecord::FromHost(moduleRecordBases[i]);
+                        moduleRecord->SetParent(this, specifiers[i]);
                     }
-                    moduleRecord = SourceTextModuleRecord::FromHost(moduleRecordBase);
-                    moduleRecord->SetParent(this, moduleName);
                 }
-                return false;
-            });
+            }
+            END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
             if (FAILED(hr))
             {
                 JavascriptError *error = scriptContext->GetLibrary()->CreateError();
@@ -104,6 +104,35 @@ namespace Js
         return arrayBufferState.Detach();
     }
 
+    bool ArrayBuffer::IsOnlyFullView(TypedArrayBase* typedArray)
+    {
+        if (this->isDetached || this->primaryParent == nullptr || this->primaryParent->Get() != typedArray)
+        {
+            return false;
+        }
+
+        if (this->otherParents != nullptr && this->otherParents->MapUntil([&](int index, RecyclerWeakReference<ArrayBufferParent>* item)
+            {
+                return item->Get() != nullptr;
+            }))
+        {
+            return false;
+        }
+
+        return typedArray->GetByteOffset() == 0 && typedArray->GetByteLength() == this->bufferLength;
+    }
+
+    void ArrayBuffer::ReplaceBufferOfOnlyView(TypedArrayBase* typedArray, BYTE* newBuffer, uint32 newBufferLength)
+    {
+        Assert(IsOnlyFullView(typedArray));
+        Assert(newBufferLength % typedArray->GetBytesPerElement() == 0);
+
+        this->buffer = newBuffer;
+        this->bufferLength = newBufferLength;
+        typedArray->buffer = newBuffer;
+        typedArray->length = newBufferLength / typedArray->GetBytesPerElement();
+    }
+
     void ArrayBuffer::AddParent(ArrayBufferParent* parent)
     {
         if (this->primaryParent == nullptr || this->primaryParent->Get() == nullptr)
@@ -451,7 +480,7 @@ namespace Js
     }
 
     template <class Allocator>
-    ArrayBuffer::ArrayBuffer(uint32 length, DynamicType * type, Allocator allocator) :
+    ArrayBuffer::ArrayBuffer(uint32 length, DynamicType * type, Allocator allocator, bool isMemoryZeroed) :
         ArrayBufferBase(type), mIsAsmJsBuffer(false), isBufferCleared(false),isDetached(false)
     {
         buffer = nullptr;
@@ -493,7 +522,10 @@ namespace Js
             if (buffer != nullptr)
             {
                 bufferLength = length;
-                ZeroMemory(buffer, bufferLength);
+                if (!isMemoryZeroed)
+                {
+                    ZeroMemory(buffer, bufferLength);
+                }
             }
         }
     }
@@ -531,8 +563,15 @@ namespace Js
     }
 #endif
 
+    // Committed virtual memory and calloc both come back zero-filled
     JavascriptArrayBuffer::JavascriptArrayBuffer(uint32 length, DynamicType * type) :
-        ArrayBuffer(length, type, (IsValidVirtualBufferLength(length)) ? AllocWrapper : malloc)
+        ArrayBuffer(length, type, (IsValidVirtualBufferLength(length)) ? AllocWrapper : ZeroedAllocWrapper, /*isMemoryZeroed*/ true)
+    {
+    }
+
+    template <typename Allocator>
+    JavascriptArrayBuffer::JavascriptArrayBuffer(uint32 length, DynamicType * type, Allocator allocator) :
+        ArrayBuffer(length, type, allocator, /*isMemoryZeroed*/ true)
     {
     }
     JavascriptArrayBuffer::JavascriptArrayBuffer(byte* buffer, uint32 length, DynamicType * type) :
@@ -725,7 +764,7 @@ namespace Js
 
         if (newBufferLength == 0 || this->bufferLength == 0)
         {
-            newArrayBuffer = GetLibrary()->CreateArrayBuffer(newBufferLength);
+            newArrayBuffer = CreateTransferredBuffer(newBufferLength);
         }
         else
         {
@@ -786,7 +825,7 @@ namespace Js
                     newBuffer = this->buffer;
                 }
             }
-            newArrayBuffer = GetLibrary()->CreateArrayBuffer(newBuffer, newBufferLength);
+            newArrayBuffer = CreateTransferredBuffer(newBuffer, newBufferLength);
 
         }
         AutoDiscardPTR<Js::ArrayBufferDetachedStateBase> state(DetachAndGetState());
@@ -795,6 +834,83 @@ namespace Js
         return newArrayBuffer;
     }
 
+    ArrayBuffer * JavascriptArrayBuffer::CreateTransferredBuffer(uint32 length)
+    {
+        return GetLibrary()->CreateArrayBuffer(length);
+    }
+
+    ArrayBuffer * JavascriptArrayBuffer::CreateTransferredBuffer(byte* buffer, uint32 length)
+    {
+        return GetLibrary()->CreateArrayBuffer(buffer, length);
+    }
+
+#ifdef ENABLE_WASM
+    // Committed virtual memory and calloc both come back zero-filled
+    WebAssemblyArrayBuffer::WebAssemblyArrayBuffer(uint32 length, DynamicType * type) :
+        JavascriptArrayBuffer(length, type, (IsValidWebAssemblyVirtualBufferLength(length)) ? AllocWrapper : ZeroedAllocWrapper)
+    {
+    }
+
+    WebAssemblyArrayBuffer::WebAssemblyArrayBuffer(byte* buffer, uint32 length, DynamicType * type) :
+        JavascriptArrayBuffer(buffer, length, type)
+    {
+    }
+
+    WebAssemblyArrayBuffer* WebAssemblyArrayBuffer::Create(uint32 length, DynamicType * type)
+    {
+        Recycler* recycler = type->GetScriptContext()->GetRecycler();
+        WebAssemblyArrayBuffer* result = RecyclerNewFinalized(recycler, WebAssemblyArrayBuffer, length, type);
+        Assert(result);
+        recycler->AddExternalMemoryUsage(length);
+        return result;
+    }
+
+    WebAssemblyArrayBuffer* WebAssemblyArrayBuffer::Create(byte* buffer, uint32 length, DynamicType * type)
+    {
+        Recycler* recycler = type->GetScriptContext()->GetRecycler();
+        WebAssemblyArrayBuffer* result = RecyclerNewFinalized(recycler, WebAssemblyArrayBuffer, buffer, length, type);
+        Assert(result);
+        recycler->AddExternalMemoryUsage(length);
+        return result;
+    }
+
+    bool WebAssemblyArrayBuffer::IsValidVirtualBufferLength(uint length)
+    {
+        return IsValidWebAssemblyVirtualBufferLength(length);
+    }
+
+    bool WebAssemblyArrayBuffer::IsValidWebAssemblyVirtualBufferLength(uint length)
+    {
+#if _WIN64
+        /*
+        1. length >= 2^16
+        2. length is a multiple of 2^16 (a WebAssembly page)
+
+        The full MAX_ASMJS_ARRAYBUFFER_LENGTH range is reserved either way, so each page
+        that memory.grow adds is committed in place.
+        */
+        CompileAssert(WebAssembly::PageSize == 0x10000);
+        return (!PHASE_OFF1(Js::TypedArrayVirtualPhase) &&
+            (length >= 0x10000) &&
+            ((length & 0xFFFF) == 0) &&
+            ((length % AutoSystemInfo::PageSize) == 0)
+            );
+#else
+        return false;
+#endif
+    }
+
+    ArrayBuffer * WebAssemblyArrayBuffer::CreateTransferredBuffer(uint32 length)
+    {
+        return GetLibrary()->CreateWebAssemblyArrayBuffer(length);
+    }
+
+    ArrayBuffer * WebAssemblyArrayBuffer::CreateTransferredBuffer(byte* buffer, uint32 length)
+    {
+        return GetLibrary()->CreateWebAssemblyArrayBuffer(buffer, length);
+    }
+#endif
+
 #if ENABLE_TTD
     TTD::NSSnapObjects::SnapObjectType JavascriptArrayBuffer::GetSnapTag_TTD() const
     {
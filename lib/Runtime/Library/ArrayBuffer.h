@@ -81,8 +81,9 @@ namespace Js
             }
         };
 
+        // isMemoryZeroed: the allocator hands back zero-filled memory, so it isn't cleared again
         template <typename Allocator>
-        ArrayBuffer(DECLSPEC_GUARD_OVERFLOW uint32 length, DynamicType * type, Allocator allocator);
+        ArrayBuffer(DECLSPEC_GUARD_OVERFLOW uint32 length, DynamicType * type, Allocator allocator, bool isMemoryZeroed = false);
 
         ArrayBuffer(byte* buffer, DECLSPEC_GUARD_OVERFLOW uint32 length, DynamicType * type);
 
@@ -138,7 +139,12 @@ namespace Js
         static uint32 ToIndex(Var value, int32 errorCode, ScriptContext *scriptContext, uint32 MaxAllowedLength, bool checkSameValueZero = true);
 
         virtual ArrayBuffer * TransferInternal(DECLSPEC_GUARD_OVERFLOW uint32 newBufferLength) = 0;
+
+        // Whether the typed array is the only live view of this buffer, and maps all of it
+        bool IsOnlyFullView(TypedArrayBase* typedArray);
     protected:
+        // Points this buffer and its only view at new memory. The caller releases the old memory.
+        void ReplaceBufferOfOnlyView(TypedArrayBase* typedArray, BYTE* newBuffer, uint32 newBufferLength);
 
         typedef void __cdecl FreeFn(void* ptr);
         virtual ArrayBufferDetachedStateBase* CreateDetachedState(BYTE* buffer, DECLSPEC_GUARD_OVERFLOW uint32 bufferLength) = 0;
@@ -242,6 +248,13 @@ namespace Js
             Assert(fSuccess);
         }
 
+        // calloc takes large blocks straight from the OS as zero pages, so no page is touched until it's used.
+        // The memory is released with free like the rest of the heap allocated buffers.
+        static void*__cdecl ZeroedAllocWrapper(DECLSPEC_GUARD_OVERFLOW size_t length)
+        {
+            return calloc(1, length);
+        }
+
         virtual bool IsValidAsmJsBufferLength(uint length, bool forceCheck = false) override;
 
         virtual bool IsValidVirtualBufferLength(uint length) override;
@@ -249,10 +262,16 @@ namespace Js
         virtual ArrayBuffer * TransferInternal(DECLSPEC_GUARD_OVERFLOW uint32 newBufferLength) override;
     protected:
         JavascriptArrayBuffer(DynamicType * type);
+        template <typename Allocator>
+        JavascriptArrayBuffer(uint32 length, DynamicType * type, Allocator allocator);
+        JavascriptArrayBuffer(byte* buffer, uint32 length, DynamicType * type);
         virtual ArrayBufferDetachedStateBase* CreateDetachedState(BYTE* buffer, DECLSPEC_GUARD_OVERFLOW uint32 bufferLength) override;
+
+        // The buffer that TransferInternal hands the contents to; derived buffers keep their own kind
+        virtual ArrayBuffer * CreateTransferredBuffer(DECLSPEC_GUARD_OVERFLOW uint32 length);
+        virtual ArrayBuffer * CreateTransferredBuffer(byte* buffer, DECLSPEC_GUARD_OVERFLOW uint32 length);
     private:
         JavascriptArrayBuffer(uint32 length, DynamicType * type);
-        JavascriptArrayBuffer(byte* buffer, uint32 length, DynamicType * type);
 
 #if ENABLE_TTD
     public:
@@ -261,6 +280,33 @@ namespace Js
 #endif
     };
 
+#ifdef ENABLE_WASM
+    // The buffer of a WebAssembly.Memory. It grows a 64K page at a time, so on Win64 any page count is kept in
+    // the virtual reservation and grown in place, not just the asm.js heap lengths that other buffers use.
+    class WebAssemblyArrayBuffer : public JavascriptArrayBuffer
+    {
+    protected:
+        DEFINE_VTABLE_CTOR(WebAssemblyArrayBuffer, JavascriptArrayBuffer);
+        DEFINE_MARSHAL_OBJECT_TO_SCRIPT_CONTEXT(WebAssemblyArrayBuffer);
+
+    public:
+        static WebAssemblyArrayBuffer* Create(DECLSPEC_GUARD_OVERFLOW uint32 length, DynamicType * type);
+        static WebAssemblyArrayBuffer* Create(byte* buffer, DECLSPEC_GUARD_OVERFLOW uint32 length, DynamicType * type);
+
+        virtual bool IsValidVirtualBufferLength(uint length) override;
+
+    protected:
+        virtual ArrayBuffer * CreateTransferredBuffer(DECLSPEC_GUARD_OVERFLOW uint32 length) override;
+        virtual ArrayBuffer * CreateTransferredBuffer(byte* buffer, DECLSPEC_GUARD_OVERFLOW uint32 length) override;
+
+    private:
+        WebAssemblyArrayBuffer(uint32 length, DynamicType * type);
+        WebAssemblyArrayBuffer(byte* buffer, uint32 length, DynamicType * type);
+
+        static bool IsValidWebAssemblyVirtualBufferLength(uint length);
+    };
+#endif
+
     // the memory must be allocated via CoTaskMemAlloc.
     class ProjectionArrayBuffer : public ArrayBuffer
     {
@@ -899,7 +899,7 @@ namespace JSON
                 }
                 tempResult->SetItem(slotIndex++, memberSeparator);
             }
-            tempResult->SetItem(slotIndex++, Quote(propertyName));
+            tempResult->SetItem(slotIndex++, QuotePropertyName(propertyName));
             tempResult->SetItem(slotIndex++, this->GetPropertySeparator());
             tempResult->SetItem(slotIndex++, Js::JavascriptString::FromVar(propertyObjectString));
 
@@ -961,4 +961,23 @@ namespace JSON
         // By default, optimize for scenario when we don't need to change the inside of the string. That's majority of cases.
         return Js::JSONString::Escape<Js::EscapingOperation_NotEscape>(value);
     }
+
+    // Objects of the same shape hand us the same PropertyStrings from the enumerator cache, so keep the
+    // quoted name on the string instead of escaping and wrapping it again for every object.
+    inline Js::JavascriptString* StringifySession::QuotePropertyName(Js::JavascriptString* propertyName)
+    {
+        if (!Js::VirtualTableInfo<Js::PropertyString>::HasVirtualTable(propertyName))
+        {
+            return Quote(propertyName);
+        }
+
+        Js::PropertyString* propertyString = (Js::PropertyString*)propertyName;
+        Js::JavascriptString* quoted = propertyString->GetQuotedString();
+        if (quoted == nullptr)
+        {
+            quoted = Quote(propertyName);
+            propertyString->SetQuotedString(quoted);
+        }
+        return quoted;
+    }
 } // namespace JSON
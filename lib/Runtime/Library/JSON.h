@@ -66,6 +66,7 @@ namespace JSON
 
     private:
         Js::JavascriptString* Quote(Js::JavascriptString* value);
+        Js::JavascriptString* QuotePropertyName(Js::JavascriptString* propertyName);
 
         Js::Var StringifyObject(Js::Var value);
 
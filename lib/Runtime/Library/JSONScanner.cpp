@@ -220,6 +220,39 @@ namespace JSON
         return true;
     }
 
+    // Skip the run of string characters that are taken as is: anything but the closing quote, a backslash
+    // or a control character. On x86/x64 this is done 8 characters at a time; the caller handles the rest.
+    // Returns the number of characters skipped.
+    uint JSONScanner::SkipPlainStringChars()
+    {
+        const char16* start = currentChar;
+#if defined(_M_IX86) || defined(_M_X64)
+        const char16* end = inputText + inputLen;
+        const __m128i quote = _mm_set1_epi16('"');
+        const __m128i backslash = _mm_set1_epi16('\\');
+        const __m128i controlMask = _mm_set1_epi16((short)0xFFE0);
+        const __m128i zero = _mm_setzero_si128();
+
+        while (end - currentChar >= 8)
+        {
+            const __m128i block = _mm_loadu_si128((const __m128i *)currentChar);
+            __m128i special = _mm_or_si128(_mm_cmpeq_epi16(block, quote), _mm_cmpeq_epi16(block, backslash));
+            special = _mm_or_si128(special, _mm_cmpeq_epi16(_mm_and_si128(block, controlMask), zero));
+
+            const int mask = _mm_movemask_epi8(special);
+            if (mask != 0)
+            {
+                DWORD index;
+                _BitScanForward(&index, (DWORD)mask);
+                currentChar += index / sizeof(char16);
+                break;
+            }
+            currentChar += 8;
+        }
+#endif
+        return (uint)(currentChar - start);
+    }
+
     tokens JSONScanner::ScanString()
     {
         char16 ch;
@@ -230,9 +263,19 @@ namespace JSON
         bool isStringDirectInputTextMapped = true;
         LPCWSTR bulkStart = currentChar;
         uint bulkLength = 0;
+        const bool skipPlainChars = !PHASE_OFF1(Js::FastJSONStringScanPhase);
 
         while (currentChar < inputText + inputLen)
         {
+            if (skipPlainChars)
+            {
+                bulkLength += SkipPlainStringChars();
+                if (currentChar >= inputText + inputLen)
+                {
+                    break;
+                }
+            }
+
             ch = ReadNextChar();
             int tempHex;
 
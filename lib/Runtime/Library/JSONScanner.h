@@ -64,6 +64,7 @@ namespace JSON
         }
 
         tokens ScanString();
+        uint SkipPlainStringChars();
         bool IsJSONNumber();
 
         const char16* inputText;
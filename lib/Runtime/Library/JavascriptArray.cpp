@@ -6254,17 +6254,57 @@ Case0:
         }
     }
 
-    static void hybridSort(__inout_ecount(length) Var *elements, uint32 length, CompareVarsInfo* compareInfo)
+    // Orders two int32 values the way the default comparer orders their strings, without creating the strings.
+    // '-' sorts before the digits, and otherwise the digit strings compare like the numbers once they are padded with
+    // trailing zeros to the same length, with a shorter string sorting first when one is a prefix of the other.
+    static int __cdecl compareInt32AsStrings(void*, const void* aRef, const void* bRef)
     {
-        // The cost of memory moves starts to be more expensive than additional comparer calls (given a simple comparer)
-        // for arrays of more than 512 elements.
-        if (length > 512)
+        const int32 a = *(const int32*)aRef;
+        const int32 b = *(const int32*)bRef;
+        if (a == b)
         {
-            qsort_s(elements, length, sizeof(Var), compareVars, compareInfo);
-            return;
+            return 0;
+        }
+        if ((a < 0) != (b < 0))
+        {
+            return a < 0 ? -1 : 1;
         }
 
-        for (int i = 1; i < (int)length; i++)
+        const uint32 absA = a < 0 ? 0u - (uint32)a : (uint32)a;
+        const uint32 absB = b < 0 ? 0u - (uint32)b : (uint32)b;
+        uint digitsA = 1;
+        uint digitsB = 1;
+        for (uint32 v = absA; v >= 10; v /= 10)
+        {
+            digitsA++;
+        }
+        for (uint32 v = absB; v >= 10; v /= 10)
+        {
+            digitsB++;
+        }
+
+        uint64 paddedA = absA;
+        uint64 paddedB = absB;
+        for (uint i = digitsA; i < digitsB; i++)
+        {
+            paddedA *= 10;
+        }
+        for (uint i = digitsB; i < digitsA; i++)
+        {
+            paddedB *= 10;
+        }
+        if (paddedA != paddedB)
+        {
+            return paddedA < paddedB ? -1 : 1;
+        }
+        return digitsA < digitsB ? -1 : 1;
+    }
+
+    // Binary insertion sort of elements[0, length), given that elements[0, sortedLength) is already sorted. Each element
+    // is inserted after any equal elements, so the sort is stable.
+    static void insertionSort(__inout_ecount(length) Var *elements, uint32 sortedLength, uint32 length, CompareVarsInfo* compareInfo)
+    {
+        for (int i = max((int)sortedLength, 1); i < (int)length; i++)
         {
             if (compareVars(compareInfo, elements + i, elements + i - 1) < 0) {
                 // binary search for the left-most element greater than value:
@@ -6291,6 +6331,173 @@ Case0:
         }
     }
 
+    // Stable merge of the sorted ranges elements[start, middle) and elements[middle, end). The comparer may throw, so
+    // the merge is done into buffer and only copied back once complete; elements always holds every value.
+    static void mergeRuns(__inout_ecount(end) Var *elements, uint32 start, uint32 middle, uint32 end, Var *buffer, CompareVarsInfo* compareInfo)
+    {
+        // Already in order, which is the common case for presorted input
+        if (compareVars(compareInfo, elements + middle, elements + middle - 1) >= 0)
+        {
+            return;
+        }
+
+        // Elements of the left run that are not greater than the first of the right run are already in place
+        uint32 first = start;
+        uint32 last = middle - 1;
+        while (first < last)
+        {
+            uint32 probe = first + (last - first) / 2;
+            if (compareVars(compareInfo, elements + middle, elements + probe) < 0)
+            {
+                last = probe;
+            }
+            else
+            {
+                first = probe + 1;
+            }
+        }
+        start = first;
+
+        // Elements of the right run that are not less than the last of the left run are already in place
+        first = middle;
+        last = end - 1;
+        while (first < last)
+        {
+            uint32 probe = first + (last - first + 1) / 2;
+            if (compareVars(compareInfo, elements + probe, elements + middle - 1) < 0)
+            {
+                first = probe;
+            }
+            else
+            {
+                last = probe - 1;
+            }
+        }
+        end = first + 1;
+
+        uint32 left = start;
+        uint32 right = middle;
+        uint32 out = 0;
+        while (left < middle && right < end)
+        {
+            // Take from the right run only when strictly less, to keep equal elements in their original order
+            if (compareVars(compareInfo, elements + right, elements + left) < 0)
+            {
+                buffer[out++] = elements[right++];
+            }
+            else
+            {
+                buffer[out++] = elements[left++];
+            }
+        }
+        while (left < middle)
+        {
+            buffer[out++] = elements[left++];
+        }
+        while (right < end)
+        {
+            buffer[out++] = elements[right++];
+        }
+
+        Assert(out == end - start);
+        js_memcpy_s(elements + start, out * sizeof(Var), buffer, out * sizeof(Var));
+    }
+
+    static void hybridSort(__inout_ecount(length) Var *elements, uint32 length, CompareVarsInfo* compareInfo)
+    {
+        // The cost of memory moves starts to be more expensive than additional comparer calls (given a simple comparer)
+        // for arrays of more than 512 elements.
+        if (length <= 512)
+        {
+            insertionSort(elements, 0, length, compareInfo);
+            return;
+        }
+
+        // Larger arrays use a stable natural merge sort. Existing ascending runs, and strictly descending runs after
+        // reversing them, are kept as they are; shorter runs are extended to MinRunLength by insertion sort. The runs
+        // are then merged pairwise, so presorted input takes about one comparer call per element.
+        const uint32 MinRunLength = 32;
+
+        // The comparer may throw, so release the allocator in a finally block
+        DECLARE_TEMP_ALLOCATOR(tempAlloc);
+
+        TryFinally([&]()
+        {
+            ACQUIRE_TEMP_ALLOCATOR(tempAlloc, compareInfo->scriptContext, _u("Runtime"));
+
+            JsUtil::List<uint32, ArenaAllocator>* runEnds = JsUtil::List<uint32, ArenaAllocator>::New(tempAlloc);
+
+            uint32 runStart = 0;
+            while (runStart < length)
+            {
+                uint32 runEnd = runStart + 1;
+                if (runEnd < length)
+                {
+                    if (compareVars(compareInfo, elements + runEnd, elements + runStart) < 0)
+                    {
+                        do
+                        {
+                            runEnd++;
+                        } while (runEnd < length && compareVars(compareInfo, elements + runEnd, elements + runEnd - 1) < 0);
+
+                        for (uint32 i = runStart, j = runEnd - 1; i < j; i++, j--)
+                        {
+                            Var value = elements[i];
+                            elements[i] = elements[j];
+                            elements[j] = value;
+                        }
+                    }
+                    else
+                    {
+                        do
+                        {
+                            runEnd++;
+                        } while (runEnd < length && compareVars(compareInfo, elements + runEnd, elements + runEnd - 1) >= 0);
+                    }
+                }
+
+                if (runEnd - runStart < MinRunLength && runEnd < length)
+                {
+                    uint32 extendedEnd = min(runStart + MinRunLength, length);
+                    insertionSort(elements + runStart, runEnd - runStart, extendedEnd - runStart, compareInfo);
+                    runEnd = extendedEnd;
+                }
+
+                runEnds->Add(runEnd);
+                runStart = runEnd;
+            }
+
+            // The merge buffer holds values that are passed back to script, so it must be visible to the recycler
+            Var* buffer = RecyclerNewArrayZ(compareInfo->scriptContext->GetRecycler(), Var, length);
+            while (runEnds->Count() > 1)
+            {
+                int writeIndex = 0;
+                uint32 start = 0;
+                for (int i = 0; i < runEnds->Count(); i += 2)
+                {
+                    if (i + 1 < runEnds->Count())
+                    {
+                        mergeRuns(elements, start, runEnds->Item(i), runEnds->Item(i + 1), buffer, compareInfo);
+                        start = runEnds->Item(i + 1);
+                    }
+                    else
+                    {
+                        start = runEnds->Item(i);
+                    }
+                    runEnds->Item(writeIndex++, start);
+                }
+                while (runEnds->Count() > writeIndex)
+                {
+                    runEnds->RemoveAtEnd();
+                }
+            }
+        },
+        [&](bool /*hasException*/)
+        {
+            RELEASE_TEMP_ALLOCATOR(tempAlloc, compareInfo->scriptContext);
+        });
+    }
+
     void JavascriptArray::Sort(RecyclableObject* compFn)
     {
         if (length <= 1)
@@ -6544,6 +6751,18 @@ Case0:
                 arr->FillFromPrototypes(0, arr->length); // We need find all missing value from [[proto]] object
             }
 
+            // Without a comparer, a dense int array can be sorted in place: its elements' string order is computed
+            // from the int32 values directly, and equal strings only come from equal values so stability is moot.
+            if (!compFn && JavascriptNativeIntArray::Is(arr) && !PHASE_OFF1(Js::NativeArraySortPhase))
+            {
+                SparseArraySegment<int32>* head = (SparseArraySegment<int32>*)arr->head;
+                if (head->next == nullptr && head->length == arr->length && arr->HasNoMissingValues())
+                {
+                    qsort_s(head->elements, head->length, sizeof(int32), compareInt32AsStrings, nullptr);
+                    return args[0];
+                }
+            }
+
             // Maintain nativity of the array only for the following cases (To favor inplace conversions - keeps the conversion cost less):
             // -    int cases for X86 and
             // -    FloatArray for AMD64
@@ -8732,6 +8951,18 @@ Case0:
         // We shouldn't have made it here if the count was going to be zero
         Assert(count > 0);
 
+        // Typed array elements are plain bytes, so one memmove handles the whole (possibly overlapping) range.
+        // The range is checked against the real length since Array.prototype.copyWithin may be given a fake one.
+        if (typedArrayBase && !PHASE_OFF1(Js::TypedArrayBulkOpsPhase) && !typedArrayBase->IsDetachedBuffer() &&
+            fromVal + count <= typedArrayBase->GetLength() && toVal + count <= typedArrayBase->GetLength())
+        {
+            const size_t bytesPerElement = typedArrayBase->GetBytesPerElement();
+            byte* buffer = typedArrayBase->GetByteBuffer();
+            memmove_s(buffer + toVal * bytesPerElement, (typedArrayBase->GetLength() - toVal) * bytesPerElement,
+                buffer + fromVal * bytesPerElement, count * bytesPerElement);
+            return obj;
+        }
+
         int direction;
 
         if (fromVal < toVal && toVal < (fromVal + count))
@@ -8895,6 +9126,15 @@ Case0:
             int64 end = min<int64>(finalVal, MaxArrayLength);
             uint32 u32k = static_cast<uint32>(k);
 
+            if (typedArrayBase && u32k < end && (TaggedInt::Is(fillValue) || JavascriptNumber::Is(fillValue)) &&
+                !PHASE_OFF1(Js::TypedArrayBulkOpsPhase))
+            {
+                // Converting a number has no side effects, so store the first element and replicate its bytes over the rest of the range
+                typedArrayBase->DirectSetItem(u32k, fillValue);
+                typedArrayBase->ReplicateItem(u32k, static_cast<uint32>(end));
+                u32k = static_cast<uint32>(end);
+            }
+
             while (u32k < end)
             {
                 if (typedArrayBase)
@@ -11189,6 +11429,49 @@ Case0:
         Throw::FatalInternalError();
     }
 
+    // Copies items [0, length) into buffer as Vars when they all live in a head segment with no missing
+    // values, so that none of them can come from the prototype chain. Returns false without writing
+    // anything otherwise; callers then fall back to per-item gets.
+    bool JavascriptArray::TryCopyDenseItemsToVars(Var * buffer, uint32 length)
+    {
+        SparseArraySegmentBase* seg = this->head;
+        if (seg->left != 0 || seg->length < length || !this->HasNoMissingValues())
+        {
+            return false;
+        }
+
+        ScriptContext* scriptContext = this->GetScriptContext();
+        switch (this->GetTypeId())
+        {
+        case TypeIds_Array:
+            js_memcpy_s(buffer, length * sizeof(Var), ((SparseArraySegment<Var>*)seg)->elements, length * sizeof(Var));
+            return true;
+
+        case TypeIds_NativeIntArray:
+        {
+            const int32* elements = ((SparseArraySegment<int32>*)seg)->elements;
+            for (uint32 i = 0; i < length; i++)
+            {
+                buffer[i] = JavascriptNumber::ToVar(elements[i], scriptContext);
+            }
+            return true;
+        }
+
+        case TypeIds_NativeFloatArray:
+        {
+            const double* elements = ((SparseArraySegment<double>*)seg)->elements;
+            for (uint32 i = 0; i < length; i++)
+            {
+                buffer[i] = JavascriptNumber::ToVarWithCheck(elements[i], scriptContext);
+            }
+            return true;
+        }
+
+        default:
+            return false;
+        }
+    }
+
 #ifdef VALIDATE_ARRAY
     class ArraySegmentsVisitor
     {
@@ -819,6 +819,7 @@ namespace Js
         static uint32 GetOffsetOfLastUsedSegmentOrSegmentMap() { return offsetof(JavascriptArray, segmentUnion.lastUsedSegment); }
         static Var SpreadArrayArgs(Var arrayToSpread, const Js::AuxArray<uint32> *spreadIndices, ScriptContext *scriptContext);
         static uint32 GetSpreadArgLen(Var spreadArg, ScriptContext *scriptContext);
+        bool TryCopyDenseItemsToVars(Var * buffer, uint32 length);
 
         static JavascriptArray * BoxStackInstance(JavascriptArray * instance);
     protected:
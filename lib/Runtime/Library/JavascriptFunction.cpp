@@ -516,11 +516,14 @@ namespace Js
                 Var undefined = pFunc->GetLibrary()->GetUndefined();
                 if (isArray && arr->GetScriptContext() == scriptContext)
                 {
-                    arr->ForEachItemInRange<false>(0, (uint)len, undefined, scriptContext,
-                        [&outArgs](uint index, Var element)
+                    if (PHASE_OFF1(Js::DenseArgsCopyPhase) || !arr->TryCopyDenseItemsToVars(outArgs.Values + 1, (uint)len))
                     {
-                        outArgs.Values[index + 1] = element;
-                    });
+                        arr->ForEachItemInRange<false>(0, (uint)len, undefined, scriptContext,
+                            [&outArgs](uint index, Var element)
+                        {
+                            outArgs.Values[index + 1] = element;
+                        });
+                    }
                 }
                 else
                 {
@@ -1028,22 +1031,27 @@ namespace Js
                     if (arr != nullptr && !arr->IsCrossSiteObject())
                     {
                         uint32 length = arr->GetLength();
-                        // CONSIDER: Optimize by creating a JavascriptArray routine which allows
-                        // memcpy-like semantics in optimal situations (no gaps, etc.)
                         if (argsIndex + length > destArgs.Info.Count)
                         {
                             AssertMsg(false, "The array length has changed since we allocated the destArgs buffer?");
                             Throw::FatalInternalError();
                         }
 
-                        for (uint32 j = 0; j < length; j++)
+                        if (!PHASE_OFF1(Js::DenseArgsCopyPhase) && arr->TryCopyDenseItemsToVars(destArgs.Values + argsIndex, length))
                         {
-                            Var element;
-                            if (!arr->DirectGetItemAtFull(j, &element))
+                            argsIndex += length;
+                        }
+                        else
+                        {
+                            for (uint32 j = 0; j < length; j++)
                             {
-                                element = undefined;
+                                Var element;
+                                if (!arr->DirectGetItemAtFull(j, &element))
+                                {
+                                    element = undefined;
+                                }
+                                destArgs.Values[argsIndex++] = element;
                             }
-                            destArgs.Values[argsIndex++] = element;
                         }
                     }
                     else
@@ -4924,6 +4924,36 @@ namespace Js
         this->nativeHostPromiseContinuationFunctionState = state;
     }
 
+    void JavascriptLibrary::SetUseEngineTaskQueue(bool enabled)
+    {
+        // Jobs already queued stay queued until they are dequeued, even after the queue is disabled
+        if (enabled && this->engineTaskQueue == nullptr)
+        {
+            this->engineTaskQueue = RecyclerNew(this->recycler, JsUtil::List<Var, Recycler>, this->recycler);
+        }
+        this->useEngineTaskQueue = enabled;
+    }
+
+    Var JavascriptLibrary::DequeueEngineTask()
+    {
+        if (this->engineTaskQueue == nullptr || this->engineTaskQueueHead >= this->engineTaskQueue->Count())
+        {
+            return nullptr;
+        }
+
+        // Clear the slot so that a job that has run is not kept alive by the queue
+        Var task = this->engineTaskQueue->Item(this->engineTaskQueueHead);
+        this->engineTaskQueue->Item(this->engineTaskQueueHead, nullptr);
+        this->engineTaskQueueHead++;
+        if (this->engineTaskQueueHead == this->engineTaskQueue->Count())
+        {
+            // Drained; reuse the buffer for the next batch of jobs
+            this->engineTaskQueue->Clear();
+            this->engineTaskQueueHead = 0;
+        }
+        return task;
+    }
+
     void JavascriptLibrary::PinJsrtContextObject(FinalizableObject* jsrtContext)
     {
         // With JsrtContext supporting cross context, ensure that it doesn't get GCed
@@ -4942,6 +4972,13 @@ namespace Js
     {
         Assert(JavascriptFunction::Is(taskVar));
 
+        if (this->useEngineTaskQueue)
+        {
+            // The host drains these with JsRunPromiseTasks; JSRT does not allow enabling the queue under TTD
+            this->engineTaskQueue->Add(taskVar);
+            return;
+        }
+
         if(this->nativeHostPromiseContinuationFunction)
         {
 #if ENABLE_TTD
@@ -6043,6 +6080,20 @@ namespace Js
         return arr;
     }
 
+#ifdef ENABLE_WASM
+    ArrayBuffer* JavascriptLibrary::CreateWebAssemblyArrayBuffer(uint32 length)
+    {
+        ArrayBuffer* arr = WebAssemblyArrayBuffer::Create(length, arrayBufferType);
+        return arr;
+    }
+
+    ArrayBuffer* JavascriptLibrary::CreateWebAssemblyArrayBuffer(byte* buffer, uint32 length)
+    {
+        ArrayBuffer* arr = WebAssemblyArrayBuffer::Create(buffer, length, arrayBufferType);
+        return arr;
+    }
+#endif
+
     SharedArrayBuffer* JavascriptLibrary::CreateSharedArrayBuffer(uint32 length)
     {
         return JavascriptSharedArrayBuffer::Create(length, sharedArrayBufferType);
@@ -448,6 +448,12 @@ namespace Js
         PromiseContinuationCallback nativeHostPromiseContinuationFunction;
         void *nativeHostPromiseContinuationFunctionState;
 
+        // Promise jobs held by the engine, instead of being handed to the host one at a time, while
+        // useEngineTaskQueue is set. engineTaskQueueHead is the index of the next job to run.
+        JsUtil::List<Var, Recycler>* engineTaskQueue;
+        int engineTaskQueueHead;
+        bool useEngineTaskQueue;
+
         typedef SList<Js::FunctionProxy*, Recycler> FunctionReferenceList;
         typedef JsUtil::WeakReferenceDictionary<uintptr_t, DynamicType, DictionarySizePolicy<PowerOf2Policy, 1>> JsrtExternalTypesCache;
 
@@ -551,6 +557,9 @@ namespace Js
                               referencedPropertyRecords(nullptr),
                               stringTemplateCallsiteObjectList(nullptr),
                               moduleRecordList(nullptr),
+                              engineTaskQueue(nullptr),
+                              engineTaskQueueHead(0),
+                              useEngineTaskQueue(false),
                               rootPath(nullptr),
                               bindRefChunkBegin(nullptr),
                               bindRefChunkCurrent(nullptr),
@@ -883,6 +892,8 @@ namespace Js
         JavascriptFunction* GetThrowerFunction() const { return throwerFunction; }
 
         void SetNativeHostPromiseContinuationFunction(PromiseContinuationCallback function, void *state);
+        void SetUseEngineTaskQueue(bool enabled);
+        Var DequeueEngineTask();
 
         void PinJsrtContextObject(FinalizableObject* jsrtContext);
         FinalizableObject* GetPinnedJsrtContextObject();
@@ -903,6 +914,10 @@ namespace Js
         JavascriptArray* CreateArray(uint32 length, uint32 size);
         ArrayBuffer* CreateArrayBuffer(uint32 length);
         ArrayBuffer* CreateArrayBuffer(byte* buffer, uint32 length);
+#ifdef ENABLE_WASM
+        ArrayBuffer* CreateWebAssemblyArrayBuffer(uint32 length);
+        ArrayBuffer* CreateWebAssemblyArrayBuffer(byte* buffer, uint32 length);
+#endif
         SharedArrayBuffer* CreateSharedArrayBuffer(uint32 length);
         SharedArrayBuffer* CreateSharedArrayBuffer(SharedContents *contents);
         ArrayBuffer* CreateProjectionArraybuffer(uint32 length);
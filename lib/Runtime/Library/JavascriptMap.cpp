@@ -346,20 +346,20 @@ namespace Js
 
     bool JavascriptMap::Delete(Var key)
     {
-        if (map->ContainsKey(key))
+        MapDataNode* node;
+        if (map->TryGetValueAndRemove(key, &node))
         {
-            MapDataNode* node = map->Item(key);
             list.Remove(node);
-            return map->Remove(key);
+            return true;
         }
         return false;
     }
 
     bool JavascriptMap::Get(Var key, Var* value)
     {
-        if (map->ContainsKey(key))
+        MapDataNode* node;
+        if (map->TryGetValue(key, &node))
         {
-            MapDataNode* node = map->Item(key);
             *value = node->data.Value();
             return true;
         }
@@ -373,15 +373,15 @@ namespace Js
 
     void JavascriptMap::Set(Var key, Var value)
     {
-        if (map->ContainsKey(key))
+        MapDataNode* node;
+        if (map->TryGetValue(key, &node))
         {
-            MapDataNode* node = map->Item(key);
             node->data = MapDataKeyValuePair(key, value);
         }
         else
         {
             MapDataKeyValuePair pair(key, value);
-            MapDataNode* node = list.Append(pair, GetScriptContext()->GetRecycler());
+            node = list.Append(pair, GetScriptContext()->GetRecycler());
             map->Add(key, node);
         }
     }
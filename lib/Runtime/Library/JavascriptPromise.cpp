@@ -1108,6 +1108,24 @@ namespace Js
         JavascriptPromise* promise = FromVar(CALL_FUNCTION(promiseResolve, CallInfo(CallFlags_Value, 2), library->GetPromiseConstructor(), value));
 
         JavascriptFunction* promiseThen = JavascriptFunction::FromVar(JavascriptOperators::GetProperty(promise, PropertyIds::then, scriptContext));
+
+        // When both then and catch are the built-ins, register the step functions as a single pair of
+        // reactions. This is what then(success) followed by catch(fail) amounts to, minus the two
+        // intermediate derived promises and the identity/thrower pass-through reactions.
+        if (!PHASE_OFF1(Js::AsyncAwaitFastPathPhase) && promiseThen->GetFunctionInfo() == &JavascriptPromise::EntryInfo::Then)
+        {
+            Var promiseCatch = JavascriptOperators::GetProperty(promise, PropertyIds::catch_, scriptContext);
+            if (JavascriptFunction::Is(promiseCatch) && JavascriptFunction::FromVar(promiseCatch)->GetFunctionInfo() == &JavascriptPromise::EntryInfo::Catch)
+            {
+                CreateThenPromise(promise, successFunction, failFunction, scriptContext);
+                return;
+            }
+
+            CALL_FUNCTION(promiseThen, CallInfo(CallFlags_Value, 2), promise, successFunction);
+            CALL_FUNCTION(JavascriptFunction::FromVar(promiseCatch), CallInfo(CallFlags_Value, 2), promise, failFunction);
+            return;
+        }
+
         CALL_FUNCTION(promiseThen, CallInfo(CallFlags_Value, 2), promise, successFunction);
 
         JavascriptFunction* promiseCatch = JavascriptFunction::FromVar(JavascriptOperators::GetProperty(promise, PropertyIds::catch_, scriptContext));
@@ -1836,7 +1836,20 @@ namespace Js
         //  3. If func is either undefined or null, return undefined.
         //  4. If IsCallable(func) is false, throw a TypeError exception.
         //  5. Return func.
-        BOOL result = JavascriptOperators::GetPropertyReference(handler, methodId, &varMethod, requestContext);
+        BOOL result;
+        InlineCache * trapInlineCache = GetTrapInlineCache(methodId, requestContext);
+        if (trapInlineCache != nullptr && handler->GetTypeId() == TypeIds_Object)
+        {
+            // Handlers are usually plain objects shared by many proxies, so the lookup of the hot traps goes through a per
+            // script context inline cache. A missing trap yields undefined, which is treated below the same way as a failed
+            // lookup.
+            varMethod = JavascriptOperators::PatchGetValueUsingSpecifiedInlineCache(trapInlineCache, handler, handler, methodId, requestContext);
+            result = TRUE;
+        }
+        else
+        {
+            result = JavascriptOperators::GetPropertyReference(handler, methodId, &varMethod, requestContext);
+        }
         if (!result || JavascriptOperators::IsUndefinedOrNull(varMethod))
         {
             return nullptr;
@@ -1851,6 +1864,21 @@ namespace Js
         return JavascriptFunction::FromVar(varMethod);
     }
 
+    InlineCache * JavascriptProxy::GetTrapInlineCache(PropertyId methodId, ScriptContext* requestContext)
+    {
+        switch (methodId)
+        {
+        case PropertyIds::get:
+            return requestContext->GetProxyGetTrapInlineCache();
+        case PropertyIds::set:
+            return requestContext->GetProxySetTrapInlineCache();
+        case PropertyIds::has:
+            return requestContext->GetProxyHasTrapInlineCache();
+        default:
+            return nullptr;
+        }
+    }
+
     Var JavascriptProxy::GetValueFromDescriptor(RecyclableObject* instance, PropertyDescriptor propertyDescriptor, ScriptContext* requestContext)
     {
         if (propertyDescriptor.ValueSpecified())
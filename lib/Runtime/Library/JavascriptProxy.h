@@ -204,6 +204,7 @@ namespace Js
 
     private:
         JavascriptFunction* GetMethodHelper(PropertyId methodId, ScriptContext* requestContext);
+        static InlineCache * GetTrapInlineCache(PropertyId methodId, ScriptContext* requestContext);
         Var GetValueFromDescriptor(RecyclableObject* instance, PropertyDescriptor propertyDescriptor, ScriptContext* requestContext);
         static Var GetName(ScriptContext* requestContext, PropertyId propertyId);
 
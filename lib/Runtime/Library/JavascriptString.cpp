@@ -1092,13 +1092,14 @@ case_2:
             const char16* inputStr = pThis->GetString();
             if (searchLen == 1)
             {
-                int i = position;
-                for(; i < len && inputStr[i] != *searchStr ; i++);
-                if (i < len)
-                {
-                    result = i;
-                }
+                result = IndexOfChar(inputStr, len, *searchStr, position);
+            }
+#if defined(_M_IX86) || defined(_M_X64)
+            else if (searchLen <= MaxFirstLastCharFilterSearchLength && !PHASE_OFF1(Js::SimdStringSearchPhase))
+            {
+                result = IndexOfUsingFirstLastCharFilter(inputStr, len, searchStr, searchLen, position);
             }
+#endif
             else
             {
                 JmpTable jmpTable;
@@ -2288,6 +2289,11 @@ case_2:
             *o++ = *inStr++;
         }
 
+        if (TryChangeAsciiCaseInPlace(outStrLim - countToCase, countToCase, toCase))
+        {
+            return builder.ToString();
+        }
+
         if(toCase == ToUpper)
         {
 #if DBG
@@ -2313,6 +2319,55 @@ case_2:
         return builder.ToString();
     }
 
+    // Change the case of an all-ASCII buffer without going through the platform's linguistic casing. Returns false
+    // as soon as a non-ASCII character is found; the characters cased up to that point are already in their final
+    // case, so the caller can hand the whole buffer to the platform as usual.
+    bool JavascriptString::TryChangeAsciiCaseInPlace(char16* str, charcount_t count, ToCase toCase)
+    {
+        const char16 first = (toCase == ToUpper) ? _u('a') : _u('A');
+        const char16 last = (toCase == ToUpper) ? _u('z') : _u('Z');
+        charcount_t i = 0;
+
+#if defined(_M_IX86) || defined(_M_X64)
+        if (!PHASE_OFF1(Js::SimdStringCasePhase))
+        {
+            const __m128i nonAscii = _mm_set1_epi16((short)0xFF80);
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i belowFirst = _mm_set1_epi16((short)(first - 1));
+            const __m128i aboveLast = _mm_set1_epi16((short)(last + 1));
+            const __m128i caseBit = _mm_set1_epi16(0x20);
+
+            for (; i + 8 <= count; i += 8)
+            {
+                __m128i block = _mm_loadu_si128((const __m128i *)(str + i));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, nonAscii), zero)) != 0xFFFF)
+                {
+                    return false;
+                }
+
+                // ASCII upper and lower case letters differ only in the 0x20 bit
+                const __m128i inRange = _mm_and_si128(_mm_cmpgt_epi16(block, belowFirst), _mm_cmplt_epi16(block, aboveLast));
+                block = _mm_xor_si128(block, _mm_and_si128(inRange, caseBit));
+                _mm_storeu_si128((__m128i *)(str + i), block);
+            }
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            const char16 ch = str[i];
+            if (ch >= 0x80)
+            {
+                return false;
+            }
+            if (ch >= first && ch <= last)
+            {
+                str[i] = (char16)(ch ^ 0x20);
+            }
+        }
+        return true;
+    }
+
     Var JavascriptString::EntryTrim(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -3353,6 +3408,78 @@ case_2:
         return builder.ToString();
     }
 
+    int JavascriptString::IndexOfChar(const char16* inputStr, int len, char16 searchChar, int position)
+    {
+        int i = position;
+#if defined(_M_IX86) || defined(_M_X64)
+        if (!PHASE_OFF1(Js::SimdStringSearchPhase))
+        {
+            // Compare eight characters at a time
+            const __m128i target = _mm_set1_epi16((short)searchChar);
+            for (; i + 8 <= len; i += 8)
+            {
+                const __m128i block = _mm_loadu_si128((const __m128i *)(inputStr + i));
+                const int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(block, target));
+                if (mask != 0)
+                {
+                    DWORD index;
+                    _BitScanForward(&index, (DWORD)mask);
+                    return i + (int)(index / sizeof(char16));
+                }
+            }
+        }
+#endif
+        for (; i < len; i++)
+        {
+            if (inputStr[i] == searchChar)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // For short patterns: check the first and last characters of the pattern at eight candidate positions at
+    // once, and only compare the rest of the pattern where both of them match.
+    int JavascriptString::IndexOfUsingFirstLastCharFilter(const char16* inputStr, int len, const char16* searchStr, int searchLen, int position)
+    {
+        Assert(searchLen >= 2);
+
+        // The last position a match can start at
+        const int lastStart = len - searchLen;
+        int i = position;
+#if defined(_M_IX86) || defined(_M_X64)
+        const __m128i first = _mm_set1_epi16((short)searchStr[0]);
+        const __m128i last = _mm_set1_epi16((short)searchStr[searchLen - 1]);
+        for (; i + 7 <= lastStart; i += 8)
+        {
+            const __m128i firstBlock = _mm_loadu_si128((const __m128i *)(inputStr + i));
+            const __m128i lastBlock = _mm_loadu_si128((const __m128i *)(inputStr + i + searchLen - 1));
+            int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi16(firstBlock, first), _mm_cmpeq_epi16(lastBlock, last)));
+            while (mask != 0)
+            {
+                DWORD index;
+                _BitScanForward(&index, (DWORD)mask);
+                const int candidate = i + (int)(index / sizeof(char16));
+                if (wmemcmp(inputStr + candidate + 1, searchStr + 1, searchLen - 2) == 0)
+                {
+                    return candidate;
+                }
+                // Each matching character sets two bits of the mask
+                mask &= ~(3 << index);
+            }
+        }
+#endif
+        for (; i <= lastStart; i++)
+        {
+            if (inputStr[i] == searchStr[0] && wmemcmp(inputStr + i + 1, searchStr + 1, searchLen - 1) == 0)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
     int JavascriptString::IndexOfUsingJmpTable(JmpTable jmpTable, const char16* inputStr, int len, const char16* searchStr, int searchLen, int position)
     {
         int result = -1;
@@ -58,6 +58,7 @@ namespace Js
         charcount_t m_charLength;          // Length in characters, not including '\0'.
 
         static const charcount_t MaxCharLength = INT_MAX - 1;  // Max number of chars not including '\0'.
+        static const int MaxFirstLastCharFilterSearchLength = 16; // Longer patterns use the Boyer-Moore jump table
 
     protected:
         static const byte MaxCopyRecursionDepth = 3;
@@ -157,6 +158,9 @@ namespace Js
         char16* GetSzCopy();   // get a copy of the inner string without compacting the chunks
 
         static Var ToCaseCore(JavascriptString* pThis, ToCase toCase);
+        static bool TryChangeAsciiCaseInPlace(char16* str, charcount_t count, ToCase toCase);
+        static int IndexOfChar(const char16* inputStr, int len, char16 searchChar, int position);
+        static int IndexOfUsingFirstLastCharFilter(const char16* inputStr, int len, const char16* searchStr, int searchLen, int position);
         static int IndexOfUsingJmpTable(JmpTable jmpTable, const char16* inputStr, int len, const char16* searchStr, int searchLen, int position);
         static int LastIndexOfUsingJmpTable(JmpTable jmpTable, const char16* inputStr, int len, const char16* searchStr, int searchLen, int position);
         static bool BuildLastCharForwardBoyerMooreTable(JmpTable jmpTable, const char16* searchStr, int searchLen);
@@ -10,7 +10,7 @@ namespace Js
     DEFINE_RECYCLER_TRACKER_WEAKREF_PERF_COUNTER(PropertyString);
 
     PropertyString::PropertyString(StaticType* type, const Js::PropertyRecord* propertyRecord)
-        : JavascriptString(type, propertyRecord->GetLength(), propertyRecord->GetBuffer()), m_propertyRecord(propertyRecord)
+        : JavascriptString(type, propertyRecord->GetLength(), propertyRecord->GetBuffer()), m_propertyRecord(propertyRecord), quotedString(nullptr)
     {
     }
 
@@ -39,6 +39,7 @@ namespace Js
     protected:
         PropertyCache* propCache;
         const Js::PropertyRecord* m_propertyRecord;
+        JavascriptString* quotedString; // JSON.stringify's quoted form of this name, created on first use
         DEFINE_VTABLE_CTOR(PropertyString, JavascriptString);
         DECLARE_CONCRETE_STRING_CLASS;
 
@@ -51,6 +52,8 @@ namespace Js
         static PropertyString* New(StaticType* type, const Js::PropertyRecord* propertyRecord, ArenaAllocator *arena);
         void UpdateCache(Type * type, uint16 dataSlotIndex, bool isInlineSlot, bool isStoreFieldEnabled);
         void ClearCache() { propCache->type = nullptr; }
+        JavascriptString* GetQuotedString() const { return quotedString; }
+        void SetQuotedString(JavascriptString* quoted) { Assert(!IsArenaAllocPropertyString()); quotedString = quoted; }
 
         virtual void const * GetOriginalStringReference() override;
         virtual RecyclableObject * CloneToScriptContext(ScriptContext* requestContext) override;
@@ -1767,6 +1767,40 @@ namespace Js
                 ary->DirectSetItemAt(i, scriptContext->GetLibrary()->GetCharStringCache().GetStringForChar(charString[i]));
             }
         }
+        else if (matchLen == 1)
+        {
+            // Single-character separators are the common case (CSV fields, log lines). Count the pieces in a
+            // first pass so that the result array is allocated at its final size, then slice the input.
+            const char16 sepChar = match->GetString()[0];
+            const char16 * charString = input->GetString();
+            const CharCount inputLen = input->GetLength();
+            CharCount count = 1;
+            for (CharCount j = 0; j < inputLen && count < limit; j++)
+            {
+                if (charString[j] == sepChar)
+                {
+                    count++;
+                }
+            }
+
+            ary = scriptContext->GetLibrary()->CreateArray(count);
+            CharCount prevOffset = 0;
+            CharCount i = 0;
+            for (CharCount j = 0; j < inputLen && i < count; j++)
+            {
+                if (charString[j] == sepChar)
+                {
+                    ary->DirectSetItemAt(i++, SubString::New(input, prevOffset, j - prevOffset));
+                    prevOffset = j + 1;
+                }
+            }
+
+            if (i < count)
+            {
+                ary->DirectSetItemAt(i++, SubString::New(input, prevOffset, inputLen - prevOffset));
+            }
+            Assert(i == count);
+        }
         else
         {
             CharCount i = 0;
@@ -21,6 +21,19 @@ namespace Js
     {
         static bool Equals(Var x, Var y)
         {
+            // Identical Vars are always the same value (including a NaN compared with itself)
+            if (x == y)
+            {
+                return true;
+            }
+
+            // Property strings with the same content share their property record
+            if (!TaggedNumber::Is(x) && !TaggedNumber::Is(y)
+                && VirtualTableInfo<PropertyString>::HasVirtualTable(x) && VirtualTableInfo<PropertyString>::HasVirtualTable(y))
+            {
+                return ((PropertyString*)x)->GetPropertyRecord() == ((PropertyString*)y)->GetPropertyRecord();
+            }
+
             if (zero)
             {
                 return JavascriptConversion::SameValueZero(x, y);
@@ -85,6 +98,12 @@ namespace Js
 
             case TypeIds_String:
                 {
+                    // A property string's record already holds the hash of its characters
+                    if (VirtualTableInfo<PropertyString>::HasVirtualTable(i))
+                    {
+                        return ((PropertyString*)i)->GetPropertyRecord()->GetHashCode();
+                    }
+
                     JavascriptString* v = JavascriptString::FromVar(i);
                     return JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(v->GetString(), v->GetLength());
                 }
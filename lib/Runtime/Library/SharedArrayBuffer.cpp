@@ -517,8 +517,20 @@ namespace Js
         csForAccess.Enter();
         return result == WAIT_OBJECT_0;
 #else
-        // TODO for xplat
-        return false;
+        Assert(m_waiters != nullptr);
+        Assert(waiter != NULL);
+        Assert(!Contains(waiter));
+
+        volatile int32 wakeFlag = 0;
+        AgentOfBuffer agent(waiter, &wakeFlag);
+        m_waiters->Add(agent);
+
+        csForAccess.Leave();
+        PlatformAgnostic::AddressWaiter::Wait(&wakeFlag, 0, timeout);
+        csForAccess.Enter();
+
+        // A wake that raced with the timeout has already removed this agent, so it counts as woken
+        return wakeFlag != 0;
 #endif
     }
 
@@ -537,8 +549,18 @@ namespace Js
         }
 
         Assert(false);
+#else
+        // A woken agent has already been removed by RemoveAndWakeWaiters
+        Assert(m_waiters != nullptr);
+        for (int i = m_waiters->Count() - 1; i >= 0; i--)
+        {
+            if (m_waiters->Item(i).identity == waiter)
+            {
+                m_waiters->RemoveAt(i);
+                return;
+            }
+        }
 #endif
-        // TODO for xplat
     }
 
     uint32 WaiterList::RemoveAndWakeWaiters(int32 count)
@@ -555,6 +577,15 @@ namespace Js
             SetEvent(agent.event);
             // This agent will be closed when their respective call to wait has returned
         }
+#else
+        while (count > 0 && m_waiters->Count() > 0)
+        {
+            AgentOfBuffer agent = m_waiters->Item(0);
+            m_waiters->RemoveAt(0);
+            count--; removed++;
+            *agent.wakeFlag = 1;
+            PlatformAgnostic::AddressWaiter::Wake(agent.wakeFlag);
+        }
 #endif
         return removed;
     }
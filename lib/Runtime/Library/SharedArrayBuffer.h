@@ -179,12 +179,22 @@ namespace Js
     struct AgentOfBuffer
     {
     public:
+#ifdef _WIN32
         AgentOfBuffer() :identity(NULL), event(NULL) {}
         AgentOfBuffer(DWORD_PTR agent, HANDLE e) :identity(agent), event(e) {}
+#else
+        AgentOfBuffer() :identity(NULL), wakeFlag(nullptr) {}
+        AgentOfBuffer(DWORD_PTR agent, volatile int32 *flag) :identity(agent), wakeFlag(flag) {}
+#endif
         static bool AgentCanSuspend(ScriptContext *scriptContext);
 
         DWORD_PTR identity;
+#ifdef _WIN32
         HANDLE event;
+#else
+        // Lives on the waiting thread's stack; set to 1 (under the waiter list lock) to wake it
+        volatile int32 *wakeFlag;
+#endif
     };
 
     typedef JsUtil::List<AgentOfBuffer, HeapAllocator> Waiters;
@@ -1958,6 +1958,14 @@ namespace Js
             return TaggedInt::ToVarUnchecked(-1);
         }
 
+        // Converting the fromIndex argument can run user code and detach the buffer
+        int32 index;
+        if (!PHASE_OFF1(Js::TypedArrayBulkOpsPhase) && !typedArrayBase->IsDetachedBuffer() &&
+            typedArrayBase->TryIndexOfNumber(search, fromIndex, length, false, &index))
+        {
+            return JavascriptNumber::ToVar(index, scriptContext);
+        }
+
         return JavascriptArray::TemplatedIndexOfHelper<false>(typedArrayBase, search, fromIndex, length, scriptContext);
     }
 
@@ -1981,6 +1989,14 @@ namespace Js
             return scriptContext->GetLibrary()->GetFalse();
         }
 
+        // Converting the fromIndex argument can run user code and detach the buffer
+        int32 index;
+        if (!PHASE_OFF1(Js::TypedArrayBulkOpsPhase) && !typedArrayBase->IsDetachedBuffer() &&
+            typedArrayBase->TryIndexOfNumber(search, fromIndex, length, true, &index))
+        {
+            return scriptContext->GetLibrary()->GetTrueOrFalse(index != -1);
+        }
+
         return JavascriptArray::TemplatedIndexOfHelper<true>(typedArrayBase, search, fromIndex, length, scriptContext);
     }
 
@@ -2612,6 +2628,144 @@ namespace Js
         return Js::JavascriptNumber::ToVarNoCheck(currentRes, scriptContext);
     }
 
+    // Searches the raw elements for a number without boxing them.
+    // Returns false if this kind of typed array has to go through the generic search.
+    bool TypedArrayBase::TryIndexOfNumber(Var search, uint32 fromIndex, uint32 toIndex, bool includesAlgorithm, int32 * index)
+    {
+        Assert(!this->IsDetachedBuffer());
+
+        TypeId typeId = this->GetTypeId();
+        if (typeId < TypeIds_Int8Array || typeId > TypeIds_Float64Array)
+        {
+            return false;
+        }
+
+        double searchValue;
+        if (TaggedInt::Is(search))
+        {
+            searchValue = TaggedInt::ToDouble(search);
+        }
+        else if (JavascriptNumber::Is_NoTaggedIntCheck(search))
+        {
+            searchValue = JavascriptNumber::GetValue(search);
+        }
+        else
+        {
+            // Every element is a number, so nothing else is strictly equal or SameValueZero to one
+            *index = -1;
+            return true;
+        }
+
+        if (toIndex > this->GetLength())
+        {
+            toIndex = this->GetLength();
+        }
+
+        switch (typeId)
+        {
+        case TypeIds_Int8Array:
+            *index = this->IndexOfNumber<int8, false>(searchValue, fromIndex, toIndex, includesAlgorithm);
+            break;
+
+        case TypeIds_Uint8Array:
+        case TypeIds_Uint8ClampedArray:
+            *index = this->IndexOfNumber<uint8, false>(searchValue, fromIndex, toIndex, includesAlgorithm);
+            break;
+
+        case TypeIds_Int16Array:
+            *index = this->IndexOfNumber<int16, false>(searchValue, fromIndex, toIndex, includesAlgorithm);
+            break;
+
+        case TypeIds_Uint16Array:
+            *index = this->IndexOfNumber<uint16, false>(searchValue, fromIndex, toIndex, includesAlgorithm);
+            break;
+
+        case TypeIds_Int32Array:
+            *index = this->IndexOfNumber<int32, false>(searchValue, fromIndex, toIndex, includesAlgorithm);
+            break;
+
+        case TypeIds_Uint32Array:
+            *index = this->IndexOfNumber<uint32, false>(searchValue, fromIndex, toIndex, includesAlgorithm);
+            break;
+
+        case TypeIds_Float32Array:
+            *index = this->IndexOfNumber<float, true>(searchValue, fromIndex, toIndex, includesAlgorithm);
+            break;
+
+        case TypeIds_Float64Array:
+            *index = this->IndexOfNumber<double, true>(searchValue, fromIndex, toIndex, includesAlgorithm);
+            break;
+
+        default:
+            Assert(UNREACHED);
+            return false;
+        }
+
+        return true;
+    }
+
+    template<typename T, bool checkNaN>
+    int32 TypedArrayBase::IndexOfNumber(double search, uint32 fromIndex, uint32 toIndex, bool includesAlgorithm)
+    {
+        T* typedBuffer = (T*)this->buffer;
+
+        Assert(toIndex * sizeof(T) + GetByteOffset() <= GetArrayBuffer()->GetByteLength());
+        if (JavascriptNumber::IsNan(search))
+        {
+            // Only SameValueZero matches NaN, and only float elements can hold it
+            if (checkNaN && includesAlgorithm)
+            {
+                for (uint32 i = fromIndex; i < toIndex; i++)
+                {
+                    if (JavascriptNumber::IsNan(double(typedBuffer[i])))
+                    {
+                        return (int32)i;
+                    }
+                }
+            }
+            return -1;
+        }
+
+        // +0 and -0 compare equal here, as both indexOf and includes require
+        for (uint32 i = fromIndex; i < toIndex; i++)
+        {
+            if (double(typedBuffer[i]) == search)
+            {
+                return (int32)i;
+            }
+        }
+        return -1;
+    }
+
+    // Copies the element at index over [index + 1, end), doubling the copied run each time.
+    // The element has already been stored with the converted value, so the bytes can be copied as they are.
+    void TypedArrayBase::ReplicateItem(uint32 index, uint32 end)
+    {
+        Assert(!this->IsDetachedBuffer());
+
+        if (end > this->GetLength())
+        {
+            end = this->GetLength();
+        }
+        if (index >= end)
+        {
+            return;
+        }
+
+        const size_t bytesPerElement = this->GetBytesPerElement();
+        byte* first = this->buffer + index * bytesPerElement;
+        const size_t totalBytes = (end - index) * bytesPerElement;
+        size_t filledBytes = bytesPerElement;
+
+        Assert(index * bytesPerElement + totalBytes + GetByteOffset() <= GetArrayBuffer()->GetByteLength());
+        while (filledBytes < totalBytes)
+        {
+            size_t copyBytes = min(filledBytes, totalBytes - filledBytes);
+            js_memcpy_s(first + filledBytes, totalBytes - filledBytes, first, copyBytes);
+            filledBytes += copyBytes;
+        }
+    }
+
     // static 
     TypedArrayBase * TypedArrayBase::ValidateTypedArray(Arguments &args, ScriptContext *scriptContext, LPCWSTR apiName)
     {
@@ -177,6 +177,10 @@ namespace Js
         Var FindMinOrMax(Js::ScriptContext * scriptContext, TypeId typeId, bool findMax);
         template<typename T, bool checkNaNAndNegZero> Var FindMinOrMax(Js::ScriptContext * scriptContext, bool findMax);
 
+        bool TryIndexOfNumber(Var search, uint32 fromIndex, uint32 toIndex, bool includesAlgorithm, int32 * index);
+        template<typename T, bool checkNaN> int32 IndexOfNumber(double search, uint32 fromIndex, uint32 toIndex, bool includesAlgorithm);
+        void ReplicateItem(uint32 index, uint32 end);
+
         static Var GetKeysEntriesValuesHelper(Arguments& args, ScriptContext *scriptContext, LPCWSTR apiName, JavascriptArrayIteratorKind kind);
 
         static uint32 GetFromIndex(Var arg, uint32 length, ScriptContext *scriptContext);
@@ -0,0 +1,55 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "Common.h"
+#include "ChakraPlatform.h"
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace PlatformAgnostic
+{
+    static uint64 GetMonotonicMilliseconds()
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (uint64)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+    }
+
+    bool AddressWaiter::Wait(volatile int32 *address, int32 expected, uint32 timeout)
+    {
+        const uint64 deadline = GetMonotonicMilliseconds() + timeout;
+
+        while (*address == expected)
+        {
+            struct timespec remaining;
+            struct timespec *remainingPtr = nullptr;
+            if (timeout != INFINITE)
+            {
+                const uint64 now = GetMonotonicMilliseconds();
+                if (now >= deadline)
+                {
+                    return false;
+                }
+
+                remaining.tv_sec = (time_t)((deadline - now) / 1000);
+                remaining.tv_nsec = (long)((deadline - now) % 1000) * 1000000;
+                remainingPtr = &remaining;
+            }
+
+            // EAGAIN (the value already changed), EINTR and spurious wakeups all just recheck the value
+            syscall(SYS_futex, (int *)address, FUTEX_WAIT_PRIVATE, expected, remainingPtr, nullptr, 0);
+        }
+
+        return true;
+    }
+
+    void AddressWaiter::Wake(volatile int32 *address)
+    {
+        syscall(SYS_futex, (int *)address, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+    }
+} // namespace PlatformAgnostic
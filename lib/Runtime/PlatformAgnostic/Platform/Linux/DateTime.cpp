@@ -213,9 +213,8 @@ namespace DateTime
         bias = offset;
     }
 
-    // DaylightTimeHelper ******
-    double DaylightTimeHelper::UtcToLocal(double utcTime, int &bias,
-                                          int &offset, bool &isDaylightSavings)
+    static double UtcToLocalUncached(double utcTime, int &bias,
+                                     int &offset, bool &isDaylightSavings)
     {
         YMD ymdUTC, local;
 
@@ -226,7 +225,7 @@ namespace DateTime
         return Js::DateUtilities::TvFromDate(local.year, local.mon, local.mday, local.time);
     }
 
-    double DaylightTimeHelper::LocalToUtc(double localTime)
+    static double LocalToUtcUncached(double localTime)
     {
         YMD ymdLocal, utc;
 
@@ -235,5 +234,98 @@ namespace DateTime
 
         return Js::DateUtilities::TvFromDate(utc.year, utc.mon, utc.mday, utc.time);
     }
+
+    // TimeZoneOffsetCache ******
+    #define updatePeriod 1000
+
+    // Time zone transitions are assumed to be more than cacheSpan apart: when conversions at
+    // both ends of a span agree, the whole span shares the result.
+    static const double cacheSpan = DateTimeTicks_PerDay;
+
+    // Years outside this range are remapped before calling the tz functions (see NormalizeYMDYear),
+    // which makes the conversion jump at the remapped year boundaries.
+    static const double cacheMin = Js::DateUtilities::TvFromDate(1900, 0, 1, 0);
+    static const double cacheMax = Js::DateUtilities::TvFromDate(2100, 0, 1, 0);
+
+    // YMD_TO_TM special cases leap days, so the conversion isn't a constant shift around them.
+    static inline bool IsNearLeapDay(const double time)
+    {
+        YMD ymd;
+        Js::DateUtilities::GetYmdFromTv(time, &ymd);
+        return IsLeap(ymd.year) && ymd.yday >= 58 && ymd.yday <= 62;
+    }
+
+    static inline bool IsCacheable(const double time)
+    {
+        return time >= cacheMin && time + cacheSpan < cacheMax && time == floor(time) &&
+            !IsNearLeapDay(time) && !IsNearLeapDay(time + cacheSpan);
+    }
+
+    bool TimeZoneOffsetCache::IsValid(const double time)
+    {
+        return time >= start && time <= end && time == floor(time) &&
+            GetTickCount() - lastUpdateTickCount < updatePeriod;
+    }
+
+    void TimeZoneOffsetCache::Update(const double time, const double convertedTime,
+                                     const double probeTime, const bool probeMatches)
+    {
+        start = time;
+        end = probeMatches ? probeTime : time;
+        delta = convertedTime - time;
+        lastUpdateTickCount = GetTickCount();
+    }
+
+    // DaylightTimeHelper ******
+    double DaylightTimeHelper::UtcToLocal(double utcTime, int &bias,
+                                          int &offset, bool &isDaylightSavings)
+    {
+        TimeZoneOffsetCache &cache = data.utcToLocal;
+        if (cache.IsValid(utcTime))
+        {
+            bias = cache.bias;
+            offset = cache.offset;
+            isDaylightSavings = cache.isDaylightSavings;
+            return utcTime + cache.delta;
+        }
+
+        double localTime = UtcToLocalUncached(utcTime, bias, offset, isDaylightSavings);
+        if (IsCacheable(utcTime))
+        {
+            int probeBias, probeOffset;
+            bool probeIsDaylightSavings;
+            const double probeTime = utcTime + cacheSpan;
+            const double probeLocalTime = UtcToLocalUncached(probeTime, probeBias, probeOffset, probeIsDaylightSavings);
+
+            cache.Update(utcTime, localTime, probeTime,
+                probeLocalTime - probeTime == localTime - utcTime && probeBias == bias &&
+                probeOffset == offset && probeIsDaylightSavings == isDaylightSavings);
+            cache.bias = bias;
+            cache.offset = offset;
+            cache.isDaylightSavings = isDaylightSavings;
+        }
+
+        return localTime;
+    }
+
+    double DaylightTimeHelper::LocalToUtc(double localTime)
+    {
+        TimeZoneOffsetCache &cache = data.localToUtc;
+        if (cache.IsValid(localTime))
+        {
+            return localTime + cache.delta;
+        }
+
+        double utcTime = LocalToUtcUncached(localTime);
+        if (IsCacheable(localTime))
+        {
+            const double probeTime = localTime + cacheSpan;
+            const double probeUtcTime = LocalToUtcUncached(probeTime);
+
+            cache.Update(localTime, utcTime, probeTime, probeUtcTime - probeTime == utcTime - localTime);
+        }
+
+        return utcTime;
+    }
 } // namespace DateTime
 } // namespace PlatformAgnostic
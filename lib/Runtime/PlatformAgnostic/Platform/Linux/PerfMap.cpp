@@ -0,0 +1,193 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "Common.h"
+#include "ChakraPlatform.h"
+#include <elf.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace PlatformAgnostic
+{
+    // Layout from tools/perf/Documentation/jitdump-specification.txt in the Linux sources
+    static const uint32 JitDumpMagic = 0x4A695444;
+    static const uint32 JitDumpVersion = 1;
+    static const uint32 JitCodeLoadRecordId = 0;
+
+    struct JitDumpHeader
+    {
+        uint32 magic;
+        uint32 version;
+        uint32 totalSize;
+        uint32 elfMachine;
+        uint32 pad;
+        uint32 pid;
+        uint64 timestamp;
+        uint64 flags;
+    };
+
+    struct JitCodeLoadRecord
+    {
+        uint32 id;
+        uint32 totalSize;
+        uint64 timestamp;
+        uint32 pid;
+        uint32 tid;
+        uint64 vma;
+        uint64 codeAddress;
+        uint64 codeSize;
+        uint64 codeIndex;
+        // followed by the null terminated name and the code bytes
+    };
+
+#if defined(_M_X64) || defined(_M_AMD64)
+    static const uint32 JitDumpElfMachine = EM_X86_64;
+#elif defined(_M_ARM64)
+    static const uint32 JitDumpElfMachine = EM_AARCH64;
+#elif defined(_M_ARM)
+    static const uint32 JitDumpElfMachine = EM_ARM;
+#else
+    static const uint32 JitDumpElfMachine = EM_386;
+#endif
+
+    static CriticalSection perfMapLock;
+    static bool perfMapInitialized = false;
+    static int perfMapFile = -1;
+    static int jitDumpFile = -1;
+    static uint64 jitDumpCodeIndex = 0;
+
+    // perf orders jitdump records against its samples using CLOCK_MONOTONIC
+    static uint64 GetMonotonicNanoseconds()
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (uint64)now.tv_sec * 1000000000 + now.tv_nsec;
+    }
+
+    static bool WriteAll(int file, const void *buffer, size_t size)
+    {
+        const char *current = (const char *)buffer;
+        while (size != 0)
+        {
+            ssize_t written = write(file, current, size);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return false;
+            }
+            current += written;
+            size -= (size_t)written;
+        }
+        return true;
+    }
+
+    static int OpenJitDump()
+    {
+        char path[64];
+        snprintf(path, sizeof(path), "jit-%d.dump", (int)getpid());
+        int file = open(path, O_CREAT | O_TRUNC | O_RDWR, 0666);
+        if (file < 0)
+        {
+            return -1;
+        }
+
+        // perf record finds the dump by seeing an executable mapping of it, so keep one alive
+        // for the life of the process.
+        long pageSize = sysconf(_SC_PAGESIZE);
+        if (mmap(nullptr, (size_t)pageSize, PROT_READ | PROT_EXEC, MAP_PRIVATE, file, 0) == MAP_FAILED)
+        {
+            close(file);
+            return -1;
+        }
+
+        JitDumpHeader header;
+        memset(&header, 0, sizeof(header));
+        header.magic = JitDumpMagic;
+        header.version = JitDumpVersion;
+        header.totalSize = sizeof(header);
+        header.elfMachine = JitDumpElfMachine;
+        header.pid = (uint32)getpid();
+        header.timestamp = GetMonotonicNanoseconds();
+        if (!WriteAll(file, &header, sizeof(header)))
+        {
+            close(file);
+            return -1;
+        }
+        return file;
+    }
+
+    bool PerfMap::EnsureInitialized(bool writeJitDump)
+    {
+        AutoCriticalSection autoLock(&perfMapLock);
+        if (!perfMapInitialized)
+        {
+            perfMapInitialized = true;
+
+            char path[64];
+            snprintf(path, sizeof(path), "/tmp/perf-%d.map", (int)getpid());
+            perfMapFile = open(path, O_CREAT | O_TRUNC | O_WRONLY | O_APPEND, 0666);
+
+            if (writeJitDump)
+            {
+                jitDumpFile = OpenJitDump();
+            }
+        }
+        return perfMapFile >= 0 || jitDumpFile >= 0;
+    }
+
+    void PerfMap::LogCodeLoad(const void *address, size_t size, const char *name)
+    {
+        AutoCriticalSection autoLock(&perfMapLock);
+        Assert(perfMapInitialized);
+
+        if (perfMapFile >= 0)
+        {
+            // One unbuffered line per range so the map is usable even if the process dies
+            char prefix[48];
+            int prefixLength = snprintf(prefix, sizeof(prefix), "%llx %llx ",
+                (unsigned long long)(uintptr_t)address, (unsigned long long)size);
+            if (!WriteAll(perfMapFile, prefix, (size_t)prefixLength) ||
+                !WriteAll(perfMapFile, name, strlen(name)) ||
+                !WriteAll(perfMapFile, "\n", 1))
+            {
+                close(perfMapFile);
+                perfMapFile = -1;
+            }
+        }
+
+        if (jitDumpFile >= 0)
+        {
+            size_t nameSize = strlen(name) + 1;
+
+            JitCodeLoadRecord record;
+            memset(&record, 0, sizeof(record));
+            record.id = JitCodeLoadRecordId;
+            record.totalSize = (uint32)(sizeof(record) + nameSize + size);
+            record.timestamp = GetMonotonicNanoseconds();
+            record.pid = (uint32)getpid();
+            record.tid = (uint32)syscall(SYS_gettid);
+            record.vma = (uint64)(uintptr_t)address;
+            record.codeAddress = (uint64)(uintptr_t)address;
+            record.codeSize = size;
+            record.codeIndex = jitDumpCodeIndex++;
+
+            if (!WriteAll(jitDumpFile, &record, sizeof(record)) ||
+                !WriteAll(jitDumpFile, name, nameSize) ||
+                !WriteAll(jitDumpFile, address, size))
+            {
+                close(jitDumpFile);
+                jitDumpFile = -1;
+            }
+        }
+    }
+} // namespace PlatformAgnostic
@@ -0,0 +1,57 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "Common.h"
+#include "ChakraPlatform.h"
+#include <errno.h>
+#include <pthread.h>
+#include <sys/time.h>
+
+namespace PlatformAgnostic
+{
+    // There is no public futex equivalent here; waits are rare enough to share one condition
+    // variable, and every waiter rechecks its own value after a broadcast.
+    static pthread_mutex_t waitLock = PTHREAD_MUTEX_INITIALIZER;
+    static pthread_cond_t waitCondition = PTHREAD_COND_INITIALIZER;
+
+    bool AddressWaiter::Wait(volatile int32 *address, int32 expected, uint32 timeout)
+    {
+        struct timespec deadline;
+        if (timeout != INFINITE)
+        {
+            struct timeval now;
+            gettimeofday(&now, nullptr);
+            uint64 nanoseconds = (uint64)now.tv_usec * 1000 + (uint64)(timeout % 1000) * 1000000;
+            deadline.tv_sec = now.tv_sec + timeout / 1000 + (time_t)(nanoseconds / 1000000000);
+            deadline.tv_nsec = (long)(nanoseconds % 1000000000);
+        }
+
+        bool changed = true;
+        pthread_mutex_lock(&waitLock);
+        while (*address == expected)
+        {
+            if (timeout == INFINITE)
+            {
+                pthread_cond_wait(&waitCondition, &waitLock);
+            }
+            else if (pthread_cond_timedwait(&waitCondition, &waitLock, &deadline) == ETIMEDOUT)
+            {
+                changed = *address != expected;
+                break;
+            }
+        }
+        pthread_mutex_unlock(&waitLock);
+
+        return changed;
+    }
+
+    void AddressWaiter::Wake(volatile int32 *address)
+    {
+        // Taking the lock orders the caller's store before any waiter's recheck
+        pthread_mutex_lock(&waitLock);
+        pthread_cond_broadcast(&waitCondition);
+        pthread_mutex_unlock(&waitLock);
+    }
+} // namespace PlatformAgnostic
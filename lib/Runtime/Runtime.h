@@ -483,6 +483,8 @@ enum tagDEBUG_EVENT_INFO_TYPE
 
 #include "Base/StackProber.h"
 #include "Base/ScriptContextProfiler.h"
+#include "Base/AllocationSiteProfiler.h"
+#include "Base/ScriptSampler.h"
 
 #include "Language/EvalMapRecord.h"
 #include "Base/RegexPatternMruMap.h"
@@ -96,12 +96,52 @@ namespace Js
     // TypePropertyCache
     // -------------------------------------------------------------------------------------------------------------------------
 
+    // Returns the first element of the set the property id maps to
     size_t TypePropertyCache::ElementIndex(const PropertyId id)
     {
+        CompileAssert((TypePropertyCache_NumElements & TypePropertyCache_NumElements - 1) == 0);
+        CompileAssert(TypePropertyCache_NumElements % TypePropertyCache_NumWays == 0);
         Assert(id != Constants::NoProperty);
-        Assert((TypePropertyCache_NumElements & TypePropertyCache_NumElements - 1) == 0);
 
-        return id & TypePropertyCache_NumElements - 1;
+        return (id & (TypePropertyCache_NumElements / TypePropertyCache_NumWays - 1)) * TypePropertyCache_NumWays;
+    }
+
+    const TypePropertyCacheElement *TypePropertyCache::FindElement(const PropertyId id) const
+    {
+        const TypePropertyCacheElement *const set = &elements[ElementIndex(id)];
+        for(size_t i = 0; i < TypePropertyCache_NumWays; ++i)
+        {
+            if(set[i].Id() == id)
+                return &set[i];
+        }
+        return nullptr;
+    }
+
+    TypePropertyCacheElement *TypePropertyCache::FindElement(const PropertyId id)
+    {
+        return const_cast<TypePropertyCacheElement *>(static_cast<const TypePropertyCache *>(this)->FindElement(id));
+    }
+
+    // A property id is cached in at most one element of its set. When the set is full, the other elements are
+    // shifted down (dropping the last one) so the first element always holds the most recently cached property.
+    TypePropertyCacheElement &TypePropertyCache::ElementToCache(const PropertyId id)
+    {
+        TypePropertyCacheElement *const set = &elements[ElementIndex(id)];
+        for(size_t i = 0; i < TypePropertyCache_NumWays; ++i)
+        {
+            if(set[i].Id() == id)
+                return set[i];
+        }
+        for(size_t i = 0; i < TypePropertyCache_NumWays; ++i)
+        {
+            if(set[i].Id() == Constants::NoProperty)
+                return set[i];
+        }
+        for(size_t i = TypePropertyCache_NumWays - 1; i > 0; --i)
+        {
+            set[i] = set[i - 1];
+        }
+        return set[0];
     }
 
     inline bool TypePropertyCache::TryGetIndexForLoad(
@@ -117,14 +157,14 @@ namespace Js
         Assert(isMissing);
         Assert(prototypeObjectWithProperty);
 
-        const TypePropertyCacheElement &element = elements[ElementIndex(id)];
-        if(element.Id() != id || (!checkMissing && element.IsMissing()))
+        const TypePropertyCacheElement *const element = FindElement(id);
+        if(!element || (!checkMissing && element->IsMissing()))
             return false;
 
-        *index = element.Index();
-        *isInlineSlot = element.IsInlineSlot();
-        *isMissing = checkMissing ? element.IsMissing() : false;
-        *prototypeObjectWithProperty = element.PrototypeObjectWithProperty();
+        *index = element->Index();
+        *isInlineSlot = element->IsInlineSlot();
+        *isMissing = checkMissing ? element->IsMissing() : false;
+        *prototypeObjectWithProperty = element->PrototypeObjectWithProperty();
         return true;
     }
 
@@ -136,17 +176,17 @@ namespace Js
         Assert(index);
         Assert(isInlineSlot);
 
-        const TypePropertyCacheElement &element = elements[ElementIndex(id)];
-        if(element.Id() != id ||
-            !element.IsSetPropertyAllowed() ||
-            element.PrototypeObjectWithProperty())
+        const TypePropertyCacheElement *const element = FindElement(id);
+        if(!element ||
+            !element->IsSetPropertyAllowed() ||
+            element->PrototypeObjectWithProperty())
         {
             return false;
         }
 
-        Assert(!element.IsMissing());
-        *index = element.Index();
-        *isInlineSlot = element.IsInlineSlot();
+        Assert(!element->IsMissing());
+        *index = element->Index();
+        *isInlineSlot = element->IsInlineSlot();
         return true;
     }
 
@@ -407,7 +447,7 @@ namespace Js
         const bool isInlineSlot,
         const bool isSetPropertyAllowed)
     {
-        elements[ElementIndex(id)].Cache(id, index, isInlineSlot, isSetPropertyAllowed);
+        ElementToCache(id).Cache(id, index, isInlineSlot, isSetPropertyAllowed);
     }
 
     void TypePropertyCache::Cache(
@@ -422,7 +462,7 @@ namespace Js
         Assert(myParentType);
         Assert(myParentType->GetPropertyCache() == this);
 
-        elements[ElementIndex(id)].Cache(
+        ElementToCache(id).Cache(
             id,
             index,
             isInlineSlot,
@@ -434,15 +474,15 @@ namespace Js
 
     void TypePropertyCache::ClearIfPropertyIsOnAPrototype(const PropertyId id)
     {
-        TypePropertyCacheElement &element = elements[ElementIndex(id)];
-        if(element.Id() == id && element.PrototypeObjectWithProperty())
-            element.Clear();
+        TypePropertyCacheElement *const element = FindElement(id);
+        if(element && element->PrototypeObjectWithProperty())
+            element->Clear();
     }
 
     void TypePropertyCache::Clear(const PropertyId id)
     {
-        TypePropertyCacheElement &element = elements[ElementIndex(id)];
-        if(element.Id() == id)
-            element.Clear();
+        TypePropertyCacheElement *const element = FindElement(id);
+        if(element)
+            element->Clear();
     }
 }
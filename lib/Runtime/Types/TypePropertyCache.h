@@ -6,6 +6,8 @@
 
 // Must be a power of 2
 #define TypePropertyCache_NumElements 16
+// Elements per set; a property id can live in any element of its set
+#define TypePropertyCache_NumWays 2
 
 namespace Js
 {
@@ -54,6 +56,9 @@ namespace Js
 
     private:
         static size_t ElementIndex(const PropertyId id);
+        const TypePropertyCacheElement *FindElement(const PropertyId id) const;
+        TypePropertyCacheElement *FindElement(const PropertyId id);
+        TypePropertyCacheElement &ElementToCache(const PropertyId id);
         bool TryGetIndexForLoad(const bool checkMissing, const PropertyId id, PropertyIndex *const index, bool *const isInlineSlot, bool *const isMissing, DynamicObject * *const prototypeObjectWithProperty) const;
         bool TryGetIndexForStore(const PropertyId id, PropertyIndex *const index, bool *const isInlineSlot) const;
 
@@ -0,0 +1,71 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function makeItems(count, keyOf) {
+    var items = [];
+    for (var i = 0; i < count; i++) {
+        items.push({ key: keyOf(i), index: i });
+    }
+    return items;
+}
+
+function checkStableSort(items) {
+    var calls = 0;
+    items.sort(function (a, b) { calls++; return a.key - b.key; });
+    for (var i = 1; i < items.length; i++) {
+        var prev = items[i - 1];
+        var curr = items[i];
+        assert.isTrue(prev.key < curr.key || (prev.key === curr.key && prev.index < curr.index),
+            "Element " + i + " out of order: {" + prev.key + ", " + prev.index + "} before {" + curr.key + ", " + curr.index + "}");
+    }
+    return calls;
+}
+
+var tests = [
+  {
+    name: "Sorting with a comparer is stable",
+    body: function () {
+      checkStableSort(makeItems(100, function (i) { return i % 7; }));
+      checkStableSort(makeItems(2000, function (i) { return (i * 7919) % 13; }));
+      checkStableSort(makeItems(3000, function (i) { return 3000 - (i >> 2); }));
+      checkStableSort(makeItems(5000, function (i) { return ((i * 2654435761) >>> 0) % 1000; }));
+    }
+  },
+  {
+    name: "Presorted input needs about one comparer call per element",
+    body: function () {
+      var count = 4000;
+      assert.isTrue(checkStableSort(makeItems(count, function (i) { return i; })) < 2 * count, "Ascending input");
+      assert.isTrue(checkStableSort(makeItems(count, function (i) { return count - i; })) < 2 * count, "Descending input");
+      assert.isTrue(checkStableSort(makeItems(count, function (i) { return i < count / 2 ? i : i - count / 2; })) < 3 * count, "Two ascending runs");
+    }
+  },
+  {
+    name: "A throwing comparer leaves every element in the array",
+    body: function () {
+      var arr = [];
+      for (var i = 0; i < 1000; i++) {
+        arr.push((i * 7919) % 1000);
+      }
+      var calls = 0;
+      assert.throws(function () {
+        arr.sort(function (a, b) {
+          if (++calls === 5000) {
+            throw new Error("stop");
+          }
+          return a - b;
+        });
+      }, Error);
+      var copy = arr.slice(0).sort(function (a, b) { return a - b; });
+      for (var i = 0; i < 1000; i++) {
+        assert.areEqual(i, copy[i], "Value " + i + " is still present");
+      }
+    }
+  }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
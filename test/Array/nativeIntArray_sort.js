@@ -0,0 +1,60 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// Sorting the strings gives the order the default comparer must produce for the numbers
+function checkDefaultSort(values) {
+    var expected = values.map(String).sort();
+    var actual = values.slice(0).sort();
+    assert.areEqual(expected.length, actual.length, "Length of sorted [" + values + "]");
+    assert.areEqual(expected.join(), actual.join(), "Sorting [" + values + "]");
+}
+
+var tests = [
+  {
+    name: "Default sort of int arrays uses string order",
+    body: function () {
+      checkDefaultSort([10, 9, 1, 100, 2, 20]);
+      checkDefaultSort([-1, -10, -2, 0, 1, -100, 5]);
+      checkDefaultSort([2147483647, -2147483648, 0, -1, 1, 214748364, 21474836]);
+      checkDefaultSort([3, 3, 30, 3, 300, 33, 303, 330]);
+      checkDefaultSort([1000000000, 999999999, 100000000, 10, 1]);
+
+      var big = [];
+      for (var i = 0; i < 1000; i++) {
+        big.push(((i * 7919) % 2001) - 1000);
+      }
+      checkDefaultSort(big);
+    }
+  },
+  {
+    name: "Arrays with holes and other values keep their behavior",
+    body: function () {
+      var holes = [5, , 1, , 30];
+      holes.sort();
+      assert.areEqual("1,30,5,,", holes.join(), "Holes sort to the end");
+      assert.areEqual(5, holes.length, "Length is unchanged");
+
+      var mixed = [10, 9, 1.5, 100];
+      mixed.sort();
+      assert.areEqual("1.5,10,100,9", mixed.join(), "Float values use string order");
+
+      var numeric = [10, 9, 1, 100];
+      numeric.sort(function (a, b) { return a - b; });
+      assert.areEqual("1,9,10,100", numeric.join(), "A comparer is still used");
+    }
+  },
+  {
+    name: "Sort returns the array it sorted",
+    body: function () {
+      var arr = [3, 1, 2];
+      assert.isTrue(arr.sort() === arr, "sort returns this");
+      assert.areEqual("1,2,3", arr.join(), "Sorted in place");
+    }
+  }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,54 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Comments long enough to be skipped in blocks, with the characters the scanner must stop at
+// placed at different offsets within a block.
+
+var results = [];
+
+function lineOf(e)
+{
+    var match = /:(\d+):\d+\)/.exec(e.stack);
+    return match ? match[1] : "unknown";
+}
+
+/* a block comment that is longer than sixteen characters and ends on its own line */
+results.push(1);
+
+/*****************************************************************************************/
+results.push(2);
+
+/* stars * inside ** a *** long **** comment ***** that / does not end early ******* here */ results.push(3);
+
+/* a block comment with non-ASCII text — café, naïve, 日本語 — in a block comment */
+results.push(4);
+
+/*
+ * a multi-line block comment
+ * spanning several lines so that line numbers have to be kept up to date
+ */
+results.push(5);
+
+try
+{
+    throw new Error();
+}
+catch (e)
+{
+    results.push("line " + lineOf(e));
+}
+
+/* a block comment that is longer than sixteen characters with a line separator inside */ results.push(11);
+
+// a line comment that is longer than sixteen characters and ends at the newline results.push(-1);
+results.push(6);
+
+// a line comment with non-ASCII text — café, naïve, 日本語 — and a paragraph separator results.push(10);
+results.push(7);
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+results.push(8); /* short */ results.push(9); // short
+
+print(results.join(","));
@@ -0,0 +1,95 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// A function's plain inline caches are allocated in runs, but each cache is freed on its own when the function's
+// caches are cleaned up (for example on redeferral). Allocate runs of several lengths, free them, and check that
+// functions allocating caches into the freed slots afterwards, and the redeferred functions themselves, still work.
+
+function makeObject(prefix, count, base) {
+    var o = {};
+    for (var i = 0; i < count; i++) {
+        o[prefix + i] = base + i;
+    }
+    return o;
+}
+
+// Builds a function with `count` distinct property loads and `count` distinct property stores, so it needs
+// more than one run of caches once count goes past the largest run.
+function makeAccessor(prefix, count) {
+    var body = "var sum = 0;\n";
+    for (var i = 0; i < count; i++) {
+        body += "sum += o." + prefix + i + ";\n";
+    }
+    for (var i = 0; i < count; i++) {
+        body += "o." + prefix + i + " = o." + prefix + i + " + 1;\n";
+    }
+    body += "return sum;\n";
+    return new Function("o", body);
+}
+
+function expectedSum(count, base) {
+    return count * base + count * (count - 1) / 2;
+}
+
+var failed = false;
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        failed = true;
+        WScript.Echo("FAIL: " + message + ": expected " + expected + ", got " + actual);
+    }
+}
+
+var counts = [1, 31, 32, 33, 64, 65, 100];
+
+function round(tag, base) {
+    var accessors = [];
+    for (var c = 0; c < counts.length; c++) {
+        var count = counts[c];
+        var prefix = tag + "_" + count + "_";
+        accessors.push({ fn: makeAccessor(prefix, count), prefix: prefix, count: count });
+    }
+    for (var iter = 0; iter < 3; iter++) {
+        for (var a = 0; a < accessors.length; a++) {
+            var entry = accessors[a];
+            var o = makeObject(entry.prefix, entry.count, base);
+            check(entry.fn(o), expectedSum(entry.count, base), tag + " count " + entry.count + " iteration " + iter);
+            check(entry.fn(o), expectedSum(entry.count, base + 1), tag + " count " + entry.count + " after stores");
+        }
+    }
+    return accessors;
+}
+
+// Allocate, then free: collecting lets the redeferral pass release the caches one by one.
+var first = round("a", 1);
+CollectGarbage();
+CollectGarbage();
+
+// Reuse: new functions take their caches from the freed slots, at different run boundaries.
+var second = round("b", 7);
+CollectGarbage();
+
+// The first set of functions allocates new runs after being redeferred.
+for (var a = 0; a < first.length; a++) {
+    var entry = first[a];
+    var o = makeObject(entry.prefix, entry.count, 3);
+    check(entry.fn(o), expectedSum(entry.count, 3), "reused a count " + entry.count);
+}
+CollectGarbage();
+round("c", 11);
+
+// Polymorphic caches share the arena with the plain caches: make some sites polymorphic between collections.
+var poly = makeAccessor("p", 40);
+for (var shape = 0; shape < 8; shape++) {
+    var o = makeObject("p", 40, shape);
+    o["extra" + shape] = shape;
+    check(poly(o), expectedSum(40, shape), "polymorphic shape " + shape);
+    if (shape % 3 == 0) {
+        CollectGarbage();
+    }
+}
+
+if (!failed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,72 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// A polymorphic inline cache whose slots are emptied by invalidation or by the GC must keep returning the right
+// values, and must still be able to take new entries into the freed slots once it had been full.
+
+function get(o) {
+    return o.x;
+}
+
+function sumOf(objects) {
+    var sum = 0;
+    for (var i = 0; i < objects.length; i++) {
+        sum += get(objects[i]);
+    }
+    return sum;
+}
+
+// Objects with distinct types that have x as an own property
+function makeLocal(count, tag) {
+    var objects = [];
+    for (var i = 0; i < count; i++) {
+        var o = {};
+        o["p" + tag + i] = i;
+        o.x = i;
+        objects.push(o);
+    }
+    return objects;
+}
+
+// Objects with distinct types that get x from their prototype
+function makeProto(count, tag) {
+    var objects = [];
+    for (var i = 0; i < count; i++) {
+        var proto = {};
+        proto["q" + tag + i] = i;
+        proto.x = i;
+        objects.push(Object.create(proto));
+    }
+    return objects;
+}
+
+// Fill up the cache
+var local = makeLocal(64, "a");
+var proto = makeProto(64, "b");
+for (var round = 0; round < 3; round++) {
+    WScript.Echo("fill " + round + ": " + sumOf(local) + " " + sumOf(proto));
+}
+
+// Invalidate the prototype entries by changing the value of x on the prototypes
+for (var i = 0; i < proto.length; i++) {
+    Object.getPrototypeOf(proto[i]).x = 2 * i;
+}
+WScript.Echo("invalidated: " + sumOf(proto) + " " + sumOf(local));
+
+// Let the cached types die, then use the site with new types
+local = null;
+proto = null;
+CollectGarbage();
+var fresh = makeLocal(16, "c");
+var freshProto = makeProto(16, "d");
+for (var round = 0; round < 3; round++) {
+    WScript.Echo("refill " + round + ": " + sumOf(fresh) + " " + sumOf(freshProto));
+}
+
+// Shadowing the prototype value must be picked up as well
+for (var i = 0; i < freshProto.length; i++) {
+    freshProto[i].x = -1;
+}
+WScript.Echo("shadowed: " + sumOf(freshProto));
@@ -0,0 +1,32 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// String scanning in JSON.parse skips the plain characters of a string in blocks; make sure the escapes,
+// control characters and terminators found around and inside those blocks are still handled.
+
+var plain = "abcdefghijklmnopqrstuvwxyz0123456789";
+
+function check(text, expected) {
+    var result = JSON.parse(text);
+    WScript.Echo(result === expected ? "PASS" : "FAIL: " + text + " => " + result);
+}
+
+for (var i = 0; i <= 20; i++) {
+    var prefix = plain.substring(0, i);
+    check('"' + prefix + '"', prefix);
+    check('"' + prefix + '\\n' + prefix + '"', prefix + "\n" + prefix);
+    check('"' + prefix + '\\"' + prefix + '"', prefix + '"' + prefix);
+    check('"' + prefix + '\\u00e9' + prefix + '"', prefix + "é" + prefix);
+    check('"' + prefix + 'é 中' + prefix + '"', prefix + "é 中" + prefix);
+}
+
+var obj = JSON.parse('{"' + plain + '":"' + plain + plain + '","k":["' + plain + '\\t",1]}');
+WScript.Echo(obj[plain] === plain + plain && obj.k[0] === plain + "\t" && obj.k[1] === 1 ? "PASS" : "FAIL: object");
+
+try { JSON.parse('"' + plain + '\u0001' + plain + '"'); } catch(e) { WScript.Echo(e); }
+try { JSON.parse('"' + plain + '\u001f"'); } catch(e) { WScript.Echo(e); }
+try { JSON.parse('"' + plain + plain); } catch(e) { WScript.Echo(e); }
+try { JSON.parse('"' + plain + '\\'); } catch(e) { WScript.Echo(e); }
+try { JSON.parse('"' + plain + '\\x"'); } catch(e) { WScript.Echo(e); }
@@ -0,0 +1,156 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JSON.stringify quotes a property name once and reuses it for every other object that has the same key.
+// Check the quoting of names that need escaping, and that objects whose shape changes between (and during)
+// calls still serialize the names they have now.
+
+var passed = true;
+
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        passed = false;
+        WScript.Echo("FAIL: " + message);
+        WScript.Echo("  expected: " + expected);
+        WScript.Echo("  actual:   " + actual);
+    }
+}
+
+// Reference quoting, written out from the spec's QuoteJSONString
+function quote(s) {
+    var result = '"';
+    for (var i = 0; i < s.length; i++) {
+        var c = s.charAt(i);
+        var code = s.charCodeAt(i);
+        switch (c) {
+            case '"': result += '\\"'; break;
+            case '\\': result += '\\\\'; break;
+            case '\b': result += '\\b'; break;
+            case '\f': result += '\\f'; break;
+            case '\n': result += '\\n'; break;
+            case '\r': result += '\\r'; break;
+            case '\t': result += '\\t'; break;
+            default:
+                if (code < 0x20) {
+                    result += '\\u' + ('000' + code.toString(16)).slice(-4);
+                } else {
+                    result += c;
+                }
+        }
+    }
+    return result + '"';
+}
+
+function reference(value) {
+    if (Array.isArray(value)) {
+        return '[' + value.map(reference).join(',') + ']';
+    }
+    if (typeof value === 'object' && value !== null) {
+        return '{' + Object.keys(value).map(function (k) { return quote(k) + ':' + reference(value[k]); }).join(',') + '}';
+    }
+    if (typeof value === 'string') {
+        return quote(value);
+    }
+    return String(value);
+}
+
+var keys = [
+    'plain',
+    'with"quote',
+    'with\\backslash',
+    'tab\there',
+    'newline\nhere',
+    'cr\rbs\bff\f',
+    'ctrl\u0001\u001f\u0000',
+    'café',
+    '中文',
+    'emoji😀',
+    '',
+    '"',
+];
+
+function makeObject(i) {
+    var o = {};
+    for (var k = 0; k < keys.length; k++) {
+        o[keys[k]] = i * 100 + k;
+    }
+    return o;
+}
+
+// Many objects of one shape, over several calls, so later objects and calls reuse the quoted names
+var list = [];
+for (var i = 0; i < 50; i++) {
+    list.push(makeObject(i));
+}
+for (var round = 0; round < 3; round++) {
+    check(JSON.stringify(list), reference(list), "repeated shape, round " + round);
+}
+
+// Each escaped name on its own, both as the first use of the name and after it has been quoted
+for (var k = 0; k < keys.length; k++) {
+    var o = {};
+    o[keys[k]] = keys[k];
+    check(JSON.stringify(o), reference(o), "single key " + JSON.stringify(keys[k]));
+    check(JSON.stringify([o, o]), reference([o, o]), "single key twice " + JSON.stringify(keys[k]));
+}
+
+// Names that come from computed strings rather than literals
+var computed = [];
+for (var i = 0; i < 20; i++) {
+    var o = {};
+    o['key' + (i % 4) + '"' + '\n'] = i;
+    o[String.fromCharCode(0x41 + i % 3) + 'é'] = i;
+    computed.push(o);
+}
+check(JSON.stringify(computed), reference(computed), "computed names");
+
+// The shape changes between calls
+var changing = [makeObject(0), makeObject(1), makeObject(2)];
+var before = JSON.stringify(changing);
+check(before, reference(changing), "before the shape changes");
+
+changing[1].added = 'new';
+changing[1]['added"too'] = 'new';
+check(JSON.stringify(changing), reference(changing), "after adding properties to one object");
+
+delete changing[2]['with"quote'];
+delete changing[2].plain;
+check(JSON.stringify(changing), reference(changing), "after deleting properties from another");
+
+Object.defineProperty(changing[0], 'tab\there', { enumerable: false });
+check(JSON.stringify(changing), reference(changing), "after making a property non-enumerable");
+
+changing[0]['tab\there'] = 'still hidden';
+changing.push({ 'newline\nhere': 1, plain: 2 });
+check(JSON.stringify(changing), reference(changing), "with the same names in a different order");
+
+// The shape changes during a call: a getter adds a property to objects that come later
+var mutating = [];
+for (var i = 0; i < 5; i++) {
+    mutating.push({ first: i, 'sec"ond': i });
+}
+Object.defineProperty(mutating[0], 'trigger', {
+    enumerable: true,
+    get: function () {
+        for (var j = 1; j < mutating.length; j++) {
+            mutating[j]['late\tcomer'] = j;
+        }
+        return 't';
+    }
+});
+var duringExpected = '[{"first":0,"sec\\"ond":0,"trigger":"t"}' +
+    ',{"first":1,"sec\\"ond":1,"late\\tcomer":1}' +
+    ',{"first":2,"sec\\"ond":2,"late\\tcomer":2}' +
+    ',{"first":3,"sec\\"ond":3,"late\\tcomer":3}' +
+    ',{"first":4,"sec\\"ond":4,"late\\tcomer":4}]';
+check(JSON.stringify(mutating), duringExpected, "a getter changes the shape of later objects");
+
+// The quoted names are the same with indentation and a replacer list
+var indented = JSON.stringify([{ 'a"b': 1, 'c\nd': 2 }, { 'a"b': 3, 'c\nd': 4 }], null, 1);
+check(indented, '[\n {\n  "a\\"b": 1,\n  "c\\nd": 2\n },\n {\n  "a\\"b": 3,\n  "c\\nd": 4\n }\n]', "indented");
+var replaced = JSON.stringify([{ 'a"b': 1, 'c\nd': 2 }, { 'a"b': 3, 'c\nd': 4 }], ['c\nd']);
+check(replaced, '[{"c\\nd":2},{"c\\nd":4}]', "replacer list");
+
+WScript.Echo(passed ? "pass" : "fail");
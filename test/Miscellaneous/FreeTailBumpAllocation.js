@@ -0,0 +1,89 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Leave swept blocks with live objects at the front and free objects at the end, so that the allocator
+// picks them up and bump allocates their free tail. New objects must come out zeroed, the tail must be
+// used up before moving on to other blocks, and nothing live may be handed out again.
+
+var kept = [];
+var passed = true;
+
+function Check(condition) {
+    if (!condition) {
+        passed = false;
+    }
+}
+
+function MakeObject(round, index) {
+    return { round: round, index: index, next: null, data: [index] };
+}
+
+// Each round ends with a run of dead objects after the last kept one, so the block the kept objects were
+// last allocated into has a free tail once it is swept.
+function AllocateRound(round, keepCount, dropCount) {
+    for (var i = 0; i < keepCount; i++) {
+        kept.push(MakeObject(round, kept.length));
+    }
+    for (var i = 0; i < dropCount; i++) {
+        MakeObject(round, -1);
+    }
+}
+
+function VerifyKept() {
+    for (var i = 0; i < kept.length; i++) {
+        var o = kept[i];
+        Check(o.index === i && o.next === null && o.data.length === 1 && o.data[0] === i);
+    }
+}
+
+// Allocate from the swept blocks. Enough objects are allocated that the free tails run out and
+// allocation has to continue in other blocks.
+function AllocateFromSweptBlocks(round, count) {
+    var fresh = [];
+    for (var i = 0; i < count; i++) {
+        var o = {};
+        Check(o.round === undefined && o.index === undefined && Object.keys(o).length === 0);
+        o.round = round;
+        o.index = i;
+        o.next = null;
+        o.data = [i];
+        fresh.push(o);
+    }
+    for (var i = 0; i < count; i++) {
+        var o = fresh[i];
+        Check(o.round === round && o.index === i && o.next === null && o.data[0] === i);
+    }
+    return fresh;
+}
+
+var retained = [];
+for (var round = 0; round < 10; round++) {
+    for (var run = 0; run < 50; run++) {
+        AllocateRound(round, 37, 23 + run);
+    }
+    CollectGarbage();
+    VerifyKept();
+
+    // The first allocations after the sweep take the free tails
+    retained.push(AllocateFromSweptBlocks(round, 5000));
+    VerifyKept();
+
+    // Blocks allocated from since the sweep no longer have accurate free bits. Free objects from the middle
+    // of them as well, so the next sweep leaves holes that are not at the end of the block.
+    if (round % 2 == 1) {
+        retained[round - 1] = retained[round - 1].filter(function (o, i) { return i % 3 != 1; });
+    }
+}
+
+CollectGarbage();
+VerifyKept();
+for (var i = 0; i < retained.length; i++) {
+    for (var j = 0; j < retained[i].length; j++) {
+        var o = retained[i][j];
+        Check(o.round === i && o.next === null && o.data[0] === o.index);
+    }
+}
+
+WScript.Echo(passed ? "pass" : "fail");
@@ -0,0 +1,41 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Keep every other object alive across collections so that the swept blocks still have live objects
+// and are left for allocation to sweep, then check that nothing live was reclaimed.
+
+var kept = [];
+var count = 20000;
+
+function Allocate(round) {
+    for (var i = 0; i < count; i++) {
+        var o = { round: round, index: i, next: null };
+        if (i % 2 == 0) {
+            kept.push(o);
+        }
+    }
+}
+
+function Verify() {
+    for (var i = 0; i < kept.length; i++) {
+        var o = kept[i];
+        if (o.index % 2 != 0 || o.next !== null) {
+            return false;
+        }
+    }
+    return true;
+}
+
+var passed = true;
+for (var round = 0; round < 5; round++) {
+    Allocate(round);
+    CollectGarbage();
+    passed = passed && Verify();
+
+    // Drop half of what we kept so the next collection frees objects in blocks that have been allocated from
+    kept = kept.filter(function (o, i) { return i % 2 == 0; });
+}
+
+WScript.Echo(passed ? "pass" : "fail");
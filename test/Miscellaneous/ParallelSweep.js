@@ -0,0 +1,72 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Churn garbage in many size classes while a live graph is kept reachable, so that background sweeps have
+// pending blocks in several buckets to hand out to the parallel sweep threads. Everything that is still
+// reachable must be intact afterwards.
+
+var live = [];
+var passed = true;
+
+function Check(condition) {
+    if (!condition) {
+        passed = false;
+    }
+}
+
+// Objects with different numbers of inline slots, arrays and strings land in different buckets
+function MakeValue(kind, id) {
+    switch (kind % 5) {
+        case 0: return { id: id };
+        case 1: return { id: id, a: id, b: id, c: id, d: id, e: id };
+        case 2: return { id: id, list: [id, id + 1, id + 2, id + 3, id + 4, id + 5, id + 6, id + 7] };
+        case 3: return { id: id, text: "value" + id };
+        case 4: return { id: id, child: { id: id, child: { id: id } } };
+    }
+}
+
+function VerifyValue(kind, id, value) {
+    if (value.id !== id) {
+        return false;
+    }
+    switch (kind % 5) {
+        case 0: return true;
+        case 1: return value.a === id && value.b === id && value.c === id && value.d === id && value.e === id;
+        case 2: return value.list.length === 8 && value.list[0] === id && value.list[7] === id + 7;
+        case 3: return value.text === "value" + id;
+        case 4: return value.child.id === id && value.child.child.id === id;
+    }
+}
+
+function Verify() {
+    for (var i = 0; i < live.length; i++) {
+        var entry = live[i];
+        Check(entry !== undefined && VerifyValue(entry.kind, entry.id, entry.value));
+    }
+}
+
+var nextId = 0;
+for (var round = 0; round < 20; round++) {
+    for (var i = 0; i < 1500; i++) {
+        var id = nextId++;
+        var value = MakeValue(i, id);
+
+        // Keep a scattered third of the objects, so most blocks end up with some objects to free
+        if (id % 3 == round % 3) {
+            live.push({ kind: i, id: id, value: value });
+        }
+    }
+
+    // Drop some of the older survivors as well, so blocks that were already swept have objects to free again
+    if (round % 4 == 3) {
+        live = live.filter(function (entry) { return entry.id % 2 == 0; });
+    }
+    Verify();
+}
+
+CollectGarbage();
+Verify();
+
+WScript.Echo(passed ? "pass" : "fail");
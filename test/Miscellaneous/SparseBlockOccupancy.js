@@ -0,0 +1,54 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Leave some swept blocks nearly empty and others nearly full, so that sweep reorders the allocable list
+// to put the sparse ones last. Allocation has to go on through both kinds without touching live objects.
+
+var dense = [];
+var sparse = [];
+var passed = true;
+
+function Check(condition) {
+    if (!condition) {
+        passed = false;
+    }
+}
+
+function Verify(list, tag) {
+    for (var i = 0; i < list.length; i++) {
+        var o = list[i];
+        Check(o.tag === tag && o.value === o.index * 2);
+    }
+}
+
+for (var round = 0; round < 5; round++) {
+    // Runs of objects that mostly survive, followed by runs where only one in ten does
+    for (var i = 0; i < 10000; i++) {
+        var o = { tag: "dense", index: i, value: i * 2 };
+        if (i % 10 != 0) {
+            dense.push(o);
+        }
+    }
+    for (var i = 0; i < 10000; i++) {
+        var o = { tag: "sparse", index: i, value: i * 2 };
+        if (i % 10 == 0) {
+            sparse.push(o);
+        }
+    }
+    CollectGarbage();
+
+    var fresh = [];
+    for (var i = 0; i < 5000; i++) {
+        fresh.push({ tag: "fresh", index: i, value: i * 2 });
+    }
+    Verify(fresh, "fresh");
+    Verify(dense, "dense");
+    Verify(sparse, "sparse");
+
+    // Let some of the sparse survivors go so their blocks can drain
+    sparse = sparse.filter(function (o, i) { return i % 2 == 0; });
+}
+
+WScript.Echo(passed ? "pass" : "fail");
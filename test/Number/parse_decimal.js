@@ -0,0 +1,67 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// String to number conversion rounds to the nearest double
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var f64 = new Float64Array(1);
+var u32 = new Uint32Array(f64.buffer);
+
+function checkBits(value, hi, lo, message) {
+    f64[0] = value;
+    assert.areEqual(hi, u32[1], message + " (high word)");
+    assert.areEqual(lo, u32[0], message + " (low word)");
+}
+
+var cases = [
+    ["0.1234567890123456", 0x3FBF9ADD, 0x3746F659],
+    ["1234567890123456789", 0x43B12210, 0xF47DE981],
+    ["9007199254740993", 0x43400000, 0x00000000],
+    ["9007199254740995", 0x43400000, 0x00000002],
+    ["1.7976931348623157e308", 0x7FEFFFFF, 0xFFFFFFFF],
+    ["2.2250738585072014e-308", 0x00100000, 0x00000000],
+    ["4.9406564584124654e-324", 0x00000000, 0x00000001],
+    ["123456789012345678e-50", 0x3919A416, 0xBC2FB919],
+    ["3.1415926535897932", 0x400921FB, 0x54442D18],
+    ["2.718281828459045235", 0x4005BF0A, 0x8B145769],
+    ["1e23", 0x44B52D02, 0xC7E14AF6],
+    ["8.5e-101", 0x2B27CC1B, 0x0F125135],
+    ["6.02214076e23", 0x44DFE185, 0xCA57C517],
+    ["1.602176634e-19", 0x3C07A4DA, 0x290C1653],
+    ["0.30000000000000004", 0x3FD33333, 0x33333334],
+    ["12345678901234567890123", 0x4484EA15, 0xB273B38A],
+    ["-0.000123456789012345678", 0xBF202E85, 0xBE180B74]
+];
+
+var tests = [
+    {
+        name: "Number, parseFloat and JSON.parse round to the nearest double",
+        body: function () {
+            cases.forEach(function (c) {
+                checkBits(Number(c[0]), c[1], c[2], "Number(\"" + c[0] + "\")");
+                checkBits(parseFloat(c[0]), c[1], c[2], "parseFloat(\"" + c[0] + "\")");
+                checkBits(JSON.parse(c[0]), c[1], c[2], "JSON.parse(\"" + c[0] + "\")");
+            });
+        }
+    },
+    {
+        name: "Printed doubles parse back to the same value",
+        body: function () {
+            var values = [];
+            for (var i = 1; i < 2000; i++) {
+                values.push(i / 7, i / 1000, 1 / i, i * 1.1e-50, i * 7.7e40);
+            }
+
+            var parsed = JSON.parse(JSON.stringify(values));
+            values.forEach(function (v, i) {
+                assert.areEqual(v, parsed[i], "JSON round-trip of " + v);
+                assert.areEqual(v, parseFloat(String(v)), "parseFloat round-trip of " + v);
+            });
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,63 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Number to string conversion produces the shortest digits that round-trip
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var tests = [
+    {
+        name: "Known shortest representations",
+        body: function () {
+            var cases = [
+                [0.1, "0.1"],
+                [0.3, "0.3"],
+                [0.1 + 0.2, "0.30000000000000004"],
+                [2 / 3, "0.6666666666666666"],
+                [100, "100"],
+                [123.456, "123.456"],
+                [1e21, "1e+21"],
+                [123456789012345680000, "123456789012345680000"],
+                [1e-7, "1e-7"],
+                [0.000001, "0.000001"],
+                [5e-324, "5e-324"],
+                [Number.MIN_VALUE, "5e-324"],
+                [Number.MAX_VALUE, "1.7976931348623157e+308"],
+                [2.2250738585072014e-308, "2.2250738585072014e-308"],
+                [Number.EPSILON, "2.220446049250313e-16"],
+                [Math.pow(2, 53), "9007199254740992"],
+                [Math.pow(2, -20), "9.5367431640625e-7"],
+                [-1.5, "-1.5"],
+                // Values that need the exact big number fallback
+                [280.943371943372, "280.943371943372"],
+                [5697.80923076923, "5697.80923076923"],
+                [5.36578947368421, "5.36578947368421"],
+                [4645.460957178841, "4645.460957178841"]
+            ];
+
+            cases.forEach(function (c) {
+                assert.areEqual(c[1], String(c[0]), "String(" + c[1] + ")");
+                assert.areEqual(c[1], JSON.stringify(c[0]), "JSON.stringify(" + c[1] + ")");
+            });
+        }
+    },
+    {
+        name: "Conversions round-trip",
+        body: function () {
+            var values = [];
+            for (var i = 1; i < 2000; i++) {
+                values.push(i / 7, i / 1000, i * 1.1, 1 / i, Math.pow(2, i % 1100 - 1074) * (1 + i / 4096), i * 1e300 / 3);
+            }
+
+            values.forEach(function (v) {
+                var s = String(v);
+                assert.areEqual(v, Number(s), "Number(String(v)) === v for " + s);
+                assert.areEqual("-" + s, String(-v), "Negative value keeps the same digits for " + s);
+            });
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,56 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Small object literals that don't escape the function are allocated on the stack.
+// Make sure they are still observed correctly when they escape on a cold path or
+// when we bail out while they are live.
+
+var g;
+
+function sumPoints(n)
+{
+    var sum = 0;
+    for (var i = 0; i < n; i++)
+    {
+        var p = { x: i, y: i * 2 };     // does not escape
+        sum += p.x + p.y;
+    }
+    return sum;
+}
+
+function escapeLast(n)
+{
+    var sum = 0;
+    for (var i = 0; i < n; i++)
+    {
+        var p = { x: i, y: i + 1 };
+        if (i === n - 1)
+        {
+            g = p;                      // escapes on the last iteration only
+        }
+        sum += p.y - p.x;
+    }
+    return sum;
+}
+
+function bailOutWhileLive(a, b)
+{
+    var p = { x: a, y: b };
+    var q = p.x + p.y;                  // bails out once a and b are strings
+    return q + ":" + p.x + "," + p.y;
+}
+
+for (var i = 0; i < 100; i++)
+{
+    sumPoints(10);
+    escapeLast(10);
+    bailOutWhileLive(i, 1);
+}
+
+WScript.Echo(sumPoints(10));
+WScript.Echo(escapeLast(10));
+WScript.Echo(g.x + "," + g.y);
+WScript.Echo(bailOutWhileLive(1, 2));
+WScript.Echo(bailOutWhileLive("a", "b"));
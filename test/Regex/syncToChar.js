@@ -0,0 +1,104 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// Index of the first character at or after start that is in chars and followed by a digit
+function naiveSearch(str, chars, start) {
+    for (var i = start; i + 1 < str.length; i++) {
+        if (chars.indexOf(str[i]) !== -1 && str[i + 1] >= "0" && str[i + 1] <= "9") {
+            return i;
+        }
+    }
+    return -1;
+}
+
+function makeInput(length, fill, insertions) {
+    var str = "";
+    for (var i = 0; i < length; i++) {
+        str += fill[i % fill.length];
+    }
+    for (var pos in insertions) {
+        str = str.substr(0, +pos) + insertions[pos] + str.substr(+pos + insertions[pos].length);
+    }
+    return str;
+}
+
+function checkGlobal(re, chars, str) {
+    var expected = [];
+    for (var i = naiveSearch(str, chars, 0); i !== -1; i = naiveSearch(str, chars, i + 2)) {
+        expected.push(i);
+    }
+    var actual = [];
+    var m;
+    re.lastIndex = 0;
+    while ((m = re.exec(str)) !== null) {
+        actual.push(m.index);
+    }
+    assert.areEqual(expected.join(), actual.join(), re + " over \"" + str + "\"");
+}
+
+var tests = [
+  {
+    name: "Sync to a single leading character",
+    body: function () {
+      for (var length = 0; length < 40; length++) {
+        for (var pos = 0; pos + 2 <= length; pos += 3) {
+          var insertions = {};
+          insertions[pos] = "x1";
+          checkGlobal(/x\d/g, "x", makeInput(length, "abcdefg", insertions));
+        }
+      }
+      checkGlobal(/x\d/g, "x", makeInput(100, "xyz", { 50: "x2", 98: "x3" }));
+      checkGlobal(/\u0101\d/g, "\u0101", makeInput(64, "\u0100\u0102\uffff", { 17: "\u01011", 40: "\u01012" }));
+    }
+  },
+  {
+    name: "Sync to one of two leading characters",
+    body: function () {
+      for (var length = 0; length < 40; length++) {
+        for (var pos = 0; pos + 4 <= length; pos += 5) {
+          var insertions = {};
+          insertions[pos] = "p1q2";
+          checkGlobal(/[pq]\d/g, "pq", makeInput(length, "abcdefghijk", insertions));
+        }
+      }
+      checkGlobal(/[pq]\d/g, "pq", makeInput(100, "pqr", { 33: "q9", 90: "p0" }));
+    }
+  },
+  {
+    name: "Scan for short literals",
+    body: function () {
+      var literals = ["ab", "aab", "abcab", "xyzzy", "abababababababab", "abababababababac", "\u0101\uffff"];
+      for (var length = 0; length < 48; length++) {
+        var str = makeInput(length, "ababcabx", { 13: "xyzzy", 30: "\u0101\uffff" });
+        for (var lit of literals) {
+          var re = new RegExp(lit, "g");
+          var expected = [];
+          for (var i = str.indexOf(lit); i !== -1; i = str.indexOf(lit, i + lit.length)) {
+            expected.push(i);
+          }
+          var actual = [];
+          var m;
+          while ((m = re.exec(str)) !== null) {
+            actual.push(m.index);
+          }
+          assert.areEqual(expected.join(), actual.join(), re + " over \"" + str + "\"");
+        }
+      }
+    }
+  },
+  {
+    name: "Matching that runs to the end of the input",
+    body: function () {
+      var str = makeInput(33, "abcdefgh", {});
+      assert.areEqual(null, /x\d/.exec(str), "No match");
+      assert.areEqual(31, /x\d/.exec(str.substr(0, 31) + "x5").index, "Match in the last two characters");
+      assert.areEqual(32, /x/.exec(str.substr(0, 32) + "x").index, "Match in the final character");
+    }
+  }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
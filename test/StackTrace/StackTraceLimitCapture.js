@@ -0,0 +1,145 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Checks the number of frames captured for several Error.stackTraceLimit values, and that the formatted stack
+// string cached on an error is reused or replaced correctly when the error is thrown again.
+
+var failed = false;
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        failed = true;
+        WScript.Echo("FAIL: " + message + ": expected " + expected + ", got " + actual);
+    }
+}
+
+function frameCount(stack) {
+    var count = 0;
+    var lines = stack.split("\n");
+    for (var i = 0; i < lines.length; i++) {
+        if (/^\s+at /.test(lines[i])) {
+            count++;
+        }
+    }
+    return count;
+}
+
+var depth = 40;
+function recurse(n) {
+    if (n == 0) {
+        throw new Error("deep");
+    }
+    return recurse(n - 1);
+}
+
+function captureDeep() {
+    try {
+        recurse(depth);
+    } catch (e) {
+        return e;
+    }
+}
+
+var defaultLimit = Error.stackTraceLimit;
+check(defaultLimit, 10, "default Error.stackTraceLimit");
+
+Error.stackTraceLimit = Infinity;
+var allFrames = frameCount(captureDeep().stack);
+check(allFrames > depth, true, "frames captured with an unlimited limit");
+
+var limits = [0, 1, defaultLimit, defaultLimit + 1, 1e9, 4294967301, Number.MAX_SAFE_INTEGER];
+for (var i = 0; i < limits.length; i++) {
+    Error.stackTraceLimit = limits[i];
+    var e = captureDeep();
+    var stack = e.stack;
+    check(stack.indexOf("Error: deep"), 0, "message with limit " + limits[i]);
+    check(frameCount(stack), Math.min(limits[i], allFrames), "frames with limit " + limits[i]);
+    // The formatted string is cached, reading it again must give the same string
+    check(e.stack, stack, "second read with limit " + limits[i]);
+}
+Error.stackTraceLimit = defaultLimit;
+
+// Throwing the same Error object again from the same place recaptures an identical trace.
+function throwAgain(e) {
+    throw e;
+}
+function throwFromElsewhere(e) {
+    throw e;
+}
+
+var error = new Error("rethrown");
+var firstStack;
+for (var i = 0; i < 3; i++) {
+    try {
+        throwAgain(error);
+    } catch (e) {
+        check(e, error, "caught object");
+        if (i == 0) {
+            firstStack = e.stack;
+        } else {
+            check(e.stack, firstStack, "stack after rethrow " + i);
+        }
+    }
+}
+check(firstStack.indexOf("throwAgain") > 0, true, "rethrow site in stack");
+
+// Throwing it from a different function replaces the cached string instead of returning the stale one.
+try {
+    throwFromElsewhere(error);
+} catch (e) {
+    check(e.stack.indexOf("throwFromElsewhere") > 0, true, "new throw site in stack");
+    check(e.stack.indexOf("throwAgain"), -1, "old throw site not in stack");
+}
+
+// An error that is thrown and caught without reading the stack gets its trace formatted on first read.
+var unread;
+try {
+    throwAgain(new Error("unread"));
+} catch (e) {
+    unread = e;
+}
+try {
+    throw unread;
+} catch (e) {
+}
+check(unread.stack.indexOf("Error: unread"), 0, "stack read after an unread rethrow");
+check(unread.stack, unread.stack, "repeated read of an unread rethrow");
+
+// Objects inheriting from Error keep the trace from their first throw: a rethrow leaves .stack unchanged.
+var derived = Object.create(Error.prototype);
+derived.message = "derived";
+var derivedStack;
+try {
+    throwAgain(derived);
+} catch (e) {
+    derivedStack = e.stack;
+}
+try {
+    throwFromElsewhere(derived);
+} catch (e) {
+    check(e.stack, derivedStack, "stack of a rethrown Error derived object");
+}
+
+// An Error whose stack was assigned keeps the assigned value when thrown again.
+var assigned = new Error("assigned");
+assigned.stack = "custom stack";
+try {
+    throwAgain(assigned);
+} catch (e) {
+    check(e.stack, "custom stack", "assigned stack after rethrow");
+}
+
+// With a limit of 0 the rethrow stores no frames, and the message is still formatted.
+Error.stackTraceLimit = 0;
+try {
+    throwAgain(error);
+} catch (e) {
+    check(frameCount(e.stack), 0, "frames after rethrow with limit 0");
+    check(e.stack.indexOf("Error: rethrown"), 0, "message after rethrow with limit 0");
+}
+Error.stackTraceLimit = defaultLimit;
+
+if (!failed) {
+    WScript.Echo("pass");
+}
@@ -0,0 +1,68 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// Reference implementation to check indexOf against
+function naiveIndexOf(str, search, position) {
+    for (var i = position; i + search.length <= str.length; i++) {
+        if (str.substr(i, search.length) === search) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+function checkAll(str, patterns) {
+    for (var p of patterns) {
+        for (var position = 0; position <= str.length; position++) {
+            assert.areEqual(naiveIndexOf(str, p, position), str.indexOf(p, position),
+                "Searching \"" + str + "\" for \"" + p + "\" from " + position);
+            assert.areEqual(naiveIndexOf(str, p, position) !== -1, str.includes(p, position),
+                "includes on \"" + str + "\" for \"" + p + "\" from " + position);
+        }
+    }
+}
+
+var tests = [
+  {
+    name: "Single character search across block boundaries",
+    body: function () {
+      var str = "";
+      for (var i = 0; i < 40; i++) {
+        str += String.fromCharCode(0x61 + (i % 7));
+      }
+      checkAll(str, ["a", "c", "g", "z"]);
+      checkAll(str + "Ā", ["Ā", "ā"]);
+      checkAll("\uffffabc\uffff耀abcdefghijk耀", ["\uffff", "耀", "k"]);
+    }
+  },
+  {
+    name: "Short patterns that match at the first and last characters only",
+    body: function () {
+      var str = "abxbabxxabcbaxxxabcdcbaabcdcbaabcdeabcdfabcde";
+      checkAll(str, ["ab", "aa", "abc", "abca", "abcde", "abcdf", "axb", "bab", "eabc", "xxxab", "abcdeabcdfabcde", "abcdeabcdfabcdef"]);
+    }
+  },
+  {
+    name: "Patterns around the length that switches to the jump table",
+    body: function () {
+      var str = "";
+      for (var i = 0; i < 80; i++) {
+        str += String.fromCharCode(0x61 + (i * 5) % 11);
+      }
+      checkAll(str, [str.substr(3, 15), str.substr(7, 16), str.substr(11, 17), str.substr(60, 16) + "q", str.substr(64)]);
+    }
+  },
+  {
+    name: "Non-ASCII patterns",
+    body: function () {
+      var str = "ĀđĒēabĀđĒēabcĀđĒē耀老";
+      checkAll(str, ["Āđ", "ēa", "Ēē耀", "耀老", "cĀđĒē耀"]);
+    }
+  }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
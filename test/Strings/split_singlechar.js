@@ -0,0 +1,69 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// Reference implementation to check split against
+function naiveSplit(str, sep, limit) {
+    var result = [];
+    if (limit === 0) {
+        return result;
+    }
+    var start = 0;
+    for (var i = 0; i < str.length; i++) {
+        if (str[i] === sep) {
+            result.push(str.substring(start, i));
+            if (result.length === limit) {
+                return result;
+            }
+            start = i + 1;
+        }
+    }
+    result.push(str.substring(start));
+    return result;
+}
+
+function checkAll(str, sep) {
+    var limits = [undefined, 0, 1, 2, 3, 5, 100];
+    for (var limit of limits) {
+        var expected = naiveSplit(str, sep, limit === undefined ? Infinity : limit);
+        var actual = str.split(sep, limit);
+        assert.areEqual(expected.length, actual.length, "Length of \"" + str + "\".split(\"" + sep + "\", " + limit + ")");
+        for (var i = 0; i < expected.length; i++) {
+            assert.areEqual(expected[i], actual[i], "Piece " + i + " of \"" + str + "\".split(\"" + sep + "\", " + limit + ")");
+        }
+    }
+}
+
+var tests = [
+  {
+    name: "Single character separators",
+    body: function () {
+      checkAll("", ",");
+      checkAll(",", ",");
+      checkAll(",,", ",");
+      checkAll("a,b,c", ",");
+      checkAll(",a,,b,", ",");
+      checkAll("no separator here", ",");
+      checkAll("key=value;key2=value2;;", ";");
+      checkAll("2016-01-01 12:00:00 INFO\tstarted\tok", "\t");
+      checkAll("Āđ,Ēē,耀老", ",");
+      checkAll("aĀbĀĀc", "Ā");
+    }
+  },
+  {
+    name: "Splitting a concatenated string",
+    body: function () {
+      var str = "";
+      for (var i = 0; i < 20; i++) {
+        str += i + ",";
+      }
+      checkAll(str, ",");
+      assert.areEqual(21, str.split(",").length, "Trailing separator produces an empty last piece");
+    }
+  }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,33 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// toUpperCase/toLowerCase on ASCII strings take a fast path that cases up to 8 characters at a time and
+// falls back to the platform casing at the first non-ASCII character. Cover lengths around the block size,
+// the characters just outside of the letter ranges, and non-ASCII characters at and around block boundaries.
+
+function show(s)
+{
+    return s.replace(/[^\x20-\x7e]/g, function (c) { return "\\u" + ("0000" + c.charCodeAt(0).toString(16)).slice(-4); });
+}
+
+function test(s)
+{
+    WScript.Echo(s.length + ": " + show(s.toUpperCase()) + " | " + show(s.toLowerCase()));
+}
+
+var pattern = "aBcDeFgHiJkLmNoPqRsTuVwXyZ@[`{0123456789";
+[0, 1, 7, 8, 9, 15, 16, 17, 31, 33, 40].forEach(function (length)
+{
+    test(pattern.substring(0, length));
+});
+
+var ascii = "abcdefghIJKLMNOPqrstuvwx";
+[0, 7, 8, 9, 16, 23].forEach(function (position)
+{
+    test(ascii.substring(0, position) + "\u00e9" + ascii.substring(position + 1));
+    test(ascii.substring(0, position) + "\u00c9" + ascii.substring(position + 1));
+});
+
+test("The quick brown fox \u03b1\u03b2\u03b3 jumps over the lazy dog \u0391\u0392\u0393");
@@ -0,0 +1,73 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Take a snapshot at each callback while the heap is large, then small, then large again, so that the snapshot
+// mark table is kept at its grown size, shrunk back to its initial size, and grown again between walks.
+
+var live = null;
+
+function Build(count)
+{
+    var list = [];
+    for (var i = 0; i < count; i++) {
+        list.push({ id: i, data: [i] });
+    }
+    return list;
+}
+
+function Check(list, count)
+{
+    if (list.length !== count) {
+        return false;
+    }
+    for (var i = 0; i < list.length; i++) {
+        if (list[i].id !== i || list[i].data[0] !== i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+var largeAgain = false;
+var small = false;
+var largeFirst = false;
+
+live = Build(100000);
+
+function growAgain()
+{
+    live = Build(100000);
+    largeAgain = Check(live, 100000);
+    WScript.SetTimeout(testFunction, 50);
+}
+
+function stayedSmall()
+{
+    small = Check(live, 100);
+    WScript.SetTimeout(growAgain, 50);
+}
+
+function shrink()
+{
+    live = Build(100);
+    WScript.SetTimeout(stayedSmall, 50);
+}
+
+function stayedLarge()
+{
+    largeFirst = Check(live, 100000);
+    WScript.SetTimeout(shrink, 50);
+}
+
+WScript.SetTimeout(stayedLarge, 50);
+
+/////////////////
+
+function testFunction()
+{
+    telemetryLog(`large heap: ${largeFirst}`, true);
+    telemetryLog(`small heap: ${small}`, true);
+    telemetryLog(`large heap again: ${largeAgain}`, true);
+}
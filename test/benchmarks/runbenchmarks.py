@@ -0,0 +1,357 @@
+#!/usr/bin/env python
+#-------------------------------------------------------------------------------------------------------
+# Copyright (C) Microsoft. All rights reserved.
+# Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+#-------------------------------------------------------------------------------------------------------
+
+from __future__ import print_function
+from threading import Timer
+import sys
+import os
+import glob
+import json
+import math
+import re
+import subprocess as SP
+import argparse
+
+# handle command line args
+parser = argparse.ArgumentParser(
+    description='ChakraCore cross-platform benchmark runner',
+    formatter_class=argparse.RawDescriptionHelpFormatter,
+    epilog='''\
+Each benchmark is run in a fresh ch process. The first --warmup runs of a
+benchmark are discarded and the next --iterations are kept. A comparison
+against a baseline reports the difference of the means with its confidence
+interval, and a benchmark only counts as changed when the whole interval is
+past --threshold.
+
+Samples:
+
+record a baseline of all suites:
+    runbenchmarks.py -b <base>/ch --save-baseline base.json
+
+compare a build against it, pinned to cpu 2:
+    runbenchmarks.py -b <new>/ch --baseline base.json --cpu 2
+
+run a single suite:
+    runbenchmarks.py octane -n 10
+
+The microbench suite runs the [MicroBenchmark] cases of NativeTests instead
+of ch. Each run of nativetests gives one sample of every microbenchmark, and
+it is only run when asked for:
+    runbenchmarks.py microbench --nativetests <base>/nativetests.exe --save-baseline micro.json
+    runbenchmarks.py microbench --nativetests <new>/nativetests.exe --baseline micro.json
+''')
+
+DEFAULT_TIMEOUT = 300
+SUITES = {
+    # suite: (folder, default iterations)
+    'octane': ('Octane', 10),
+    'kraken': ('Kraken', 10),
+    'sunspider': ('SunSpider', 35),
+    'jetstream': ('jetstream', 5),
+}
+# Not part of the default run, it needs a NativeTests build
+MICROBENCH_SUITE = 'microbench'
+MICROBENCH_ITERATIONS = 5
+
+parser.add_argument('suites', metavar='suite', nargs='*',
+                    help='suites to run: ' + ', '.join(sorted(SUITES)) + ' (default all), or ' + MICROBENCH_SUITE)
+parser.add_argument('-b', '--binary', metavar='bin', help='ch full path')
+parser.add_argument('--nativetests', metavar='bin', help='nativetests full path, for ' + MICROBENCH_SUITE)
+parser.add_argument('-d', '--debug', action='store_true',
+                    help='use debug build')
+parser.add_argument('-t', '--test', action='store_true', help='use test build')
+parser.add_argument('-n', '--iterations', type=int,
+                    help='measured runs of each benchmark (default per suite)')
+parser.add_argument('-w', '--warmup', type=int, default=1,
+                    help='discarded runs of each benchmark before measuring (default 1)')
+parser.add_argument('--filter', metavar='regex',
+                    help='only run benchmarks whose name matches')
+parser.add_argument('--interpreted', action='store_true',
+                    help='run with -NoNative')
+parser.add_argument('--args', metavar='args', default='',
+                    help='other arguments to ch')
+parser.add_argument('--cpu', metavar='cpus',
+                    help='comma separated cpus to pin ch to (Linux only)')
+parser.add_argument('--baseline', metavar='file',
+                    help='baseline to compare against')
+parser.add_argument('--save-baseline', metavar='file',
+                    help='write the samples of this run as a baseline')
+parser.add_argument('--confidence', type=int, default=95, choices=[90, 95, 99],
+                    help='confidence level of the intervals, in percent (default 95)')
+parser.add_argument('--threshold', type=float, default=1.0,
+                    help='smallest change to report, in percent (default 1)')
+parser.add_argument('--timeout', type=int, default=DEFAULT_TIMEOUT,
+                    help='timeout of each run (default ' + str(DEFAULT_TIMEOUT) + ' seconds)')
+args = parser.parse_args()
+
+
+benchmarks_root = os.path.dirname(os.path.realpath(__file__))
+repo_root = os.path.dirname(os.path.dirname(benchmarks_root))
+
+suites = args.suites or sorted(SUITES)
+for suite in suites:
+    if suite not in SUITES and suite != MICROBENCH_SUITE:
+        print('ERROR: unknown suite {}'.format(suite))
+        sys.exit(1)
+
+flavor = 'Debug' if args.debug else ('Test' if args.test else 'Release')
+
+# binary: full ch path
+binary = args.binary
+if binary == None:
+    if sys.platform == 'win32':
+        binary = 'Build/VcBuild/bin/x64_{}/ch.exe'.format(flavor)
+    else:
+        binary = 'BuildLinux/{0}/ch'.format(flavor)
+    binary = os.path.join(repo_root, binary)
+if any(suite in SUITES for suite in suites) and not os.path.isfile(binary):
+    print('{} not found. Did you run ./build.sh already?'.format(binary))
+    sys.exit(1)
+
+# nativetests: full nativetests path, only needed for the microbenchmarks
+nativetests = args.nativetests
+if nativetests == None:
+    nativetests = os.path.join(repo_root, 'Build/VcBuild/bin/x64_{}/nativetests.exe'.format(flavor))
+if MICROBENCH_SUITE in suites and not os.path.isfile(nativetests):
+    print('{} not found. NativeTests is only built by the Visual Studio solution.'.format(nativetests))
+    sys.exit(1)
+
+cpus = None
+if args.cpu:
+    if not sys.platform.startswith('linux'):
+        print('ERROR: --cpu is only supported on Linux')
+        sys.exit(1)
+    cpus = set(int(x) for x in args.cpu.split(','))
+
+ch_flags = ['-highprecisiondate'] + (['-NoNative'] if args.interpreted else []) + args.args.split()
+
+# Two-sided critical values of Student's t distribution, by degrees of freedom
+T_TABLE = {
+    90: [6.314, 2.920, 2.353, 2.132, 2.015, 1.943, 1.895, 1.860, 1.833, 1.812,
+         1.796, 1.782, 1.771, 1.761, 1.753, 1.746, 1.740, 1.734, 1.729, 1.725,
+         1.721, 1.717, 1.714, 1.711, 1.708, 1.706, 1.703, 1.701, 1.699, 1.697],
+    95: [12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+         2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+         2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042],
+    99: [63.657, 9.925, 5.841, 4.604, 4.032, 3.707, 3.499, 3.355, 3.250, 3.169,
+         3.106, 3.055, 3.012, 2.977, 2.947, 2.921, 2.898, 2.878, 2.861, 2.845,
+         2.831, 2.819, 2.807, 2.797, 2.787, 2.779, 2.771, 2.763, 2.756, 2.750],
+}
+Z_TABLE = {90: 1.645, 95: 1.960, 99: 2.576}
+
+def t_critical(df):
+    if df < 1:
+        return float('inf')
+    df = int(math.floor(df))
+    table = T_TABLE[int(args.confidence)]
+    return table[df - 1] if df <= len(table) else Z_TABLE[int(args.confidence)]
+
+def mean(samples):
+    return sum(samples) / len(samples)
+
+def variance(samples):
+    if len(samples) < 2:
+        return 0.0
+    m = mean(samples)
+    return sum((x - m) ** 2 for x in samples) / (len(samples) - 1)
+
+def interval(samples):
+    # half width of the confidence interval of the mean
+    if len(samples) < 2:
+        return float('inf')
+    return t_critical(len(samples) - 1) * math.sqrt(variance(samples) / len(samples))
+
+# Welch's interval for the difference of two means, which does not assume equal variances
+def difference_interval(base, test):
+    vb = variance(base) / len(base)
+    vt = variance(test) / len(test)
+    if len(base) < 2 or len(test) < 2:
+        return float('inf')
+    if vb + vt == 0:
+        return 0.0
+    df = (vb + vt) ** 2 / ((vb ** 2) / (len(base) - 1) + (vt ** 2) / (len(test) - 1))
+    return t_critical(df) * math.sqrt(vb + vt)
+
+RESULT_PATTERNS = [
+    ('time', re.compile(r'###\sTIME:\s*([0-9]+(?:\.[0-9]+)?)\s*ms')),
+    ('score', re.compile(r'###\sSCORE:\s*([0-9]+(?:\.[0-9]+)?)')),
+    ('latency', re.compile(r'###\sLATENCY:\s*([0-9]+(?:\.[0-9]+)?)')),
+]
+
+MICROBENCH_PATTERN = re.compile(r'###\sMICROBENCHMARK\s+(\S+):\s*([0-9]+(?:\.[0-9]+)?)\s*ns/op')
+
+def pin_to_cpus():
+    os.sched_setaffinity(0, cpus)
+
+# Runs a command, and returns its output
+def run_process(cmd, cwd, name):
+    preexec_fn = None
+    if cpus is not None:
+        if hasattr(os, 'sched_setaffinity'):
+            preexec_fn = pin_to_cpus
+        else:
+            cmd = ['taskset', '-c', args.cpu] + cmd
+
+    proc = SP.Popen(cmd, stdout=SP.PIPE, stderr=SP.STDOUT,
+                    cwd=cwd, preexec_fn=preexec_fn)
+    timeout_data = [proc, False]
+    def timeout_func(timeout_data):
+        timeout_data[0].kill()
+        timeout_data[1] = True
+    timer = Timer(args.timeout, timeout_func, [timeout_data])
+    try:
+        timer.start()
+        output = proc.communicate()[0].decode('utf-8', 'replace')
+        exit_code = proc.wait()
+    finally:
+        timer.cancel()
+
+    if timeout_data[1]:
+        raise RuntimeError('{} timed out'.format(name))
+    if exit_code != 0:
+        raise RuntimeError('{} exited with {}:\n{}'.format(name, exit_code, output))
+    return output
+
+def run_benchmark(js_file):
+    cmd = [binary] + ch_flags + [os.path.basename(js_file)]
+    output = run_process(cmd, os.path.dirname(js_file), js_file)
+
+    results = {}
+    for metric, pattern in RESULT_PATTERNS:
+        match = pattern.search(output)
+        if match:
+            results[metric] = float(match.group(1))
+    if 'time' not in results and 'score' not in results:
+        raise RuntimeError('{} produced invalid output:\n{}'.format(js_file, output))
+    return results
+
+# Runs all the microbenchmarks once, and returns {name: nanoseconds per operation}
+def run_microbenchmarks():
+    output = run_process([nativetests, '[MicroBenchmark]'], os.path.dirname(nativetests), nativetests)
+    results = dict((match.group(1), float(match.group(2))) for match in MICROBENCH_PATTERN.finditer(output))
+    if not results:
+        raise RuntimeError('{} produced no microbenchmark results:\n{}'.format(nativetests, output))
+    return results
+
+def run_microbench_suite():
+    iterations = args.iterations or MICROBENCH_ITERATIONS
+    print('Running {} ({} warmup, {} measured runs)'.format(MICROBENCH_SUITE, args.warmup, iterations))
+    for i in range(args.warmup):
+        run_microbenchmarks()
+    data = {}
+    for i in range(iterations):
+        for name, value in run_microbenchmarks().items():
+            if args.filter and not re.search(args.filter, name):
+                continue
+            data.setdefault(name, {'metric': 'time', 'samples': []})['samples'].append(value)
+    for name in sorted(data):
+        samples = data[name]['samples']
+        print('  {:<36} {:>10.1f} +-{:.1f}% ns/op'.format(name, mean(samples),
+            100 * interval(samples) / mean(samples) if mean(samples) else 0))
+    return data
+
+# Runs a suite, and returns {benchmark: {'metric': 'time' or 'score', 'samples': [...]}}. Latency
+# scores are kept as a separate benchmark, as perftest.pl does.
+def run_suite(suite):
+    if suite == MICROBENCH_SUITE:
+        return run_microbench_suite()
+
+    folder, default_iterations = SUITES[suite]
+    iterations = args.iterations or default_iterations
+    js_files = sorted(glob.glob(os.path.join(benchmarks_root, folder, '*.js')))
+    if args.filter:
+        js_files = [f for f in js_files if re.search(args.filter, os.path.basename(f))]
+
+    print('Running {} ({} warmup, {} measured runs)'.format(suite, args.warmup, iterations))
+    data = {}
+    for js_file in js_files:
+        name = os.path.splitext(os.path.basename(js_file))[0]
+        for i in range(args.warmup):
+            run_benchmark(js_file)
+        for i in range(iterations):
+            results = run_benchmark(js_file)
+            metric = 'time' if 'time' in results else 'score'
+            data.setdefault(name, {'metric': metric, 'samples': []})['samples'].append(results[metric])
+            if 'latency' in results:
+                data.setdefault(name + ' (latency)', {'metric': 'score', 'samples': []})['samples'].append(results['latency'])
+        entry = data[name]
+        print('  {:<36} {:>10.1f} +-{:.1f}% {}'.format(name, mean(entry['samples']),
+            100 * interval(entry['samples']) / mean(entry['samples']) if mean(entry['samples']) else 0,
+            'ms' if entry['metric'] == 'time' else ''))
+    return data
+
+# Compares a suite against its baseline, and returns the number of regressions
+def compare_suite(suite, base_data, test_data):
+    print()
+    print('{:<36} {:>16} {:>16} {:>20}'.format(suite.upper(), 'BASE', 'TEST', 'CHANGE'))
+    print('-' * 92)
+    regressions = 0
+    for name in sorted(test_data):
+        test = test_data[name]
+        base = base_data.get(name)
+        if base is None or base['metric'] != test['metric']:
+            print('{:<36} {:>16} {:>16.1f}'.format(name, 'n/a', mean(test['samples'])))
+            continue
+
+        base_mean = mean(base['samples'])
+        test_mean = mean(test['samples'])
+        if base_mean == 0:
+            continue
+        change = 100 * (test_mean - base_mean) / base_mean
+        half_width = 100 * difference_interval(base['samples'], test['samples']) / base_mean
+
+        # time is better lower and score higher, so a regression is a change past the threshold in that direction
+        worse = change if test['metric'] == 'time' else -change
+        verdict = ''
+        if worse - half_width > args.threshold:
+            verdict = 'REGRESSION'
+            regressions += 1
+        elif worse + half_width < -args.threshold:
+            verdict = 'improvement'
+        print('{:<36} {:>16.1f} {:>16.1f} {:>+10.1f}% +-{:>4.1f}% {}'.format(
+            name, base_mean, test_mean, change, half_width, verdict))
+    return regressions
+
+def main():
+    baseline = None
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+
+    if any(suite in SUITES for suite in suites):
+        print('Binary: {}'.format(binary))
+    if MICROBENCH_SUITE in suites:
+        print('NativeTests: {}'.format(nativetests))
+    if cpus is not None:
+        print('Pinned to cpus: {}'.format(args.cpu))
+
+    results = {}
+    try:
+        for suite in suites:
+            results[suite] = run_suite(suite)
+    except RuntimeError as e:
+        print('ERROR: {}'.format(e))
+        return 1
+
+    if args.save_baseline:
+        with open(args.save_baseline, 'w') as f:
+            json.dump({'binary': binary, 'nativetests': nativetests, 'flags': ch_flags, 'suites': results}, f, indent=1, sort_keys=True)
+        print('Baseline written to {}'.format(args.save_baseline))
+
+    regressions = 0
+    if baseline is not None:
+        for suite in suites:
+            if suite not in baseline['suites']:
+                print('WARNING: {} is not in the baseline'.format(suite))
+                continue
+            regressions += compare_suite(suite, baseline['suites'][suite], results[suite])
+        print()
+        print('{} regression(s) at {}% confidence'.format(regressions, args.confidence))
+
+    return 1 if regressions else 0
+
+if __name__ == '__main__':
+    sys.exit(main())
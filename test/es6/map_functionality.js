@@ -819,6 +819,34 @@ var tests = [
             assert.areEqual("test", map.get(key), "1.0 should be equal to the key 1 and map to 'test'");
         }
     },
+
+    {
+        name: "String keys from property names and from string operations should compare and hash equal",
+        body: function() {
+            var obj = { alpha: 1, beta: 2, gamma: 3 };
+            var propertyNames = Object.keys(obj);
+            var map = new Map();
+
+            for (var name in obj) {
+                map.set(name, obj[name]);
+            }
+            assert.areEqual(3, map.size, "One entry per property name");
+
+            assert.areEqual(1, map.get("al" + "pha".toString()), "Concatenated string finds the entry keyed by a property name");
+            assert.areEqual(2, map.get(["b", "e", "t", "a"].join("")), "Joined string finds the entry keyed by a property name");
+            assert.areEqual(3, map.get(propertyNames[2]), "Property name from Object.keys finds the entry");
+            assert.isFalse(map.has("delta"), "Unrelated name is not found");
+
+            map.set("gam" + "ma", 30);
+            assert.areEqual(3, map.size, "Setting an equal computed string replaces the entry");
+            assert.areEqual(30, map.get(propertyNames[2]), "The replaced value is found through the property name");
+
+            var set = new Set(propertyNames);
+            assert.isTrue(set.has("be" + "ta"), "Set finds a property name through a computed string");
+            set.add("alp" + "ha");
+            assert.areEqual(3, set.size, "Adding an equal computed string does not add an entry");
+        }
+    },
 ];
 
 testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,231 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Map keeps its keys in an open addressing dictionary. The table starts with 16 entries, holds at most 7/8
+// of them before it resizes, and marks removed entries Deleted until a rehash drops them. These tests drive
+// insert, lookup and remove through each of those paths.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function verifyContents(map, keys, valueOf) {
+    assert.areEqual(keys.length, map.size, "size matches the number of live keys");
+    for (var i = 0; i < keys.length; i++) {
+        assert.isTrue(map.has(keys[i]), "live key " + String(keys[i]) + " is found");
+        assert.areEqual(valueOf(keys[i]), map.get(keys[i]), "live key " + String(keys[i]) + " maps to its value");
+    }
+}
+
+// Doubles whose two 32-bit halves XOR to the same value hash to the same code, and so land in the same group
+// and share all 7 control bits
+function makeCollidingDoubles(count) {
+    var f64 = new Float64Array(1);
+    var u32 = new Uint32Array(f64.buffer);
+    var doubles = [];
+    for (var i = 0; i < count; i++) {
+        var high = 0x40000000 + i;
+        u32[0] = 0x12345678 ^ high;
+        u32[1] = high;
+        doubles.push(f64[0]);
+    }
+    return doubles;
+}
+
+var tests = [
+    {
+        name: "Insert and look up keys one at a time across every load threshold up to 4096 entries",
+        body: function () {
+            var map = new Map();
+            var keys = [];
+            for (var i = 0; i < 4096; i++) {
+                assert.isFalse(map.has(i), "key " + i + " is not found before it is inserted");
+                map.set(i, i * 3);
+                keys.push(i);
+
+                // Check everything right before and after each threshold (14, 28, 56, ...) is crossed
+                var capacity = 16;
+                while (capacity - capacity / 8 < keys.length) {
+                    capacity *= 2;
+                }
+                var threshold = capacity - capacity / 8;
+                if (keys.length == threshold || keys.length == threshold / 2 + 1) {
+                    verifyContents(map, keys, function (k) { return k * 3; });
+                }
+            }
+            verifyContents(map, keys, function (k) { return k * 3; });
+            assert.isFalse(map.has(4096), "a key that was never inserted is not found");
+            assert.isFalse(map.has("0"), "a key of a different type is not found");
+        }
+    },
+    {
+        name: "Overwriting an existing key does not add an entry",
+        body: function () {
+            var map = new Map();
+            for (var i = 0; i < 100; i++) {
+                map.set(i, i);
+            }
+            for (var i = 0; i < 100; i++) {
+                map.set(i, -i);
+            }
+            verifyContents(map, Array.from(map.keys()), function (k) { return -k; });
+            assert.areEqual(100, map.size, "overwrites keep the size");
+        }
+    },
+    {
+        name: "Removed keys are not found, and lookups probe past their tombstones",
+        body: function () {
+            var map = new Map();
+            var keys = [];
+            for (var i = 0; i < 1000; i++) {
+                map.set("key" + i, i);
+            }
+            for (var i = 0; i < 1000; i++) {
+                if (i % 3 == 0) {
+                    assert.isTrue(map.delete("key" + i), "deleting a live key succeeds");
+                    assert.isFalse(map.delete("key" + i), "deleting it again fails");
+                } else {
+                    keys.push("key" + i);
+                }
+            }
+            verifyContents(map, keys, function (k) { return +k.substring(3); });
+            for (var i = 0; i < 1000; i += 3) {
+                assert.isFalse(map.has("key" + i), "removed key " + i + " is not found");
+                assert.areEqual(undefined, map.get("key" + i), "removed key " + i + " has no value");
+            }
+
+            // Reinserting reuses the deleted entries
+            for (var i = 0; i < 1000; i += 3) {
+                map.set("key" + i, i);
+            }
+            assert.areEqual(1000, map.size, "every key is back");
+            for (var i = 0; i < 1000; i++) {
+                assert.areEqual(i, map.get("key" + i), "key " + i + " maps to its value after reinsertion");
+            }
+        }
+    },
+    {
+        name: "Churning through tombstones at a fixed size rehashes in place without losing keys",
+        body: function () {
+            // Stay well under half of the 7/8 threshold, so that the deleted entries are what fills the table
+            var map = new Map();
+            var live = [];
+            for (var i = 0; i < 5; i++) {
+                map.set(i, i);
+                live.push(i);
+            }
+            for (var next = 5; next < 5000; next++) {
+                var removed = live.shift();
+                assert.isTrue(map.delete(removed), "deleting the oldest key succeeds");
+                map.set(next, next);
+                live.push(next);
+                assert.areEqual(5, map.size, "the size stays the same");
+                assert.isFalse(map.has(removed), "the removed key stays removed");
+            }
+            verifyContents(map, live, function (k) { return k; });
+        }
+    },
+    {
+        name: "Growing while tombstones are present keeps only the live keys",
+        body: function () {
+            var map = new Map();
+            var live = [];
+            for (var i = 0; i < 3000; i++) {
+                map.set(i, i);
+                if (i % 2 == 1) {
+                    map.delete(i - 1);
+                    live.push(i);
+                }
+            }
+            verifyContents(map, live, function (k) { return k; });
+            for (var i = 0; i < 3000; i += 2) {
+                assert.isFalse(map.has(i), "removed key " + i + " is not found after growing");
+            }
+        }
+    },
+    {
+        name: "Keys with the same hash code are all kept apart, including after removals and growth",
+        body: function () {
+            var doubles = makeCollidingDoubles(200);
+            var map = new Map();
+            for (var i = 0; i < doubles.length; i++) {
+                map.set(doubles[i], i);
+            }
+            assert.areEqual(doubles.length, map.size, "colliding keys are all distinct");
+            for (var i = 0; i < doubles.length; i++) {
+                assert.areEqual(i, map.get(doubles[i]), "colliding key " + i + " maps to its own value");
+            }
+
+            // Remove every other one, so that the probe for a later key has to skip deleted entries in the
+            // groups it shares with them
+            for (var i = 0; i < doubles.length; i += 2) {
+                assert.isTrue(map.delete(doubles[i]), "deleting colliding key " + i + " succeeds");
+            }
+            for (var i = 0; i < doubles.length; i++) {
+                assert.areEqual(i % 2 == 0 ? undefined : i, map.get(doubles[i]), "colliding key " + i + " after removals");
+            }
+
+            // Fill in with unrelated keys so the table grows while the colliding ones are in it
+            for (var i = 0; i < 2000; i++) {
+                map.set({ id: i }, i);
+            }
+            for (var i = 1; i < doubles.length; i += 2) {
+                assert.areEqual(i, map.get(doubles[i]), "colliding key " + i + " after growth");
+            }
+        }
+    },
+    {
+        name: "Keys that are the same value zero share an entry",
+        body: function () {
+            var map = new Map();
+            map.set(0, "zero");
+            map.set(-0, "negative zero");
+            assert.areEqual(1, map.size, "-0 and +0 are the same key");
+            assert.areEqual("negative zero", map.get(0), "+0 finds the entry set through -0");
+
+            map.set(NaN, "nan");
+            map.set(0 / 0, "other nan");
+            assert.areEqual(2, map.size, "every NaN is the same key");
+            assert.areEqual("other nan", map.get(NaN), "NaN finds its entry");
+
+            map.set(5, "int");
+            map.set(10 / 2, "double");
+            map.set(Math.pow(2, 31), "large");
+            assert.areEqual(4, map.size, "an integer and the same double are the same key");
+            assert.areEqual("double", map.get(5), "the integer finds the entry set through the double");
+            assert.areEqual("large", map.get(2147483648), "a double outside the int range is found");
+
+            var s = "ab";
+            map.set(s, "literal");
+            map.set(["a", "b"].join(""), "joined");
+            assert.areEqual(5, map.size, "strings with the same characters are the same key");
+            assert.areEqual("joined", map.get("a" + "b"), "a string finds the entry set through an equal string");
+
+            assert.isTrue(map.delete(-0), "deleting through -0 removes the +0 entry");
+            assert.isFalse(map.has(0), "+0 is gone");
+            assert.areEqual(4, map.size, "one entry was removed");
+        }
+    },
+    {
+        name: "Clear empties the table and it can be filled again",
+        body: function () {
+            var map = new Map();
+            for (var i = 0; i < 500; i++) {
+                map.set(i, i);
+            }
+            map.delete(7);
+            map.clear();
+            assert.areEqual(0, map.size, "clear removes everything");
+            assert.isFalse(map.has(1), "cleared keys are not found");
+
+            var keys = [];
+            for (var i = 0; i < 500; i++) {
+                map.set(i + 0.5, i);
+                keys.push(i + 0.5);
+            }
+            verifyContents(map, keys, function (k) { return k - 0.5; });
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,109 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var tests = [
+    {
+        name: "Trap replaced on a shared handler is picked up by every proxy",
+        body() {
+            var handler = { get(t, p) { return "a:" + p; } };
+            var proxies = [];
+            for (var i = 0; i < 10; i++) {
+                proxies.push(new Proxy({}, handler));
+            }
+            for (var i = 0; i < 10; i++) {
+                assert.areEqual("a:x", proxies[i].x, "original get trap");
+            }
+            handler.get = function (t, p) { return "b:" + p; };
+            for (var i = 0; i < 10; i++) {
+                assert.areEqual("b:x", proxies[i].x, "replaced get trap");
+            }
+        }
+    },
+    {
+        name: "Deleting and re-adding a trap",
+        body() {
+            var target = { x: 1 };
+            var handler = { has() { return false; } };
+            var p = new Proxy(target, handler);
+            for (var i = 0; i < 5; i++) {
+                assert.isFalse("x" in p, "has trap");
+            }
+            delete handler.has;
+            for (var i = 0; i < 5; i++) {
+                assert.isTrue("x" in p, "no has trap forwards to the target");
+            }
+            handler.has = function () { return false; };
+            assert.isFalse("x" in p, "re-added has trap");
+        }
+    },
+    {
+        name: "Trap inherited from the handler's prototype",
+        body() {
+            var base = {};
+            var handler = Object.create(base);
+            var p = new Proxy({ x: 1 }, handler);
+            for (var i = 0; i < 5; i++) {
+                assert.areEqual(1, p.x, "no get trap yet");
+            }
+            base.get = function () { return 2; };
+            for (var i = 0; i < 5; i++) {
+                assert.areEqual(2, p.x, "get trap added to the prototype");
+            }
+            handler.get = function () { return 3; };
+            assert.areEqual(3, p.x, "own get trap shadows the prototype");
+        }
+    },
+    {
+        name: "Accessor traps are invoked on every lookup",
+        body() {
+            var count = 0;
+            var handler = {
+                get set() {
+                    count++;
+                    return function (t, p, v) { t[p] = v * 2; return true; };
+                }
+            };
+            var target = {};
+            var p = new Proxy(target, handler);
+            for (var i = 0; i < 5; i++) {
+                p.x = i;
+            }
+            assert.areEqual(5, count, "set trap getter is called for each store");
+            assert.areEqual(8, target.x, "set trap result");
+        }
+    },
+    {
+        name: "Handlers of different shapes",
+        body() {
+            var handlers = [
+                { get() { return 0; } },
+                { a: 1, get() { return 1; } },
+                { b: 1, c: 2, get() { return 2; } },
+                { has() { return true; } },
+            ];
+            for (var n = 0; n < 3; n++) {
+                for (var i = 0; i < handlers.length; i++) {
+                    var p = new Proxy({ x: "t" }, handlers[i]);
+                    assert.areEqual(i < 3 ? i : "t", p.x, "get trap of handler " + i);
+                    assert.isTrue("y" in p === (i === 3), "has trap of handler " + i);
+                }
+            }
+        }
+    },
+    {
+        name: "Non-callable trap still throws",
+        body() {
+            var handler = { get() { return 1; } };
+            var p = new Proxy({}, handler);
+            assert.areEqual(1, p.x);
+            handler.get = 42;
+            assert.throws(function () { return p.x; }, TypeError);
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -412,6 +412,56 @@ var tests = [
       assert.throws(function () { eval("foo(typeof ...[1,2,3]);"); }, SyntaxError, "Spread with keyword unary operator throws a syntax error",  "Unexpected ... operator");
       assert.throws(function () { eval("foo(!!...[1,2,3]);"); },      SyntaxError, "Spread with chained unary operators throws a syntax error", "Unexpected ... operator");
     }
+  },
+  {
+    name: "Spread and apply of dense int, float and var arrays",
+    body: function () {
+      function collect() { return Array.prototype.slice.call(arguments); }
+
+      var ints = [];
+      var floats = [];
+      var vars = [];
+      for (var i = 0; i < 50; i++) {
+        ints.push(i - 25);
+        floats.push(i + 0.5);
+        vars.push(i % 2 ? "s" + i : { v: i });
+      }
+
+      assert.areEqual(24, Math.max(...ints), "Spread of a native int array");
+      assert.areEqual(-25, Math.min.apply(null, ints), "Apply with a native int array");
+      assert.areEqual(49.5, Math.max(...floats), "Spread of a native float array");
+      assert.areEqual(0.5, Math.min.apply(null, floats), "Apply with a native float array");
+
+      var spreadVars = collect(1, ...vars, 2);
+      assert.areEqual(52, spreadVars.length, "Spread of a var array keeps surrounding arguments");
+      assert.areEqual(1, spreadVars[0], "Argument before the spread");
+      assert.areEqual(0, spreadVars[1].v, "First spread element");
+      assert.areEqual("s49", spreadVars[50], "Last spread element");
+      assert.areEqual(2, spreadVars[51], "Argument after the spread");
+
+      var appliedVars = collect.apply(null, vars);
+      assert.areEqual(50, appliedVars.length, "Apply with a var array");
+      assert.areEqual("s1", appliedVars[1], "Apply copies var array elements");
+    }
+  },
+  {
+    name: "Spread and apply of arrays with holes read through the prototype",
+    body: function () {
+      function collect() { return Array.prototype.slice.call(arguments); }
+
+      var holey = [1, , 3];
+      var holeyFloat = [1.5, , 3.5];
+      Array.prototype[1] = "proto";
+      try {
+        assert.areEqual([1, "proto", 3], collect(...holey), "Spread of an int array with a hole reads the prototype");
+        assert.areEqual([1, "proto", 3], collect.apply(null, holey), "Apply with an int array with a hole reads the prototype");
+        assert.areEqual([1.5, "proto", 3.5], collect.apply(null, holeyFloat), "Apply with a float array with a hole reads the prototype");
+      } finally {
+        delete Array.prototype[1];
+      }
+
+      assert.areEqual([1, undefined, 3], collect.apply(null, holey), "Apply with a hole and no prototype element passes undefined");
+    }
   }
 ];
 
@@ -0,0 +1,85 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Async/await tests -- awaiting native promises with and without the built-in then/catch
+
+function echo(str) {
+    WScript.Echo(str);
+}
+
+async function awaitValues() {
+    var sum = 0;
+    for (var i = 0; i < 100; i++) {
+        sum += await Promise.resolve(i);
+        sum += await i;
+    }
+    return sum;
+}
+
+async function awaitRejection() {
+    var caught = 0;
+    for (var i = 0; i < 10; i++) {
+        try {
+            await Promise.reject(i);
+        } catch (e) {
+            caught += e;
+        }
+    }
+    return caught;
+}
+
+async function awaitPending() {
+    var resolveLater;
+    var p = new Promise(function (resolve) { resolveLater = resolve; });
+    Promise.resolve().then(function () { resolveLater("pending resolved"); });
+    return await p;
+}
+
+async function awaitPendingRejection() {
+    var rejectLater;
+    var p = new Promise(function (resolve, reject) { rejectLater = reject; });
+    Promise.resolve().then(function () { rejectLater("pending rejected"); });
+    try {
+        await p;
+    } catch (e) {
+        return e;
+    }
+    return "no exception";
+}
+
+awaitValues().then(function (result) {
+    echo("awaitValues: " + result);
+    return awaitRejection();
+}).then(function (result) {
+    echo("awaitRejection: " + result);
+    return awaitPending();
+}).then(function (result) {
+    echo("awaitPending: " + result);
+    return awaitPendingRejection();
+}).then(function (result) {
+    echo("awaitPendingRejection: " + result);
+
+    // Awaiting still works when then has been replaced
+    var originalThen = Promise.prototype.then;
+    var thenCalls = 0;
+    Promise.prototype.then = function (onFulfilled, onRejected) {
+        thenCalls++;
+        return originalThen.call(this, onFulfilled, onRejected);
+    };
+
+    async function awaitPatched() {
+        return await Promise.resolve("patched");
+    }
+
+    var p = awaitPatched();
+    Promise.prototype.then = originalThen;
+    return p.then(function (result) {
+        echo("awaitPatched: " + result);
+    });
+}).then(function () {
+    echo("done");
+}, function (e) {
+    echo("unexpected failure: " + e);
+});
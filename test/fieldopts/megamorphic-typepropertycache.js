@@ -0,0 +1,94 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Megamorphic loads and stores across many shapes and many property names, so that several properties
+// share a set in each type's property cache, including properties that live on a prototype.
+
+var shapeCount = 40;
+var propertyCount = 24;
+var names = [];
+for (var i = 0; i < propertyCount; i++) {
+    names.push("p" + i);
+}
+
+var proto = { inherited: 100 };
+var objects = [];
+for (var s = 0; s < shapeCount; s++) {
+    var o = Object.create(proto);
+    o["shape" + s] = s;
+    for (var i = 0; i < propertyCount; i++) {
+        o[names[i]] = s * 1000 + i;
+    }
+    objects.push(o);
+}
+
+function load(o, name) {
+    return o[name];
+}
+
+function sumAll() {
+    var sum = 0;
+    for (var s = 0; s < objects.length; s++) {
+        var o = objects[s];
+        for (var i = 0; i < names.length; i++) {
+            sum += load(o, names[i]);
+        }
+        sum += o.inherited;
+    }
+    return sum;
+}
+
+function store(o, i, value) {
+    o[names[i]] = value;
+}
+
+var failed = false;
+function check(actual, expected, message) {
+    if (actual !== expected) {
+        WScript.Echo("FAILED: " + message + ": expected " + expected + ", got " + actual);
+        failed = true;
+    }
+}
+
+var expected = 0;
+for (var s = 0; s < shapeCount; s++) {
+    for (var i = 0; i < propertyCount; i++) {
+        expected += s * 1000 + i;
+    }
+    expected += 100;
+}
+
+for (var iteration = 0; iteration < 20; iteration++) {
+    check(sumAll(), expected, "sum on iteration " + iteration);
+}
+
+// Changing the prototype property must invalidate the cached prototype lookups
+proto.inherited = 1;
+expected -= 99 * shapeCount;
+check(sumAll(), expected, "sum after changing the prototype");
+
+// Shadowing it on one object must be seen as well
+objects[7].inherited = 2;
+expected += 1;
+check(sumAll(), expected, "sum after shadowing the prototype property");
+
+// Stores through the megamorphic site
+for (var iteration = 0; iteration < 5; iteration++) {
+    for (var s = 0; s < shapeCount; s++) {
+        for (var i = 0; i < propertyCount; i++) {
+            store(objects[s], i, 1);
+        }
+    }
+}
+check(sumAll(), shapeCount * propertyCount + 1 * (shapeCount - 1) + 2, "sum after storing");
+
+// Deleting a property must not leave a stale cached slot behind
+delete objects[3].p5;
+check(load(objects[3], "p5"), undefined, "deleted property");
+check(load(objects[4], "p5"), 1, "property on another shape");
+
+if (!failed) {
+    WScript.Echo("pass");
+}
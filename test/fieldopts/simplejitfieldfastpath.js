@@ -0,0 +1,22 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// SimpleJit emits the inline cache fast path for field loads and stores. Profiled loads also profile the cache hit.
+
+function load(o) {
+    return o.x;
+}
+
+function store(o, v) {
+    o.y = v;
+}
+
+var obj = { x: 1, y: 2 };
+for (var i = 0; i < 100; i++) {
+    load(obj);
+    store(obj, i);
+}
+
+WScript.Echo(load(obj), obj.y);
@@ -0,0 +1,25 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The call site in run() sees f0 most often and f3 least often, so the callees are
+// considered for inlining in that order and the coldest ones are left out first.
+function f0(x) { return x; }
+function f1(x) { return x; }
+function f2(x) { return x; }
+function f3(x) { return x; }
+
+var fns = [f0, f0, f0, f0, f1, f1, f1, f2, f2, f3];
+
+function run() {
+    var sum = 0;
+    for (var i = 0; i < 20; i++) {
+        sum += fns[i % 10](i);
+    }
+    return sum;
+}
+
+var total = run();
+total += run();
+WScript.Echo(total);
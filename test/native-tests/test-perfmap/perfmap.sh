@@ -0,0 +1,59 @@
+#-------------------------------------------------------------------------------------------------------
+# Copyright (C) Microsoft. All rights reserved.
+# Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+#-------------------------------------------------------------------------------------------------------
+
+# Runs sample.js with -PerfMap and checks that /tmp/perf-<pid>.map holds well formed
+# "<start> <size> <name>" lines, with hex start and size, and an entry for the sample function.
+
+CH=$1
+
+if [[ ! $(uname -s) =~ "Linux" ]]; then
+    echo "SUCCESS (perf map output is only written on Linux)"
+    exit 0
+fi
+
+$CH -PerfMap sample.js > /dev/null &
+PID=$!
+wait $PID
+if [[ $? != 0 ]]; then
+    echo "ch failed"
+    exit 1
+fi
+
+MAP="/tmp/perf-${PID}.map"
+if [[ ! -s $MAP ]]; then
+    echo "$MAP is missing or empty"
+    exit 1
+fi
+
+STATUS=0
+LINES=0
+while IFS= read -r LINE; do
+    LINES=$((LINES + 1))
+    if [[ ! $LINE =~ ^([0-9a-f]+)\ ([0-9a-f]+)\ (.+)$ ]]; then
+        echo "Malformed line $LINES: $LINE"
+        STATUS=1
+    else
+        START=${BASH_REMATCH[1]}
+        SIZE=${BASH_REMATCH[2]}
+        if [[ $START =~ ^0+$ || $SIZE =~ ^0+$ ]]; then
+            echo "Empty range on line $LINES: $LINE"
+            STATUS=1
+        fi
+    fi
+done < $MAP
+
+if ! grep -q "^[0-9a-f]* [0-9a-f]* JS:perfMapSample .*\[[A-Za-z]*\] .*sample.js:[0-9]*$" $MAP; then
+    echo "No entry for perfMapSample"
+    STATUS=1
+fi
+
+if [[ $STATUS != 0 ]]; then
+    cat $MAP
+else
+    echo "SUCCESS ($LINES entries)"
+fi
+
+rm -f $MAP
+exit $STATUS
@@ -0,0 +1,18 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+function perfMapSample(n) {
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        sum += i % 7;
+    }
+    return sum;
+}
+
+var total = 0;
+for (var i = 0; i < 2000; i++) {
+    total += perfMapSample(1000);
+}
+print(total);
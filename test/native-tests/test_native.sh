@@ -92,4 +92,12 @@ RUN "test-static-native"
 # test python
 RUN_CMD "test-python" "python helloWorld.py ${BUILD_TYPE}"
 
+# ch tests
+
+# test perf map
+TEST_PATH="test-perfmap"
+echo "Testing $TEST_PATH"
+RES=$(cd $TEST_PATH; bash perfmap.sh ${CH_DIR} 2>&1)
+TEST "SUCCESS"
+
 SAFE_RUN `rm -rf Makefile`
@@ -0,0 +1,120 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+var ctors = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array, Float32Array, Float64Array];
+
+function toArray(ta) {
+    return Array.prototype.slice.call(ta);
+}
+
+var tests = [
+    {
+        name: "fill stores the converted value over the whole range",
+        body: function () {
+            ctors.forEach(function (ctor) {
+                var ta = new ctor(37);
+                ta.fill(1.5, 3, 34);
+                var expected = new ctor(37);
+                for (var i = 3; i < 34; i++) {
+                    expected[i] = 1.5;
+                }
+                assert.areEqual(toArray(expected), toArray(ta), ctor.name + ".prototype.fill with a range");
+
+                ta.fill(-300);
+                expected = new ctor(1);
+                expected[0] = -300;
+                assert.isTrue(toArray(ta).every(function (v) { return Object.is(v, expected[0]); }), ctor.name + ".prototype.fill over the whole array");
+            });
+        }
+    },
+    {
+        name: "fill clamps and keeps -0 in float arrays",
+        body: function () {
+            assert.areEqual([0, 255, 255, 255, 0], toArray(new Uint8ClampedArray(5).fill(1000, 1, -1)), "Uint8ClampedArray clamps the fill value");
+            assert.isTrue(toArray(new Float64Array(9).fill(-0)).every(function (v) { return Object.is(v, -0); }), "Float64Array keeps -0");
+            assert.isTrue(toArray(new Float32Array(9).fill(NaN)).every(function (v) { return v !== v; }), "Float32Array stores NaN");
+        }
+    },
+    {
+        name: "fill with an object converts it through valueOf",
+        body: function () {
+            var calls = 0;
+            var value = { valueOf: function () { calls++; return 7; } };
+            var ta = new Int32Array(4).fill(value);
+            assert.areEqual([7, 7, 7, 7], toArray(ta), "object fill value");
+            assert.isTrue(calls > 0, "valueOf is called");
+        }
+    },
+    {
+        name: "Array.prototype.fill on a typed array with a fake length",
+        body: function () {
+            var ta = new Int16Array(4);
+            Object.defineProperty(ta, "length", { value: 100 });
+            Array.prototype.fill.call(ta, 9);
+            assert.areEqual([9, 9, 9, 9], toArray(new Int16Array(ta.buffer)), "only the real elements are written");
+        }
+    },
+    {
+        name: "copyWithin handles overlapping ranges in both directions",
+        body: function () {
+            ctors.forEach(function (ctor) {
+                var ta = new ctor([1, 2, 3, 4, 5, 6, 7, 8]);
+                ta.copyWithin(2, 0, 5);
+                assert.areEqual([1, 2, 1, 2, 3, 4, 5, 8], toArray(ta), ctor.name + " forward overlapping copy");
+
+                ta = new ctor([1, 2, 3, 4, 5, 6, 7, 8]);
+                ta.copyWithin(0, 3);
+                assert.areEqual([4, 5, 6, 7, 8, 6, 7, 8], toArray(ta), ctor.name + " backward overlapping copy");
+
+                ta = new ctor([1, 2, 3, 4, 5, 6, 7, 8]);
+                ta.copyWithin(-2, 0);
+                assert.areEqual([1, 2, 3, 4, 5, 6, 1, 2], toArray(ta), ctor.name + " copy truncated by the target");
+            });
+
+            var f = new Float64Array([-0, NaN, 1]);
+            f.copyWithin(1, 0);
+            assert.isTrue(Object.is(f[1], -0) && f[2] !== f[2], "copyWithin copies -0 and NaN bit for bit");
+        }
+    },
+    {
+        name: "copyWithin on a subarray stays within the view",
+        body: function () {
+            var whole = new Uint16Array([1, 2, 3, 4, 5, 6, 7, 8]);
+            whole.subarray(2, 6).copyWithin(0, 2);
+            assert.areEqual([1, 2, 5, 6, 5, 6, 7, 8], toArray(whole), "subarray copyWithin");
+        }
+    },
+    {
+        name: "indexOf and includes compare numbers against the raw elements",
+        body: function () {
+            ctors.forEach(function (ctor) {
+                var ta = new ctor([0, 1, 2, 3, 2, 1, 0]);
+                assert.areEqual(2, ta.indexOf(2), ctor.name + ".prototype.indexOf");
+                assert.areEqual(4, ta.indexOf(2, 3), ctor.name + ".prototype.indexOf with fromIndex");
+                assert.areEqual(6, ta.indexOf(-0, 1), ctor.name + ".prototype.indexOf(-0) matches 0");
+                assert.areEqual(-1, ta.indexOf(1.5), ctor.name + ".prototype.indexOf with a fraction");
+                assert.areEqual(-1, ta.indexOf("2"), ctor.name + ".prototype.indexOf with a string");
+                assert.areEqual(-1, ta.indexOf(256 + 2), ctor.name + ".prototype.indexOf out of range");
+                assert.isTrue(ta.includes(3), ctor.name + ".prototype.includes");
+                assert.isFalse(ta.includes(3, 4), ctor.name + ".prototype.includes with fromIndex");
+                assert.isFalse(ta.includes(undefined), ctor.name + ".prototype.includes(undefined)");
+                assert.isFalse(ta.includes(NaN), ctor.name + ".prototype.includes(NaN)");
+            });
+
+            var f = new Float32Array([1, NaN, 0.5]);
+            assert.areEqual(-1, f.indexOf(NaN), "indexOf never finds NaN");
+            assert.isTrue(f.includes(NaN), "includes finds NaN");
+            assert.areEqual(2, f.indexOf(0.5), "Float32Array finds exactly representable values");
+            assert.areEqual(-1, new Float32Array([0.1]).indexOf(0.1), "Float32Array does not round the search value");
+            assert.areEqual(1, new Uint32Array([1, 4294967295]).indexOf(4294967295), "Uint32Array finds values above int32");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,69 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// On Win64, ArrayBuffers whose length is a power of 2 of at least 64K, or a multiple of 16M, live in a 4GB
+// virtual reservation; all other lengths are heap allocated. Transfer between lengths on both sides of
+// those boundaries and check that the contents move and that any new bytes are zero.
+
+var lengths = [
+    0xF000,     // under 64K
+    0x10000,    // 64K
+    0x11000,    // 64K + 4K
+    0x20000,    // power of 2
+    0x30000,    // a multiple of 64K that is not a power of 2
+    0xFF0000,   // a multiple of 64K just under 16M
+    0x1000000,  // 16M
+    0x1010000,  // 16M + 64K
+    0x3000000,  // a multiple of 16M that is not a power of 2
+];
+
+var passed = true;
+
+function Check(condition, message) {
+    if (!condition) {
+        passed = false;
+        print("FAILED: " + message);
+    }
+}
+
+function Fill(buffer) {
+    var view = new Uint8Array(buffer);
+    for (var i = 0; i < view.length; i += 0x1000) {
+        view[i] = (i >> 12) & 0xFF;
+        view[i + 0xFFF] = 0xA5;
+    }
+}
+
+function Verify(buffer, oldLength, name) {
+    var view = new Uint8Array(buffer);
+    var kept = Math.min(oldLength, view.length);
+    for (var i = 0; i < kept; i += 0x1000) {
+        Check(view[i] === ((i >> 12) & 0xFF) && view[i + 0xFFF] === 0xA5, name + ": byte at " + i + " was kept");
+    }
+    for (var i = kept; i < view.length; i += 0x1000) {
+        Check(view[i] === 0 && view[i + 0xFFF] === 0, name + ": byte at " + i + " is zero");
+    }
+}
+
+for (var i = 0; i < lengths.length; i++) {
+    for (var j = 0; j < lengths.length; j++) {
+        var name = "0x" + lengths[i].toString(16) + " to 0x" + lengths[j].toString(16);
+        var from = new ArrayBuffer(lengths[i]);
+        Verify(from, 0, name + " (new buffer)");
+        Fill(from);
+
+        var to = ArrayBuffer.transfer(from, lengths[j]);
+        Check(from.byteLength === 0, name + ": the source is detached");
+        Check(to.byteLength === lengths[j], name + ": the new length");
+        Verify(to, lengths[i], name);
+
+        // A typed array over the whole buffer reaches the last byte
+        var view = new Uint8Array(to);
+        view[view.length - 1] = 0x5A;
+        Check(new Uint8Array(to)[lengths[j] - 1] === 0x5A, name + ": the last byte is writable");
+    }
+}
+
+print(passed ? "pass" : "fail");
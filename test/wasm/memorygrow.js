@@ -0,0 +1,79 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Grow WebAssembly.Memory a page at a time, through page counts that are and are not powers of 2, and check
+// that every grow detaches the old buffer, keeps the contents, and adds zeroed pages.
+
+const pageSize = 0x10000;
+let passed = true;
+
+function check(condition, message) {
+  if (!condition) {
+    passed = false;
+    print(`FAILED: ${message}`);
+  }
+}
+
+// Never 0, so that a marked page can be told apart from a new one
+function pageMark(page) {
+  return page % 255 + 1;
+}
+
+function markPage(buffer, page) {
+  const view = new Uint8Array(buffer);
+  view[page * pageSize] = pageMark(page);
+  view[page * pageSize + pageSize - 1] = pageMark(page);
+}
+
+function verifyPages(buffer, markedPages, pageCount, name) {
+  check(buffer.byteLength === pageCount * pageSize, `${name}: byteLength is ${pageCount} pages`);
+  const view = new Uint8Array(buffer);
+  for (let page = 0; page < pageCount; page++) {
+    const expected = page < markedPages ? pageMark(page) : 0;
+    check(view[page * pageSize] === expected && view[page * pageSize + pageSize - 1] === expected,
+      `${name}: page ${page} holds ${expected}`);
+  }
+}
+
+function test(initial, maximum, deltas) {
+  const memory = new WebAssembly.Memory({initial, maximum});
+  let pageCount = initial;
+  verifyPages(memory.buffer, 0, pageCount, `initial ${initial}`);
+  for (let page = 0; page < pageCount; page++) {
+    markPage(memory.buffer, page);
+  }
+
+  for (const delta of deltas) {
+    const name = `initial ${initial}, growing ${pageCount} by ${delta}`;
+    const oldBuffer = memory.buffer;
+    check(memory.grow(delta) === pageCount, `${name}: grow returns the old page count`);
+    if (delta !== 0) {
+      check(oldBuffer.byteLength === 0, `${name}: the old buffer is detached`);
+    }
+    verifyPages(memory.buffer, pageCount, pageCount + delta, name);
+    for (let page = pageCount; page < pageCount + delta; page++) {
+      markPage(memory.buffer, page);
+    }
+    pageCount += delta;
+  }
+
+  // Growing past the maximum fails and leaves the memory alone
+  const buffer = memory.buffer;
+  try {
+    memory.grow(maximum - pageCount + 1);
+    check(false, `initial ${initial}: growing past the maximum throws`);
+  } catch (e) {
+    check(e instanceof RangeError, `initial ${initial}: growing past the maximum throws a RangeError`);
+  }
+  check(memory.buffer === buffer, `initial ${initial}: a failed grow keeps the buffer`);
+  verifyPages(memory.buffer, pageCount, pageCount, `initial ${initial} after a failed grow`);
+}
+
+test(0, 8, [1, 1, 1, 1, 0, 2, 1]);
+test(1, 10, [1, 1, 1, 2, 3]);
+test(3, 20, [1, 4, 8]);
+test(255, 300, [1, 1, 15, 1]);
+
+print(passed ? "pass" : "fail");